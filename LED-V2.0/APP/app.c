@@ -13,17 +13,13 @@
 #include "app.h"
 #include "led_interface.h"
 #include "btn_interface.h"
-
-/*
- * Private Typedefs */
-typedef enum{
-    ALL_OFF = 0 ,
-    RED_ON      ,
-    GREEN_ON    ,
-    BLUE_ON     ,
-    ALL_ON      ,
-    STATES_TOTAL
-}en_app_state_t;
+#include "systick_interface.h"
+#include "timer_interface.h"
+#include "cpu_interface.h"
+#include "latency_interface.h"
+#include "trace_interface.h"
+#include "console_interface.h"
+#include "uart_interface.h"
 
 /*
  * Private MACROS/Defines */
@@ -36,21 +32,352 @@ typedef enum{
 #define BLUE_LED_PORT 	LED_PORT_F // Port F
 #define BLUE_LED_PIN		LED_PIN_2
 
+#define RGB_LED_PORT		LED_PORT_F // port shared by the RGB LEDs
+
+#define RED_LED			(1 << RED_LED_PIN)
+#define GREEN_LED		(1 << GREEN_LED_PIN)
+#define BLUE_LED		(1 << BLUE_LED_PIN)
+#define RGB_LED_MASK		(RED_LED | GREEN_LED | BLUE_LED)
+
 #define USER_BTN_PORT		BTN_PORT_F // Port F
 #define USER_BTN_PIN		BTN_PIN_4
 
+#define COLOR_ON_MS		1000 // each color is on for 1 second only
+#define APP_TIMEOUT_TIMER	TIMER_0 // one-shot, times the state on-time
+#define APP_TIME_BASE_MS	50 // systick period, the loop's only periodic wake
+
+#define CONSOLE_BAUD_RATE	115200
+
+/*
+ * Private Typedefs */
+typedef enum{
+    ALL_OFF = 0 ,
+    RED_ON      ,
+    RED_DONE    ,   // red on-time over, waiting for the next press
+    GREEN_ON    ,
+    GREEN_DONE  ,
+    BLUE_ON     ,
+    BLUE_DONE   ,
+    ALL_ON      ,
+    ALL_DONE    ,
+    STATES_TOTAL
+}en_app_state_t;
+
+/* State machine inputs, index of the next state in st_app_state_t */
+typedef enum{
+    APP_INPUT_PRESS = 0 ,   // debounced button press
+    APP_INPUT_TIMEOUT   ,   // u16_duration_ms elapsed in the state
+    APP_INPUTS_TOTAL
+}en_app_input_t;
+
+/* One row of the state table */
+typedef struct{
+    uint8_t_        u8_leds                         ; // RGB LED levels (bit set -> on), pins in RGB_LED_MASK
+    uint16_t_       u16_duration_ms                 ; // time in state before APP_INPUT_TIMEOUT, 0: none
+    en_app_state_t  arr_en_next[APP_INPUTS_TOTAL]   ; // next state per input
+}st_app_state_t;
 
 /*
  * Private Variables */
-static en_app_state_t gl_u8_app_state = ALL_OFF;
+
+/* State table, each state fully defines the LED outputs so no transition depends on the previous state */
+static const st_app_state_t gl_arr_st_app_states[STATES_TOTAL] = {
+    /*               LEDs            ms              on press                         on timeout */
+    [ALL_OFF]    = { 0,              0,              { [APP_INPUT_PRESS] = RED_ON,    [APP_INPUT_TIMEOUT] = ALL_OFF    } },
+    [RED_ON]     = { RED_LED,        COLOR_ON_MS,    { [APP_INPUT_PRESS] = GREEN_ON,  [APP_INPUT_TIMEOUT] = RED_DONE   } },
+    [RED_DONE]   = { 0,              0,              { [APP_INPUT_PRESS] = GREEN_ON,  [APP_INPUT_TIMEOUT] = RED_DONE   } },
+    [GREEN_ON]   = { GREEN_LED,      COLOR_ON_MS,    { [APP_INPUT_PRESS] = BLUE_ON,   [APP_INPUT_TIMEOUT] = GREEN_DONE } },
+    [GREEN_DONE] = { 0,              0,              { [APP_INPUT_PRESS] = BLUE_ON,   [APP_INPUT_TIMEOUT] = GREEN_DONE } },
+    [BLUE_ON]    = { BLUE_LED,       COLOR_ON_MS,    { [APP_INPUT_PRESS] = ALL_ON,    [APP_INPUT_TIMEOUT] = BLUE_DONE  } },
+    [BLUE_DONE]  = { 0,              0,              { [APP_INPUT_PRESS] = ALL_ON,    [APP_INPUT_TIMEOUT] = BLUE_DONE  } },
+    [ALL_ON]     = { RGB_LED_MASK,   COLOR_ON_MS,    { [APP_INPUT_PRESS] = ALL_OFF,   [APP_INPUT_TIMEOUT] = ALL_DONE   } },
+    [ALL_DONE]   = { 0,              0,              { [APP_INPUT_PRESS] = ALL_OFF,   [APP_INPUT_TIMEOUT] = ALL_DONE   } },
+};
+
+static en_app_state_t gl_en_app_state = ALL_OFF;
+static volatile boolean gl_bool_app_timeout = FALSE;  // the state's on-time elapsed, set by its one-shot timer
+
+static uint32_t_ gl_u32_app_presses = 0;       // debounced presses dispatched
+
+static boolean gl_bool_app_woken = FALSE;     // woke from sleep, reason not recorded yet
+static st_app_wake_stats_t gl_st_app_wake_stats = { { 0 }, APP_WAKE_IDLE };
+
+static st_systick_cfg_t gl_st_systick_cfg = {
+        .bool_systick_int_enabled = TRUE,
+        .en_systick_clk_src = CLK_SRC_PIOSC
+};
 
 static st_btn_config_t_ gl_st_user_btn_cfg = {
         .en_btn_port = USER_BTN_PORT,
         .en_btn_pin  = USER_BTN_PIN,
         .en_btn_activation = BTN_ACTIVATED,
-        .en_btn_pull_type = BTN_INTERNAL_PULL_UP
+        .en_btn_pull_type = BTN_INTERNAL_PULL_UP,
+        .u16_btn_holdoff_ms = 20    // one debounce period, the debouncer samples the pin meanwhile
+};
+
+/*
+ * Private Functions */
+static void app_timeout_cbf(void);
+static en_console_error_t_ app_cmd_color(uint8_t_ u8_argc, char * ptr_str_argv[]);
+static en_console_error_t_ app_cmd_btn(uint8_t_ u8_argc, char * ptr_str_argv[]);
+static en_console_error_t_ app_cmd_stats(uint8_t_ u8_argc, char * ptr_str_argv[]);
+
+static const st_console_cmd_t_ gl_arr_st_app_cmds[] = {
+    { "color",  "<off|red|green|blue|all> : enter the color state",    app_cmd_color   },
+    { "btn",    ": button counters",                                    app_cmd_btn     },
+    { "stats",  ": uptime, wake ups, LED/UART counters",                app_cmd_stats   },
 };
 
+static const st_console_cfg_t_ gl_st_console_cfg = {
+        .u32_baud_rate = CONSOLE_BAUD_RATE,
+        .ptr_st_cmds = gl_arr_st_app_cmds,
+        .u8_cmds_count = (uint8_t_)(sizeof(gl_arr_st_app_cmds) / sizeof(gl_arr_st_app_cmds[0]))
+};
+
+static const st_timer_cfg_t gl_st_app_timeout_cfg = {
+        .en_timer = APP_TIMEOUT_TIMER,
+        .u32_period_us = COLOR_ON_MS * 1000UL,
+        .ptr_cbf = app_timeout_cbf
+};
+
+/**
+ * @brief                       :   State timeout callback, runs in the timer interrupt and wakes the loop
+ */
+static void app_timeout_cbf(void)
+{
+    gl_bool_app_timeout = TRUE;
+}
+
+/**
+ * @brief                       :   Enters a state, writes its LED outputs in one masked port write
+ *                                  and arms the one-shot timer with its on-time
+ *
+ * @param[in]   en_app_state    :   State to enter
+ *
+ * @return  APP_OK              :   In case of Successful Operation
+ *          APP_FAIL            :   In case of Failed Operation
+ */
+static en_app_error_t app_enter(en_app_state_t en_app_state)
+{
+    en_app_error_t en_app_error_retval = APP_OK;
+    uint16_t_ u16_duration_ms = gl_arr_st_app_states[en_app_state].u16_duration_ms;
+    boolean bool_masked = cpu_irq_save();
+
+    gl_en_app_state = en_app_state;
+
+    // a time-out of the previous state must not end this one
+    timer_stop(APP_TIMEOUT_TIMER);
+    gl_bool_app_timeout = FALSE;
+
+    if(ZERO != u16_duration_ms)
+    {
+        if(
+                (TIMER_OK != timer_set_period(APP_TIMEOUT_TIMER, u16_duration_ms * 1000UL)) ||
+                (TIMER_OK != timer_start(APP_TIMEOUT_TIMER))
+                )
+        {
+            en_app_error_retval = APP_FAIL;
+        }
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    cpu_irq_restore(bool_masked);
+
+    TRACE(TRACE_EV_APP_STATE, en_app_state, 0);
+
+    if(LED_OK != led_write_port(RGB_LED_PORT, RGB_LED_MASK, gl_arr_st_app_states[en_app_state].u8_leds))
+    {
+        en_app_error_retval = APP_FAIL;
+    }
+
+    return en_app_error_retval;
+}
+
+/**
+ * @brief                       :   Applies one input to the state table, outputs are written only
+ *                                  when the state changes
+ *
+ * @param[in]   en_app_input    :   State machine input
+ */
+static void app_dispatch(en_app_input_t en_app_input)
+{
+    en_app_state_t en_app_next = gl_arr_st_app_states[gl_en_app_state].arr_en_next[en_app_input];
+
+    if(APP_INPUT_TIMEOUT == en_app_input)
+    {
+        gl_bool_app_timeout = FALSE;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    if(en_app_next != gl_en_app_state)
+    {
+        app_enter(en_app_next);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+/**
+ * @brief                       :   Checks whether the current state's on-time elapsed
+ *
+ * @return  TRUE                :   Timeout due
+ *          FALSE               :   No timeout or not due yet
+ */
+static boolean app_timeout_due(void)
+{
+    return gl_bool_app_timeout;
+}
+
+/**
+ * @brief                       :   Records the reason of the last wake up once the loop found what woke it
+ *
+ * @param[in]   en_app_wake     :   Wake up reason
+ */
+static void app_wake_record(en_app_wake_t en_app_wake)
+{
+    if(TRUE == gl_bool_app_woken)
+    {
+        gl_bool_app_woken = FALSE;
+        gl_st_app_wake_stats.arr_u32_wakes[en_app_wake]++;
+        gl_st_app_wake_stats.en_last_wake = en_app_wake;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+/**
+ * @brief                       :   Sleeps until the next interrupt unless an event is pending,
+ *                                  the check runs with interrupts masked so no event is missed
+ */
+static void app_sleep(void)
+{
+    // woke up again without finding work
+    app_wake_record(APP_WAKE_IDLE);
+
+    cpu_irq_disable();
+
+    if((FALSE == btn_event_pending()) && (FALSE == app_timeout_due()))
+    {
+        cpu_wait_for_interrupt();
+        gl_bool_app_woken = TRUE;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    // the waking interrupt is handled here
+    cpu_irq_enable();
+}
+
+/**
+ * @brief                       :   Console "color" command, enters the state showing the color
+ *                                  (its on-time applies as if it was reached by presses)
+ */
+static en_console_error_t_ app_cmd_color(uint8_t_ u8_argc, char * ptr_str_argv[])
+{
+    static const struct{
+        const char *    ptr_str_name    ;
+        en_app_state_t  en_app_state    ;
+    }arr_st_colors[] = {
+        { "off", ALL_OFF }, { "red", RED_ON }, { "green", GREEN_ON }, { "blue", BLUE_ON }, { "all", ALL_ON }
+    };
+    en_console_error_t_ en_console_error_retval = CONSOLE_ERROR;
+    uint8_t_ u8_color;
+    uint8_t_ u8_char;
+
+    for(u8_color = 0; (2 == u8_argc) && (u8_color < (sizeof(arr_st_colors) / sizeof(arr_st_colors[0]))); u8_color++)
+    {
+        for(u8_char = 0;
+            (ptr_str_argv[1][u8_char] == arr_st_colors[u8_color].ptr_str_name[u8_char]) && ('\0' != ptr_str_argv[1][u8_char]);
+            u8_char++)
+        {
+        }
+
+        if(ptr_str_argv[1][u8_char] == arr_st_colors[u8_color].ptr_str_name[u8_char])
+        {
+            app_enter(arr_st_colors[u8_color].en_app_state);
+            en_console_error_retval = CONSOLE_OK;
+            break;
+        }
+    }
+
+    return en_console_error_retval;
+}
+
+/**
+ * @brief                       :   Console "btn" command, prints the button counters
+ */
+static en_console_error_t_ app_cmd_btn(uint8_t_ u8_argc, char * ptr_str_argv[])
+{
+    uint32_t_ u32_suppressed = 0;
+
+    (void) ptr_str_argv;
+
+    btn_read_suppressed(&gl_st_user_btn_cfg, &u32_suppressed);
+
+    console_print_value("presses", gl_u32_app_presses);
+    console_print_value("edges_suppressed", u32_suppressed);
+    console_print_value("events_dropped", btn_event_dropped());
+
+    return (1 == u8_argc) ? CONSOLE_OK : CONSOLE_ERROR;
+}
+
+/**
+ * @brief                       :   Console "stats" command, prints uptime and the diagnostic counters
+ */
+static en_console_error_t_ app_cmd_stats(uint8_t_ u8_argc, char * ptr_str_argv[])
+{
+    st_led_stats_t_ st_led_stats;
+    st_uart_stats_t st_uart_stats;
+
+    (void) ptr_str_argv;
+
+    console_print_value("uptime_ms", systick_get_ms());
+
+    console_print_value("wake_button", gl_st_app_wake_stats.arr_u32_wakes[APP_WAKE_BUTTON]);
+    console_print_value("wake_timeout", gl_st_app_wake_stats.arr_u32_wakes[APP_WAKE_TIMEOUT]);
+    console_print_value("wake_console", gl_st_app_wake_stats.arr_u32_wakes[APP_WAKE_CONSOLE]);
+    console_print_value("wake_idle", gl_st_app_wake_stats.arr_u32_wakes[APP_WAKE_IDLE]);
+
+    if(LED_OK == led_get_stats(&st_led_stats))
+    {
+        console_print_value("led_writes_issued", st_led_stats.u32_writes_issued);
+        console_print_value("led_writes_elided", st_led_stats.u32_writes_elided);
+    }
+
+    if(UART_OK == uart_get_stats(&st_uart_stats))
+    {
+        console_print_value("uart_tx_bytes", st_uart_stats.u32_tx_bytes);
+        console_print_value("uart_tx_dropped", st_uart_stats.u32_tx_dropped);
+        console_print_value("uart_rx_bytes", st_uart_stats.u32_rx_bytes);
+        console_print_value("uart_rx_overruns", st_uart_stats.u32_rx_overruns);
+    }
+
+#if LATENCY_INSTRUMENTATION
+    {
+        st_latency_stats_t_ st_latency_stats;
+
+        latency_get_stats(&st_latency_stats);
+        console_print_value("latency_samples", st_latency_stats.u32_samples);
+        console_print_value("latency_min_us", st_latency_stats.u32_min_us);
+        console_print_value("latency_max_us", st_latency_stats.u32_max_us);
+    }
+#endif
+
+    return (1 == u8_argc) ? CONSOLE_OK : CONSOLE_ERROR;
+}
+
 /**
  * @brief                      : Initializes the required modules by the app
  *
@@ -63,6 +390,11 @@ en_app_error_t app_init(void)
     en_btn_status_code_t_ en_btn_status_code = BTN_STATUS_OK;
     en_led_error_t_ en_led_error = LED_OK;
 
+#if TRACE_INSTRUMENTATION
+    // event log of the drivers, decoded with tools/trace_decode.py
+    trace_init();
+#endif
+
     /* init RGB LED */
 
     // init RED LED
@@ -77,77 +409,99 @@ en_app_error_t app_init(void)
     en_led_error = led_init(BLUE_LED_PORT, BLUE_LED_PIN);
     if(LED_OK != en_led_error) en_app_error_retval = APP_FAIL;
 
+    // uptime and console time base, the state timeouts run on their own one-shot timer
+    if(
+            (ST_OK != systick_init(&gl_st_systick_cfg)) ||
+            (ST_OK != systick_tick_start(APP_TIME_BASE_MS)) ||
+            (TIMER_OK != timer_init_one_shot(&gl_st_app_timeout_cfg))
+            )
+    {
+        en_app_error_retval = APP_FAIL;
+    }
+
+    // RGB LED is OFF initially
+    if(APP_OK != app_enter(ALL_OFF)) en_app_error_retval = APP_FAIL;
+
+#if LATENCY_INSTRUMENTATION
+    // button -> LED latency histogram, read with latency_get_stats
+    latency_init();
+#endif
+
     // init button
     en_btn_status_code = btn_init(&gl_st_user_btn_cfg);
     if(BTN_STATUS_OK != en_btn_status_code) en_app_error_retval = APP_FAIL;
 
+    // command console on UART0 (ICDI virtual COM port)
+    if(CONSOLE_OK != console_init(&gl_st_console_cfg)) en_app_error_retval = APP_FAIL;
+
     return en_app_error_retval;
 }
 
+/**
+ * @brief                       :   Starts the application program and keeps it running indefinitely,
+ *                                  dispatches button events, timeouts and console commands and sleeps
+ *                                  while there are none
+ */
 void app_start(void)
 {
     while(1)
     {
 
-        en_btn_state_t_ en_btn_state = BTN_STATE_NOT_PRESSED;
-        btn_read(&gl_st_user_btn_cfg, &en_btn_state);
+        st_btn_event_t_ st_btn_event;
 
-        if(BTN_STATE_PRESSED == en_btn_state)
+        if(BTN_STATUS_OK == btn_event_get(&st_btn_event))
         {
-            if(ALL_ON == gl_u8_app_state)
+            app_wake_record(APP_WAKE_BUTTON);
+
+            // one step per debounced press, holding the button doesn't repeat
+            if(BTN_EVENT_PRESS == st_btn_event.en_btn_event)
             {
-                gl_u8_app_state = ALL_OFF;
+                gl_u32_app_presses++;
+                app_dispatch(APP_INPUT_PRESS);
             }
             else
             {
-                gl_u8_app_state += 1;
+                /* Do Nothing */
             }
         }
+        else if(TRUE == app_timeout_due())
+        {
+            app_wake_record(APP_WAKE_TIMEOUT);
+            app_dispatch(APP_INPUT_TIMEOUT);
+        }
+        else if(TRUE == console_poll(systick_get_ms()))
+        {
+            // received characters raise no interrupt each, the time base wakes the loop
+            // to pick them up within APP_TIME_BASE_MS
+            app_wake_record(APP_WAKE_CONSOLE);
+        }
         else
         {
-            /* Do Nothing */
+            app_sleep();
         }
+    }
+}
 
-        switch (gl_u8_app_state) {
+/**
+ * @brief                       :   Reads the main loop wake up counters
+ *
+ * @param[out]  ptr_st_wake_stats   :   Pointer to store the counters in
+ *
+ * @return  APP_OK              :   In case of Successful Operation
+ *          APP_FAIL            :   In case of NULL pointer
+ */
+en_app_error_t app_get_wake_stats(st_app_wake_stats_t * ptr_st_wake_stats)
+{
+    en_app_error_t en_app_error_retval = APP_OK;
 
-            case ALL_OFF:
-            {
-                led_off(RED_LED_PORT, RED_LED_PIN);
-                led_off(GREEN_LED_PORT, GREEN_LED_PIN);
-                led_off(BLUE_LED_PORT, BLUE_LED_PIN);
-                break;
-            }
-            case RED_ON:
-            {
-                led_on(RED_LED_PORT, RED_LED_PIN);
-                break;
-            }
-            case GREEN_ON:
-            {
-                led_off(RED_LED_PORT, RED_LED_PIN);
-                led_on(GREEN_LED_PORT, GREEN_LED_PIN);
-                break;
-            }
-            case BLUE_ON:
-            {
-                led_off(GREEN_LED_PORT, GREEN_LED_PIN);
-                led_on(BLUE_LED_PORT, BLUE_LED_PIN);
-                break;
-            }
-            case ALL_ON:
-            {
-                led_on(RED_LED_PORT, RED_LED_PIN);
-                led_on(GREEN_LED_PORT, GREEN_LED_PIN);
-                led_on(BLUE_LED_PORT, BLUE_LED_PIN);
-                break;
-            }
-            case STATES_TOTAL:
-            default:
-            {
-                // bad state, reset to ALL_OFF
-                gl_u8_app_state = ALL_OFF;
-                break;
-            }
-        }
+    if(NULL_PTR == ptr_st_wake_stats)
+    {
+        en_app_error_retval = APP_FAIL;
+    }
+    else
+    {
+        *ptr_st_wake_stats = gl_st_app_wake_stats;
     }
-}
\ No newline at end of file
+
+    return en_app_error_retval;
+}
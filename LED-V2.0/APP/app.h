@@ -11,11 +11,28 @@
 #ifndef APP_H_
 #define APP_H_
 
+#include "std.h"
+
 typedef enum{
     APP_OK,
     APP_FAIL
 }en_app_error_t;
 
+/* What the main loop found to do after waking from sleep */
+typedef enum{
+    APP_WAKE_BUTTON = 0 ,   // button event queued
+    APP_WAKE_TIMEOUT    ,   // state on-time elapsed
+    APP_WAKE_CONSOLE    ,   // console command completed
+    APP_WAKE_IDLE       ,   // interrupt without app work (time base, debounce ticks)
+    APP_WAKE_TOTAL
+}en_app_wake_t;
+
+/* Sleep diagnostics of the main loop */
+typedef struct{
+    uint32_t_       arr_u32_wakes[APP_WAKE_TOTAL]   ; // wake ups per reason
+    en_app_wake_t   en_last_wake                    ; // reason of the last wake up
+}st_app_wake_stats_t;
+
 
 /**
  * @brief                       : Initializes the required modules by the app
@@ -27,8 +44,20 @@ en_app_error_t app_init(void);
 
 
 /**
- * @brief                       :   Starts the application program and keeps it running indefinitely
+ * @brief                       :   Starts the application program and keeps it running indefinitely,
+ *                                  dispatches button events, timeouts and console commands and sleeps
+ *                                  while there are none
  */
 void app_start(void);
 
+/**
+ * @brief                       :   Reads the main loop wake up counters
+ *
+ * @param[out]  ptr_st_wake_stats   :   Pointer to store the counters in
+ *
+ * @return  APP_OK              :   In case of Successful Operation
+ *          APP_FAIL            :   In case of NULL pointer
+ */
+en_app_error_t app_get_wake_stats(st_app_wake_stats_t * ptr_st_wake_stats);
+
 #endif
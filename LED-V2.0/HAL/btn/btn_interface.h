@@ -10,6 +10,18 @@
 #ifndef BTN_INTERFACE_H_
 #define BTN_INTERFACE_H_
 
+#include "std.h"
+
+/*----------------------------------------------------------/
+/- MACROS
+/----------------------------------------------------------*/
+#define BTN_TICK_MS				5	/* debounce sampling period */
+#define BTN_DEBOUNCE_SAMPLES	4	/* agreeing samples before a state change (20 ms), fixed by the 2-bit vertical counter */
+#define BTN_EVENT_QUEUE_SIZE	16	/* power of 2 */
+
+/* bit of a button in the btn_read_all bitmap */
+#define BTN_ALL_BIT(PORT, PIN)	(((uint64_t_) 1) << (((PORT) * BTN_PIN_TOTAL) + (PIN)))
+
 /*----------------------------------------------------------/
 /- ENUMS
 /----------------------------------------------------------*/
@@ -65,9 +77,30 @@ typedef enum
 	BTN_STATUS_OK = 0			 ,
 	BTN_STATUS_INVALID_PULL_TYPE ,
 	BTN_STATUS_INVALID_STATE	 ,
-	BTN_STATUS_DEACTIVATED
+	BTN_STATUS_DEACTIVATED		 ,
+	BTN_STATUS_NO_INSTANCE
 }en_btn_status_code_t_;
 
+/* debounced edge flags, bit masks */
+typedef enum
+{
+	BTN_EDGE_NONE		= 0		,
+	BTN_EDGE_PRESS		= 1		,
+	BTN_EDGE_RELEASE	= 2
+}en_btn_edge_t_;
+
+/* events emitted into the button event queue */
+typedef enum
+{
+	BTN_EVENT_PRESS		= 0	,	/* debounced press */
+	BTN_EVENT_RELEASE		,	/* debounced release */
+	BTN_EVENT_CLICK			,	/* single short press, no second press within the multi-click window */
+	BTN_EVENT_DOUBLE_CLICK	,	/* second short press within the multi-click window */
+	BTN_EVENT_LONG_PRESS	,	/* held for the long press time */
+	BTN_EVENT_HOLD_REPEAT	,	/* still held, every repeat period after the long press */
+	BTN_EVENT_TOTAL
+}en_btn_event_t_;
+
 /*----------------------------------------------------------/
 /- STRUCTS
 /----------------------------------------------------------*/
@@ -76,10 +109,37 @@ typedef struct
 	en_btn_port_t_				en_btn_port 	  ;
 	en_btn_pin_t_ 				en_btn_pin 	  ;
 	en_btn_pull_t_				en_btn_pull_type ;
+	/** Event thresholds, 0 disables the event */
+	uint16_t_					u16_btn_long_press_ms	;	/* press -> BTN_EVENT_LONG_PRESS */
+	uint16_t_					u16_btn_repeat_ms		;	/* BTN_EVENT_LONG_PRESS -> BTN_EVENT_HOLD_REPEAT period */
+	uint16_t_					u16_btn_multi_click_ms	;	/* release -> next press window for BTN_EVENT_DOUBLE_CLICK */
+	/** Edge interrupt holdoff, 0 disables it */
+	uint16_t_					u16_btn_holdoff_ms		;	/* port edge interrupts stay masked this long after an edge */
 	/** Read only */
 	en_btn_active_state_t_		en_btn_activation;
+	/** Debouncer state, private to the btn module */
+	volatile en_btn_state_t_	en_btn_state		;	/* debounced state */
+	volatile uint8_t_			u8_btn_press_count	;	/* written by the tick only */
+	volatile uint8_t_			u8_btn_release_count;	/* written by the tick only */
+	uint8_t_					u8_btn_press_seen	;	/* written by btn_read_edges only */
+	uint8_t_					u8_btn_release_seen	;	/* written by btn_read_edges only */
+	/** Event state, private to the btn module */
+	uint32_t_					u32_btn_press_ms	;	/* time of the last press */
+	uint32_t_					u32_btn_release_ms	;	/* time of the last release */
+	uint32_t_					u32_btn_repeat_ms	;	/* time of the next hold repeat */
+	uint8_t_					u8_btn_clicks		;	/* short presses waiting for the multi-click window */
+	boolean						bool_btn_long_sent	;	/* long press already emitted for this press */
+	/** Read only */
+	volatile uint32_t_			u32_btn_suppressed	;	/* holdoff ticks in which this pin latched an edge */
 }st_btn_config_t_;
 
+typedef struct
+{
+	st_btn_config_t_*			ptr_st_btn		;	/* button the event belongs to */
+	en_btn_event_t_				en_btn_event	;
+	uint32_t_					u32_time_ms		;	/* btn time base when the event was emitted, it stands still while no port is active */
+}st_btn_event_t_;
+
 /*---------------------------------------------------------/
 /- FUNCTION PROTOTYPES
 /---------------------------------------------------------*/
@@ -90,25 +150,119 @@ typedef struct
  * @param ptr_st_btn_config            : pointer to the desired button structure
  * 
  * @return BTN_STATUS_OK 	            : When the operation is successful
- *         BTN_STATUS_INVALID_STATE		: Button structure pointer is a NULL_PTR
+ *         BTN_STATUS_INVALID_STATE		: Button structure pointer is a NULL_PTR, invalid port or pin, or the
+ *                                        pin or the tick timer couldn't be configured
  *         BTN_STATUS_INVALID_PULL_TYPE : If the pull type field in button structure is set to invalid value
+ *         BTN_STATUS_NO_INSTANCE       : The pin is already owned by another button structure
  */
 en_btn_status_code_t_ btn_init(st_btn_config_t_* ptr_st_btn_config);
 
+/**
+ * @brief Function to release a button's pin, another button structure can own it afterwards
+ * 
+ * @param ptr_st_btn_config            : pointer to the desired button structure
+ * 
+ * @return BTN_STATUS_OK                : When the operation is successful
+ *         BTN_STATUS_INVALID_STATE     : Button structure pointer is a NULL_PTR, invalid port or pin
+ *         BTN_STATUS_NO_INSTANCE       : The pin isn't owned by this button structure
+ */
 en_btn_status_code_t_ btn_deinit(st_btn_config_t_* ptr_st_btn_config);
 
 /**
- * @brief Function to read the current button state 
+ * @brief Function to read the debounced button state, never blocks
  * 
  * @param ptr_st_btn_config            : pointer to the desired button structure
  * @param ptr_en_btn_state             : pointer to variable to store the button state
  * 
  * @return BTN_STATUS_OK                : When the operation is successful
  *         BTN_STATUS_INVALID_STATE     : Button structure and/or button state pointers are NULL_PTRs
- *         BTN_STATUS_INVALID_PULL_TYPE : If the pull type field in button structure is set to invalid value
  *		   BTN_STATUS_DEACTIVATED		: If we are trying to read from a deactivated button
  */
 en_btn_status_code_t_ btn_read(st_btn_config_t_* ptr_st_btn_config, en_btn_state_t_* ptr_en_btn_state);
 
+/**
+ * @brief Function to read and consume the debounced edges since the last call, never blocks
+ * 
+ * @param ptr_st_btn_config            : pointer to the desired button structure
+ * @param ptr_u8_btn_edges             : pointer to variable to store the en_btn_edge_t_ flags
+ * 
+ * @return BTN_STATUS_OK                : When the operation is successful
+ *         BTN_STATUS_INVALID_STATE     : Button structure and/or edges pointers are NULL_PTRs
+ *		   BTN_STATUS_DEACTIVATED		: If we are trying to read from a deactivated button
+ */
+en_btn_status_code_t_ btn_read_edges(st_btn_config_t_* ptr_st_btn_config, uint8_t_* ptr_u8_btn_edges);
+
+/**
+ * @brief Function to read the debounced state of every button on a port, never blocks
+ * 
+ * @param en_btn_port                  : port to read
+ * @param ptr_u8_pressed               : pointer to variable to store the pressed pins mask
+ * @param ptr_u8_changed               : pointer to variable to store the pins changed since the last call
+ * 
+ * @return BTN_STATUS_OK                : When the operation is successful
+ *         BTN_STATUS_INVALID_STATE     : Invalid port and/or NULL_PTRs
+ */
+en_btn_status_code_t_ btn_read_port(en_btn_port_t_ en_btn_port, uint8_t_* ptr_u8_pressed, uint8_t_* ptr_u8_changed);
+
+/**
+ * @brief Function to sample every initialized button at once, never blocks
+ * 
+ * One GPIODATA read per port with buttons, the pressed level of every pin is applied
+ * by a precomputed XOR mask. Instant (not debounced) levels, see btn_read_port for the
+ * debounced state
+ * 
+ * @param ptr_u64_pressed              : pointer to variable to store the bitmap, BTN_ALL_BIT(port, pin) set if pressed
+ * 
+ * @return BTN_STATUS_OK                : When the operation is successful
+ *         BTN_STATUS_INVALID_STATE     : NULL_PTR
+ */
+en_btn_status_code_t_ btn_read_all(uint64_t_* ptr_u64_pressed);
+
+/**
+ * @brief Function to read the edges suppressed by the interrupt holdoff of a button
+ * 
+ * The pin interrupt is masked during the holdoff, the hardware only latches that an edge
+ * happened: the count is the number of holdoff ticks with at least one edge
+ * 
+ * @param ptr_st_btn_config            : pointer to the desired button structure
+ * @param ptr_u32_suppressed           : pointer to variable to store the count
+ * 
+ * @return BTN_STATUS_OK                : When the operation is successful
+ *         BTN_STATUS_INVALID_STATE     : NULL_PTRs
+ */
+en_btn_status_code_t_ btn_read_suppressed(st_btn_config_t_* ptr_st_btn_config, uint32_t_* ptr_u32_suppressed);
+
+/**
+ * @brief Function to take the oldest event from the button event queue, never blocks
+ * 
+ * @param ptr_st_btn_event             : pointer to variable to store the event
+ * 
+ * @return BTN_STATUS_OK                : When an event was taken
+ *         BTN_STATUS_INVALID_STATE     : NULL_PTR or the queue is empty
+ */
+en_btn_status_code_t_ btn_event_get(st_btn_event_t_* ptr_st_btn_event);
+
+/**
+ * @brief Function to check for queued events without taking one
+ * 
+ * @return TRUE                         : At least one event is queued
+ *         FALSE                        : The queue is empty
+ */
+boolean btn_event_pending(void);
+
+/**
+ * @brief Function to read the number of events dropped because the event queue was full
+ * 
+ * @return dropped events since start up
+ */
+uint32_t_ btn_event_dropped(void);
+
+/**
+ * @brief Function to advance the debouncer of every port with button activity by one sample
+ *        and generate the timed events, called every BTN_TICK_MS from the button tick timer
+ *        while a port is active, the timer stops once every port settled
+ */
+void btn_tick(void);
+
 
 #endif /* BTN_INTERFACE_H_ */
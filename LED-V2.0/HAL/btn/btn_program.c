@@ -8,15 +8,455 @@
 /*----------------------------------------------------------/
 /- INCLUDES 
 /----------------------------------------------------------*/
-#include "systick_interface.h"
+#include "bit_math.h"
 #include "gpio_interface.h"
+#include "timer_interface.h"
+#include "cpu_interface.h"
+#include "latency_interface.h"
+#include "trace_interface.h"
 
 #include "btn_interface.h"
 
 /*---------------------------------------------------------/
 /- LOCAL MACROS
 /---------------------------------------------------------*/
-#define BTN_DEBOUNCE_DELAY			300 //in ms
+#define BTN_TICK_TIMER				TIMER_2
+#define BTN_US_PER_MS				1000
+#define BTN_EVENT_QUEUE_MASK		(BTN_EVENT_QUEUE_SIZE - 1)
+#define BTN_DOUBLE_CLICK_COUNT		2
+#define BTN_HOLDOFF_TICKS_MAX		255
+
+/*---------------------------------------------------------/
+/- PRIVATE TYPEDEFS
+/---------------------------------------------------------*/
+/* Port-wide debouncer, one bit per pin, all pins advanced together */
+typedef struct
+{
+	uint8_t_			u8_pins		;	/* pins with a registered button */
+	uint8_t_			u8_polarity	;	/* 1: pressed reads low (pull up) */
+	uint8_t_			u8_cnt0		;	/* 2-bit vertical counter, bit 0 of every pin */
+	uint8_t_			u8_cnt1		;	/* 2-bit vertical counter, bit 1 of every pin */
+	volatile uint8_t_	u8_state	;	/* debounced state, 1: pressed */
+	uint8_t_			u8_reported	;	/* state returned by the last btn_read_port */
+	uint8_t_			u8_clicks	;	/* released pins waiting for their multi-click window */
+	uint8_t_			u8_holdoff_ticks	;	/* longest holdoff of the port's buttons */
+	volatile uint8_t_	u8_masked			;	/* pins with their edge interrupt masked */
+	volatile uint8_t_	u8_holdoff_left		;	/* ticks until the masked pins are re-armed */
+#if LATENCY_INSTRUMENTATION
+	uint32_t_			u32_edge_stamp		;	/* first raw edge since the last debounced change */
+	boolean				bool_edge_stamped	;
+#endif
+}st_btn_port_t;
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+static st_btn_port_t gl_arr_st_btn_ports[BTN_PORT_TOTAL];
+
+/* button owning each pin, for per-button state and edges */
+static st_btn_config_t_* gl_arr_ptr_st_btn_map[BTN_PORT_TOTAL][BTN_PIN_TOTAL] = {{NULL_PTR}};
+
+static boolean gl_bool_btn_tick_init = FALSE;
+
+/* tick timer running, it stops once every port settled and an edge restarts it */
+static volatile boolean gl_bool_btn_tick_running = FALSE;
+
+/* ports with at least one button, bit n = port n */
+static uint8_t_ gl_u8_btn_ports_used = 0;
+
+/* time base for the events, advanced by btn_tick, stands still while the tick is stopped */
+static volatile uint32_t_ gl_u32_btn_time_ms = 0;
+
+/* set by the pin edge interrupts, cleared by btn_tick once the port settled */
+static volatile boolean gl_arr_bool_btn_port_active[BTN_PORT_TOTAL] = {FALSE};
+
+/* event queue, single producer (btn_tick) single consumer (btn_event_get) */
+static st_btn_event_t_ gl_arr_st_btn_events[BTN_EVENT_QUEUE_SIZE];
+static volatile uint8_t_ gl_u8_btn_events_head = 0;	/* written by btn_tick only */
+static volatile uint8_t_ gl_u8_btn_events_tail = 0;	/* written by btn_event_get only */
+static uint32_t_ gl_u32_btn_events_dropped = 0;
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+* @brief Function to handle a button pin edge: wakes the port debouncer, restarting the tick
+*        if it was stopped, and, if a holdoff is configured, masks the port's button interrupts
+*        so a bouncing or noisy line can't flood the GPIO handler, btn_tick re-arms them
+*
+* @param en_btn_port                  : port of the pin edge
+*/
+static void btn_edge(en_btn_port_t_ en_btn_port)
+{
+	st_btn_port_t* lo_ptr_st_port = &gl_arr_st_btn_ports[en_btn_port];
+	uint8_t_ lo_u8_pin;
+
+	TRACE(TRACE_EV_BTN_EDGE, en_btn_port, 0);
+
+#if LATENCY_INSTRUMENTATION
+	if(FALSE == lo_ptr_st_port->bool_edge_stamped)
+	{
+		LATENCY_STAMP(lo_ptr_st_port->u32_edge_stamp);
+		lo_ptr_st_port->bool_edge_stamped = TRUE;
+	}
+#endif
+
+	gl_arr_bool_btn_port_active[en_btn_port] = TRUE;
+
+	if(FALSE == gl_bool_btn_tick_running)
+	{
+		/* the first sample a full tick after the edge */
+		gl_bool_btn_tick_running = TRUE;
+		timer_start(BTN_TICK_TIMER);
+	}
+
+	if(0 != lo_ptr_st_port->u8_holdoff_ticks)
+	{
+		for(lo_u8_pin = 0; lo_u8_pin < BTN_PIN_TOTAL; lo_u8_pin++)
+		{
+			if(GET_BIT(lo_ptr_st_port->u8_pins, lo_u8_pin))
+			{
+				gpio_disableInt((en_gpio_port_t) en_btn_port, (en_gpio_pin_t) lo_u8_pin);
+			}
+		}
+
+		lo_ptr_st_port->u8_masked = lo_ptr_st_port->u8_pins;
+		lo_ptr_st_port->u8_holdoff_left = lo_ptr_st_port->u8_holdoff_ticks;
+	}
+}
+
+/**
+* @brief Function to count the edges latched by the masked pins of a port and re-arm them
+*        once the holdoff expired, called every tick while pins are masked
+*
+* @param en_btn_port                  : port to service
+*/
+static void btn_holdoff(en_btn_port_t_ en_btn_port)
+{
+	st_btn_port_t* lo_ptr_st_port = &gl_arr_st_btn_ports[en_btn_port];
+	boolean lo_bool_pending = FALSE;
+	boolean lo_bool_irq_masked;
+	uint8_t_ lo_u8_masked;
+	uint8_t_ lo_u8_pin;
+
+	for(lo_u8_pin = 0; lo_u8_pin < BTN_PIN_TOTAL; lo_u8_pin++)
+	{
+		if(GET_BIT(lo_ptr_st_port->u8_masked, lo_u8_pin))
+		{
+			gpio_clearRawInt((en_gpio_port_t) en_btn_port, (en_gpio_pin_t) lo_u8_pin, &lo_bool_pending);
+			if(TRUE == lo_bool_pending)
+			{
+				gl_arr_ptr_st_btn_map[en_btn_port][lo_u8_pin]->u32_btn_suppressed++;
+			}
+		}
+	}
+
+	lo_ptr_st_port->u8_holdoff_left--;
+	if(0 == lo_ptr_st_port->u8_holdoff_left)
+	{
+		/* stale edges were cleared above: re-arm, then re-sample the level through the debouncer.
+		   The mask is cleared before the pins are unmasked and the edge handler held off meanwhile,
+		   an edge once they are armed masks the port again and its u8_masked is kept */
+		lo_bool_irq_masked = cpu_irq_save();
+
+		lo_u8_masked = lo_ptr_st_port->u8_masked;
+		lo_ptr_st_port->u8_masked = 0;
+		gl_arr_bool_btn_port_active[en_btn_port] = TRUE;
+
+		for(lo_u8_pin = 0; lo_u8_pin < BTN_PIN_TOTAL; lo_u8_pin++)
+		{
+			if(GET_BIT(lo_u8_masked, lo_u8_pin))
+			{
+				gpio_enableInt((en_gpio_port_t) en_btn_port, (en_gpio_pin_t) lo_u8_pin);
+			}
+		}
+
+		cpu_irq_restore(lo_bool_irq_masked);
+	}
+}
+
+/* pin edge interrupt callbacks, one per port */
+static void btn_edge_port_a(void) { btn_edge(BTN_PORT_A); }
+static void btn_edge_port_b(void) { btn_edge(BTN_PORT_B); }
+static void btn_edge_port_c(void) { btn_edge(BTN_PORT_C); }
+static void btn_edge_port_d(void) { btn_edge(BTN_PORT_D); }
+static void btn_edge_port_e(void) { btn_edge(BTN_PORT_E); }
+static void btn_edge_port_f(void) { btn_edge(BTN_PORT_F); }
+
+static const gpio_cb gl_arr_btn_edge_cbf[BTN_PORT_TOTAL] = {
+	btn_edge_port_a,
+	btn_edge_port_b,
+	btn_edge_port_c,
+	btn_edge_port_d,
+	btn_edge_port_e,
+	btn_edge_port_f
+};
+
+/**
+* @brief Function to push an event into the event queue, counts it as dropped if the queue is full
+*
+* @param ptr_st_btn_config            : pointer to the button the event belongs to
+* @param en_btn_event                 : event to push
+*/
+static void btn_emit(st_btn_config_t_* ptr_st_btn_config, en_btn_event_t_ en_btn_event)
+{
+	uint8_t_ lo_u8_head = gl_u8_btn_events_head;
+
+	if(BTN_ACTIVATED != ptr_st_btn_config->en_btn_activation)
+	{
+		/* Do Nothing */
+	}
+	else if(BTN_EVENT_QUEUE_SIZE <= (uint8_t_)(lo_u8_head - gl_u8_btn_events_tail))
+	{
+		gl_u32_btn_events_dropped++;
+	}
+	else
+	{
+		gl_arr_st_btn_events[lo_u8_head & BTN_EVENT_QUEUE_MASK].ptr_st_btn = ptr_st_btn_config;
+		gl_arr_st_btn_events[lo_u8_head & BTN_EVENT_QUEUE_MASK].en_btn_event = en_btn_event;
+		gl_arr_st_btn_events[lo_u8_head & BTN_EVENT_QUEUE_MASK].u32_time_ms = gl_u32_btn_time_ms;
+
+		TRACE(TRACE_EV_BTN_EVENT, en_btn_event,
+			  ((uint16_t_) ptr_st_btn_config->en_btn_port << 8) | ptr_st_btn_config->en_btn_pin);
+
+		/* publish after the slot is written */
+		gl_u8_btn_events_head = lo_u8_head + 1;
+	}
+}
+
+/**
+* @brief Function to emit the events of a debounced press or release
+*
+* @param ptr_st_port                  : port debouncer of the button
+* @param ptr_st_btn_config            : pointer to the button
+* @param u8_pin_mask                  : button pin mask
+*/
+static void btn_on_edge(st_btn_port_t* ptr_st_port, st_btn_config_t_* ptr_st_btn_config, uint8_t_ u8_pin_mask)
+{
+	uint32_t_ lo_u32_now = gl_u32_btn_time_ms;
+
+	if(ptr_st_port->u8_state & u8_pin_mask)
+	{
+		ptr_st_btn_config->en_btn_state = BTN_STATE_PRESSED;
+		ptr_st_btn_config->u8_btn_press_count++;
+
+		ptr_st_btn_config->u32_btn_press_ms = lo_u32_now;
+		ptr_st_btn_config->bool_btn_long_sent = FALSE;
+		btn_emit(ptr_st_btn_config, BTN_EVENT_PRESS);
+
+		/* press -> LED write latency starts at the raw edge */
+		LATENCY_INPUT(ptr_st_port->u32_edge_stamp);
+	}
+	else
+	{
+		ptr_st_btn_config->en_btn_state = BTN_STATE_NOT_PRESSED;
+		ptr_st_btn_config->u8_btn_release_count++;
+
+		ptr_st_btn_config->u32_btn_release_ms = lo_u32_now;
+		btn_emit(ptr_st_btn_config, BTN_EVENT_RELEASE);
+
+		if(TRUE == ptr_st_btn_config->bool_btn_long_sent)
+		{
+			/* a long press ends any click sequence */
+			ptr_st_btn_config->u8_btn_clicks = 0;
+		}
+		else if(0 == ptr_st_btn_config->u16_btn_multi_click_ms)
+		{
+			ptr_st_btn_config->u8_btn_clicks = 0;
+			btn_emit(ptr_st_btn_config, BTN_EVENT_CLICK);
+		}
+		else if(BTN_DOUBLE_CLICK_COUNT <= ++ptr_st_btn_config->u8_btn_clicks)
+		{
+			ptr_st_btn_config->u8_btn_clicks = 0;
+			btn_emit(ptr_st_btn_config, BTN_EVENT_DOUBLE_CLICK);
+		}
+		else
+		{
+			/* wait for the multi-click window */
+		}
+
+		if(0 == ptr_st_btn_config->u8_btn_clicks)
+		{
+			ptr_st_port->u8_clicks &= ~u8_pin_mask;
+		}
+		else
+		{
+			ptr_st_port->u8_clicks |= u8_pin_mask;
+		}
+	}
+}
+
+/**
+* @brief Function to emit the timed events of a held button or a button waiting for its multi-click window
+*
+* @param ptr_st_port                  : port debouncer of the button
+* @param ptr_st_btn_config            : pointer to the button
+* @param u8_pin_mask                  : button pin mask
+*/
+static void btn_on_hold(st_btn_port_t* ptr_st_port, st_btn_config_t_* ptr_st_btn_config, uint8_t_ u8_pin_mask)
+{
+	uint32_t_ lo_u32_now = gl_u32_btn_time_ms;
+
+	if(ptr_st_port->u8_state & u8_pin_mask)
+	{
+		if(
+				(0 != ptr_st_btn_config->u16_btn_long_press_ms) &&
+				(FALSE == ptr_st_btn_config->bool_btn_long_sent) &&
+				((lo_u32_now - ptr_st_btn_config->u32_btn_press_ms) >= ptr_st_btn_config->u16_btn_long_press_ms)
+				)
+		{
+			if(0 != ptr_st_btn_config->u8_btn_clicks)
+			{
+				/* the press held long after a short one: the short one was a single click */
+				ptr_st_btn_config->u8_btn_clicks = 0;
+				ptr_st_port->u8_clicks &= ~u8_pin_mask;
+				btn_emit(ptr_st_btn_config, BTN_EVENT_CLICK);
+			}
+
+			ptr_st_btn_config->bool_btn_long_sent = TRUE;
+			ptr_st_btn_config->u32_btn_repeat_ms = lo_u32_now + ptr_st_btn_config->u16_btn_repeat_ms;
+			btn_emit(ptr_st_btn_config, BTN_EVENT_LONG_PRESS);
+		}
+		else if(
+				(TRUE == ptr_st_btn_config->bool_btn_long_sent) &&
+				(0 != ptr_st_btn_config->u16_btn_repeat_ms) &&
+				((sint32_t_)(lo_u32_now - ptr_st_btn_config->u32_btn_repeat_ms) >= 0)
+				)
+		{
+			ptr_st_btn_config->u32_btn_repeat_ms += ptr_st_btn_config->u16_btn_repeat_ms;
+			btn_emit(ptr_st_btn_config, BTN_EVENT_HOLD_REPEAT);
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+	}
+	else if((lo_u32_now - ptr_st_btn_config->u32_btn_release_ms) >= ptr_st_btn_config->u16_btn_multi_click_ms)
+	{
+		/* window closed with a single click */
+		ptr_st_btn_config->u8_btn_clicks = 0;
+		ptr_st_port->u8_clicks &= ~u8_pin_mask;
+		btn_emit(ptr_st_btn_config, BTN_EVENT_CLICK);
+	}
+	else
+	{
+		/* Do Nothing */
+	}
+}
+
+/**
+* @brief Function to register a button with its port debouncer, sets up the tick timer with the first
+*        button and starts it to sample the new pin
+*
+* @param ptr_st_btn_config            : pointer to the desired button structure
+* @param bool_active_low              : TRUE if the pressed level is low
+*
+* @return BTN_STATUS_OK                : When the operation is successful
+*         BTN_STATUS_INVALID_STATE     : Invalid port or pin, or the tick timer couldn't be started
+*         BTN_STATUS_NO_INSTANCE       : The pin is already owned by another button structure
+*/
+static en_btn_status_code_t_ btn_register(st_btn_config_t_* ptr_st_btn_config, boolean bool_active_low)
+{
+	en_btn_status_code_t_ lo_en_btn_status = BTN_STATUS_OK;
+	en_btn_port_t_ lo_en_port = ptr_st_btn_config->en_btn_port;
+	en_btn_pin_t_ lo_en_pin = ptr_st_btn_config->en_btn_pin;
+	st_btn_port_t* lo_ptr_st_port;
+	uint8_t_ lo_u8_mask;
+	uint8_t_ lo_u8_raw = 0;
+	uint32_t_ lo_u32_holdoff_ticks;
+	st_timer_cfg_t lo_st_timer_cfg = {
+		.en_timer		= BTN_TICK_TIMER,
+		.u32_period_us	= BTN_TICK_MS * BTN_US_PER_MS,
+		.ptr_cbf		= btn_tick
+	};
+
+	if((BTN_PORT_TOTAL <= lo_en_port) || (BTN_PIN_TOTAL <= lo_en_pin))
+	{
+		lo_en_btn_status = BTN_STATUS_INVALID_STATE;
+	}
+	else if(
+			(NULL_PTR != gl_arr_ptr_st_btn_map[lo_en_port][lo_en_pin]) &&
+			(ptr_st_btn_config != gl_arr_ptr_st_btn_map[lo_en_port][lo_en_pin])
+			)
+	{
+		lo_en_btn_status = BTN_STATUS_NO_INSTANCE;
+	}
+	else if(
+			(FALSE == gl_bool_btn_tick_init) &&
+			(TIMER_OK != timer_init_periodic(&lo_st_timer_cfg))
+			)
+	{
+		/* nothing registered yet, a later btn_init retries the timer */
+		lo_en_btn_status = BTN_STATUS_INVALID_STATE;
+	}
+	else
+	{
+		gl_bool_btn_tick_init = TRUE;
+		lo_ptr_st_port = &gl_arr_st_btn_ports[lo_en_port];
+		lo_u8_mask = (1 << lo_en_pin);
+		gl_arr_ptr_st_btn_map[lo_en_port][lo_en_pin] = ptr_st_btn_config;
+
+		if(TRUE == bool_active_low)
+		{
+			lo_ptr_st_port->u8_polarity |= lo_u8_mask;
+		}
+		else
+		{
+			lo_ptr_st_port->u8_polarity &= ~lo_u8_mask;
+		}
+
+		/* Seed with the current level, no edge at start up */
+		gpio_getPortVal((en_gpio_port_t) lo_en_port, &lo_u8_raw);
+		lo_ptr_st_port->u8_cnt0 &= ~lo_u8_mask;
+		lo_ptr_st_port->u8_cnt1 &= ~lo_u8_mask;
+		lo_ptr_st_port->u8_state = (lo_ptr_st_port->u8_state & ~lo_u8_mask) |
+									((lo_u8_raw ^ lo_ptr_st_port->u8_polarity) & lo_u8_mask);
+		lo_ptr_st_port->u8_reported = (lo_ptr_st_port->u8_reported & ~lo_u8_mask) |
+									(lo_ptr_st_port->u8_state & lo_u8_mask);
+		lo_ptr_st_port->u8_pins |= lo_u8_mask;
+		gl_u8_btn_ports_used |= (1 << lo_en_port);
+
+		ptr_st_btn_config->en_btn_state = (en_btn_state_t_) GET_BIT(lo_ptr_st_port->u8_state, lo_en_pin);
+		ptr_st_btn_config->u8_btn_press_seen = ptr_st_btn_config->u8_btn_press_count;
+		ptr_st_btn_config->u8_btn_release_seen = ptr_st_btn_config->u8_btn_release_count;
+		ptr_st_btn_config->u8_btn_clicks = 0;
+		ptr_st_btn_config->bool_btn_long_sent = FALSE;
+		lo_ptr_st_port->u8_clicks &= ~lo_u8_mask;
+		ptr_st_btn_config->u32_btn_suppressed = 0;
+
+		/* the port holds off for its longest button holdoff, rounded up to whole ticks */
+		lo_u32_holdoff_ticks = (ptr_st_btn_config->u16_btn_holdoff_ms + BTN_TICK_MS - 1) / BTN_TICK_MS;
+		if(BTN_HOLDOFF_TICKS_MAX < lo_u32_holdoff_ticks)
+		{
+			lo_u32_holdoff_ticks = BTN_HOLDOFF_TICKS_MAX;
+		}
+		if(lo_ptr_st_port->u8_holdoff_ticks < lo_u32_holdoff_ticks)
+		{
+			lo_ptr_st_port->u8_holdoff_ticks = (uint8_t_) lo_u32_holdoff_ticks;
+		}
+
+		/* Any edge wakes the port debouncer */
+		gpio_setIntSense((en_gpio_port_t) lo_en_port, (en_gpio_pin_t) lo_en_pin, BOTH_EDGES);
+		gpio_setIntCallback((en_gpio_port_t) lo_en_port, (en_gpio_pin_t) lo_en_pin, gl_arr_btn_edge_cbf[lo_en_port]);
+		gpio_enableInt((en_gpio_port_t) lo_en_port, (en_gpio_pin_t) lo_en_pin);
+		gl_arr_bool_btn_port_active[lo_en_port] = TRUE;
+
+		/* sample the new pin until it settles */
+		if(FALSE == gl_bool_btn_tick_running)
+		{
+			if(TIMER_OK == timer_start(BTN_TICK_TIMER))
+			{
+				gl_bool_btn_tick_running = TRUE;
+			}
+			else
+			{
+				lo_en_btn_status = BTN_STATUS_INVALID_STATE;
+			}
+		}
+	}
+
+	return lo_en_btn_status;
+}
 
 /*---------------------------------------------------------/
 /- FUNCTION IMPLEMENTATION
@@ -27,22 +467,20 @@
 * @param ptr_st_btn_config            : pointer to the desired button structure
 *
 * @return BTN_STATUS_OK 	            : When the operation is successful
-*         BTN_STATUS_INVALID_STATE		: Button structure pointer is a NULL_PTR
+*         BTN_STATUS_INVALID_STATE		: Button structure pointer is a NULL_PTR, invalid port or pin, or the
+*                                        pin or the tick timer couldn't be configured
 *         BTN_STATUS_INVALID_PULL_TYPE : If the pull type field in button structure is set to invalid value
+*         BTN_STATUS_NO_INSTANCE       : The pin is already owned by another button structure
 */
 en_btn_status_code_t_ btn_init(st_btn_config_t_* ptr_st_btn_config)
 {
 	en_btn_status_code_t_ lo_en_btn_status = BTN_STATUS_OK;
 	st_gpio_cfg_t btn_pin_cfg;
-	st_systick_cfg_t lo_stk_cfg;
 	
 	if (NULL_PTR != ptr_st_btn_config)
 	{
 		btn_pin_cfg.port = (en_gpio_port_t) ptr_st_btn_config->en_btn_port;
 		btn_pin_cfg.pin  = (en_gpio_pin_t)  ptr_st_btn_config->en_btn_pin;
-		
-		lo_stk_cfg.bool_systick_int_enabled = FALSE;
-		lo_stk_cfg.en_systick_clk_src = CLK_SRC_PIOSC;
 
 		switch (ptr_st_btn_config->en_btn_pull_type)
 		{
@@ -56,13 +494,23 @@ en_btn_status_code_t_ btn_init(st_btn_config_t_* ptr_st_btn_config)
 			default : lo_en_btn_status = BTN_STATUS_INVALID_PULL_TYPE;
 		}
 		
-		/* Initialize the button pin */
-		gpio_pin_init(&btn_pin_cfg);
-		
-		systick_init(&lo_stk_cfg);
-		
-		/* Set the button state */
-		ptr_st_btn_config->en_btn_activation = BTN_ACTIVATED;
+		if(BTN_STATUS_OK == lo_en_btn_status)
+		{
+			/* Initialize the button pin */
+			if(GPIO_OK != gpio_pin_init(&btn_pin_cfg))
+			{
+				lo_en_btn_status = BTN_STATUS_INVALID_STATE;
+			}
+			else
+			{
+				lo_en_btn_status = btn_register(ptr_st_btn_config,
+												(BTN_INTERNAL_PULL_UP == ptr_st_btn_config->en_btn_pull_type) ||
+												(BTN_EXTERNAL_PULL_UP == ptr_st_btn_config->en_btn_pull_type));
+			}
+
+			/* Set the button state, a button that failed to register stays deactivated */
+			ptr_st_btn_config->en_btn_activation = (BTN_STATUS_OK == lo_en_btn_status) ? BTN_ACTIVATED : BTN_DEACTIVATED;
+		}
 	}
 	else
 	{
@@ -92,52 +540,164 @@ en_btn_status_code_t_ btn_disable(st_btn_config_t_* ptr_st_btn_config)
 }
 
 /**
-* @brief Function to read the current button state
+* @brief Function to release a button's pin: the pin edge interrupt is disabled, the pin leaves its
+*        port debouncer and another button structure can own it
+*
+* @param ptr_st_btn_config            : pointer to the desired button structure
+*
+* @return BTN_STATUS_OK                : When the operation is successful
+*         BTN_STATUS_INVALID_STATE     : Button structure pointer is a NULL_PTR, invalid port or pin
+*         BTN_STATUS_NO_INSTANCE       : The pin isn't owned by this button structure
+*/
+en_btn_status_code_t_ btn_deinit(st_btn_config_t_* ptr_st_btn_config)
+{
+	en_btn_status_code_t_ lo_en_btn_status = BTN_STATUS_OK;
+	st_btn_port_t* lo_ptr_st_port;
+	boolean lo_bool_irq_masked;
+	uint8_t_ lo_u8_mask;
+	uint8_t_ lo_u8_pin;
+	uint32_t_ lo_u32_holdoff_ticks;
+
+	if(
+		(NULL_PTR == ptr_st_btn_config) ||
+		(BTN_PORT_TOTAL <= ptr_st_btn_config->en_btn_port) ||
+		(BTN_PIN_TOTAL <= ptr_st_btn_config->en_btn_pin)
+		)
+	{
+		lo_en_btn_status = BTN_STATUS_INVALID_STATE;
+	}
+	else if(ptr_st_btn_config != gl_arr_ptr_st_btn_map[ptr_st_btn_config->en_btn_port][ptr_st_btn_config->en_btn_pin])
+	{
+		lo_en_btn_status = BTN_STATUS_NO_INSTANCE;
+	}
+	else
+	{
+		lo_ptr_st_port = &gl_arr_st_btn_ports[ptr_st_btn_config->en_btn_port];
+		lo_u8_mask = (1 << ptr_st_btn_config->en_btn_pin);
+
+		gpio_disableInt((en_gpio_port_t) ptr_st_btn_config->en_btn_port, (en_gpio_pin_t) ptr_st_btn_config->en_btn_pin);
+
+		/* the tick and the edge handler see the pin leave in one step */
+		lo_bool_irq_masked = cpu_irq_save();
+
+		gl_arr_ptr_st_btn_map[ptr_st_btn_config->en_btn_port][ptr_st_btn_config->en_btn_pin] = NULL_PTR;
+		lo_ptr_st_port->u8_pins &= ~lo_u8_mask;
+		lo_ptr_st_port->u8_masked &= ~lo_u8_mask;
+		lo_ptr_st_port->u8_cnt0 &= ~lo_u8_mask;
+		lo_ptr_st_port->u8_cnt1 &= ~lo_u8_mask;
+		lo_ptr_st_port->u8_state &= ~lo_u8_mask;
+		lo_ptr_st_port->u8_reported &= ~lo_u8_mask;
+		lo_ptr_st_port->u8_clicks &= ~lo_u8_mask;
+
+		/* the port holds off for the longest holdoff of the buttons left */
+		lo_ptr_st_port->u8_holdoff_ticks = 0;
+		for(lo_u8_pin = 0; lo_u8_pin < BTN_PIN_TOTAL; lo_u8_pin++)
+		{
+			if(GET_BIT(lo_ptr_st_port->u8_pins, lo_u8_pin))
+			{
+				lo_u32_holdoff_ticks = (gl_arr_ptr_st_btn_map[ptr_st_btn_config->en_btn_port][lo_u8_pin]->u16_btn_holdoff_ms
+										+ BTN_TICK_MS - 1) / BTN_TICK_MS;
+				if(BTN_HOLDOFF_TICKS_MAX < lo_u32_holdoff_ticks)
+				{
+					lo_u32_holdoff_ticks = BTN_HOLDOFF_TICKS_MAX;
+				}
+				if(lo_ptr_st_port->u8_holdoff_ticks < lo_u32_holdoff_ticks)
+				{
+					lo_ptr_st_port->u8_holdoff_ticks = (uint8_t_) lo_u32_holdoff_ticks;
+				}
+			}
+			else
+			{
+				/* Do Nothing */
+			}
+		}
+
+		if(0 == lo_ptr_st_port->u8_pins)
+		{
+			gl_u8_btn_ports_used &= ~(1 << ptr_st_btn_config->en_btn_port);
+			gl_arr_bool_btn_port_active[ptr_st_btn_config->en_btn_port] = FALSE;
+		}
+		else
+		{
+			/* Do Nothing */
+		}
+
+		cpu_irq_restore(lo_bool_irq_masked);
+
+		ptr_st_btn_config->en_btn_activation = BTN_DEACTIVATED;
+		ptr_st_btn_config->en_btn_state = BTN_STATE_NOT_PRESSED;
+	}
+
+	return lo_en_btn_status;
+}
+
+/**
+* @brief Function to read the debounced button state, never blocks
 *
 * @param ptr_st_btn_config            : pointer to the desired button structure
 * @param ptr_en_btn_state             : pointer to variable to store the button state
 *
 * @return BTN_STATUS_OK                : When the operation is successful
 *         BTN_STATUS_INVALID_STATE     : Button structure and/or button state pointers are NULL_PTRs
-*         BTN_STATUS_INVALID_PULL_TYPE : If the pull type field in button structure is set to invalid value
 *		  BTN_STATUS_DEACTIVATED	   : If we are trying to read from a deactivated button
 */
 en_btn_status_code_t_ btn_read(st_btn_config_t_* ptr_st_btn_config, en_btn_state_t_* ptr_en_btn_state)
 {
 	en_btn_status_code_t_ lo_en_btn_status = BTN_STATUS_OK;
-	en_gpio_pin_level_t lo_en_btn_val;
 
 	if((ptr_st_btn_config != NULL_PTR) && (ptr_en_btn_state != NULL_PTR))
 	{
 		if(BTN_ACTIVATED == ptr_st_btn_config->en_btn_activation)
 		{
-			gpio_getPinVal((en_gpio_port_t) ptr_st_btn_config->en_btn_port,
-										(en_gpio_pin_t)  ptr_st_btn_config->en_btn_pin ,
-											&lo_en_btn_val);
-	
-			switch (ptr_st_btn_config->en_btn_pull_type)
+			*ptr_en_btn_state = ptr_st_btn_config->en_btn_state;
+		}
+		else
+		{
+			lo_en_btn_status = BTN_STATUS_DEACTIVATED;
+		}
+	}
+	else
+	{
+		lo_en_btn_status = BTN_STATUS_INVALID_STATE;
+	}
+
+	return lo_en_btn_status;
+}
+
+/**
+* @brief Function to read and consume the debounced edges since the last call, never blocks
+*
+* @param ptr_st_btn_config            : pointer to the desired button structure
+* @param ptr_u8_btn_edges             : pointer to variable to store the en_btn_edge_t_ flags
+*
+* @return BTN_STATUS_OK                : When the operation is successful
+*         BTN_STATUS_INVALID_STATE     : Button structure and/or edges pointers are NULL_PTRs
+*		  BTN_STATUS_DEACTIVATED	   : If we are trying to read from a deactivated button
+*/
+en_btn_status_code_t_ btn_read_edges(st_btn_config_t_* ptr_st_btn_config, uint8_t_* ptr_u8_btn_edges)
+{
+	en_btn_status_code_t_ lo_en_btn_status = BTN_STATUS_OK;
+	uint8_t_ lo_u8_count;
+
+	if((ptr_st_btn_config != NULL_PTR) && (ptr_u8_btn_edges != NULL_PTR))
+	{
+		if(BTN_ACTIVATED == ptr_st_btn_config->en_btn_activation)
+		{
+			*ptr_u8_btn_edges = BTN_EDGE_NONE;
+
+			/* counters are only written by the tick, seen copies only here: no lock needed */
+			lo_u8_count = ptr_st_btn_config->u8_btn_press_count;
+			if(lo_u8_count != ptr_st_btn_config->u8_btn_press_seen)
 			{
-				case BTN_INTERNAL_PULL_UP:
-				case BTN_EXTERNAL_PULL_UP:
-				{
-					*ptr_en_btn_state = (en_btn_state_t_)(!lo_en_btn_val);
-					if(BTN_STATE_PRESSED == *ptr_en_btn_state)
-					{
-						systick_ms_delay(BTN_DEBOUNCE_DELAY);
-					}
-					break;
-				}
-				case BTN_INTERNAL_PULL_DOWN:
-				case BTN_EXTERNAL_PULL_DOWN:
-				{
-					*ptr_en_btn_state = (en_btn_state_t_)lo_en_btn_val;
-					if(BTN_STATE_PRESSED == *ptr_en_btn_state)
-					{
-						systick_ms_delay(BTN_DEBOUNCE_DELAY);
-					}
-					break;
-				}				
-				default : lo_en_btn_status = BTN_STATUS_INVALID_PULL_TYPE;
+				ptr_st_btn_config->u8_btn_press_seen = lo_u8_count;
+				*ptr_u8_btn_edges |= BTN_EDGE_PRESS;
+			}
+
+			lo_u8_count = ptr_st_btn_config->u8_btn_release_count;
+			if(lo_u8_count != ptr_st_btn_config->u8_btn_release_seen)
+			{
+				ptr_st_btn_config->u8_btn_release_seen = lo_u8_count;
+				*ptr_u8_btn_edges |= BTN_EDGE_RELEASE;
 			}
 		}
 		else
@@ -153,3 +713,270 @@ en_btn_status_code_t_ btn_read(st_btn_config_t_* ptr_st_btn_config, en_btn_state
 	return lo_en_btn_status;
 }
 
+/**
+* @brief Function to read the debounced state of every button on a port, never blocks
+*
+* @param en_btn_port                  : port to read
+* @param ptr_u8_pressed               : pointer to variable to store the pressed pins mask
+* @param ptr_u8_changed               : pointer to variable to store the pins changed since the last call
+*
+* @return BTN_STATUS_OK                : When the operation is successful
+*         BTN_STATUS_INVALID_STATE     : Invalid port and/or NULL_PTRs
+*/
+en_btn_status_code_t_ btn_read_port(en_btn_port_t_ en_btn_port, uint8_t_* ptr_u8_pressed, uint8_t_* ptr_u8_changed)
+{
+	en_btn_status_code_t_ lo_en_btn_status = BTN_STATUS_OK;
+	uint8_t_ lo_u8_state;
+
+	if((en_btn_port < BTN_PORT_TOTAL) && (ptr_u8_pressed != NULL_PTR) && (ptr_u8_changed != NULL_PTR))
+	{
+		/* state is only written by the tick, reported copy only here: no lock needed */
+		lo_u8_state = gl_arr_st_btn_ports[en_btn_port].u8_state;
+
+		*ptr_u8_pressed = lo_u8_state;
+		*ptr_u8_changed = lo_u8_state ^ gl_arr_st_btn_ports[en_btn_port].u8_reported;
+
+		gl_arr_st_btn_ports[en_btn_port].u8_reported = lo_u8_state;
+	}
+	else
+	{
+		lo_en_btn_status = BTN_STATUS_INVALID_STATE;
+	}
+
+	return lo_en_btn_status;
+}
+
+/**
+* @brief Function to sample every initialized button at once, never blocks
+*
+* One GPIODATA read per port with buttons, the pressed level of every pin is applied
+* by a precomputed XOR mask. Instant (not debounced) levels, see btn_read_port for the
+* debounced state
+*
+* @param ptr_u64_pressed              : pointer to variable to store the bitmap, BTN_ALL_BIT(port, pin) set if pressed
+*
+* @return BTN_STATUS_OK                : When the operation is successful
+*         BTN_STATUS_INVALID_STATE     : NULL_PTR
+*/
+en_btn_status_code_t_ btn_read_all(uint64_t_* ptr_u64_pressed)
+{
+	en_btn_status_code_t_ lo_en_btn_status = BTN_STATUS_OK;
+	uint8_t_ lo_u8_ports = gl_u8_btn_ports_used;
+	uint8_t_ lo_u8_port;
+	uint8_t_ lo_u8_raw = 0;
+	uint64_t_ lo_u64_pressed = 0;
+
+	if(ptr_u64_pressed != NULL_PTR)
+	{
+		for(lo_u8_port = 0; (0 != lo_u8_ports) && (lo_u8_port < BTN_PORT_TOTAL); lo_u8_port++)
+		{
+			if(GET_BIT(lo_u8_ports, lo_u8_port))
+			{
+				CLR_BIT(lo_u8_ports, lo_u8_port);
+
+				gpio_getPortVal((en_gpio_port_t) lo_u8_port, &lo_u8_raw);
+				lo_u64_pressed |= ((uint64_t_)((lo_u8_raw ^ gl_arr_st_btn_ports[lo_u8_port].u8_polarity) &
+											   gl_arr_st_btn_ports[lo_u8_port].u8_pins))
+								  << (lo_u8_port * BTN_PIN_TOTAL);
+			}
+		}
+
+		*ptr_u64_pressed = lo_u64_pressed;
+	}
+	else
+	{
+		lo_en_btn_status = BTN_STATUS_INVALID_STATE;
+	}
+
+	return lo_en_btn_status;
+}
+
+/**
+* @brief Function to read the edges suppressed by the interrupt holdoff of a button
+*
+* The pin interrupt is masked during the holdoff, the hardware only latches that an edge
+* happened: the count is the number of holdoff ticks with at least one edge
+*
+* @param ptr_st_btn_config            : pointer to the desired button structure
+* @param ptr_u32_suppressed           : pointer to variable to store the count
+*
+* @return BTN_STATUS_OK                : When the operation is successful
+*         BTN_STATUS_INVALID_STATE     : NULL_PTRs
+*/
+en_btn_status_code_t_ btn_read_suppressed(st_btn_config_t_* ptr_st_btn_config, uint32_t_* ptr_u32_suppressed)
+{
+	en_btn_status_code_t_ lo_en_btn_status = BTN_STATUS_OK;
+
+	if((ptr_st_btn_config != NULL_PTR) && (ptr_u32_suppressed != NULL_PTR))
+	{
+		*ptr_u32_suppressed = ptr_st_btn_config->u32_btn_suppressed;
+	}
+	else
+	{
+		lo_en_btn_status = BTN_STATUS_INVALID_STATE;
+	}
+
+	return lo_en_btn_status;
+}
+
+/**
+* @brief Function to take the oldest event from the button event queue, never blocks
+*
+* @param ptr_st_btn_event             : pointer to variable to store the event
+*
+* @return BTN_STATUS_OK                : When an event was taken
+*         BTN_STATUS_INVALID_STATE     : NULL_PTR or the queue is empty
+*/
+en_btn_status_code_t_ btn_event_get(st_btn_event_t_* ptr_st_btn_event)
+{
+	en_btn_status_code_t_ lo_en_btn_status = BTN_STATUS_OK;
+	uint8_t_ lo_u8_tail = gl_u8_btn_events_tail;
+
+	if((NULL_PTR == ptr_st_btn_event) || (lo_u8_tail == gl_u8_btn_events_head))
+	{
+		lo_en_btn_status = BTN_STATUS_INVALID_STATE;
+	}
+	else
+	{
+		*ptr_st_btn_event = gl_arr_st_btn_events[lo_u8_tail & BTN_EVENT_QUEUE_MASK];
+
+		/* release the slot after it is copied */
+		gl_u8_btn_events_tail = lo_u8_tail + 1;
+	}
+
+	return lo_en_btn_status;
+}
+
+/**
+* @brief Function to check for queued events without taking one
+*
+* @return TRUE                         : At least one event is queued
+*         FALSE                        : The queue is empty
+*/
+boolean btn_event_pending(void)
+{
+	return (gl_u8_btn_events_tail != gl_u8_btn_events_head);
+}
+
+/**
+* @brief Function to read the number of events dropped because the event queue was full
+*
+* @return dropped events since start up
+*/
+uint32_t_ btn_event_dropped(void)
+{
+	return gl_u32_btn_events_dropped;
+}
+
+/**
+* @brief Function to advance the debouncer of every port with button activity by one sample
+*        and generate the timed events, called every BTN_TICK_MS from the button tick timer
+*
+*        Each pin has a 2-bit counter spread over u8_cnt0/u8_cnt1 (vertical counter), so one
+*        GPIODATA read and a few bitwise operations debounce all 8 pins of a port at once.
+*        A counter runs while the sample differs from the debounced state and resets when it
+*        agrees, the state toggles on the BTN_DEBOUNCE_SAMPLES-th differing sample.
+*        A port is only sampled after a pin edge interrupt and until it settles released,
+*        its edge interrupts stay masked for the holdoff after every edge. Once every port
+*        settled the tick timer stops, the next edge restarts it.
+*/
+void btn_tick(void)
+{
+	st_btn_port_t* lo_ptr_st_port;
+	uint8_t_ lo_u8_port;
+	uint8_t_ lo_u8_pin;
+	uint8_t_ lo_u8_raw = 0;
+	uint8_t_ lo_u8_delta;
+	uint8_t_ lo_u8_toggle;
+	uint8_t_ lo_u8_timed;
+	boolean lo_bool_irq_masked;
+
+	gl_u32_btn_time_ms += BTN_TICK_MS;
+
+	for(lo_u8_port = 0; lo_u8_port < BTN_PORT_TOTAL; lo_u8_port++)
+	{
+		lo_ptr_st_port = &gl_arr_st_btn_ports[lo_u8_port];
+
+		if(0 != lo_ptr_st_port->u8_masked)
+		{
+			btn_holdoff((en_btn_port_t_) lo_u8_port);
+		}
+
+		if((0 != lo_ptr_st_port->u8_pins) && (TRUE == gl_arr_bool_btn_port_active[lo_u8_port]))
+		{
+			gpio_getPortVal((en_gpio_port_t) lo_u8_port, &lo_u8_raw);
+
+			/* 1: sample differs from the debounced state */
+			lo_u8_delta = ((lo_u8_raw ^ lo_ptr_st_port->u8_polarity) & lo_ptr_st_port->u8_pins) ^ lo_ptr_st_port->u8_state;
+
+			lo_ptr_st_port->u8_cnt1 = (lo_ptr_st_port->u8_cnt1 ^ lo_ptr_st_port->u8_cnt0) & lo_u8_delta;
+			lo_ptr_st_port->u8_cnt0 = (uint8_t_)(~lo_ptr_st_port->u8_cnt0) & lo_u8_delta;
+
+			/* counter wrapped to 0 while still differing */
+			lo_u8_toggle = lo_u8_delta & (uint8_t_)(~(lo_ptr_st_port->u8_cnt0 | lo_ptr_st_port->u8_cnt1));
+
+			/* timed events of held buttons and open multi-click windows, before this tick's edges */
+			lo_u8_timed = lo_ptr_st_port->u8_state | lo_ptr_st_port->u8_clicks;
+			for(lo_u8_pin = 0; (0 != lo_u8_timed) && (lo_u8_pin < BTN_PIN_TOTAL); lo_u8_pin++)
+			{
+				if(GET_BIT(lo_u8_timed, lo_u8_pin))
+				{
+					CLR_BIT(lo_u8_timed, lo_u8_pin);
+					btn_on_hold(lo_ptr_st_port, gl_arr_ptr_st_btn_map[lo_u8_port][lo_u8_pin], (1 << lo_u8_pin));
+				}
+			}
+
+			lo_ptr_st_port->u8_state ^= lo_u8_toggle;
+
+#if LATENCY_INSTRUMENTATION
+			if(0 != lo_u8_toggle)
+			{
+				/* the next raw edge starts a new measurement */
+				lo_ptr_st_port->bool_edge_stamped = FALSE;
+			}
+#endif
+
+			/* per-button bookkeeping only for the pins that changed */
+			for(lo_u8_pin = 0; (0 != lo_u8_toggle) && (lo_u8_pin < BTN_PIN_TOTAL); lo_u8_pin++)
+			{
+				if(GET_BIT(lo_u8_toggle, lo_u8_pin))
+				{
+					CLR_BIT(lo_u8_toggle, lo_u8_pin);
+					btn_on_edge(lo_ptr_st_port, gl_arr_ptr_st_btn_map[lo_u8_port][lo_u8_pin], (1 << lo_u8_pin));
+				}
+			}
+
+			if(0 == (lo_u8_delta | lo_ptr_st_port->u8_state | lo_ptr_st_port->u8_clicks))
+			{
+				/* settled and released: sleep until the next edge, re-check for an edge lost in between */
+				gl_arr_bool_btn_port_active[lo_u8_port] = FALSE;
+
+				gpio_getPortVal((en_gpio_port_t) lo_u8_port, &lo_u8_raw);
+				if(0 != (((lo_u8_raw ^ lo_ptr_st_port->u8_polarity) & lo_ptr_st_port->u8_pins) ^ lo_ptr_st_port->u8_state))
+				{
+					gl_arr_bool_btn_port_active[lo_u8_port] = TRUE;
+				}
+			}
+		}
+	}
+
+	/* every port settled and re-armed: stop ticking until the next edge, which can't come
+	   between the check and the stop */
+	lo_bool_irq_masked = cpu_irq_save();
+
+	for(lo_u8_port = 0;
+		(lo_u8_port < BTN_PORT_TOTAL) &&
+		(FALSE == gl_arr_bool_btn_port_active[lo_u8_port]) &&
+		(0 == gl_arr_st_btn_ports[lo_u8_port].u8_masked);
+		lo_u8_port++)
+	{
+	}
+
+	if((BTN_PORT_TOTAL == lo_u8_port) && (TRUE == gl_bool_btn_tick_running))
+	{
+		timer_stop(BTN_TICK_TIMER);
+		gl_bool_btn_tick_running = FALSE;
+	}
+
+	cpu_irq_restore(lo_bool_irq_masked);
+}
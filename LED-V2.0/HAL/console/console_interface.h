@@ -0,0 +1,118 @@
+/**
+ * @file    :   console_interface.h
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Header File contains all UART command console typedefs and functions' prototypes
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Text commands over UART0: a command ends with CR/LF or when the line stays idle for
+ * CONSOLE_IDLE_MS (scripts may send commands without a line end). The line is split on
+ * spaces and dispatched to the handler of the matching entry in the user's command table,
+ * "help" lists the table. console_poll is called from the main loop and never waits,
+ * output is queued in the UART TX ring (truncated when it is full).
+ */
+
+#ifndef CONSOLE_INTERFACE_H_
+#define CONSOLE_INTERFACE_H_
+
+#include "std.h"
+
+/*----------------------------------------------------------/
+/- MACROS
+/----------------------------------------------------------*/
+#define CONSOLE_LINE_MAX        64      /* characters per command */
+#define CONSOLE_ARGS_MAX        6       /* words per command, command name included */
+#define CONSOLE_IDLE_MS         5       /* idle line ends a command */
+
+/*----------------------------------------------------------/
+/- ENUMS
+/----------------------------------------------------------*/
+typedef enum
+{
+    CONSOLE_OK              = 0 ,
+    CONSOLE_ERROR               ,
+}en_console_error_t_;
+
+/*----------------------------------------------------------/
+/- STRUCTS
+/----------------------------------------------------------*/
+/**
+ * Command handler, ptr_str_argv[0] is the command name.
+ * Returns CONSOLE_ERROR on bad arguments, the console then prints the command's usage.
+ */
+typedef en_console_error_t_ (*console_handler_t_)(uint8_t_ u8_argc, char * ptr_str_argv[]);
+
+typedef struct
+{
+    const char *            ptr_str_name    ;
+    const char *            ptr_str_usage   ; /* arguments and description, shown by help */
+    console_handler_t_      ptr_handler     ;
+}st_console_cmd_t_;
+
+typedef struct
+{
+    uint32_t_               u32_baud_rate   ;
+    const st_console_cmd_t_ * ptr_st_cmds   ; /* command table (must stay valid) */
+    uint8_t_                u8_cmds_count   ;
+}st_console_cfg_t_;
+
+/*---------------------------------------------------------/
+/- FUNCTION PROTOTYPES
+/---------------------------------------------------------*/
+
+/**
+ * @brief                       :   Initializes UART0 for the console and prints the prompt
+ *
+ * @param[in]   ptr_st_cfg      :   Pointer to console configuration (must stay valid)
+ *
+ * @return  CONSOLE_OK          :   In case of Successful Operation
+ *          CONSOLE_ERROR       :   In case of invalid configuration or UART failure
+ */
+en_console_error_t_ console_init(const st_console_cfg_t_ * ptr_st_cfg);
+
+/**
+ * @brief                       :   Takes received characters and runs a completed command, never waits
+ *
+ * @param[in]   u32_now_ms      :   Current time, for the idle line timeout
+ *
+ * @return  TRUE                :   A command was run
+ *          FALSE               :   Nothing to run yet
+ */
+boolean console_poll(uint32_t_ u32_now_ms);
+
+/**
+ * @brief                       :   Queues a string for output
+ *
+ * @param[in]   ptr_str         :   NUL terminated string
+ */
+void console_print(const char * ptr_str);
+
+/**
+ * @brief                       :   Queues a decimal number for output
+ *
+ * @param[in]   u32_value       :   Number
+ */
+void console_print_u32(uint32_t_ u32_value);
+
+/**
+ * @brief                       :   Queues "name value" and a line end, for counter dumps
+ *
+ * @param[in]   ptr_str_name    :   NUL terminated name
+ * @param[in]   u32_value       :   Value
+ */
+void console_print_value(const char * ptr_str_name, uint32_t_ u32_value);
+
+/**
+ * @brief                       :   Parses a decimal argument
+ *
+ * @param[in]   ptr_str         :   NUL terminated argument
+ * @param[out]  ptr_u32_value   :   Pointer to store the number in
+ *
+ * @return  CONSOLE_OK          :   In case of Successful Operation
+ *          CONSOLE_ERROR       :   Not a number, empty or out of range
+ */
+en_console_error_t_ console_parse_u32(const char * ptr_str, uint32_t_ * ptr_u32_value);
+
+#endif /* CONSOLE_INTERFACE_H_ */
@@ -0,0 +1,362 @@
+/**
+ * @file    :   console_program.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Program File contains all UART command console functions' implementation
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "console_interface.h"
+
+// private includes
+#include "uart_interface.h"
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define CONSOLE_PROMPT              "> "
+#define CONSOLE_NEWLINE             "\r\n"
+#define CONSOLE_U32_DIGITS          10
+#define CONSOLE_DECIMAL             10
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+static const st_console_cfg_t_ * gl_ptr_st_console_cfg = NULL_PTR;
+
+static char gl_arr_c_console_line[CONSOLE_LINE_MAX + 1];
+static uint8_t_ gl_u8_console_length = 0;
+static boolean gl_bool_console_overflow = FALSE;    // line too long, dropped up to its end
+static uint32_t_ gl_u32_console_last_rx_ms = 0;
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Queues the help text: every command with its usage
+ */
+static void console_help(void)
+{
+    uint8_t_ u8_cmd;
+
+    console_print("help" CONSOLE_NEWLINE);
+    for(u8_cmd = 0; u8_cmd < gl_ptr_st_console_cfg->u8_cmds_count; u8_cmd++)
+    {
+        console_print(gl_ptr_st_console_cfg->ptr_st_cmds[u8_cmd].ptr_str_name);
+        console_print(" ");
+        console_print(gl_ptr_st_console_cfg->ptr_st_cmds[u8_cmd].ptr_str_usage);
+        console_print(CONSOLE_NEWLINE);
+    }
+}
+
+/**
+ * @brief                       :   Compares two NUL terminated strings
+ *
+ * @return  TRUE                :   Equal
+ *          FALSE               :   Different
+ */
+static boolean console_equal(const char * ptr_str_a, const char * ptr_str_b)
+{
+    while((*ptr_str_a == *ptr_str_b) && ('\0' != *ptr_str_a))
+    {
+        ptr_str_a++;
+        ptr_str_b++;
+    }
+
+    return (*ptr_str_a == *ptr_str_b);
+}
+
+/**
+ * @brief                       :   Splits the line on spaces and runs its command
+ */
+static void console_execute(void)
+{
+    char * arr_ptr_str_argv[CONSOLE_ARGS_MAX];
+    uint8_t_ u8_argc = 0;
+    uint8_t_ u8_index;
+    uint8_t_ u8_cmd;
+    boolean bool_word = FALSE;
+
+    gl_arr_c_console_line[gl_u8_console_length] = '\0';
+
+    for(u8_index = 0; u8_index < gl_u8_console_length; u8_index++)
+    {
+        if(' ' == gl_arr_c_console_line[u8_index])
+        {
+            gl_arr_c_console_line[u8_index] = '\0';
+            bool_word = FALSE;
+        }
+        else if(FALSE == bool_word)
+        {
+            bool_word = TRUE;
+            if(CONSOLE_ARGS_MAX > u8_argc)
+            {
+                arr_ptr_str_argv[u8_argc] = &gl_arr_c_console_line[u8_index];
+            }
+            u8_argc++;
+        }
+    }
+
+    if(ZERO == u8_argc)
+    {
+        /* empty line, prompt again */
+    }
+    else if(CONSOLE_ARGS_MAX < u8_argc)
+    {
+        console_print("too many arguments" CONSOLE_NEWLINE);
+    }
+    else if(TRUE == console_equal("help", arr_ptr_str_argv[0]))
+    {
+        console_help();
+    }
+    else
+    {
+        for(u8_cmd = 0; u8_cmd < gl_ptr_st_console_cfg->u8_cmds_count; u8_cmd++)
+        {
+            if(TRUE == console_equal(gl_ptr_st_console_cfg->ptr_st_cmds[u8_cmd].ptr_str_name, arr_ptr_str_argv[0]))
+            {
+                break;
+            }
+        }
+
+        if(gl_ptr_st_console_cfg->u8_cmds_count == u8_cmd)
+        {
+            console_print("unknown command, try help" CONSOLE_NEWLINE);
+        }
+        else if(CONSOLE_OK != gl_ptr_st_console_cfg->ptr_st_cmds[u8_cmd].ptr_handler(u8_argc, arr_ptr_str_argv))
+        {
+            console_print("usage: ");
+            console_print(gl_ptr_st_console_cfg->ptr_st_cmds[u8_cmd].ptr_str_name);
+            console_print(" ");
+            console_print(gl_ptr_st_console_cfg->ptr_st_cmds[u8_cmd].ptr_str_usage);
+            console_print(CONSOLE_NEWLINE);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    console_print(CONSOLE_PROMPT);
+    gl_u8_console_length = 0;
+}
+
+/*---------------------------------------------------------/
+/- FUNCTION IMPLEMENTATION
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Initializes UART0 for the console and prints the prompt
+ *
+ * @param[in]   ptr_st_cfg      :   Pointer to console configuration (must stay valid)
+ *
+ * @return  CONSOLE_OK          :   In case of Successful Operation
+ *          CONSOLE_ERROR       :   In case of invalid configuration or UART failure
+ */
+en_console_error_t_ console_init(const st_console_cfg_t_ * ptr_st_cfg)
+{
+    en_console_error_t_ en_console_error_retval = CONSOLE_OK;
+
+    if(
+            (NULL_PTR == ptr_st_cfg)                                            ||
+            ((NULL_PTR == ptr_st_cfg->ptr_st_cmds) && (ZERO != ptr_st_cfg->u8_cmds_count))
+            )
+    {
+        en_console_error_retval = CONSOLE_ERROR;
+    }
+    else
+    {
+        st_uart_cfg_t st_uart_cfg = {
+            .u32_baud_rate = ptr_st_cfg->u32_baud_rate
+        };
+
+        if(UART_OK != uart_init(&st_uart_cfg))
+        {
+            en_console_error_retval = CONSOLE_ERROR;
+        }
+        else
+        {
+            gl_ptr_st_console_cfg = ptr_st_cfg;
+            gl_u8_console_length = 0;
+            gl_bool_console_overflow = FALSE;
+
+            console_print(CONSOLE_NEWLINE CONSOLE_PROMPT);
+        }
+    }
+
+    return en_console_error_retval;
+}
+
+/**
+ * @brief                       :   Takes received characters and runs a completed command, never waits
+ *
+ * @param[in]   u32_now_ms      :   Current time, for the idle line timeout
+ *
+ * @return  TRUE                :   A command was run
+ *          FALSE               :   Nothing to run yet
+ */
+boolean console_poll(uint32_t_ u32_now_ms)
+{
+    boolean bool_executed = FALSE;
+    uint8_t_ u8_char;
+
+    if(NULL_PTR != gl_ptr_st_console_cfg)
+    {
+        // one character at a time so nothing past a completed command is taken
+        while((FALSE == bool_executed) && (ZERO != uart_read(&u8_char, 1)))
+        {
+            gl_u32_console_last_rx_ms = u32_now_ms;
+
+            if(('\r' == u8_char) || ('\n' == u8_char))
+            {
+                if(TRUE == gl_bool_console_overflow)
+                {
+                    gl_bool_console_overflow = FALSE;
+                    gl_u8_console_length = 0;
+                    console_print("line too long" CONSOLE_NEWLINE CONSOLE_PROMPT);
+                }
+                else if(ZERO != gl_u8_console_length)
+                {
+                    console_execute();
+                    bool_executed = TRUE;
+                }
+                else
+                {
+                    /* second half of CR LF or empty line */
+                }
+            }
+            else if(CONSOLE_LINE_MAX <= gl_u8_console_length)
+            {
+                gl_bool_console_overflow = TRUE;
+            }
+            else
+            {
+                gl_arr_c_console_line[gl_u8_console_length++] = (char) u8_char;
+            }
+        }
+
+        // idle line ends a command sent without a line end
+        if(
+                (FALSE == bool_executed)                                            &&
+                ((ZERO != gl_u8_console_length) || (TRUE == gl_bool_console_overflow))  &&
+                (CONSOLE_IDLE_MS <= (u32_now_ms - gl_u32_console_last_rx_ms))
+                )
+        {
+            if(TRUE == gl_bool_console_overflow)
+            {
+                gl_bool_console_overflow = FALSE;
+                gl_u8_console_length = 0;
+                console_print("line too long" CONSOLE_NEWLINE CONSOLE_PROMPT);
+            }
+            else
+            {
+                console_print(CONSOLE_NEWLINE);
+                console_execute();
+                bool_executed = TRUE;
+            }
+        }
+    }
+
+    return bool_executed;
+}
+
+/**
+ * @brief                       :   Queues a string for output
+ *
+ * @param[in]   ptr_str         :   NUL terminated string
+ */
+void console_print(const char * ptr_str)
+{
+    uint16_t_ u16_length = 0;
+
+    if(NULL_PTR != ptr_str)
+    {
+        while('\0' != ptr_str[u16_length])
+        {
+            u16_length++;
+        }
+
+        uart_write((const uint8_t_ *) ptr_str, u16_length);
+    }
+}
+
+/**
+ * @brief                       :   Queues a decimal number for output
+ *
+ * @param[in]   u32_value       :   Number
+ */
+void console_print_u32(uint32_t_ u32_value)
+{
+    char arr_c_digits[CONSOLE_U32_DIGITS + 1];
+    uint8_t_ u8_first = CONSOLE_U32_DIGITS;
+
+    arr_c_digits[CONSOLE_U32_DIGITS] = '\0';
+
+    do
+    {
+        arr_c_digits[--u8_first] = (char)('0' + (u32_value % CONSOLE_DECIMAL));
+        u32_value /= CONSOLE_DECIMAL;
+    }
+    while(ZERO != u32_value);
+
+    console_print(&arr_c_digits[u8_first]);
+}
+
+/**
+ * @brief                       :   Queues "name value" and a line end, for counter dumps
+ *
+ * @param[in]   ptr_str_name    :   NUL terminated name
+ * @param[in]   u32_value       :   Value
+ */
+void console_print_value(const char * ptr_str_name, uint32_t_ u32_value)
+{
+    console_print(ptr_str_name);
+    console_print(" ");
+    console_print_u32(u32_value);
+    console_print(CONSOLE_NEWLINE);
+}
+
+/**
+ * @brief                       :   Parses a decimal argument
+ *
+ * @param[in]   ptr_str         :   NUL terminated argument
+ * @param[out]  ptr_u32_value   :   Pointer to store the number in
+ *
+ * @return  CONSOLE_OK          :   In case of Successful Operation
+ *          CONSOLE_ERROR       :   Not a number, empty or out of range
+ */
+en_console_error_t_ console_parse_u32(const char * ptr_str, uint32_t_ * ptr_u32_value)
+{
+    en_console_error_t_ en_console_error_retval = CONSOLE_OK;
+    uint32_t_ u32_value = 0;
+
+    if((NULL_PTR == ptr_str) || (NULL_PTR == ptr_u32_value) || ('\0' == *ptr_str))
+    {
+        en_console_error_retval = CONSOLE_ERROR;
+    }
+    else
+    {
+        for(; ('\0' != *ptr_str) && (CONSOLE_OK == en_console_error_retval); ptr_str++)
+        {
+            if(
+                    ('0' > *ptr_str) || ('9' < *ptr_str)                                    ||
+                    (((0xFFFFFFFFUL - (uint32_t_)(*ptr_str - '0')) / CONSOLE_DECIMAL) < u32_value)
+                    )
+            {
+                en_console_error_retval = CONSOLE_ERROR;
+            }
+            else
+            {
+                u32_value = (u32_value * CONSOLE_DECIMAL) + (uint32_t_)(*ptr_str - '0');
+            }
+        }
+
+        if(CONSOLE_OK == en_console_error_retval)
+        {
+            *ptr_u32_value = u32_value;
+        }
+    }
+
+    return en_console_error_retval;
+}
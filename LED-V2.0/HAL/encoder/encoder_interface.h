@@ -0,0 +1,88 @@
+/**
+ * @file    :   encoder_interface.h
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Header File contains all rotary quadrature encoder typedefs and functions' prototypes
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Decodes the A/B channels of a mechanical or optical quadrature encoder from BOTH_EDGES
+ * pin interrupts. Every edge reads both channels with one port read and looks the
+ * (previous, current) state pair up in a 16-entry transition table: +1, -1, 0 or invalid
+ * (both channels changed, a missed edge), invalid transitions are counted and not applied.
+ * Position counts every edge (4 counts per quadrature cycle), velocity is sampled from a timer.
+ */
+
+#ifndef ENCODER_INTERFACE_H_
+#define ENCODER_INTERFACE_H_
+
+#include "btn_interface.h"
+#include "timer_interface.h"
+
+/*----------------------------------------------------------/
+/- ENUMS
+/----------------------------------------------------------*/
+typedef enum
+{
+    ENCODER_OK              = 0 ,
+    ENCODER_ERROR               ,
+}en_encoder_error_t_;
+
+/*----------------------------------------------------------/
+/- STRUCTS
+/----------------------------------------------------------*/
+typedef struct
+{
+    en_btn_port_t_          en_port         ; /* both channels on one port */
+    en_btn_pin_t_           en_pin_a        ;
+    en_btn_pin_t_           en_pin_b        ;
+    en_btn_pull_t_          en_pull_type    ; /* common pin to ground: pull up */
+    en_timer_t              en_timer        ; /* velocity sampling time base */
+    uint16_t_               u16_sample_ms   ; /* velocity sampling period */
+}st_encoder_cfg_t_;
+
+/*---------------------------------------------------------/
+/- FUNCTION PROTOTYPES
+/---------------------------------------------------------*/
+
+/**
+ * @brief                       :   Initializes the channel pins and their edge interrupts,
+ *                                  starts the velocity timer, position starts at 0
+ *
+ * @param[in]   ptr_st_cfg      :   Pointer to encoder configuration (must stay valid)
+ *
+ * @return  ENCODER_OK          :   In case of Successful Operation
+ *          ENCODER_ERROR       :   In case of invalid configuration
+ */
+en_encoder_error_t_ encoder_init(const st_encoder_cfg_t_ * ptr_st_cfg);
+
+/**
+ * @brief                       :   Reads the position (counts, 4 per quadrature cycle)
+ *
+ * @return  position, positive: B leads A
+ */
+sint32_t_ encoder_get_position(void);
+
+/**
+ * @brief                       :   Overwrites the position, e.g. to rebase it to 0
+ *
+ * @param[in]   s32_position    :   New position
+ */
+void encoder_set_position(sint32_t_ s32_position);
+
+/**
+ * @brief                       :   Reads the velocity measured over the last sampling period
+ *
+ * @return  velocity in counts per second
+ */
+sint32_t_ encoder_get_velocity(void);
+
+/**
+ * @brief                       :   Reads the number of rejected (invalid) transitions
+ *
+ * @return  rejected transitions since init
+ */
+uint32_t_ encoder_get_errors(void);
+
+#endif /* ENCODER_INTERFACE_H_ */
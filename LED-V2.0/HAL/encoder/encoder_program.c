@@ -0,0 +1,248 @@
+/**
+ * @file    :   encoder_program.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Program File contains all rotary quadrature encoder functions' implementation
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "encoder_interface.h"
+
+// private includes
+#include "gpio_interface.h"
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define ENCODER_US_PER_MS           1000UL
+#define ENCODER_MS_PER_S            1000L
+
+#define ENCODER_INVALID             2       /* both channels changed */
+
+/* state = (A << 1) | B */
+#define ENCODER_STATE_BITS          2
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+/*
+ * Step of every (previous, current) state pair, index = (previous << 2) | current
+ * Forward Gray sequence: 00 -> 01 -> 11 -> 10 -> 00
+ */
+static const sint8_t_ gl_arr_s8_encoder_steps[1 << (2 * ENCODER_STATE_BITS)] = {
+    /* prev 00 */    0,                 1,                 -1,                ENCODER_INVALID,
+    /* prev 01 */   -1,                 0,                 ENCODER_INVALID,    1,
+    /* prev 10 */    1,                 ENCODER_INVALID,    0,                -1,
+    /* prev 11 */    ENCODER_INVALID,  -1,                  1,                 0
+};
+
+static const st_encoder_cfg_t_ * gl_ptr_st_encoder_cfg = NULL_PTR;
+
+static uint8_t_ gl_u8_encoder_state = 0;
+static volatile sint32_t_ gl_s32_encoder_position = 0;
+static volatile sint32_t_ gl_s32_encoder_velocity = 0;
+static volatile uint32_t_ gl_u32_encoder_errors = 0;
+static sint32_t_ gl_s32_encoder_sampled = 0;    // position at the last velocity sample
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Reads both channels with one port read
+ *
+ * @return  state, (A << 1) | B
+ */
+static uint8_t_ encoder_read_state(void)
+{
+    uint8_t_ u8_raw = 0;
+
+    gpio_getPortVal((en_gpio_port_t) gl_ptr_st_encoder_cfg->en_port, &u8_raw);
+
+    return (uint8_t_)((((u8_raw >> gl_ptr_st_encoder_cfg->en_pin_a) & 1) << 1) |
+                      ((u8_raw >> gl_ptr_st_encoder_cfg->en_pin_b) & 1));
+}
+
+/**
+ * @brief                       :   Edge interrupt callback of both channels, applies one table step
+ */
+static void encoder_edge(void)
+{
+    uint8_t_ u8_state = encoder_read_state();
+    sint8_t_ s8_step = gl_arr_s8_encoder_steps[(gl_u8_encoder_state << ENCODER_STATE_BITS) | u8_state];
+
+    if(ENCODER_INVALID == s8_step)
+    {
+        // an edge was missed, direction unknown: resync without counting
+        gl_u32_encoder_errors++;
+    }
+    else
+    {
+        gl_s32_encoder_position += s8_step;
+    }
+
+    gl_u8_encoder_state = u8_state;
+}
+
+/**
+ * @brief                       :   Velocity timer callback, counts travelled since the last sample
+ */
+static void encoder_sample(void)
+{
+    sint32_t_ s32_position = gl_s32_encoder_position;
+
+    gl_s32_encoder_velocity = ((s32_position - gl_s32_encoder_sampled) * ENCODER_MS_PER_S) /
+                              (sint32_t_) gl_ptr_st_encoder_cfg->u16_sample_ms;
+    gl_s32_encoder_sampled = s32_position;
+}
+
+/**
+ * @brief                       :   Configures one channel pin as a BOTH_EDGES interrupt input
+ *
+ * @param[in]   en_pin          :   Channel pin
+ *
+ * @return  ENCODER_OK          :   In case of Successful Operation
+ *          ENCODER_ERROR       :   In case of GPIO failure
+ */
+static en_encoder_error_t_ encoder_init_pin(en_btn_pin_t_ en_pin)
+{
+    en_encoder_error_t_ en_encoder_error_retval = ENCODER_OK;
+    st_gpio_cfg_t st_gpio_cfg_pin = {
+        .port = (en_gpio_port_t) gl_ptr_st_encoder_cfg->en_port,
+        .pin = (en_gpio_pin_t) en_pin,
+        .current = PIN_CURRENT_2MA,
+        .pin_cfg = INPUT
+    };
+
+    switch(gl_ptr_st_encoder_cfg->en_pull_type)
+    {
+        case BTN_INTERNAL_PULL_UP   : st_gpio_cfg_pin.pin_cfg = INPUT_PULL_UP; break;
+        case BTN_INTERNAL_PULL_DOWN : st_gpio_cfg_pin.pin_cfg = INPUT_PULL_DOWN; break;
+        default                     : /* external pull, plain input */ break;
+    }
+
+    if(
+            (GPIO_OK != gpio_pin_init(&st_gpio_cfg_pin))                                                ||
+            (GPIO_OK != gpio_setIntSense(st_gpio_cfg_pin.port, st_gpio_cfg_pin.pin, BOTH_EDGES))        ||
+            (GPIO_OK != gpio_setIntCallback(st_gpio_cfg_pin.port, st_gpio_cfg_pin.pin, encoder_edge))
+            )
+    {
+        en_encoder_error_retval = ENCODER_ERROR;
+    }
+
+    return en_encoder_error_retval;
+}
+
+/*---------------------------------------------------------/
+/- FUNCTION IMPLEMENTATION
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Initializes the channel pins and their edge interrupts,
+ *                                  starts the velocity timer, position starts at 0
+ *
+ * @param[in]   ptr_st_cfg      :   Pointer to encoder configuration (must stay valid)
+ *
+ * @return  ENCODER_OK          :   In case of Successful Operation
+ *          ENCODER_ERROR       :   In case of invalid configuration
+ */
+en_encoder_error_t_ encoder_init(const st_encoder_cfg_t_ * ptr_st_cfg)
+{
+    en_encoder_error_t_ en_encoder_error_retval = ENCODER_OK;
+
+    if(
+            (NULL_PTR == ptr_st_cfg)                        ||
+            (BTN_PORT_TOTAL <= ptr_st_cfg->en_port)         ||
+            (BTN_PIN_TOTAL <= ptr_st_cfg->en_pin_a)         ||
+            (BTN_PIN_TOTAL <= ptr_st_cfg->en_pin_b)         ||
+            (ptr_st_cfg->en_pin_a == ptr_st_cfg->en_pin_b)  ||
+            (BTN_PULL_TOTAL <= ptr_st_cfg->en_pull_type)    ||
+            (ZERO == ptr_st_cfg->u16_sample_ms)
+            )
+    {
+        en_encoder_error_retval = ENCODER_ERROR;
+    }
+    else
+    {
+        st_timer_cfg_t st_timer_cfg = {
+            .en_timer       = ptr_st_cfg->en_timer,
+            .u32_period_us  = ptr_st_cfg->u16_sample_ms * ENCODER_US_PER_MS,
+            .ptr_cbf        = encoder_sample
+        };
+
+        timer_stop(ptr_st_cfg->en_timer);
+        gl_ptr_st_encoder_cfg = ptr_st_cfg;
+
+        gl_s32_encoder_position = 0;
+        gl_s32_encoder_velocity = 0;
+        gl_s32_encoder_sampled = 0;
+        gl_u32_encoder_errors = 0;
+
+        if(
+                (ENCODER_OK != encoder_init_pin(ptr_st_cfg->en_pin_a))  ||
+                (ENCODER_OK != encoder_init_pin(ptr_st_cfg->en_pin_b))
+                )
+        {
+            en_encoder_error_retval = ENCODER_ERROR;
+        }
+        else
+        {
+            // start from the current state so the first edge decodes
+            gl_u8_encoder_state = encoder_read_state();
+
+            if(
+                    (GPIO_OK != gpio_enableInt((en_gpio_port_t) ptr_st_cfg->en_port, (en_gpio_pin_t) ptr_st_cfg->en_pin_a))  ||
+                    (GPIO_OK != gpio_enableInt((en_gpio_port_t) ptr_st_cfg->en_port, (en_gpio_pin_t) ptr_st_cfg->en_pin_b))  ||
+                    (TIMER_OK != timer_init_periodic(&st_timer_cfg))                                                        ||
+                    (TIMER_OK != timer_start(ptr_st_cfg->en_timer))
+                    )
+            {
+                en_encoder_error_retval = ENCODER_ERROR;
+            }
+        }
+    }
+
+    return en_encoder_error_retval;
+}
+
+/**
+ * @brief                       :   Reads the position (counts, 4 per quadrature cycle)
+ *
+ * @return  position, positive: B leads A
+ */
+sint32_t_ encoder_get_position(void)
+{
+    return gl_s32_encoder_position;
+}
+
+/**
+ * @brief                       :   Overwrites the position, e.g. to rebase it to 0
+ *
+ * @param[in]   s32_position    :   New position
+ */
+void encoder_set_position(sint32_t_ s32_position)
+{
+    // rebase the velocity reference too so the next sample isn't a jump
+    gl_s32_encoder_sampled += s32_position - gl_s32_encoder_position;
+    gl_s32_encoder_position = s32_position;
+}
+
+/**
+ * @brief                       :   Reads the velocity measured over the last sampling period
+ *
+ * @return  velocity in counts per second
+ */
+sint32_t_ encoder_get_velocity(void)
+{
+    return gl_s32_encoder_velocity;
+}
+
+/**
+ * @brief                       :   Reads the number of rejected (invalid) transitions
+ *
+ * @return  rejected transitions since init
+ */
+uint32_t_ encoder_get_errors(void)
+{
+    return gl_u32_encoder_errors;
+}
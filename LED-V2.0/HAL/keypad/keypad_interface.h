@@ -0,0 +1,111 @@
+/**
+ * @file    :   keypad_interface.h
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Header File contains all matrix keypad typedefs and functions' prototypes
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Scans a row/column keypad (up to 8x8) from a timer interrupt, one row per tick.
+ * The active row is the only row pin driven (low), the others are hi-Z so pressed keys
+ * can't short two driven rows. Columns are pulled up and read with one port read.
+ * A key changes state after KEYPAD_DEBOUNCE_SCANS identical full scans. Rows that share
+ * two or more pressed columns can't be told apart from ghost keys (no diodes), their
+ * state is held until the ambiguity clears.
+ */
+
+#ifndef KEYPAD_INTERFACE_H_
+#define KEYPAD_INTERFACE_H_
+
+#include "btn_interface.h"
+#include "timer_interface.h"
+
+/*----------------------------------------------------------/
+/- MACROS
+/----------------------------------------------------------*/
+#define KEYPAD_ROWS_MAX             BTN_PIN_TOTAL   /* all rows on one port */
+#define KEYPAD_COLS_MAX             BTN_PIN_TOTAL   /* all columns on one port */
+#define KEYPAD_DEBOUNCE_SCANS       2               /* identical full scans before a key changes */
+#define KEYPAD_EVENT_QUEUE_SIZE     16              /* power of 2 */
+
+/*----------------------------------------------------------/
+/- ENUMS
+/----------------------------------------------------------*/
+typedef enum
+{
+    KEYPAD_OK               = 0 ,
+    KEYPAD_ERROR                ,
+}en_keypad_error_t_;
+
+/*----------------------------------------------------------/
+/- STRUCTS
+/----------------------------------------------------------*/
+typedef struct
+{
+    en_btn_port_t_          en_row_port                         ; /* driven low one at a time */
+    en_btn_pin_t_           arr_en_row_pins[KEYPAD_ROWS_MAX]    ;
+    uint8_t_                u8_rows                             ;
+    en_btn_port_t_          en_col_port                         ; /* inputs, internal pull up */
+    en_btn_pin_t_           arr_en_col_pins[KEYPAD_COLS_MAX]    ;
+    uint8_t_                u8_cols                             ;
+    en_timer_t              en_timer                            ; /* scan time base */
+    uint16_t_               u16_scan_hz                         ; /* full keypad scans per second */
+}st_keypad_cfg_t_;
+
+typedef struct
+{
+    uint8_t_                u8_key                              ; /* row * u8_cols + col */
+    boolean                 bool_pressed                        ; /* TRUE: pressed, FALSE: released */
+}st_keypad_event_t_;
+
+/*---------------------------------------------------------/
+/- FUNCTION PROTOTYPES
+/---------------------------------------------------------*/
+
+/**
+ * @brief                       :   Initializes the row/column pins and starts the scan timer
+ *
+ * @param[in]   ptr_st_cfg      :   Pointer to keypad configuration (must stay valid)
+ *
+ * @return  KEYPAD_OK           :   In case of Successful Operation
+ *          KEYPAD_ERROR        :   In case of invalid configuration
+ */
+en_keypad_error_t_ keypad_init(const st_keypad_cfg_t_ * ptr_st_cfg);
+
+/**
+ * @brief                       :   Reads the debounced state of one key, never blocks
+ *
+ * @param[in]   u8_row          :   Row index
+ * @param[in]   u8_col          :   Column index
+ *
+ * @return  TRUE                :   Key pressed
+ *          FALSE               :   Key released or invalid key
+ */
+boolean keypad_is_pressed(uint8_t_ u8_row, uint8_t_ u8_col);
+
+/**
+ * @brief                       :   Takes the oldest key event, never blocks
+ *
+ * @param[out]  ptr_st_event    :   Pointer to variable to store the event
+ *
+ * @return  KEYPAD_OK           :   When an event was taken
+ *          KEYPAD_ERROR        :   NULL_PTR or no event pending
+ */
+en_keypad_error_t_ keypad_event_get(st_keypad_event_t_ * ptr_st_event);
+
+/**
+ * @brief                       :   Checks whether the last full scan had ghosting rows (state held)
+ *
+ * @return  TRUE                :   Ambiguous key combination pressed
+ *          FALSE               :   All pressed keys unambiguous
+ */
+boolean keypad_is_ghosting(void);
+
+/**
+ * @brief                       :   Scan step, reads the active row and drives the next one,
+ *                                  called by the scan timer
+ */
+void keypad_scan(void);
+
+#endif /* KEYPAD_INTERFACE_H_ */
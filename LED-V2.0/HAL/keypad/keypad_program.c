@@ -0,0 +1,387 @@
+/**
+ * @file    :   keypad_program.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Program File contains all matrix keypad functions' implementation
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "keypad_interface.h"
+
+// private includes
+#include "gpio_interface.h"
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define KEYPAD_US_PER_S             1000000UL
+#define KEYPAD_EVENT_QUEUE_MASK     (KEYPAD_EVENT_QUEUE_SIZE - 1)
+
+/* more than one bit set */
+#define KEYPAD_MULTI_BITS(X)        (ZERO != ((X) & ((X) - 1)))
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+static const st_keypad_cfg_t_ * gl_ptr_st_keypad_cfg = NULL_PTR;
+
+/* port masks of the row pins and column pins */
+static uint8_t_ gl_u8_keypad_row_mask = 0;
+static uint8_t_ gl_u8_keypad_col_mask = 0;
+static uint8_t_ gl_arr_u8_keypad_row_bits[KEYPAD_ROWS_MAX];
+static uint8_t_ gl_arr_u8_keypad_col_bits[KEYPAD_COLS_MAX];
+
+/* pressed columns of every row as column port bits: scan in progress, last full scan, debounced */
+static uint8_t_ gl_arr_u8_keypad_scan[KEYPAD_ROWS_MAX];
+static uint8_t_ gl_arr_u8_keypad_last[KEYPAD_ROWS_MAX];
+static volatile uint8_t_ gl_arr_u8_keypad_state[KEYPAD_ROWS_MAX];
+
+static uint8_t_ gl_u8_keypad_row = 0;               // row being driven
+static uint8_t_ gl_u8_keypad_same_scans = 0;        // consecutive identical full scans
+static volatile boolean gl_bool_keypad_ghosting = FALSE;
+
+/* event queue, single producer (keypad_scan) single consumer (keypad_event_get) */
+static st_keypad_event_t_ gl_arr_st_keypad_events[KEYPAD_EVENT_QUEUE_SIZE];
+static volatile uint8_t_ gl_u8_keypad_events_head = 0;
+static volatile uint8_t_ gl_u8_keypad_events_tail = 0;
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Builds a pin mask from a pin list, fails on invalid or duplicated pins
+ *
+ * @param[in]   ptr_en_pins     :   Pin list
+ * @param[in]   u8_count        :   Pins in the list
+ * @param[out]  ptr_u8_bits     :   Bit of every pin
+ * @param[out]  ptr_u8_mask     :   Mask of all pins
+ *
+ * @return  KEYPAD_OK           :   In case of Successful Operation
+ *          KEYPAD_ERROR        :   In case of invalid or duplicated pin
+ */
+static en_keypad_error_t_ keypad_compile_pins(const en_btn_pin_t_ * ptr_en_pins, uint8_t_ u8_count,
+                                              uint8_t_ * ptr_u8_bits, uint8_t_ * ptr_u8_mask)
+{
+    en_keypad_error_t_ en_keypad_error_retval = KEYPAD_OK;
+    uint8_t_ u8_index;
+
+    *ptr_u8_mask = 0;
+
+    for(u8_index = 0; u8_index < u8_count; u8_index++)
+    {
+        if((BTN_PIN_TOTAL <= ptr_en_pins[u8_index]) || (ZERO != (*ptr_u8_mask & (1 << ptr_en_pins[u8_index]))))
+        {
+            en_keypad_error_retval = KEYPAD_ERROR;
+        }
+        else
+        {
+            ptr_u8_bits[u8_index] = (1 << ptr_en_pins[u8_index]);
+            *ptr_u8_mask |= ptr_u8_bits[u8_index];
+        }
+    }
+
+    return en_keypad_error_retval;
+}
+
+/**
+ * @brief                       :   Configures the pins of a mask
+ *
+ * @param[in]   en_btn_port     :   Port
+ * @param[in]   u8_mask         :   Pins
+ * @param[in]   en_pin_cfg      :   Pin configuration
+ *
+ * @return  KEYPAD_OK           :   In case of Successful Operation
+ *          KEYPAD_ERROR        :   In case of GPIO failure
+ */
+static en_keypad_error_t_ keypad_init_pins(en_btn_port_t_ en_btn_port, uint8_t_ u8_mask, en_gpio_pin_cfg_t en_pin_cfg)
+{
+    en_keypad_error_t_ en_keypad_error_retval = KEYPAD_OK;
+    uint8_t_ u8_pin;
+
+    for(u8_pin = 0; u8_pin < BTN_PIN_TOTAL; u8_pin++)
+    {
+        if(ZERO != (u8_mask & (1 << u8_pin)))
+        {
+            st_gpio_cfg_t st_gpio_cfg_pin = {
+                .port = (en_gpio_port_t) en_btn_port,
+                .pin = (en_gpio_pin_t) u8_pin,
+                .current = PIN_CURRENT_2MA,
+                .pin_cfg = en_pin_cfg
+            };
+
+            if(GPIO_OK != gpio_pin_init(&st_gpio_cfg_pin))
+            {
+                en_keypad_error_retval = KEYPAD_ERROR;
+            }
+        }
+    }
+
+    return en_keypad_error_retval;
+}
+
+/**
+ * @brief                       :   Queues the state changes of one row
+ *
+ * @param[in]   u8_row          :   Row index
+ * @param[in]   u8_changed      :   Changed columns (column port bits)
+ */
+static void keypad_emit_row(uint8_t_ u8_row, uint8_t_ u8_changed)
+{
+    uint8_t_ u8_col;
+    uint8_t_ u8_head;
+
+    for(u8_col = 0; (ZERO != u8_changed) && (u8_col < gl_ptr_st_keypad_cfg->u8_cols); u8_col++)
+    {
+        if(ZERO != (u8_changed & gl_arr_u8_keypad_col_bits[u8_col]))
+        {
+            u8_changed &= ~gl_arr_u8_keypad_col_bits[u8_col];
+            u8_head = gl_u8_keypad_events_head;
+
+            // dropped when full, the state stays readable with keypad_is_pressed
+            if(KEYPAD_EVENT_QUEUE_SIZE > (uint8_t_)(u8_head - gl_u8_keypad_events_tail))
+            {
+                gl_arr_st_keypad_events[u8_head & KEYPAD_EVENT_QUEUE_MASK].u8_key =
+                        (u8_row * gl_ptr_st_keypad_cfg->u8_cols) + u8_col;
+                gl_arr_st_keypad_events[u8_head & KEYPAD_EVENT_QUEUE_MASK].bool_pressed =
+                        (ZERO != (gl_arr_u8_keypad_state[u8_row] & gl_arr_u8_keypad_col_bits[u8_col]));
+
+                gl_u8_keypad_events_head = u8_head + 1;
+            }
+        }
+    }
+}
+
+/**
+ * @brief                       :   Processes a completed full scan: debounce, ghost check and events
+ */
+static void keypad_scan_done(void)
+{
+    uint8_t_ u8_rows = gl_ptr_st_keypad_cfg->u8_rows;
+    uint8_t_ u8_ghost_rows = 0;
+    boolean bool_same = TRUE;
+    uint8_t_ u8_row;
+    uint8_t_ u8_other;
+    uint8_t_ u8_changed;
+
+    for(u8_row = 0; u8_row < u8_rows; u8_row++)
+    {
+        if(gl_arr_u8_keypad_scan[u8_row] != gl_arr_u8_keypad_last[u8_row])
+        {
+            bool_same = FALSE;
+        }
+        gl_arr_u8_keypad_last[u8_row] = gl_arr_u8_keypad_scan[u8_row];
+    }
+
+    gl_u8_keypad_same_scans = (TRUE == bool_same) ? (gl_u8_keypad_same_scans + 1) : 1;
+
+    if(KEYPAD_DEBOUNCE_SCANS <= gl_u8_keypad_same_scans)
+    {
+        gl_u8_keypad_same_scans = KEYPAD_DEBOUNCE_SCANS;
+
+        // two rows sharing two pressed columns close a rectangle: a fourth key may be a ghost
+        for(u8_row = 0; u8_row < u8_rows; u8_row++)
+        {
+            for(u8_other = u8_row + 1; u8_other < u8_rows; u8_other++)
+            {
+                if(KEYPAD_MULTI_BITS(gl_arr_u8_keypad_last[u8_row] & gl_arr_u8_keypad_last[u8_other]))
+                {
+                    u8_ghost_rows |= (1 << u8_row) | (1 << u8_other);
+                }
+            }
+        }
+
+        gl_bool_keypad_ghosting = (ZERO != u8_ghost_rows);
+
+        // n-key rollover for every unambiguous row
+        for(u8_row = 0; u8_row < u8_rows; u8_row++)
+        {
+            u8_changed = gl_arr_u8_keypad_last[u8_row] ^ gl_arr_u8_keypad_state[u8_row];
+
+            if((ZERO == (u8_ghost_rows & (1 << u8_row))) && (ZERO != u8_changed))
+            {
+                gl_arr_u8_keypad_state[u8_row] = gl_arr_u8_keypad_last[u8_row];
+                keypad_emit_row(u8_row, u8_changed);
+            }
+        }
+    }
+}
+
+/*---------------------------------------------------------/
+/- FUNCTION IMPLEMENTATION
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Initializes the row/column pins and starts the scan timer
+ *
+ * @param[in]   ptr_st_cfg      :   Pointer to keypad configuration (must stay valid)
+ *
+ * @return  KEYPAD_OK           :   In case of Successful Operation
+ *          KEYPAD_ERROR        :   In case of invalid configuration
+ */
+en_keypad_error_t_ keypad_init(const st_keypad_cfg_t_ * ptr_st_cfg)
+{
+    en_keypad_error_t_ en_keypad_error_retval = KEYPAD_OK;
+    uint8_t_ u8_row;
+
+    if(
+            (NULL_PTR == ptr_st_cfg)                        ||
+            (BTN_PORT_TOTAL <= ptr_st_cfg->en_row_port)     ||
+            (BTN_PORT_TOTAL <= ptr_st_cfg->en_col_port)     ||
+            (ZERO == ptr_st_cfg->u8_rows)                   ||
+            (KEYPAD_ROWS_MAX < ptr_st_cfg->u8_rows)         ||
+            (ZERO == ptr_st_cfg->u8_cols)                   ||
+            (KEYPAD_COLS_MAX < ptr_st_cfg->u8_cols)         ||
+            (ZERO == ptr_st_cfg->u16_scan_hz)
+            )
+    {
+        en_keypad_error_retval = KEYPAD_ERROR;
+    }
+    else
+    {
+        timer_stop(ptr_st_cfg->en_timer);
+        gl_ptr_st_keypad_cfg = ptr_st_cfg;
+
+        if(
+                (KEYPAD_OK != keypad_compile_pins(ptr_st_cfg->arr_en_row_pins, ptr_st_cfg->u8_rows,
+                                                  gl_arr_u8_keypad_row_bits, &gl_u8_keypad_row_mask))   ||
+                (KEYPAD_OK != keypad_compile_pins(ptr_st_cfg->arr_en_col_pins, ptr_st_cfg->u8_cols,
+                                                  gl_arr_u8_keypad_col_bits, &gl_u8_keypad_col_mask))   ||
+                ((ptr_st_cfg->en_col_port == ptr_st_cfg->en_row_port) &&
+                 (ZERO != (gl_u8_keypad_col_mask & gl_u8_keypad_row_mask)))
+                )
+        {
+            en_keypad_error_retval = KEYPAD_ERROR;
+        }
+        else if(
+                (KEYPAD_OK != keypad_init_pins(ptr_st_cfg->en_row_port, gl_u8_keypad_row_mask, OUTPUT))       ||
+                (KEYPAD_OK != keypad_init_pins(ptr_st_cfg->en_col_port, gl_u8_keypad_col_mask, INPUT_PULL_UP))
+                )
+        {
+            en_keypad_error_retval = KEYPAD_ERROR;
+        }
+        else
+        {
+            // rows idle as inputs (hi-Z) with their output latches low, a row is driven by its direction only
+            gpio_setPortMaskedVal((en_gpio_port_t) ptr_st_cfg->en_row_port, gl_u8_keypad_row_mask, LOW);
+            gpio_setPortMaskedDir((en_gpio_port_t) ptr_st_cfg->en_row_port, gl_u8_keypad_row_mask,
+                                  gl_arr_u8_keypad_row_bits[0]);
+        }
+    }
+
+    if(KEYPAD_OK == en_keypad_error_retval)
+    {
+        st_timer_cfg_t st_timer_cfg = {
+            .en_timer       = ptr_st_cfg->en_timer,
+            .u32_period_us  = KEYPAD_US_PER_S / ((uint32_t_) ptr_st_cfg->u16_scan_hz * ptr_st_cfg->u8_rows),
+            .ptr_cbf        = keypad_scan
+        };
+
+        for(u8_row = 0; u8_row < ptr_st_cfg->u8_rows; u8_row++)
+        {
+            gl_arr_u8_keypad_scan[u8_row] = 0;
+            gl_arr_u8_keypad_last[u8_row] = 0;
+            gl_arr_u8_keypad_state[u8_row] = 0;
+        }
+
+        gl_u8_keypad_row = 0;
+        gl_u8_keypad_same_scans = 0;
+        gl_bool_keypad_ghosting = FALSE;
+
+        if(
+                (TIMER_OK != timer_init_periodic(&st_timer_cfg)) ||
+                (TIMER_OK != timer_start(ptr_st_cfg->en_timer))
+                )
+        {
+            en_keypad_error_retval = KEYPAD_ERROR;
+        }
+    }
+
+    return en_keypad_error_retval;
+}
+
+/**
+ * @brief                       :   Reads the debounced state of one key, never blocks
+ *
+ * @param[in]   u8_row          :   Row index
+ * @param[in]   u8_col          :   Column index
+ *
+ * @return  TRUE                :   Key pressed
+ *          FALSE               :   Key released or invalid key
+ */
+boolean keypad_is_pressed(uint8_t_ u8_row, uint8_t_ u8_col)
+{
+    boolean bool_retval = FALSE;
+
+    if(
+            (NULL_PTR != gl_ptr_st_keypad_cfg)          &&
+            (u8_row < gl_ptr_st_keypad_cfg->u8_rows)    &&
+            (u8_col < gl_ptr_st_keypad_cfg->u8_cols)
+            )
+    {
+        bool_retval = (ZERO != (gl_arr_u8_keypad_state[u8_row] & gl_arr_u8_keypad_col_bits[u8_col]));
+    }
+
+    return bool_retval;
+}
+
+/**
+ * @brief                       :   Takes the oldest key event, never blocks
+ *
+ * @param[out]  ptr_st_event    :   Pointer to variable to store the event
+ *
+ * @return  KEYPAD_OK           :   When an event was taken
+ *          KEYPAD_ERROR        :   NULL_PTR or no event pending
+ */
+en_keypad_error_t_ keypad_event_get(st_keypad_event_t_ * ptr_st_event)
+{
+    en_keypad_error_t_ en_keypad_error_retval = KEYPAD_OK;
+    uint8_t_ u8_tail = gl_u8_keypad_events_tail;
+
+    if((NULL_PTR == ptr_st_event) || (u8_tail == gl_u8_keypad_events_head))
+    {
+        en_keypad_error_retval = KEYPAD_ERROR;
+    }
+    else
+    {
+        *ptr_st_event = gl_arr_st_keypad_events[u8_tail & KEYPAD_EVENT_QUEUE_MASK];
+        gl_u8_keypad_events_tail = u8_tail + 1;
+    }
+
+    return en_keypad_error_retval;
+}
+
+/**
+ * @brief                       :   Checks whether the last full scan had ghosting rows (state held)
+ *
+ * @return  TRUE                :   Ambiguous key combination pressed
+ *          FALSE               :   All pressed keys unambiguous
+ */
+boolean keypad_is_ghosting(void)
+{
+    return gl_bool_keypad_ghosting;
+}
+
+/**
+ * @brief                       :   Scan step, reads the active row and drives the next one,
+ *                                  called by the scan timer
+ */
+void keypad_scan(void)
+{
+    uint8_t_ u8_cols = 0;
+
+    // the active row was driven one tick ago, its columns are settled
+    gpio_getPortVal((en_gpio_port_t) gl_ptr_st_keypad_cfg->en_col_port, &u8_cols);
+    gl_arr_u8_keypad_scan[gl_u8_keypad_row] = (uint8_t_)(~u8_cols) & gl_u8_keypad_col_mask;
+
+    gl_u8_keypad_row++;
+    if(gl_ptr_st_keypad_cfg->u8_rows <= gl_u8_keypad_row)
+    {
+        gl_u8_keypad_row = 0;
+        keypad_scan_done();
+    }
+
+    // one direction write moves the low level to the next row
+    gpio_setPortMaskedDir((en_gpio_port_t) gl_ptr_st_keypad_cfg->en_row_port, gl_u8_keypad_row_mask,
+                          gl_arr_u8_keypad_row_bits[gl_u8_keypad_row]);
+}
@@ -0,0 +1,98 @@
+/**
+ * @file    :   latency_interface.h
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Header File contains all input to LED latency instrumentation typedefs and functions' prototypes
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Measures the time from a button's first raw edge to the next LED port write caused by it,
+ * with the DWT cycle counter. Build with LATENCY_INSTRUMENTATION = 1 to enable the hooks in
+ * the btn and led drivers, they compile to nothing otherwise.
+ * Samples go into a log2 histogram: bucket 0 holds 0 -> 1 us, bucket n holds 2^n -> 2^(n+1) - 1 us,
+ * the last bucket everything above.
+ */
+
+#ifndef LATENCY_INTERFACE_H_
+#define LATENCY_INTERFACE_H_
+
+#include "std.h"
+
+/*----------------------------------------------------------/
+/- MACROS
+/----------------------------------------------------------*/
+#ifndef LATENCY_INSTRUMENTATION
+#define LATENCY_INSTRUMENTATION     0
+#endif
+
+#define LATENCY_BUCKETS             21      /* up to ~1 s, the last bucket is open ended */
+
+/* driver hooks */
+#if LATENCY_INSTRUMENTATION
+#define LATENCY_STAMP(VAR)          ((VAR) = latency_now())
+#define LATENCY_INPUT(STAMP)        latency_input(STAMP)
+#define LATENCY_OUTPUT()            latency_output()
+#else
+#define LATENCY_STAMP(VAR)
+#define LATENCY_INPUT(STAMP)
+#define LATENCY_OUTPUT()
+#endif
+
+/*----------------------------------------------------------/
+/- STRUCTS
+/----------------------------------------------------------*/
+typedef struct
+{
+    uint32_t_   u32_samples                     ;
+    uint32_t_   u32_min_us                      ;
+    uint32_t_   u32_max_us                      ;
+    uint32_t_   arr_u32_buckets[LATENCY_BUCKETS];
+}st_latency_stats_t_;
+
+/*---------------------------------------------------------/
+/- FUNCTION PROTOTYPES
+/---------------------------------------------------------*/
+
+/**
+ * @brief                       :   Starts the cycle counter and clears the histogram
+ */
+void latency_init(void);
+
+/**
+ * @brief                       :   Reads the time stamp used by the hooks
+ *
+ * @return  cycle counter
+ */
+uint32_t_ latency_now(void);
+
+/**
+ * @brief                       :   Opens a measurement: an input edge at the given time stamp
+ *                                  waits for its LED write, replaces a measurement still open
+ *
+ * @param[in]   u32_stamp       :   Time stamp of the input edge
+ */
+void latency_input(uint32_t_ u32_stamp);
+
+/**
+ * @brief                       :   Closes the open measurement (if any) on an LED port write
+ */
+void latency_output(void);
+
+/**
+ * @brief                       :   Copies the histogram
+ *
+ * @param[out]  ptr_st_stats    :   Pointer to variable to store the statistics
+ */
+void latency_get_stats(st_latency_stats_t_ * ptr_st_stats);
+
+/**
+ * @brief                       :   Upper bound of the given percentile, from the histogram
+ *
+ * @param[in]   u8_percentile   :   1 -> 100
+ *
+ * @return  latency in us that u8_percentile % of the samples don't exceed (0 without samples)
+ */
+uint32_t_ latency_get_percentile_us(uint8_t_ u8_percentile);
+
+#endif /* LATENCY_INTERFACE_H_ */
@@ -0,0 +1,159 @@
+/**
+ * @file    :   latency_program.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Program File contains all input to LED latency instrumentation functions' implementation
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "latency_interface.h"
+
+// private includes
+#include "dwt_interface.h"
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define LATENCY_PERCENT             100
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+static st_latency_stats_t_ gl_st_latency_stats;
+
+static volatile boolean gl_bool_latency_open = FALSE;
+static volatile uint32_t_ gl_u32_latency_stamp = 0;
+
+/*---------------------------------------------------------/
+/- FUNCTION IMPLEMENTATION
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Starts the cycle counter and clears the histogram
+ */
+void latency_init(void)
+{
+    uint8_t_ u8_bucket;
+
+    dwt_init();
+
+    gl_st_latency_stats.u32_samples = 0;
+    gl_st_latency_stats.u32_min_us = 0xFFFFFFFFUL;
+    gl_st_latency_stats.u32_max_us = 0;
+    for(u8_bucket = 0; u8_bucket < LATENCY_BUCKETS; u8_bucket++)
+    {
+        gl_st_latency_stats.arr_u32_buckets[u8_bucket] = 0;
+    }
+
+    gl_bool_latency_open = FALSE;
+}
+
+/**
+ * @brief                       :   Reads the time stamp used by the hooks
+ *
+ * @return  cycle counter
+ */
+uint32_t_ latency_now(void)
+{
+    return dwt_get_cycles();
+}
+
+/**
+ * @brief                       :   Opens a measurement: an input edge at the given time stamp
+ *                                  waits for its LED write, replaces a measurement still open
+ *
+ * @param[in]   u32_stamp       :   Time stamp of the input edge
+ */
+void latency_input(uint32_t_ u32_stamp)
+{
+    gl_u32_latency_stamp = u32_stamp;
+    gl_bool_latency_open = TRUE;
+}
+
+/**
+ * @brief                       :   Closes the open measurement (if any) on an LED port write
+ */
+void latency_output(void)
+{
+    uint32_t_ u32_us;
+    uint8_t_ u8_bucket = 0;
+
+    if(TRUE == gl_bool_latency_open)
+    {
+        gl_bool_latency_open = FALSE;
+        u32_us = dwt_cycles_to_us(dwt_get_cycles() - gl_u32_latency_stamp);
+
+        // floor(log2(us)), 0 and 1 us share bucket 0
+        while(((u32_us >> 1) >> u8_bucket) && (u8_bucket < (LATENCY_BUCKETS - 1)))
+        {
+            u8_bucket++;
+        }
+
+        gl_st_latency_stats.arr_u32_buckets[u8_bucket]++;
+        gl_st_latency_stats.u32_samples++;
+
+        if(u32_us < gl_st_latency_stats.u32_min_us)
+        {
+            gl_st_latency_stats.u32_min_us = u32_us;
+        }
+        if(u32_us > gl_st_latency_stats.u32_max_us)
+        {
+            gl_st_latency_stats.u32_max_us = u32_us;
+        }
+    }
+}
+
+/**
+ * @brief                       :   Copies the histogram
+ *
+ * @param[out]  ptr_st_stats    :   Pointer to variable to store the statistics
+ */
+void latency_get_stats(st_latency_stats_t_ * ptr_st_stats)
+{
+    if(NULL_PTR != ptr_st_stats)
+    {
+        *ptr_st_stats = gl_st_latency_stats;
+    }
+}
+
+/**
+ * @brief                       :   Upper bound of the given percentile, from the histogram
+ *
+ * @param[in]   u8_percentile   :   1 -> 100
+ *
+ * @return  latency in us that u8_percentile % of the samples don't exceed (0 without samples)
+ */
+uint32_t_ latency_get_percentile_us(uint8_t_ u8_percentile)
+{
+    uint32_t_ u32_retval = 0;
+    uint32_t_ u32_needed;
+    uint32_t_ u32_seen = 0;
+    uint8_t_ u8_bucket;
+
+    if((ZERO != gl_st_latency_stats.u32_samples) && (LATENCY_PERCENT >= u8_percentile))
+    {
+        // samples at or below the percentile, rounded up
+        u32_needed = ((gl_st_latency_stats.u32_samples * u8_percentile) + (LATENCY_PERCENT - 1)) / LATENCY_PERCENT;
+
+        for(u8_bucket = 0; u8_bucket < LATENCY_BUCKETS; u8_bucket++)
+        {
+            u32_seen += gl_st_latency_stats.arr_u32_buckets[u8_bucket];
+            if(u32_seen >= u32_needed)
+            {
+                break;
+            }
+        }
+
+        // top of the bucket, the observed max bounds the open ended one
+        u32_retval = (LATENCY_BUCKETS <= (u8_bucket + 1)) ?
+                     gl_st_latency_stats.u32_max_us :
+                     ((2UL << u8_bucket) - 1);
+        if(u32_retval > gl_st_latency_stats.u32_max_us)
+        {
+            u32_retval = gl_st_latency_stats.u32_max_us;
+        }
+    }
+
+    return u32_retval;
+}
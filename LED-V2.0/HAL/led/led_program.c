@@ -12,6 +12,78 @@
 
 // private includes
 #include "gpio_interface.h"
+#include "cpu_interface.h"
+#include "latency_interface.h"
+#include "trace_interface.h"
+
+/*
+ * Private Variables
+ * The state cache is written from the main line and from handlers (led_frame refresh tick),
+ * its read-modify-writes and led_flush run with interrupts masked */
+static uint8_t_ gl_arr_u8_led_pins[LED_PORT_TOTAL]      = {0}; // pins initialized as LEDs per port
+static uint8_t_ gl_arr_u8_led_desired[LED_PORT_TOTAL]   = {0}; // requested pin levels per port
+static uint8_t_ gl_arr_u8_led_actual[LED_PORT_TOTAL]    = {0}; // last written pin levels per port
+
+static st_led_stats_t_ gl_st_led_stats = {0};
+
+/**
+ * @brief                       :   Writes the pending (desired != actual) LEDs of a port within a mask
+ *                                  in one masked port write, or counts the request as elided,
+ *                                  call with interrupts masked
+ *
+ * @param[in]   en_led_port    :   LED Port
+ * @param[in]   u8_mask        :   LED pins to flush
+ *
+ * @return  LED_OK              :   In case of Successful Operation
+ *          LED_ERROR           :   In case of Failed Operation
+ */
+static en_led_error_t_ led_flush(en_led_port_t_ en_led_port, uint8_t_ u8_mask)
+{
+    en_led_error_t_ en_led_error_retval = LED_OK;
+    uint8_t_ u8_pending = (gl_arr_u8_led_desired[en_led_port] ^ gl_arr_u8_led_actual[en_led_port]) & u8_mask;
+
+    if(ZERO == u8_pending)
+    {
+        gl_st_led_stats.u32_writes_elided++;
+    }
+    else
+    {
+        en_gpio_error_t en_dio_error = gpio_setPortMaskedVal((en_gpio_port_t) en_led_port,
+                                                             u8_pending,
+                                                             gl_arr_u8_led_desired[en_led_port]);
+        if(GPIO_OK == en_dio_error)
+        {
+            gl_arr_u8_led_actual[en_led_port] = (gl_arr_u8_led_actual[en_led_port] & ~u8_pending) |
+                                                (gl_arr_u8_led_desired[en_led_port] & u8_pending);
+            gl_st_led_stats.u32_writes_issued++;
+            LATENCY_OUTPUT();
+            TRACE(TRACE_EV_LED_WRITE, en_led_port,
+                  ((uint16_t_) u8_pending << 8) | (gl_arr_u8_led_desired[en_led_port] & u8_pending));
+        }
+        else
+        {
+            en_led_error_retval = LED_ERROR;
+        }
+    }
+
+    return en_led_error_retval;
+}
+
+/**
+ * @brief                       :   Checks that the given port/pin was initialized as an LED
+ *
+ * @param[in]   en_led_port    :   LED Port
+ * @param[in]   en_led_pin     :   LED Pin number in en_led_port
+ *
+ * @return  TRUE                :   Valid initialized LED
+ *          FALSE               :   Invalid port/pin or not initialized
+ */
+static boolean led_is_valid(en_led_port_t_ en_led_port, en_led_pin_t_ en_led_pin)
+{
+    return ((LED_PORT_TOTAL > en_led_port) &&
+            (LED_PIN_TOTAL > en_led_pin) &&
+            (ZERO != (gl_arr_u8_led_pins[en_led_port] & (1 << en_led_pin))));
+}
 
 /**
  * @brief                       :   Initializes LED on given port & pin
@@ -40,6 +112,23 @@ en_led_error_t_ led_init(en_led_port_t_ en_led_port, en_led_pin_t_ en_led_pin)
         };
         en_gpio_error_t en_dio_error = gpio_pin_init(&st_gpio_cfg_led);
 
+        // start off, so the cache matches the pin
+        if(GPIO_OK == en_dio_error)
+        {
+            en_dio_error = gpio_setPortMaskedVal((en_gpio_port_t) en_led_port, (1 << en_led_pin), LOW);
+        }
+
+        if(GPIO_OK == en_dio_error)
+        {
+            boolean bool_masked = cpu_irq_save();
+
+            gl_arr_u8_led_pins[en_led_port]     |= (1 << en_led_pin);
+            gl_arr_u8_led_desired[en_led_port]  &= ~(1 << en_led_pin);
+            gl_arr_u8_led_actual[en_led_port]   &= ~(1 << en_led_pin);
+
+            cpu_irq_restore(bool_masked);
+        }
+
         en_led_error_retval = (en_dio_error == GPIO_OK ? LED_OK : LED_ERROR);
     }
 
@@ -58,17 +147,18 @@ en_led_error_t_ led_init(en_led_port_t_ en_led_port, en_led_pin_t_ en_led_pin)
 en_led_error_t_ led_on(en_led_port_t_ en_led_port, en_led_pin_t_ en_led_pin)
 {
     en_led_error_t_ en_led_error_retval = LED_OK;
-    if((LED_PORT_TOTAL <= en_led_port) || (LED_PIN_TOTAL <= en_led_pin))
+    if(FALSE == led_is_valid(en_led_port, en_led_pin))
     {
         en_led_error_retval = LED_ERROR;
     }
     else
     {
-        en_gpio_error_t en_dio_error = gpio_setPinVal((en_gpio_port_t) en_led_port,
-                                                       (en_gpio_pin_t) en_led_pin,
-                                                       HIGH);
+        boolean bool_masked = cpu_irq_save();
+
+        gl_arr_u8_led_desired[en_led_port] |= (1 << en_led_pin);
+        en_led_error_retval = led_flush(en_led_port, (1 << en_led_pin));
 
-        en_led_error_retval = (en_dio_error != GPIO_OK ? LED_ERROR : LED_OK);
+        cpu_irq_restore(bool_masked);
     }
 
     return en_led_error_retval;
@@ -87,16 +177,18 @@ en_led_error_t_ led_off(en_led_port_t_ en_led_port, en_led_pin_t_ en_led_pin)
 {
     en_led_error_t_ en_led_error_retval = LED_OK;
 
-    if((LED_PORT_TOTAL <= en_led_port) || (LED_PIN_TOTAL <= en_led_pin))
+    if(FALSE == led_is_valid(en_led_port, en_led_pin))
     {
         en_led_error_retval = LED_ERROR;
     }
     else
     {
-        en_gpio_error_t en_dio_error = gpio_setPinVal((en_gpio_port_t) en_led_port,
-                                                       (en_gpio_pin_t) en_led_pin,
-                                                       LOW);
-        en_led_error_retval = (en_dio_error != GPIO_OK ? LED_ERROR : LED_OK);
+        boolean bool_masked = cpu_irq_save();
+
+        gl_arr_u8_led_desired[en_led_port] &= ~(1 << en_led_pin);
+        en_led_error_retval = led_flush(en_led_port, (1 << en_led_pin));
+
+        cpu_irq_restore(bool_masked);
     }
 
     return en_led_error_retval;
@@ -115,16 +207,155 @@ en_led_error_t_ led_toggle(en_led_port_t_ en_led_port, en_led_pin_t_ en_led_pin)
 {
     en_led_error_t_ en_led_error_retval = LED_OK;
 
-    if((LED_PORT_TOTAL <= en_led_port) || (LED_PIN_TOTAL <= en_led_pin))
+    if(FALSE == led_is_valid(en_led_port, en_led_pin))
+    {
+        en_led_error_retval = LED_ERROR;
+    }
+    else
+    {
+        boolean bool_masked = cpu_irq_save();
+
+        gl_arr_u8_led_desired[en_led_port] ^= (1 << en_led_pin);
+        en_led_error_retval = led_flush(en_led_port, (1 << en_led_pin));
+
+        cpu_irq_restore(bool_masked);
+    }
+
+    return en_led_error_retval;
+}
+
+/**
+ * @brief                       :   Sets the state of an LED in the state cache without touching the hardware,
+ *                                  pending changes are written by led_commit
+ *
+ * @param[in]   en_led_port    :   LED Port
+ * @param[in]   en_led_pin     :   LED Pin number in en_led_port
+ * @param[in]   en_led_state   :   Requested LED state
+ *
+ * @return  LED_OK              :   In case of Successful Operation
+ *          LED_ERROR           :   In case of Failed Operation
+ */
+en_led_error_t_ led_stage(en_led_port_t_ en_led_port, en_led_pin_t_ en_led_pin, en_led_state_t_ en_led_state)
+{
+    en_led_error_t_ en_led_error_retval = LED_OK;
+
+    if((FALSE == led_is_valid(en_led_port, en_led_pin)) || (LED_STATE_TOTAL <= en_led_state))
+    {
+        en_led_error_retval = LED_ERROR;
+    }
+    else
+    {
+        boolean bool_masked = cpu_irq_save();
+
+        if(LED_STATE_ON == en_led_state)
+        {
+            gl_arr_u8_led_desired[en_led_port] |= (1 << en_led_pin);
+        }
+        else
+        {
+            gl_arr_u8_led_desired[en_led_port] &= ~(1 << en_led_pin);
+        }
+
+        cpu_irq_restore(bool_masked);
+    }
+
+    return en_led_error_retval;
+}
+
+/**
+ * @brief                       :   Writes all pending LED changes of a port in one port write,
+ *                                  nothing is written if no LED changed
+ *
+ * @param[in]   en_led_port    :   LED Port
+ *
+ * @return  LED_OK              :   In case of Successful Operation
+ *          LED_ERROR           :   In case of Failed Operation
+ */
+en_led_error_t_ led_commit(en_led_port_t_ en_led_port)
+{
+    en_led_error_t_ en_led_error_retval = LED_OK;
+
+    if(LED_PORT_TOTAL <= en_led_port)
+    {
+        en_led_error_retval = LED_ERROR;
+    }
+    else
+    {
+        boolean bool_masked = cpu_irq_save();
+
+        en_led_error_retval = led_flush(en_led_port, gl_arr_u8_led_pins[en_led_port]);
+
+        cpu_irq_restore(bool_masked);
+    }
+
+    return en_led_error_retval;
+}
+
+/**
+ * @brief                       :   Sets the states of several LEDs of a port and writes the changed ones
+ *                                  in one port write
+ *
+ * @param[in]   en_led_port    :   LED Port
+ * @param[in]   u8_mask        :   LED pins to set (all must be initialized LEDs)
+ * @param[in]   u8_levels      :   Pin levels (bit set -> LED on) of the masked pins
+ *
+ * @return  LED_OK              :   In case of Successful Operation
+ *          LED_ERROR           :   In case of Failed Operation
+ */
+en_led_error_t_ led_write_port(en_led_port_t_ en_led_port, uint8_t_ u8_mask, uint8_t_ u8_levels)
+{
+    en_led_error_t_ en_led_error_retval = LED_OK;
+
+    if(
+            (LED_PORT_TOTAL <= en_led_port) ||
+            (u8_mask != (gl_arr_u8_led_pins[en_led_port] & u8_mask))
+            )
     {
         en_led_error_retval = LED_ERROR;
     }
     else
     {
-        en_gpio_error_t en_dio_error = gpio_togPinVal((en_gpio_port_t) en_led_port,
-                                                    (en_gpio_pin_t) en_led_pin);
-        en_led_error_retval = (en_dio_error != GPIO_OK ? LED_ERROR : LED_OK);
+        boolean bool_masked = cpu_irq_save();
+
+        gl_arr_u8_led_desired[en_led_port] = (gl_arr_u8_led_desired[en_led_port] & ~u8_mask) |
+                                             (u8_levels & u8_mask);
+        en_led_error_retval = led_flush(en_led_port, u8_mask);
+
+        cpu_irq_restore(bool_masked);
     }
 
     return en_led_error_retval;
 }
+
+/**
+ * @brief                       :   Reads the issued/elided hardware write counters
+ *
+ * @param[out]  ptr_st_led_stats   :   Pointer to store the counters in
+ *
+ * @return  LED_OK              :   In case of Successful Operation
+ *          LED_ERROR           :   In case of NULL pointer
+ */
+en_led_error_t_ led_get_stats(st_led_stats_t_ * ptr_st_led_stats)
+{
+    en_led_error_t_ en_led_error_retval = LED_OK;
+
+    if(NULL_PTR == ptr_st_led_stats)
+    {
+        en_led_error_retval = LED_ERROR;
+    }
+    else
+    {
+        *ptr_st_led_stats = gl_st_led_stats;
+    }
+
+    return en_led_error_retval;
+}
+
+/**
+ * @brief                       :   Resets the issued/elided hardware write counters
+ */
+void led_reset_stats(void)
+{
+    gl_st_led_stats.u32_writes_issued = 0;
+    gl_st_led_stats.u32_writes_elided = 0;
+}
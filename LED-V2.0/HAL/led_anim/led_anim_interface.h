@@ -0,0 +1,103 @@
+/**
+ * @file    :   led_anim_interface.h
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Header File contains all compressed LED animation player typedefs and functions' prototypes
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Animations are stored compressed in const (flash) tables generated by tools/led_anim_encode.py
+ * and decoded one frame per led_anim_next_frame() call, straight into the output callback:
+ * there is no frame buffer, only changed channels are written, the output keeps the others
+ * (e.g. the tlc59xx back buffer).
+ *
+ * A frame is a sequence of tokens covering all channels in order, the top 2 bits select the
+ * token and the low 6 bits hold the channel count - 1 (1 -> 64 channels):
+ *  SKIP    00nnnnnn                : channels unchanged since the previous frame
+ *  RUN     01nnnnnn v              : channels all set to v
+ *  LITERAL 10nnnnnn v0 v1 ...      : one value per channel
+ *  DELTA   11nnnnnn d1d0 d3d2 ...  : each channel is the previous value written in this frame plus a
+ *                                    signed 4-bit delta (-8 -> 7), two per byte, low nibble first,
+ *                                    the previous value is 0 at the start of a frame
+ * Tokens never cross a frame boundary.
+ */
+
+#ifndef LED_ANIM_INTERFACE_H_
+#define LED_ANIM_INTERFACE_H_
+
+#include "std.h"
+
+/*----------------------------------------------------------/
+/- MACROS
+/----------------------------------------------------------*/
+#define LED_ANIM_TOKEN_SHIFT        6
+#define LED_ANIM_TOKEN_COUNT_MASK   0x3F
+#define LED_ANIM_TOKEN_SKIP         0x00
+#define LED_ANIM_TOKEN_RUN          0x01
+#define LED_ANIM_TOKEN_LITERAL      0x02
+#define LED_ANIM_TOKEN_DELTA        0x03
+
+/*----------------------------------------------------------/
+/- ENUMS
+/----------------------------------------------------------*/
+typedef enum
+{
+    LED_ANIM_OK             = 0 ,
+    LED_ANIM_DONE               ,   /* all frames played, nothing written */
+    LED_ANIM_ERROR              ,   /* invalid arguments or corrupt data, player stopped */
+}en_led_anim_error_t_;
+
+/*----------------------------------------------------------/
+/- STRUCTS
+/----------------------------------------------------------*/
+/* Compressed animation, generated */
+typedef struct
+{
+    const uint8_t_ *        ptr_u8_data     ;
+    uint32_t_               u32_size        ; /* data bytes */
+    uint16_t_               u16_channels    ; /* channels per frame */
+    uint16_t_               u16_frames      ;
+    uint16_t_               u16_frame_ms    ; /* frame period to call led_anim_next_frame with */
+}st_led_anim_t_;
+
+typedef void (*led_anim_cb)(uint16_t_ u16_channel, uint8_t_ u8_value);
+
+typedef struct
+{
+    /** Player state, private to the led_anim module */
+    const st_led_anim_t_ *  ptr_st_anim     ;
+    led_anim_cb             ptr_cbf         ;
+    uint32_t_               u32_offset      ; /* next token */
+    uint16_t_               u16_frame       ; /* next frame */
+}st_led_anim_player_t_;
+
+/*---------------------------------------------------------/
+/- FUNCTION PROTOTYPES
+/---------------------------------------------------------*/
+
+/**
+ * @brief                       :   Rewinds a player to the first frame of an animation
+ *
+ * @param[out]  ptr_st_player   :   Pointer to player instance
+ * @param[in]   ptr_st_anim     :   Pointer to compressed animation (must stay valid)
+ * @param[in]   ptr_cbf         :   Output callback, called once per written channel
+ *
+ * @return  LED_ANIM_OK         :   In case of Successful Operation
+ *          LED_ANIM_ERROR      :   In case of NULL pointer or empty animation
+ */
+en_led_anim_error_t_ led_anim_start(st_led_anim_player_t_ * ptr_st_player, const st_led_anim_t_ * ptr_st_anim,
+                                    led_anim_cb ptr_cbf);
+
+/**
+ * @brief                       :   Decodes the next frame into the output callback
+ *
+ * @param[in]   ptr_st_player   :   Pointer to player instance
+ *
+ * @return  LED_ANIM_OK         :   Frame written
+ *          LED_ANIM_DONE       :   No frames left, led_anim_start replays
+ *          LED_ANIM_ERROR      :   In case of NULL pointer, stopped player or corrupt data
+ */
+en_led_anim_error_t_ led_anim_next_frame(st_led_anim_player_t_ * ptr_st_player);
+
+#endif /* LED_ANIM_INTERFACE_H_ */
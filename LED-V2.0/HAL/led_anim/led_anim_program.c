@@ -0,0 +1,178 @@
+/**
+ * @file    :   led_anim_program.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Program File contains all compressed LED animation player functions' implementation
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "led_anim_interface.h"
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define LED_ANIM_NIBBLE_BITS        4
+#define LED_ANIM_NIBBLE_MASK        0x0F
+#define LED_ANIM_NIBBLE_SIGN        0x08
+
+/*---------------------------------------------------------/
+/- FUNCTION IMPLEMENTATION
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Rewinds a player to the first frame of an animation
+ *
+ * @param[out]  ptr_st_player   :   Pointer to player instance
+ * @param[in]   ptr_st_anim     :   Pointer to compressed animation (must stay valid)
+ * @param[in]   ptr_cbf         :   Output callback, called once per written channel
+ *
+ * @return  LED_ANIM_OK         :   In case of Successful Operation
+ *          LED_ANIM_ERROR      :   In case of NULL pointer or empty animation
+ */
+en_led_anim_error_t_ led_anim_start(st_led_anim_player_t_ * ptr_st_player, const st_led_anim_t_ * ptr_st_anim,
+                                    led_anim_cb ptr_cbf)
+{
+    en_led_anim_error_t_ en_led_anim_error_retval = LED_ANIM_OK;
+
+    if(
+            (NULL_PTR == ptr_st_player)             ||
+            (NULL_PTR == ptr_st_anim)               ||
+            (NULL_PTR == ptr_st_anim->ptr_u8_data)  ||
+            (ZERO == ptr_st_anim->u16_channels)     ||
+            (NULL_PTR == ptr_cbf)
+            )
+    {
+        en_led_anim_error_retval = LED_ANIM_ERROR;
+    }
+    else
+    {
+        ptr_st_player->ptr_st_anim = ptr_st_anim;
+        ptr_st_player->ptr_cbf = ptr_cbf;
+        ptr_st_player->u32_offset = 0;
+        ptr_st_player->u16_frame = 0;
+    }
+
+    return en_led_anim_error_retval;
+}
+
+/**
+ * @brief                       :   Decodes the next frame into the output callback
+ *
+ * @param[in]   ptr_st_player   :   Pointer to player instance
+ *
+ * @return  LED_ANIM_OK         :   Frame written
+ *          LED_ANIM_DONE       :   No frames left, led_anim_start replays
+ *          LED_ANIM_ERROR      :   In case of NULL pointer, stopped player or corrupt data
+ */
+en_led_anim_error_t_ led_anim_next_frame(st_led_anim_player_t_ * ptr_st_player)
+{
+    en_led_anim_error_t_ en_led_anim_error_retval = LED_ANIM_OK;
+
+    if((NULL_PTR == ptr_st_player) || (NULL_PTR == ptr_st_player->ptr_st_anim))
+    {
+        en_led_anim_error_retval = LED_ANIM_ERROR;
+    }
+    else if(ptr_st_player->ptr_st_anim->u16_frames <= ptr_st_player->u16_frame)
+    {
+        en_led_anim_error_retval = LED_ANIM_DONE;
+    }
+    else
+    {
+        const uint8_t_ * ptr_u8_data = ptr_st_player->ptr_st_anim->ptr_u8_data;
+        uint32_t_ u32_size = ptr_st_player->ptr_st_anim->u32_size;
+        uint32_t_ u32_offset = ptr_st_player->u32_offset;
+        uint16_t_ u16_channels = ptr_st_player->ptr_st_anim->u16_channels;
+        uint16_t_ u16_channel = 0;
+        uint8_t_ u8_value = 0;     // previous value written in this frame, DELTA base
+        uint8_t_ u8_token;
+        uint8_t_ u8_count;
+        uint8_t_ u8_index;
+        uint8_t_ u8_nibble;
+        uint32_t_ u32_operands;
+
+        while((LED_ANIM_OK == en_led_anim_error_retval) && (u16_channel < u16_channels))
+        {
+            u8_token = (u32_offset < u32_size) ? ptr_u8_data[u32_offset] : 0;
+            u8_count = (u8_token & LED_ANIM_TOKEN_COUNT_MASK) + 1;
+
+            switch(u8_token >> LED_ANIM_TOKEN_SHIFT)
+            {
+                case LED_ANIM_TOKEN_SKIP    : u32_operands = 0; break;
+                case LED_ANIM_TOKEN_RUN     : u32_operands = 1; break;
+                case LED_ANIM_TOKEN_LITERAL : u32_operands = u8_count; break;
+                default                     : u32_operands = (u8_count + 1) / 2; break;    // DELTA
+            }
+
+            if(
+                    (u32_size <= u32_offset)                                ||
+                    ((u32_size - u32_offset - 1) < u32_operands)            ||
+                    ((uint16_t_)(u16_channels - u16_channel) < u8_count)
+                    )
+            {
+                // truncated data or token crossing the frame boundary
+                en_led_anim_error_retval = LED_ANIM_ERROR;
+            }
+            else
+            {
+                u32_offset++;
+
+                switch(u8_token >> LED_ANIM_TOKEN_SHIFT)
+                {
+                    case LED_ANIM_TOKEN_SKIP:
+                    {
+                        u16_channel += u8_count;
+                        break;
+                    }
+                    case LED_ANIM_TOKEN_RUN:
+                    {
+                        u8_value = ptr_u8_data[u32_offset];
+                        for(u8_index = 0; u8_index < u8_count; u8_index++)
+                        {
+                            ptr_st_player->ptr_cbf(u16_channel++, u8_value);
+                        }
+                        break;
+                    }
+                    case LED_ANIM_TOKEN_LITERAL:
+                    {
+                        for(u8_index = 0; u8_index < u8_count; u8_index++)
+                        {
+                            u8_value = ptr_u8_data[u32_offset + u8_index];
+                            ptr_st_player->ptr_cbf(u16_channel++, u8_value);
+                        }
+                        break;
+                    }
+                    default:    // DELTA
+                    {
+                        for(u8_index = 0; u8_index < u8_count; u8_index++)
+                        {
+                            u8_nibble = (ptr_u8_data[u32_offset + (u8_index >> 1)] >>
+                                         ((u8_index & 1) * LED_ANIM_NIBBLE_BITS)) & LED_ANIM_NIBBLE_MASK;
+
+                            // sign extend, wraps modulo 256 like the encoder
+                            u8_value += (u8_nibble & LED_ANIM_NIBBLE_SIGN) ?
+                                        (uint8_t_)(u8_nibble | (uint8_t_)~LED_ANIM_NIBBLE_MASK) : u8_nibble;
+                            ptr_st_player->ptr_cbf(u16_channel++, u8_value);
+                        }
+                        break;
+                    }
+                }
+
+                u32_offset += u32_operands;
+            }
+        }
+
+        if(LED_ANIM_OK == en_led_anim_error_retval)
+        {
+            ptr_st_player->u32_offset = u32_offset;
+            ptr_st_player->u16_frame++;
+        }
+        else
+        {
+            // stop, the stream position is lost
+            ptr_st_player->ptr_st_anim = NULL_PTR;
+        }
+    }
+
+    return en_led_anim_error_retval;
+}
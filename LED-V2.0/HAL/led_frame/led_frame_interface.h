@@ -0,0 +1,103 @@
+/**
+ * @file    :   led_frame_interface.h
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Header File contains all LED frame buffer typedefs and functions' prototypes
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Logical LEDs are drawn into a back buffer and shown together:
+ * led_frame_commit() requests the swap, the refresh tick (the interrupt of the
+ * timer given to led_frame_init) swaps the buffers and writes every changed
+ * port once.
+ *
+ * Each logical LED is a GPIO pin driven directly, so a frame holds at most
+ * LED_FRAME_LEDS_MAX = 6 ports x 8 pins = 48 LEDs. Larger boards (up to 256
+ * LEDs) go through a driver chain, which keeps its own back buffer and latches
+ * it at once: tlc59xx (TLC5947, 24 LEDs per chip), ws2812 or led_matrix.
+ */
+
+#ifndef LED_FRAME_INTERFACE_H_
+#define LED_FRAME_INTERFACE_H_
+
+#include "led_interface.h"
+#include "timer_interface.h"
+
+/*----------------------------------------------------------/
+/- MACROS
+/----------------------------------------------------------*/
+#define LED_FRAME_LEDS_MAX      (LED_PORT_TOTAL * LED_PIN_TOTAL)    /* one logical LED per pin */
+
+/*----------------------------------------------------------/
+/- ENUMS
+/----------------------------------------------------------*/
+typedef enum
+{
+    LED_FRAME_OK            = 0 ,
+    LED_FRAME_ERROR             ,
+    LED_FRAME_BUSY              ,   /* a committed frame is waiting for the refresh tick */
+}en_led_frame_error_t_;
+
+/*----------------------------------------------------------/
+/- STRUCTS
+/----------------------------------------------------------*/
+/* Logical LED -> pin mapping entry, index in the table is the logical LED number */
+typedef struct
+{
+    en_led_port_t_  en_led_port ;
+    en_led_pin_t_   en_led_pin  ;
+}st_led_frame_map_t_;
+
+typedef struct
+{
+    const st_led_frame_map_t_ * ptr_st_map      ; /* mapping table (must stay valid) */
+    uint8_t_                    u8_leds_count   ; /* entries in the table (1 -> LED_FRAME_LEDS_MAX) */
+    en_timer_t                  en_timer        ; /* refresh tick time base */
+    uint16_t_                   u16_refresh_hz  ; /* refresh ticks per second, a commit waits at most one */
+}st_led_frame_cfg_t_;
+
+/*---------------------------------------------------------/
+/- FUNCTION PROTOTYPES
+/---------------------------------------------------------*/
+
+/**
+ * @brief                       :   Compiles the mapping table into per-port masks, initializes every LED,
+ *                                  clears both buffers and starts the refresh tick timer
+ *
+ * @param[in]   ptr_st_cfg      :   Pointer to frame buffer configuration
+ *
+ * @return  LED_FRAME_OK        :   In case of Successful Operation
+ *          LED_FRAME_ERROR     :   In case of invalid table, duplicated pin, LED or timer init failure
+ */
+en_led_frame_error_t_ led_frame_init(const st_led_frame_cfg_t_ * ptr_st_cfg);
+
+/**
+ * @brief                       :   Draws one logical LED into the back buffer
+ *
+ * @param[in]   u8_led          :   Logical LED number
+ * @param[in]   en_led_state    :   LED state
+ *
+ * @return  LED_FRAME_OK        :   In case of Successful Operation
+ *          LED_FRAME_BUSY      :   Back buffer is committed and waits for the refresh tick
+ *          LED_FRAME_ERROR     :   In case of invalid LED or state
+ */
+en_led_frame_error_t_ led_frame_set(uint8_t_ u8_led, en_led_state_t_ en_led_state);
+
+/**
+ * @brief                       :   Requests showing the back buffer on the next refresh tick
+ *
+ * @return  LED_FRAME_OK        :   In case of Successful Operation
+ *          LED_FRAME_BUSY      :   Previous commit not applied yet
+ */
+en_led_frame_error_t_ led_frame_commit(void);
+
+/**
+ * @brief                       :   Checks whether a committed frame waits for the refresh tick
+ *
+ * @return  TRUE                :   Commit pending
+ *          FALSE               :   Back buffer free for drawing
+ */
+boolean led_frame_is_pending(void);
+
+#endif /* LED_FRAME_INTERFACE_H_ */
@@ -0,0 +1,252 @@
+/**
+ * @file    :   led_frame_program.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Program File contains all LED frame buffer functions' implementation
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "led_frame_interface.h"
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define LED_FRAME_BUFFERS_TOTAL     2
+#define LED_FRAME_US_PER_S          1000000UL
+
+/*---------------------------------------------------------/
+/- PRIVATE TYPEDEFS
+/---------------------------------------------------------*/
+/* Compiled mapping entry, logical LED -> port image bit */
+typedef struct
+{
+    uint8_t_ u8_port    ;
+    uint8_t_ u8_mask    ;
+}st_led_frame_slot_t;
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+static st_led_frame_slot_t gl_arr_st_led_frame_slots[LED_FRAME_LEDS_MAX];
+static uint8_t_ gl_u8_led_frame_leds_count = 0;
+
+/* pins owned by the frame buffer per port, and the ports that own any (in port order) */
+static uint8_t_ gl_arr_u8_led_frame_port_masks[LED_PORT_TOTAL] = {0};
+static uint8_t_ gl_arr_u8_led_frame_ports[LED_PORT_TOTAL];
+static uint8_t_ gl_u8_led_frame_ports_count = 0;
+
+/* frames are kept as port images, one byte per port */
+static uint8_t_ gl_arr_u8_led_frame_buffers[LED_FRAME_BUFFERS_TOTAL][LED_PORT_TOTAL];
+static uint8_t_ gl_u8_led_frame_back = 0;
+
+/* the main line draws and commits only while no frame is pending, the tick swaps only while one is */
+static volatile boolean gl_bool_led_frame_pending = FALSE;
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Refresh tick (timer interrupt), swaps the buffers if a frame was committed
+ *                                  and writes the difference with one write per changed port
+ */
+static void led_frame_tick(void)
+{
+    if(TRUE == gl_bool_led_frame_pending)
+    {
+        uint8_t_ u8_front = gl_u8_led_frame_back;
+        uint8_t_ u8_index;
+
+        // swap, new back buffer starts as a copy of the shown frame
+        gl_u8_led_frame_back ^= 1;
+
+        for(u8_index = 0; u8_index < gl_u8_led_frame_ports_count; u8_index++)
+        {
+            uint8_t_ u8_port = gl_arr_u8_led_frame_ports[u8_index];
+            uint8_t_ u8_image = gl_arr_u8_led_frame_buffers[u8_front][u8_port];
+
+            gl_arr_u8_led_frame_buffers[gl_u8_led_frame_back][u8_port] = u8_image;
+
+            // unchanged ports are elided by the LED state cache
+            led_write_port((en_led_port_t_) u8_port, gl_arr_u8_led_frame_port_masks[u8_port], u8_image);
+        }
+
+        gl_bool_led_frame_pending = FALSE;
+    }
+}
+
+/*---------------------------------------------------------/
+/- FUNCTION IMPLEMENTATION
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Compiles the mapping table into per-port masks, initializes every LED,
+ *                                  clears both buffers and starts the refresh tick timer
+ *
+ * @param[in]   ptr_st_cfg      :   Pointer to frame buffer configuration
+ *
+ * @return  LED_FRAME_OK        :   In case of Successful Operation
+ *          LED_FRAME_ERROR     :   In case of invalid table, duplicated pin, LED or timer init failure
+ */
+en_led_frame_error_t_ led_frame_init(const st_led_frame_cfg_t_ * ptr_st_cfg)
+{
+    en_led_frame_error_t_ en_led_frame_error_retval = LED_FRAME_OK;
+    uint8_t_ u8_index;
+
+    gl_u8_led_frame_leds_count = 0;
+    gl_u8_led_frame_ports_count = 0;
+    gl_bool_led_frame_pending = FALSE;
+    gl_u8_led_frame_back = 0;
+
+    for(u8_index = 0; u8_index < LED_PORT_TOTAL; u8_index++)
+    {
+        gl_arr_u8_led_frame_port_masks[u8_index] = 0;
+        gl_arr_u8_led_frame_buffers[0][u8_index] = 0;
+        gl_arr_u8_led_frame_buffers[1][u8_index] = 0;
+    }
+
+    if(
+            (NULL_PTR == ptr_st_cfg)                                                        ||
+            (NULL_PTR == ptr_st_cfg->ptr_st_map)                                            ||
+            (ZERO == ptr_st_cfg->u8_leds_count) || (LED_FRAME_LEDS_MAX < ptr_st_cfg->u8_leds_count) ||
+            (ZERO == ptr_st_cfg->u16_refresh_hz)
+            )
+    {
+        en_led_frame_error_retval = LED_FRAME_ERROR;
+    }
+    else
+    {
+        const st_led_frame_map_t_ * ptr_st_map = ptr_st_cfg->ptr_st_map;
+
+        // 1. compile logical LEDs into (port, bit) slots
+        for(u8_index = 0; (u8_index < ptr_st_cfg->u8_leds_count) && (LED_FRAME_OK == en_led_frame_error_retval); u8_index++)
+        {
+            en_led_port_t_ en_led_port = ptr_st_map[u8_index].en_led_port;
+            en_led_pin_t_ en_led_pin = ptr_st_map[u8_index].en_led_pin;
+
+            if(
+                    (LED_PORT_TOTAL <= en_led_port)                                         ||
+                    (LED_PIN_TOTAL <= en_led_pin)                                           ||
+                    (ZERO != (gl_arr_u8_led_frame_port_masks[en_led_port] & (1 << en_led_pin))) ||
+                    (LED_OK != led_init(en_led_port, en_led_pin))
+                    )
+            {
+                en_led_frame_error_retval = LED_FRAME_ERROR;
+            }
+            else
+            {
+                gl_arr_st_led_frame_slots[u8_index].u8_port = en_led_port;
+                gl_arr_st_led_frame_slots[u8_index].u8_mask = (1 << en_led_pin);
+                gl_arr_u8_led_frame_port_masks[en_led_port] |= (1 << en_led_pin);
+            }
+        }
+
+        // 2. group by port, the refresh tick only walks the ports in use
+        if(LED_FRAME_OK == en_led_frame_error_retval)
+        {
+            for(u8_index = 0; u8_index < LED_PORT_TOTAL; u8_index++)
+            {
+                if(ZERO != gl_arr_u8_led_frame_port_masks[u8_index])
+                {
+                    gl_arr_u8_led_frame_ports[gl_u8_led_frame_ports_count++] = u8_index;
+                }
+            }
+
+            gl_u8_led_frame_leds_count = ptr_st_cfg->u8_leds_count;
+        }
+
+        // 3. refresh tick, applies commits
+        if(LED_FRAME_OK == en_led_frame_error_retval)
+        {
+            st_timer_cfg_t st_timer_cfg = {
+                .en_timer       = ptr_st_cfg->en_timer,
+                .u32_period_us  = LED_FRAME_US_PER_S / ptr_st_cfg->u16_refresh_hz,
+                .ptr_cbf        = led_frame_tick
+            };
+
+            if(
+                    (TIMER_OK != timer_init_periodic(&st_timer_cfg))                        ||
+                    (TIMER_OK != timer_start(ptr_st_cfg->en_timer))
+                    )
+            {
+                gl_u8_led_frame_leds_count = 0;
+                en_led_frame_error_retval = LED_FRAME_ERROR;
+            }
+        }
+    }
+
+    return en_led_frame_error_retval;
+}
+
+/**
+ * @brief                       :   Draws one logical LED into the back buffer
+ *
+ * @param[in]   u8_led          :   Logical LED number
+ * @param[in]   en_led_state    :   LED state
+ *
+ * @return  LED_FRAME_OK        :   In case of Successful Operation
+ *          LED_FRAME_BUSY      :   Back buffer is committed and waits for the refresh tick
+ *          LED_FRAME_ERROR     :   In case of invalid LED or state
+ */
+en_led_frame_error_t_ led_frame_set(uint8_t_ u8_led, en_led_state_t_ en_led_state)
+{
+    en_led_frame_error_t_ en_led_frame_error_retval = LED_FRAME_OK;
+
+    if((gl_u8_led_frame_leds_count <= u8_led) || (LED_STATE_TOTAL <= en_led_state))
+    {
+        en_led_frame_error_retval = LED_FRAME_ERROR;
+    }
+    else if(TRUE == gl_bool_led_frame_pending)
+    {
+        en_led_frame_error_retval = LED_FRAME_BUSY;
+    }
+    else
+    {
+        uint8_t_ * ptr_u8_image = &gl_arr_u8_led_frame_buffers[gl_u8_led_frame_back]
+                                                             [gl_arr_st_led_frame_slots[u8_led].u8_port];
+
+        if(LED_STATE_ON == en_led_state)
+        {
+            *ptr_u8_image |= gl_arr_st_led_frame_slots[u8_led].u8_mask;
+        }
+        else
+        {
+            *ptr_u8_image &= ~gl_arr_st_led_frame_slots[u8_led].u8_mask;
+        }
+    }
+
+    return en_led_frame_error_retval;
+}
+
+/**
+ * @brief                       :   Requests showing the back buffer on the next refresh tick
+ *
+ * @return  LED_FRAME_OK        :   In case of Successful Operation
+ *          LED_FRAME_BUSY      :   Previous commit not applied yet
+ */
+en_led_frame_error_t_ led_frame_commit(void)
+{
+    en_led_frame_error_t_ en_led_frame_error_retval = LED_FRAME_OK;
+
+    if(TRUE == gl_bool_led_frame_pending)
+    {
+        en_led_frame_error_retval = LED_FRAME_BUSY;
+    }
+    else
+    {
+        gl_bool_led_frame_pending = TRUE;
+    }
+
+    return en_led_frame_error_retval;
+}
+
+/**
+ * @brief                       :   Checks whether a committed frame waits for the refresh tick
+ *
+ * @return  TRUE                :   Commit pending
+ *          FALSE               :   Back buffer free for drawing
+ */
+boolean led_frame_is_pending(void)
+{
+    return gl_bool_led_frame_pending;
+}
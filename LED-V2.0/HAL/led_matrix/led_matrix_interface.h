@@ -0,0 +1,97 @@
+/**
+ * @file    :   led_matrix_interface.h
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Header File contains all LED matrix typedefs and functions' prototypes
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Scans a row/column or a charlieplexed LED matrix from a timer interrupt.
+ * Each scan line (row, or anode pin when charlieplexed) is lit for LED_MATRIX_LEVELS
+ * time slots, an LED of brightness B is on for B of them:
+ *      duty = B / (LED_MATRIX_LEVELS * lines)
+ * Every slot is one precomputed port write, a line change is three.
+ */
+
+#ifndef LED_MATRIX_INTERFACE_H_
+#define LED_MATRIX_INTERFACE_H_
+
+#include "led_interface.h"
+#include "timer_interface.h"
+
+/*----------------------------------------------------------/
+/- MACROS
+/----------------------------------------------------------*/
+#define LED_MATRIX_LINES_MAX        LED_PIN_TOTAL   /* all lines on one port */
+#define LED_MATRIX_COLS_MAX         LED_PIN_TOTAL   /* all columns on one port */
+#define LED_MATRIX_LEVELS           16              /* brightness 0 (off) -> LED_MATRIX_LEVELS (full) */
+
+/*----------------------------------------------------------/
+/- ENUMS
+/----------------------------------------------------------*/
+typedef enum
+{
+    LED_MATRIX_ROW_COL      = 0 ,   /* rows drive LED anodes/cathodes, columns the other side */
+    LED_MATRIX_CHARLIEPLEX      ,   /* n pins, LED(a, b) lit by a high and b low, others hi-Z */
+    LED_MATRIX_TYPE_TOTAL
+}en_led_matrix_type_t_;
+
+typedef enum
+{
+    LED_MATRIX_OK           = 0 ,
+    LED_MATRIX_ERROR            ,
+}en_led_matrix_error_t_;
+
+/*----------------------------------------------------------/
+/- STRUCTS
+/----------------------------------------------------------*/
+typedef struct
+{
+    en_led_matrix_type_t_   en_type                                 ;
+    en_led_port_t_          en_row_port                             ; /* rows, or all charlieplexed pins */
+    en_led_pin_t_           arr_en_row_pins[LED_MATRIX_LINES_MAX]   ;
+    uint8_t_                u8_rows                                 ;
+    en_led_port_t_          en_col_port                             ; /* ignored when charlieplexed */
+    en_led_pin_t_           arr_en_col_pins[LED_MATRIX_COLS_MAX]    ; /* ignored when charlieplexed */
+    uint8_t_                u8_cols                                 ; /* ignored when charlieplexed */
+    boolean                 bool_row_active_high                    ; /* ignored when charlieplexed */
+    boolean                 bool_col_active_high                    ; /* ignored when charlieplexed */
+    en_timer_t              en_timer                                ; /* scan time base */
+    uint16_t_               u16_refresh_hz                          ; /* full matrix refresh rate */
+}st_led_matrix_cfg_t_;
+
+/*---------------------------------------------------------/
+/- FUNCTION PROTOTYPES
+/---------------------------------------------------------*/
+
+/**
+ * @brief                       :   Initializes the matrix pins, precomputes the per-line port masks
+ *                                  and starts the scan timer with all LEDs off
+ *
+ * @param[in]   ptr_st_cfg      :   Pointer to matrix configuration (must stay valid)
+ *
+ * @return  LED_MATRIX_OK       :   In case of Successful Operation
+ *          LED_MATRIX_ERROR    :   In case of invalid configuration
+ */
+en_led_matrix_error_t_ led_matrix_init(const st_led_matrix_cfg_t_ * ptr_st_cfg);
+
+/**
+ * @brief                       :   Sets the brightness of one LED, row/col are the anode/cathode pin
+ *                                  indexes when charlieplexed (row != col)
+ *
+ * @param[in]   u8_row          :   Row (line) index
+ * @param[in]   u8_col          :   Column index
+ * @param[in]   u8_brightness   :   0 (off) -> LED_MATRIX_LEVELS (full)
+ *
+ * @return  LED_MATRIX_OK       :   In case of Successful Operation
+ *          LED_MATRIX_ERROR    :   In case of invalid LED or brightness
+ */
+en_led_matrix_error_t_ led_matrix_set(uint8_t_ u8_row, uint8_t_ u8_col, uint8_t_ u8_brightness);
+
+/**
+ * @brief                       :   Scan step, advances one brightness slot, called by the scan timer
+ */
+void led_matrix_scan(void);
+
+#endif /* LED_MATRIX_INTERFACE_H_ */
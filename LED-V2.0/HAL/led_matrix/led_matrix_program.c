@@ -0,0 +1,409 @@
+/**
+ * @file    :   led_matrix_program.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Program File contains all LED matrix functions' implementation
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "led_matrix_interface.h"
+
+// private includes
+#include "gpio_interface.h"
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define LED_MATRIX_US_PER_S         1000000UL
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+static const st_led_matrix_cfg_t_ * gl_ptr_st_led_matrix_cfg = NULL_PTR;
+
+static uint8_t_ gl_u8_led_matrix_lines = 0;
+static uint8_t_ gl_u8_led_matrix_cols = 0;
+
+/* port masks of the line pins and column pins */
+static uint8_t_ gl_u8_led_matrix_line_mask = 0;
+static uint8_t_ gl_u8_led_matrix_col_mask = 0;
+static uint8_t_ gl_arr_u8_led_matrix_line_bits[LED_MATRIX_LINES_MAX];
+static uint8_t_ gl_arr_u8_led_matrix_col_bits[LED_MATRIX_COLS_MAX];
+
+/* row/col: row port values with no line / only one line active */
+static uint8_t_ gl_u8_led_matrix_rows_idle = 0;
+static uint8_t_ gl_arr_u8_led_matrix_row_on[LED_MATRIX_LINES_MAX];
+
+static uint8_t_ gl_arr_u8_led_matrix_brightness[LED_MATRIX_LINES_MAX][LED_MATRIX_COLS_MAX];
+
+/*
+ * Port value written at each slot of each line
+ *  row/col     : column port value
+ *  charlieplex : direction of the line pins (anode + lit cathodes as outputs)
+ */
+static volatile uint8_t_ gl_arr_u8_led_matrix_slots[LED_MATRIX_LINES_MAX][LED_MATRIX_LEVELS];
+
+static uint8_t_ gl_u8_led_matrix_line = 0;
+static uint8_t_ gl_u8_led_matrix_slot = 0;
+static uint8_t_ gl_u8_led_matrix_outputs = 0;     // charlieplex pins currently driven
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Recomputes the slot port values of one line from its brightness row
+ *
+ * @param[in]   u8_line         :   Line index
+ */
+static void led_matrix_compile_line(uint8_t_ u8_line)
+{
+    uint8_t_ u8_slot;
+    uint8_t_ u8_col;
+
+    for(u8_slot = 0; u8_slot < LED_MATRIX_LEVELS; u8_slot++)
+    {
+        uint8_t_ u8_lit = 0;
+
+        for(u8_col = 0; u8_col < gl_u8_led_matrix_cols; u8_col++)
+        {
+            if(gl_arr_u8_led_matrix_brightness[u8_line][u8_col] > u8_slot)
+            {
+                u8_lit |= gl_arr_u8_led_matrix_col_bits[u8_col];
+            }
+        }
+
+        if(LED_MATRIX_CHARLIEPLEX == gl_ptr_st_led_matrix_cfg->en_type)
+        {
+            gl_arr_u8_led_matrix_slots[u8_line][u8_slot] = gl_arr_u8_led_matrix_line_bits[u8_line] | u8_lit;
+        }
+        else if(TRUE == gl_ptr_st_led_matrix_cfg->bool_col_active_high)
+        {
+            gl_arr_u8_led_matrix_slots[u8_line][u8_slot] = u8_lit;
+        }
+        else
+        {
+            gl_arr_u8_led_matrix_slots[u8_line][u8_slot] = gl_u8_led_matrix_col_mask & ~u8_lit;
+        }
+    }
+}
+
+/**
+ * @brief                       :   Builds a pin mask from a pin list, fails on invalid or duplicated pins
+ *
+ * @param[in]   ptr_en_pins     :   Pin list
+ * @param[in]   u8_count        :   Pins in the list
+ * @param[out]  ptr_u8_bits     :   Bit of every pin
+ * @param[out]  ptr_u8_mask     :   Mask of all pins
+ *
+ * @return  LED_MATRIX_OK       :   In case of Successful Operation
+ *          LED_MATRIX_ERROR    :   In case of invalid or duplicated pin
+ */
+static en_led_matrix_error_t_ led_matrix_compile_pins(const en_led_pin_t_ * ptr_en_pins, uint8_t_ u8_count,
+                                                      uint8_t_ * ptr_u8_bits, uint8_t_ * ptr_u8_mask)
+{
+    en_led_matrix_error_t_ en_led_matrix_error_retval = LED_MATRIX_OK;
+    uint8_t_ u8_index;
+
+    *ptr_u8_mask = 0;
+
+    for(u8_index = 0; u8_index < u8_count; u8_index++)
+    {
+        if((LED_PIN_TOTAL <= ptr_en_pins[u8_index]) || (ZERO != (*ptr_u8_mask & (1 << ptr_en_pins[u8_index]))))
+        {
+            en_led_matrix_error_retval = LED_MATRIX_ERROR;
+        }
+        else
+        {
+            ptr_u8_bits[u8_index] = (1 << ptr_en_pins[u8_index]);
+            *ptr_u8_mask |= ptr_u8_bits[u8_index];
+        }
+    }
+
+    return en_led_matrix_error_retval;
+}
+
+/**
+ * @brief                       :   Configures the pins of a mask as outputs driven low
+ *
+ * @param[in]   en_led_port     :   Port
+ * @param[in]   u8_mask         :   Pins
+ * @param[in]   en_current      :   Drive strength
+ *
+ * @return  LED_MATRIX_OK       :   In case of Successful Operation
+ *          LED_MATRIX_ERROR    :   In case of GPIO failure
+ */
+static en_led_matrix_error_t_ led_matrix_init_pins(en_led_port_t_ en_led_port, uint8_t_ u8_mask,
+                                                   en_gpio_pin_current_t en_current)
+{
+    en_led_matrix_error_t_ en_led_matrix_error_retval = LED_MATRIX_OK;
+    uint8_t_ u8_pin;
+
+    for(u8_pin = 0; u8_pin < LED_PIN_TOTAL; u8_pin++)
+    {
+        if(ZERO != (u8_mask & (1 << u8_pin)))
+        {
+            st_gpio_cfg_t st_gpio_cfg_pin = {
+                .port = (en_gpio_port_t) en_led_port,
+                .pin = (en_gpio_pin_t) u8_pin,
+                .current = en_current,
+                .pin_cfg = OUTPUT
+            };
+
+            if(GPIO_OK != gpio_pin_init(&st_gpio_cfg_pin))
+            {
+                en_led_matrix_error_retval = LED_MATRIX_ERROR;
+            }
+        }
+    }
+
+    if(LED_MATRIX_OK == en_led_matrix_error_retval)
+    {
+        gpio_setPortMaskedVal((en_gpio_port_t) en_led_port, u8_mask, LOW);
+    }
+
+    return en_led_matrix_error_retval;
+}
+
+/*---------------------------------------------------------/
+/- FUNCTION IMPLEMENTATION
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Initializes the matrix pins, precomputes the per-line port masks
+ *                                  and starts the scan timer with all LEDs off
+ *
+ * @param[in]   ptr_st_cfg      :   Pointer to matrix configuration (must stay valid)
+ *
+ * @return  LED_MATRIX_OK       :   In case of Successful Operation
+ *          LED_MATRIX_ERROR    :   In case of invalid configuration
+ */
+en_led_matrix_error_t_ led_matrix_init(const st_led_matrix_cfg_t_ * ptr_st_cfg)
+{
+    en_led_matrix_error_t_ en_led_matrix_error_retval = LED_MATRIX_OK;
+    uint8_t_ u8_line;
+    uint8_t_ u8_col;
+
+    if(
+            (NULL_PTR == ptr_st_cfg)                        ||
+            (LED_MATRIX_TYPE_TOTAL <= ptr_st_cfg->en_type)  ||
+            (LED_PORT_TOTAL <= ptr_st_cfg->en_row_port)     ||
+            (ZERO == ptr_st_cfg->u8_rows)                   ||
+            (LED_MATRIX_LINES_MAX < ptr_st_cfg->u8_rows)    ||
+            (ZERO == ptr_st_cfg->u16_refresh_hz)
+            )
+    {
+        en_led_matrix_error_retval = LED_MATRIX_ERROR;
+    }
+    else
+    {
+        timer_stop(ptr_st_cfg->en_timer);
+        gl_ptr_st_led_matrix_cfg = ptr_st_cfg;
+        gl_u8_led_matrix_lines = ptr_st_cfg->u8_rows;
+
+        en_led_matrix_error_retval = led_matrix_compile_pins(ptr_st_cfg->arr_en_row_pins, ptr_st_cfg->u8_rows,
+                                                             gl_arr_u8_led_matrix_line_bits,
+                                                             &gl_u8_led_matrix_line_mask);
+    }
+
+    if(LED_MATRIX_OK != en_led_matrix_error_retval)
+    {
+        /* Do Nothing */
+    }
+    else if(LED_MATRIX_CHARLIEPLEX == ptr_st_cfg->en_type)
+    {
+        // every line pin is also a cathode of the other lines
+        gl_u8_led_matrix_cols = gl_u8_led_matrix_lines;
+        gl_u8_led_matrix_col_mask = gl_u8_led_matrix_line_mask;
+        for(u8_col = 0; u8_col < gl_u8_led_matrix_cols; u8_col++)
+        {
+            gl_arr_u8_led_matrix_col_bits[u8_col] = gl_arr_u8_led_matrix_line_bits[u8_col];
+        }
+
+        if(
+                (2 > gl_u8_led_matrix_lines)                                                ||
+                (LED_MATRIX_OK != led_matrix_init_pins(ptr_st_cfg->en_row_port, gl_u8_led_matrix_line_mask,
+                                                       PIN_CURRENT_8MA))
+                )
+        {
+            en_led_matrix_error_retval = LED_MATRIX_ERROR;
+        }
+        else
+        {
+            // pins idle as inputs (hi-Z) with their output latches low
+            gpio_setPortMaskedDir((en_gpio_port_t) ptr_st_cfg->en_row_port, gl_u8_led_matrix_line_mask, 0);
+            gl_u8_led_matrix_outputs = 0;
+        }
+    }
+    else
+    {
+        gl_u8_led_matrix_cols = ptr_st_cfg->u8_cols;
+
+        if(
+                (LED_PORT_TOTAL <= ptr_st_cfg->en_col_port) ||
+                (ZERO == ptr_st_cfg->u8_cols)               ||
+                (LED_MATRIX_COLS_MAX < ptr_st_cfg->u8_cols) ||
+                (LED_MATRIX_OK != led_matrix_compile_pins(ptr_st_cfg->arr_en_col_pins, ptr_st_cfg->u8_cols,
+                                                          gl_arr_u8_led_matrix_col_bits,
+                                                          &gl_u8_led_matrix_col_mask))      ||
+                ((ptr_st_cfg->en_col_port == ptr_st_cfg->en_row_port) &&
+                 (ZERO != (gl_u8_led_matrix_col_mask & gl_u8_led_matrix_line_mask)))
+                )
+        {
+            en_led_matrix_error_retval = LED_MATRIX_ERROR;
+        }
+        else
+        {
+            // precompute row port values
+            gl_u8_led_matrix_rows_idle = (TRUE == ptr_st_cfg->bool_row_active_high) ? 0 : gl_u8_led_matrix_line_mask;
+            for(u8_line = 0; u8_line < gl_u8_led_matrix_lines; u8_line++)
+            {
+                gl_arr_u8_led_matrix_row_on[u8_line] = gl_u8_led_matrix_rows_idle ^ gl_arr_u8_led_matrix_line_bits[u8_line];
+            }
+
+            // rows sink/source a whole line
+            if(
+                    (LED_MATRIX_OK != led_matrix_init_pins(ptr_st_cfg->en_row_port, gl_u8_led_matrix_line_mask,
+                                                           PIN_CURRENT_8MA))    ||
+                    (LED_MATRIX_OK != led_matrix_init_pins(ptr_st_cfg->en_col_port, gl_u8_led_matrix_col_mask,
+                                                           PIN_CURRENT_2MA))
+                    )
+            {
+                en_led_matrix_error_retval = LED_MATRIX_ERROR;
+            }
+            else
+            {
+                gpio_setPortMaskedVal((en_gpio_port_t) ptr_st_cfg->en_row_port, gl_u8_led_matrix_line_mask,
+                                      gl_u8_led_matrix_rows_idle);
+            }
+        }
+    }
+
+    if(LED_MATRIX_OK == en_led_matrix_error_retval)
+    {
+        st_timer_cfg_t st_timer_cfg = {
+            .en_timer       = ptr_st_cfg->en_timer,
+            .u32_period_us  = LED_MATRIX_US_PER_S /
+                              ((uint32_t_) ptr_st_cfg->u16_refresh_hz * gl_u8_led_matrix_lines * LED_MATRIX_LEVELS),
+            .ptr_cbf        = led_matrix_scan
+        };
+
+        // all off
+        for(u8_line = 0; u8_line < gl_u8_led_matrix_lines; u8_line++)
+        {
+            for(u8_col = 0; u8_col < gl_u8_led_matrix_cols; u8_col++)
+            {
+                gl_arr_u8_led_matrix_brightness[u8_line][u8_col] = 0;
+            }
+            led_matrix_compile_line(u8_line);
+        }
+
+        // next scan step starts line 0
+        gl_u8_led_matrix_line = gl_u8_led_matrix_lines - 1;
+        gl_u8_led_matrix_slot = LED_MATRIX_LEVELS - 1;
+
+        if(
+                (TIMER_OK != timer_init_periodic(&st_timer_cfg)) ||
+                (TIMER_OK != timer_start(ptr_st_cfg->en_timer))
+                )
+        {
+            en_led_matrix_error_retval = LED_MATRIX_ERROR;
+        }
+    }
+
+    return en_led_matrix_error_retval;
+}
+
+/**
+ * @brief                       :   Sets the brightness of one LED, row/col are the anode/cathode pin
+ *                                  indexes when charlieplexed (row != col)
+ *
+ * @param[in]   u8_row          :   Row (line) index
+ * @param[in]   u8_col          :   Column index
+ * @param[in]   u8_brightness   :   0 (off) -> LED_MATRIX_LEVELS (full)
+ *
+ * @return  LED_MATRIX_OK       :   In case of Successful Operation
+ *          LED_MATRIX_ERROR    :   In case of invalid LED or brightness
+ */
+en_led_matrix_error_t_ led_matrix_set(uint8_t_ u8_row, uint8_t_ u8_col, uint8_t_ u8_brightness)
+{
+    en_led_matrix_error_t_ en_led_matrix_error_retval = LED_MATRIX_OK;
+
+    if(
+            (NULL_PTR == gl_ptr_st_led_matrix_cfg)      ||
+            (gl_u8_led_matrix_lines <= u8_row)          ||
+            (gl_u8_led_matrix_cols <= u8_col)           ||
+            (LED_MATRIX_LEVELS < u8_brightness)         ||
+            ((LED_MATRIX_CHARLIEPLEX == gl_ptr_st_led_matrix_cfg->en_type) && (u8_row == u8_col))
+            )
+    {
+        en_led_matrix_error_retval = LED_MATRIX_ERROR;
+    }
+    else
+    {
+        gl_arr_u8_led_matrix_brightness[u8_row][u8_col] = u8_brightness;
+        led_matrix_compile_line(u8_row);
+    }
+
+    return en_led_matrix_error_retval;
+}
+
+/**
+ * @brief                       :   Scan step, advances one brightness slot, called by the scan timer
+ */
+void led_matrix_scan(void)
+{
+    const st_led_matrix_cfg_t_ * ptr_st_cfg = gl_ptr_st_led_matrix_cfg;
+    en_gpio_port_t en_row_port = (en_gpio_port_t) ptr_st_cfg->en_row_port;
+
+    gl_u8_led_matrix_slot++;
+
+    if(LED_MATRIX_LEVELS > gl_u8_led_matrix_slot)
+    {
+        // same line, next slot: one write
+        if(LED_MATRIX_CHARLIEPLEX == ptr_st_cfg->en_type)
+        {
+            gl_u8_led_matrix_outputs = gl_arr_u8_led_matrix_slots[gl_u8_led_matrix_line][gl_u8_led_matrix_slot];
+            gpio_setPortMaskedDir(en_row_port, gl_u8_led_matrix_line_mask, gl_u8_led_matrix_outputs);
+        }
+        else
+        {
+            gpio_setPortMaskedVal((en_gpio_port_t) ptr_st_cfg->en_col_port, gl_u8_led_matrix_col_mask,
+                                  gl_arr_u8_led_matrix_slots[gl_u8_led_matrix_line][gl_u8_led_matrix_slot]);
+        }
+    }
+    else
+    {
+        gl_u8_led_matrix_slot = 0;
+        gl_u8_led_matrix_line++;
+        if(gl_u8_led_matrix_lines <= gl_u8_led_matrix_line)
+        {
+            gl_u8_led_matrix_line = 0;
+        }
+
+        if(LED_MATRIX_CHARLIEPLEX == ptr_st_cfg->en_type)
+        {
+            // blank (drive all low), anode only, anode high, then anode + lit cathodes
+            if(ZERO != gl_u8_led_matrix_outputs)
+            {
+                gpio_setPortMaskedVal(en_row_port, gl_u8_led_matrix_outputs, LOW);
+            }
+            gpio_setPortMaskedDir(en_row_port, gl_u8_led_matrix_line_mask,
+                                  gl_arr_u8_led_matrix_line_bits[gl_u8_led_matrix_line]);
+            gpio_setPortMaskedVal(en_row_port, gl_arr_u8_led_matrix_line_bits[gl_u8_led_matrix_line],
+                                  gl_arr_u8_led_matrix_line_bits[gl_u8_led_matrix_line]);
+
+            gl_u8_led_matrix_outputs = gl_arr_u8_led_matrix_slots[gl_u8_led_matrix_line][0];
+            gpio_setPortMaskedDir(en_row_port, gl_u8_led_matrix_line_mask, gl_u8_led_matrix_outputs);
+        }
+        else
+        {
+            // blank rows, next line columns, next row on
+            gpio_setPortMaskedVal(en_row_port, gl_u8_led_matrix_line_mask, gl_u8_led_matrix_rows_idle);
+            gpio_setPortMaskedVal((en_gpio_port_t) ptr_st_cfg->en_col_port, gl_u8_led_matrix_col_mask,
+                                  gl_arr_u8_led_matrix_slots[gl_u8_led_matrix_line][0]);
+            gpio_setPortMaskedVal(en_row_port, gl_u8_led_matrix_line_mask,
+                                  gl_arr_u8_led_matrix_row_on[gl_u8_led_matrix_line]);
+        }
+    }
+}
@@ -0,0 +1,182 @@
+/**
+ * @file    :   led_pattern_interface.h
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Header File contains all LED pattern interpreter typedefs and functions' prototypes
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * LED patterns are small bytecode programs kept in const (flash) tables and written with the
+ * LED_PATTERN_* macros below. The interpreter runs one pattern per st_led_pattern_t_ instance,
+ * led_pattern_tick() advances it by one tick (LED_PATTERN_TICK_MS): timed instructions (fade, wait)
+ * take a fixed number of ticks, zero time instructions run back to back, at most
+ * LED_PATTERN_STEPS_MAX of them per tick. The pattern color goes to the output callback on change.
+ * Addresses are byte offsets in the program, the *_SIZE macros give each instruction's length.
+ *
+ * Example, blue breathing until event 0, then red for 2 s:
+ *
+ *  static const uint8_t_ gl_arr_u8_pattern_breathe[] = {
+ *      LED_PATTERN_LOOP(0),                        //  0: forever
+ *      LED_PATTERN_FADE(0, 0, 255, 1000),          //  2: blue up in 1 s
+ *      LED_PATTERN_WAIT_EVENT(0, 500, 21),         //  8: hold 0.5 s, event 0 -> 21
+ *      LED_PATTERN_FADE(0, 0, 0, 1000),            // 14: blue down in 1 s
+ *      LED_PATTERN_NEXT(),                         // 20
+ *      LED_PATTERN_SET(255, 0, 0),                 // 21: red
+ *      LED_PATTERN_WAIT(2000),                     // 25
+ *      LED_PATTERN_END()                           // 28: off
+ *  };
+ */
+
+#ifndef LED_PATTERN_INTERFACE_H_
+#define LED_PATTERN_INTERFACE_H_
+
+#include "std.h"
+
+/*----------------------------------------------------------/
+/- MACROS
+/----------------------------------------------------------*/
+#ifndef LED_PATTERN_TICK_MS
+#define LED_PATTERN_TICK_MS         10      /* led_pattern_tick() period */
+#endif
+
+#define LED_PATTERN_STEPS_MAX       8       /* zero time instructions per tick, bounds the tick cost */
+#define LED_PATTERN_LOOP_DEPTH      4       /* nested LOOPs */
+#define LED_PATTERN_EVENTS          8       /* event numbers 0 -> 7 */
+#define LED_PATTERN_FOREVER         0xFFFF  /* WAIT_EVENT ticks: no timeout */
+
+/* opcodes */
+#define LED_PATTERN_OP_END          0x00    /* stop, LEDs off */
+#define LED_PATTERN_OP_SET          0x01    /* R G B */
+#define LED_PATTERN_OP_FADE         0x02    /* R G B ticks(16): linear fade from the current color */
+#define LED_PATTERN_OP_WAIT         0x03    /* ticks(16) */
+#define LED_PATTERN_OP_WAIT_EVENT   0x04    /* event ticks(16) address(16): wait up to ticks for the event,
+                                               jump on the event (open loops are dropped), else continue */
+#define LED_PATTERN_OP_LOOP         0x05    /* count: body up to NEXT runs count times, 0: forever */
+#define LED_PATTERN_OP_NEXT         0x06
+#define LED_PATTERN_OP_JUMP         0x07    /* address(16) */
+
+/* instruction sizes in bytes */
+#define LED_PATTERN_END_SIZE        1
+#define LED_PATTERN_SET_SIZE        4
+#define LED_PATTERN_FADE_SIZE       6
+#define LED_PATTERN_WAIT_SIZE       3
+#define LED_PATTERN_WAIT_EVENT_SIZE 6
+#define LED_PATTERN_LOOP_SIZE       2
+#define LED_PATTERN_NEXT_SIZE       1
+#define LED_PATTERN_JUMP_SIZE       3
+
+/* pattern DSL, 16-bit operands are little endian, times in ms are rounded down to ticks */
+#define LED_PATTERN_U16(VAL)                    ((uint8_t_)((VAL) & 0xFF)), ((uint8_t_)(((VAL) >> 8) & 0xFF))
+#define LED_PATTERN_TICKS(MS)                   ((MS) / LED_PATTERN_TICK_MS)
+
+#define LED_PATTERN_END()                       LED_PATTERN_OP_END
+#define LED_PATTERN_SET(R, G, B)                LED_PATTERN_OP_SET, (R), (G), (B)
+#define LED_PATTERN_FADE(R, G, B, MS)           LED_PATTERN_OP_FADE, (R), (G), (B), LED_PATTERN_U16(LED_PATTERN_TICKS(MS))
+#define LED_PATTERN_WAIT(MS)                    LED_PATTERN_OP_WAIT, LED_PATTERN_U16(LED_PATTERN_TICKS(MS))
+#define LED_PATTERN_WAIT_EVENT(EV, MS, ADDR)    LED_PATTERN_OP_WAIT_EVENT, (EV), LED_PATTERN_U16(LED_PATTERN_TICKS(MS)), LED_PATTERN_U16(ADDR)
+#define LED_PATTERN_WAIT_EVENT_FOREVER(EV, ADDR) LED_PATTERN_OP_WAIT_EVENT, (EV), LED_PATTERN_U16(LED_PATTERN_FOREVER), LED_PATTERN_U16(ADDR)
+#define LED_PATTERN_BRANCH(EV, ADDR)            LED_PATTERN_WAIT_EVENT(EV, 0, ADDR)
+#define LED_PATTERN_LOOP(COUNT)                 LED_PATTERN_OP_LOOP, (COUNT)
+#define LED_PATTERN_NEXT()                      LED_PATTERN_OP_NEXT
+#define LED_PATTERN_JUMP(ADDR)                  LED_PATTERN_OP_JUMP, LED_PATTERN_U16(ADDR)
+
+/*----------------------------------------------------------/
+/- ENUMS
+/----------------------------------------------------------*/
+typedef enum
+{
+    LED_PATTERN_OK          = 0 ,
+    LED_PATTERN_ERROR           ,
+}en_led_pattern_error_t_;
+
+typedef enum
+{
+    LED_PATTERN_STOPPED     = 0 ,   /* not started or END reached */
+    LED_PATTERN_RUNNING         ,
+    LED_PATTERN_FAULT           ,   /* bad opcode, operand or address, LOOP nesting, LEDs off */
+}en_led_pattern_state_t_;
+
+/*----------------------------------------------------------/
+/- STRUCTS
+/----------------------------------------------------------*/
+typedef struct
+{
+    uint8_t_                u8_red      ;
+    uint8_t_                u8_green    ;
+    uint8_t_                u8_blue     ;
+}st_led_pattern_color_t_;
+
+typedef void (*led_pattern_cb)(const st_led_pattern_color_t_ * ptr_st_color);
+
+typedef struct
+{
+    /** Interpreter state, private to the led_pattern module */
+    const uint8_t_ *        ptr_u8_program                              ;
+    uint16_t_               u16_length                                  ;
+    led_pattern_cb          ptr_cbf                                     ;
+    en_led_pattern_state_t_ en_state                                    ;
+    uint16_t_               u16_pc                                      ; /* next instruction */
+    uint16_t_               u16_ticks_left                              ; /* of the running timed instruction */
+    uint16_t_               u16_ticks_total                             ;
+    uint8_t_                u8_op                                       ; /* running timed instruction */
+    uint8_t_                u8_event                                    ; /* WAIT_EVENT event */
+    uint16_t_               u16_target                                  ; /* WAIT_EVENT address */
+    st_led_pattern_color_t_ st_color                                    ; /* current */
+    st_led_pattern_color_t_ st_from                                     ; /* fade start */
+    st_led_pattern_color_t_ st_to                                       ; /* fade end */
+    uint16_t_               arr_u16_loop_pc[LED_PATTERN_LOOP_DEPTH]     ;
+    uint8_t_                arr_u8_loop_left[LED_PATTERN_LOOP_DEPTH]    ;
+    uint8_t_                u8_loop_depth                               ;
+    volatile uint8_t_       arr_u8_posted[LED_PATTERN_EVENTS]           ; /* written by led_pattern_post_event only */
+    uint8_t_                arr_u8_seen[LED_PATTERN_EVENTS]             ; /* written by led_pattern_tick only */
+}st_led_pattern_t_;
+
+/*---------------------------------------------------------/
+/- FUNCTION PROTOTYPES
+/---------------------------------------------------------*/
+
+/**
+ * @brief                       :   Starts a pattern from its first instruction with the LEDs off,
+ *                                  clears pending events, the first instruction runs on the next tick
+ *
+ * @param[out]  ptr_st_pattern  :   Pointer to interpreter instance
+ * @param[in]   ptr_u8_program  :   Pointer to pattern bytecode (must stay valid)
+ * @param[in]   u16_length      :   Pattern length in bytes
+ * @param[in]   ptr_cbf         :   Output callback, called with the new color on every change
+ *
+ * @return  LED_PATTERN_OK      :   In case of Successful Operation
+ *          LED_PATTERN_ERROR   :   In case of NULL pointer or empty pattern
+ */
+en_led_pattern_error_t_ led_pattern_start(st_led_pattern_t_ * ptr_st_pattern, const uint8_t_ * ptr_u8_program,
+                                          uint16_t_ u16_length, led_pattern_cb ptr_cbf);
+
+/**
+ * @brief                       :   Advances the pattern by one tick, call every LED_PATTERN_TICK_MS
+ *
+ * @param[in]   ptr_st_pattern  :   Pointer to interpreter instance
+ */
+void led_pattern_tick(st_led_pattern_t_ * ptr_st_pattern);
+
+/**
+ * @brief                       :   Posts an event for WAIT_EVENT, it stays pending until a WAIT_EVENT
+ *                                  on it runs (ISR safe against led_pattern_tick)
+ *
+ * @param[in]   ptr_st_pattern  :   Pointer to interpreter instance
+ * @param[in]   u8_event        :   Event number (0 -> LED_PATTERN_EVENTS - 1)
+ *
+ * @return  LED_PATTERN_OK      :   In case of Successful Operation
+ *          LED_PATTERN_ERROR   :   In case of NULL pointer or invalid event
+ */
+en_led_pattern_error_t_ led_pattern_post_event(st_led_pattern_t_ * ptr_st_pattern, uint8_t_ u8_event);
+
+/**
+ * @brief                       :   Reads the interpreter state
+ *
+ * @param[in]   ptr_st_pattern  :   Pointer to interpreter instance
+ *
+ * @return  interpreter state, LED_PATTERN_STOPPED for NULL pointer
+ */
+en_led_pattern_state_t_ led_pattern_get_state(const st_led_pattern_t_ * ptr_st_pattern);
+
+#endif /* LED_PATTERN_INTERFACE_H_ */
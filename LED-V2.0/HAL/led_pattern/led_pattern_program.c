@@ -0,0 +1,444 @@
+/**
+ * @file    :   led_pattern_program.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Program File contains all LED pattern interpreter functions' implementation
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "led_pattern_interface.h"
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define LED_PATTERN_OP_NONE         0xFF    /* no timed instruction running */
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+/* instruction sizes by opcode */
+static const uint8_t_ gl_arr_u8_led_pattern_sizes[] = {
+    [LED_PATTERN_OP_END]        = LED_PATTERN_END_SIZE,
+    [LED_PATTERN_OP_SET]        = LED_PATTERN_SET_SIZE,
+    [LED_PATTERN_OP_FADE]       = LED_PATTERN_FADE_SIZE,
+    [LED_PATTERN_OP_WAIT]       = LED_PATTERN_WAIT_SIZE,
+    [LED_PATTERN_OP_WAIT_EVENT] = LED_PATTERN_WAIT_EVENT_SIZE,
+    [LED_PATTERN_OP_LOOP]       = LED_PATTERN_LOOP_SIZE,
+    [LED_PATTERN_OP_NEXT]       = LED_PATTERN_NEXT_SIZE,
+    [LED_PATTERN_OP_JUMP]       = LED_PATTERN_JUMP_SIZE
+};
+
+static const st_led_pattern_color_t_ gl_st_led_pattern_off = { 0, 0, 0 };
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Reads a little endian 16-bit operand
+ *
+ * @param[in]   ptr_u8_operand  :   Pointer to the operand's low byte
+ *
+ * @return  operand
+ */
+static uint16_t_ led_pattern_u16(const uint8_t_ * ptr_u8_operand)
+{
+    return (uint16_t_)(ptr_u8_operand[0] | (ptr_u8_operand[1] << 8));
+}
+
+/**
+ * @brief                       :   Stops the pattern with the LEDs off
+ *
+ * @param[in]   ptr_st_pattern  :   Pointer to interpreter instance
+ * @param[in]   en_state        :   LED_PATTERN_STOPPED or LED_PATTERN_FAULT
+ */
+static void led_pattern_stop(st_led_pattern_t_ * ptr_st_pattern, en_led_pattern_state_t_ en_state)
+{
+    ptr_st_pattern->en_state = en_state;
+    ptr_st_pattern->u8_op = LED_PATTERN_OP_NONE;
+    ptr_st_pattern->st_color = gl_st_led_pattern_off;
+}
+
+/**
+ * @brief                       :   Takes a pending event
+ *
+ * @param[in]   ptr_st_pattern  :   Pointer to interpreter instance
+ * @param[in]   u8_event        :   Event number
+ *
+ * @return  TRUE                :   Event was pending, now taken (all posts of it)
+ *          FALSE               :   Event not pending
+ */
+static boolean led_pattern_take_event(st_led_pattern_t_ * ptr_st_pattern, uint8_t_ u8_event)
+{
+    boolean bool_taken = FALSE;
+    uint8_t_ u8_posted = ptr_st_pattern->arr_u8_posted[u8_event];
+
+    if(u8_posted != ptr_st_pattern->arr_u8_seen[u8_event])
+    {
+        ptr_st_pattern->arr_u8_seen[u8_event] = u8_posted;
+        bool_taken = TRUE;
+    }
+
+    return bool_taken;
+}
+
+/**
+ * @brief                       :   Takes the WAIT_EVENT branch, open loops are dropped
+ *
+ * @param[in]   ptr_st_pattern  :   Pointer to interpreter instance
+ * @param[in]   u16_target      :   Branch address
+ */
+static void led_pattern_branch(st_led_pattern_t_ * ptr_st_pattern, uint16_t_ u16_target)
+{
+    ptr_st_pattern->u8_loop_depth = 0;
+    ptr_st_pattern->u8_op = LED_PATTERN_OP_NONE;
+    ptr_st_pattern->u16_pc = u16_target;
+}
+
+/**
+ * @brief                       :   Decodes and runs the instruction at the program counter,
+ *                                  timed instructions are started and left running
+ *
+ * @param[in]   ptr_st_pattern  :   Pointer to interpreter instance
+ */
+static void led_pattern_step(st_led_pattern_t_ * ptr_st_pattern)
+{
+    uint16_t_ u16_pc = ptr_st_pattern->u16_pc;
+    const uint8_t_ * ptr_u8_instr = &ptr_st_pattern->ptr_u8_program[u16_pc];
+    uint8_t_ u8_op = ptr_u8_instr[0];
+    uint16_t_ u16_ticks;
+    uint16_t_ u16_target;
+
+    if(
+            (sizeof(gl_arr_u8_led_pattern_sizes) <= u8_op)                                          ||
+            ((uint32_t_) ptr_st_pattern->u16_length < ((uint32_t_) u16_pc + gl_arr_u8_led_pattern_sizes[u8_op]))
+            )
+    {
+        // unknown opcode or truncated operands
+        led_pattern_stop(ptr_st_pattern, LED_PATTERN_FAULT);
+    }
+    else
+    {
+        ptr_st_pattern->u16_pc = u16_pc + gl_arr_u8_led_pattern_sizes[u8_op];
+
+        switch(u8_op)
+        {
+            case LED_PATTERN_OP_END:
+            {
+                led_pattern_stop(ptr_st_pattern, LED_PATTERN_STOPPED);
+                break;
+            }
+            case LED_PATTERN_OP_SET:
+            {
+                ptr_st_pattern->st_color.u8_red = ptr_u8_instr[1];
+                ptr_st_pattern->st_color.u8_green = ptr_u8_instr[2];
+                ptr_st_pattern->st_color.u8_blue = ptr_u8_instr[3];
+                break;
+            }
+            case LED_PATTERN_OP_FADE:
+            {
+                ptr_st_pattern->st_to.u8_red = ptr_u8_instr[1];
+                ptr_st_pattern->st_to.u8_green = ptr_u8_instr[2];
+                ptr_st_pattern->st_to.u8_blue = ptr_u8_instr[3];
+                u16_ticks = led_pattern_u16(&ptr_u8_instr[4]);
+
+                if(ZERO == u16_ticks)
+                {
+                    ptr_st_pattern->st_color = ptr_st_pattern->st_to;
+                }
+                else
+                {
+                    ptr_st_pattern->st_from = ptr_st_pattern->st_color;
+                    ptr_st_pattern->u16_ticks_total = u16_ticks;
+                    ptr_st_pattern->u16_ticks_left = u16_ticks;
+                    ptr_st_pattern->u8_op = LED_PATTERN_OP_FADE;
+                }
+                break;
+            }
+            case LED_PATTERN_OP_WAIT:
+            {
+                u16_ticks = led_pattern_u16(&ptr_u8_instr[1]);
+
+                if(ZERO != u16_ticks)
+                {
+                    ptr_st_pattern->u16_ticks_left = u16_ticks;
+                    ptr_st_pattern->u8_op = LED_PATTERN_OP_WAIT;
+                }
+                break;
+            }
+            case LED_PATTERN_OP_WAIT_EVENT:
+            {
+                u16_ticks = led_pattern_u16(&ptr_u8_instr[2]);
+                u16_target = led_pattern_u16(&ptr_u8_instr[4]);
+
+                if((LED_PATTERN_EVENTS <= ptr_u8_instr[1]) || (ptr_st_pattern->u16_length <= u16_target))
+                {
+                    led_pattern_stop(ptr_st_pattern, LED_PATTERN_FAULT);
+                }
+                else if(TRUE == led_pattern_take_event(ptr_st_pattern, ptr_u8_instr[1]))
+                {
+                    led_pattern_branch(ptr_st_pattern, u16_target);
+                }
+                else if(ZERO != u16_ticks)
+                {
+                    ptr_st_pattern->u8_event = ptr_u8_instr[1];
+                    ptr_st_pattern->u16_target = u16_target;
+                    ptr_st_pattern->u16_ticks_left = u16_ticks;
+                    ptr_st_pattern->u8_op = LED_PATTERN_OP_WAIT_EVENT;
+                }
+                else
+                {
+                    /* branch not taken, continue */
+                }
+                break;
+            }
+            case LED_PATTERN_OP_LOOP:
+            {
+                if(LED_PATTERN_LOOP_DEPTH <= ptr_st_pattern->u8_loop_depth)
+                {
+                    led_pattern_stop(ptr_st_pattern, LED_PATTERN_FAULT);
+                }
+                else
+                {
+                    ptr_st_pattern->arr_u16_loop_pc[ptr_st_pattern->u8_loop_depth] = ptr_st_pattern->u16_pc;
+                    ptr_st_pattern->arr_u8_loop_left[ptr_st_pattern->u8_loop_depth] = ptr_u8_instr[1];
+                    ptr_st_pattern->u8_loop_depth++;
+                }
+                break;
+            }
+            case LED_PATTERN_OP_NEXT:
+            {
+                uint8_t_ u8_top = ptr_st_pattern->u8_loop_depth - 1;
+
+                if(ZERO == ptr_st_pattern->u8_loop_depth)
+                {
+                    // NEXT without LOOP
+                    led_pattern_stop(ptr_st_pattern, LED_PATTERN_FAULT);
+                }
+                else if(ZERO == ptr_st_pattern->arr_u8_loop_left[u8_top])
+                {
+                    // endless loop
+                    ptr_st_pattern->u16_pc = ptr_st_pattern->arr_u16_loop_pc[u8_top];
+                }
+                else if(ZERO != --ptr_st_pattern->arr_u8_loop_left[u8_top])
+                {
+                    ptr_st_pattern->u16_pc = ptr_st_pattern->arr_u16_loop_pc[u8_top];
+                }
+                else
+                {
+                    ptr_st_pattern->u8_loop_depth--;
+                }
+                break;
+            }
+            case LED_PATTERN_OP_JUMP:
+            {
+                u16_target = led_pattern_u16(&ptr_u8_instr[1]);
+
+                if(ptr_st_pattern->u16_length <= u16_target)
+                {
+                    led_pattern_stop(ptr_st_pattern, LED_PATTERN_FAULT);
+                }
+                else
+                {
+                    ptr_st_pattern->u16_pc = u16_target;
+                }
+                break;
+            }
+            default:
+            {
+                led_pattern_stop(ptr_st_pattern, LED_PATTERN_FAULT);
+                break;
+            }
+        }
+
+        // running off the end of the program
+        if(
+                (LED_PATTERN_RUNNING == ptr_st_pattern->en_state)   &&
+                (ptr_st_pattern->u16_length <= ptr_st_pattern->u16_pc)
+                )
+        {
+            led_pattern_stop(ptr_st_pattern, LED_PATTERN_FAULT);
+        }
+    }
+}
+
+/**
+ * @brief                       :   Advances the running timed instruction by one tick
+ *
+ * @param[in]   ptr_st_pattern  :   Pointer to interpreter instance
+ */
+static void led_pattern_advance(st_led_pattern_t_ * ptr_st_pattern)
+{
+    if(
+            (LED_PATTERN_OP_WAIT_EVENT == ptr_st_pattern->u8_op) &&
+            (TRUE == led_pattern_take_event(ptr_st_pattern, ptr_st_pattern->u8_event))
+            )
+    {
+        led_pattern_branch(ptr_st_pattern, ptr_st_pattern->u16_target);
+    }
+    else
+    {
+        if(
+                (LED_PATTERN_OP_WAIT_EVENT != ptr_st_pattern->u8_op)    ||
+                (LED_PATTERN_FOREVER != ptr_st_pattern->u16_ticks_left)
+                )
+        {
+            ptr_st_pattern->u16_ticks_left--;
+        }
+
+        if(LED_PATTERN_OP_FADE == ptr_st_pattern->u8_op)
+        {
+            // color = to + (from - to) * left / total, reaches to exactly on the last tick
+            sint32_t_ s32_left = ptr_st_pattern->u16_ticks_left;
+            sint32_t_ s32_total = ptr_st_pattern->u16_ticks_total;
+
+            ptr_st_pattern->st_color.u8_red = (uint8_t_)(ptr_st_pattern->st_to.u8_red +
+                    (((sint32_t_) ptr_st_pattern->st_from.u8_red - ptr_st_pattern->st_to.u8_red) * s32_left) / s32_total);
+            ptr_st_pattern->st_color.u8_green = (uint8_t_)(ptr_st_pattern->st_to.u8_green +
+                    (((sint32_t_) ptr_st_pattern->st_from.u8_green - ptr_st_pattern->st_to.u8_green) * s32_left) / s32_total);
+            ptr_st_pattern->st_color.u8_blue = (uint8_t_)(ptr_st_pattern->st_to.u8_blue +
+                    (((sint32_t_) ptr_st_pattern->st_from.u8_blue - ptr_st_pattern->st_to.u8_blue) * s32_left) / s32_total);
+        }
+
+        if(ZERO == ptr_st_pattern->u16_ticks_left)
+        {
+            ptr_st_pattern->u8_op = LED_PATTERN_OP_NONE;
+        }
+    }
+}
+
+/*---------------------------------------------------------/
+/- FUNCTION IMPLEMENTATION
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Starts a pattern from its first instruction with the LEDs off,
+ *                                  clears pending events, the first instruction runs on the next tick
+ *
+ * @param[out]  ptr_st_pattern  :   Pointer to interpreter instance
+ * @param[in]   ptr_u8_program  :   Pointer to pattern bytecode (must stay valid)
+ * @param[in]   u16_length      :   Pattern length in bytes
+ * @param[in]   ptr_cbf         :   Output callback, called with the new color on every change
+ *
+ * @return  LED_PATTERN_OK      :   In case of Successful Operation
+ *          LED_PATTERN_ERROR   :   In case of NULL pointer or empty pattern
+ */
+en_led_pattern_error_t_ led_pattern_start(st_led_pattern_t_ * ptr_st_pattern, const uint8_t_ * ptr_u8_program,
+                                          uint16_t_ u16_length, led_pattern_cb ptr_cbf)
+{
+    en_led_pattern_error_t_ en_led_pattern_error_retval = LED_PATTERN_OK;
+    uint8_t_ u8_event;
+
+    if(
+            (NULL_PTR == ptr_st_pattern)    ||
+            (NULL_PTR == ptr_u8_program)    ||
+            (ZERO == u16_length)            ||
+            (NULL_PTR == ptr_cbf)
+            )
+    {
+        en_led_pattern_error_retval = LED_PATTERN_ERROR;
+    }
+    else
+    {
+        // stop first, a tick from an ISR must not run a half set up pattern
+        ptr_st_pattern->en_state = LED_PATTERN_STOPPED;
+
+        ptr_st_pattern->ptr_u8_program = ptr_u8_program;
+        ptr_st_pattern->u16_length = u16_length;
+        ptr_st_pattern->ptr_cbf = ptr_cbf;
+        ptr_st_pattern->u16_pc = 0;
+        ptr_st_pattern->u8_op = LED_PATTERN_OP_NONE;
+        ptr_st_pattern->u8_loop_depth = 0;
+        ptr_st_pattern->st_color = gl_st_led_pattern_off;
+
+        for(u8_event = 0; u8_event < LED_PATTERN_EVENTS; u8_event++)
+        {
+            ptr_st_pattern->arr_u8_seen[u8_event] = ptr_st_pattern->arr_u8_posted[u8_event];
+        }
+
+        ptr_cbf(&ptr_st_pattern->st_color);
+
+        ptr_st_pattern->en_state = LED_PATTERN_RUNNING;
+    }
+
+    return en_led_pattern_error_retval;
+}
+
+/**
+ * @brief                       :   Advances the pattern by one tick, call every LED_PATTERN_TICK_MS
+ *
+ * @param[in]   ptr_st_pattern  :   Pointer to interpreter instance
+ */
+void led_pattern_tick(st_led_pattern_t_ * ptr_st_pattern)
+{
+    st_led_pattern_color_t_ st_before;
+    uint8_t_ u8_steps = 0;
+
+    if((NULL_PTR != ptr_st_pattern) && (LED_PATTERN_RUNNING == ptr_st_pattern->en_state))
+    {
+        st_before = ptr_st_pattern->st_color;
+
+        if(LED_PATTERN_OP_NONE != ptr_st_pattern->u8_op)
+        {
+            led_pattern_advance(ptr_st_pattern);
+        }
+
+        // an instruction that finished this tick is followed without a gap
+        while(
+                (LED_PATTERN_RUNNING == ptr_st_pattern->en_state)   &&
+                (LED_PATTERN_OP_NONE == ptr_st_pattern->u8_op)      &&
+                (LED_PATTERN_STEPS_MAX > u8_steps)
+                )
+        {
+            led_pattern_step(ptr_st_pattern);
+            u8_steps++;
+        }
+
+        if(
+                (st_before.u8_red != ptr_st_pattern->st_color.u8_red)       ||
+                (st_before.u8_green != ptr_st_pattern->st_color.u8_green)   ||
+                (st_before.u8_blue != ptr_st_pattern->st_color.u8_blue)
+                )
+        {
+            ptr_st_pattern->ptr_cbf(&ptr_st_pattern->st_color);
+        }
+    }
+}
+
+/**
+ * @brief                       :   Posts an event for WAIT_EVENT, it stays pending until a WAIT_EVENT
+ *                                  on it runs (ISR safe against led_pattern_tick)
+ *
+ * @param[in]   ptr_st_pattern  :   Pointer to interpreter instance
+ * @param[in]   u8_event        :   Event number (0 -> LED_PATTERN_EVENTS - 1)
+ *
+ * @return  LED_PATTERN_OK      :   In case of Successful Operation
+ *          LED_PATTERN_ERROR   :   In case of NULL pointer or invalid event
+ */
+en_led_pattern_error_t_ led_pattern_post_event(st_led_pattern_t_ * ptr_st_pattern, uint8_t_ u8_event)
+{
+    en_led_pattern_error_t_ en_led_pattern_error_retval = LED_PATTERN_OK;
+
+    if((NULL_PTR == ptr_st_pattern) || (LED_PATTERN_EVENTS <= u8_event))
+    {
+        en_led_pattern_error_retval = LED_PATTERN_ERROR;
+    }
+    else
+    {
+        ptr_st_pattern->arr_u8_posted[u8_event]++;
+    }
+
+    return en_led_pattern_error_retval;
+}
+
+/**
+ * @brief                       :   Reads the interpreter state
+ *
+ * @param[in]   ptr_st_pattern  :   Pointer to interpreter instance
+ *
+ * @return  interpreter state, LED_PATTERN_STOPPED for NULL pointer
+ */
+en_led_pattern_state_t_ led_pattern_get_state(const st_led_pattern_t_ * ptr_st_pattern)
+{
+    return (NULL_PTR == ptr_st_pattern) ? LED_PATTERN_STOPPED : ptr_st_pattern->en_state;
+}
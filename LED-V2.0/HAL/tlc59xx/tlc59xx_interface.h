@@ -0,0 +1,85 @@
+/**
+ * @file    :   tlc59xx_interface.h
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Header File contains all TLC5947 LED driver chain typedefs and functions' prototypes
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Daisy-chained TLC5947 24-channel 12-bit PWM drivers. Grayscale data is shifted out of SSI2
+ * (CLK: PB4, SIN: PB7) by uDMA using 12 bit SSI frames, one frame per channel, last channel of
+ * the last chip first. XLAT (PB5) is pulsed on the next latch timer tick after the shift
+ * completed, BLANK (PB6) is held low: the TLC5947 runs its PWM from its internal oscillator.
+ * TLC5940 chains are not supported, they need a GSCLK clock and a BLANK pulse every 4096 of its
+ * cycles, which this driver doesn't generate.
+ */
+
+#ifndef TLC59XX_INTERFACE_H_
+#define TLC59XX_INTERFACE_H_
+
+#include "std.h"
+
+/*----------------------------------------------------------/
+/- MACROS
+/----------------------------------------------------------*/
+#define TLC59XX_CHANNELS_PER_CHIP   24      /* TLC5947 */
+#define TLC59XX_CHIPS               4
+#define TLC59XX_CHANNELS            (TLC59XX_CHANNELS_PER_CHIP * TLC59XX_CHIPS)
+
+#define TLC59XX_BRIGHTNESS_MAX      4095    /* 12 bit grayscale */
+#define TLC59XX_LATCH_HZ            200     /* frames latched at most this often */
+
+/*----------------------------------------------------------/
+/- ENUMS
+/----------------------------------------------------------*/
+typedef enum
+{
+    TLC59XX_OK              = 0 ,
+    TLC59XX_ERROR               ,
+    TLC59XX_BUSY                ,
+}en_tlc59xx_error_t_;
+
+/*---------------------------------------------------------/
+/- FUNCTION PROTOTYPES
+/---------------------------------------------------------*/
+
+/**
+ * @brief                       :   Initializes SSI2, its uDMA channel, the XLAT/BLANK pins and the latch timer,
+ *                                  all channels start off
+ *
+ * @return  TLC59XX_OK          :   In case of Successful Operation
+ *          TLC59XX_ERROR       :   In case of Failed Operation
+ */
+en_tlc59xx_error_t_ tlc59xx_init(void);
+
+/**
+ * @brief                       :   Sets the brightness of one channel in the back buffer
+ *
+ * @param[in]   u8_channel      :   Channel (0 -> TLC59XX_CHANNELS - 1), chip 0 channel 0 is 0
+ * @param[in]   u16_brightness  :   0 (off) -> TLC59XX_BRIGHTNESS_MAX (full)
+ *
+ * @return  TLC59XX_OK          :   In case of Successful Operation
+ *          TLC59XX_ERROR       :   In case of invalid channel or brightness
+ */
+en_tlc59xx_error_t_ tlc59xx_set_brightness(uint8_t_ u8_channel, uint16_t_ u16_brightness);
+
+/**
+ * @brief                       :   Swaps the buffers and starts shifting the drawn frame (non-blocking),
+ *                                  the chips latch it on the next latch timer tick
+ *
+ * @return  TLC59XX_OK          :   In case of Successful Operation
+ *          TLC59XX_BUSY        :   Previous frame not latched yet, nothing swapped
+ *          TLC59XX_ERROR       :   In case driver isn't initialized
+ */
+en_tlc59xx_error_t_ tlc59xx_show(void);
+
+/**
+ * @brief                       :   Checks whether a frame is being shifted or waits for its latch
+ *
+ * @return  TRUE                :   Frame in flight
+ *          FALSE               :   Idle
+ */
+boolean tlc59xx_is_busy(void);
+
+#endif /* TLC59XX_INTERFACE_H_ */
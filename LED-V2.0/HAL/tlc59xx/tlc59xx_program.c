@@ -0,0 +1,243 @@
+/**
+ * @file    :   tlc59xx_program.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Program File contains all TLC5947 LED driver chain functions' implementation
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "tlc59xx_interface.h"
+
+// private includes
+#include "gpio_interface.h"
+#include "ssi_interface.h"
+#include "timer_interface.h"
+#include "udma_interface.h"
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define TLC59XX_SSI_MODULE          SSI_2
+#define TLC59XX_DMA_CHANNEL         UDMA_CH_SSI2_TX
+#define TLC59XX_DMA_ENCODING        UDMA_ENC_SSI2
+
+#define TLC59XX_SSI_DATA_SIZE       12      /* one grayscale value per SSI frame */
+#define TLC59XX_SSI_PRESCALE        2       /* PIOSC / 2 = 8 MHz */
+#define TLC59XX_SSI_SCR             0
+
+#define TLC59XX_CTRL_PORT           GPIO_PORT_B
+#define TLC59XX_XLAT_PIN            GPIO_PIN_5
+#define TLC59XX_BLANK_PIN           GPIO_PIN_6
+
+#define TLC59XX_LATCH_TIMER         TIMER_1
+#define TLC59XX_US_PER_S            1000000UL
+
+#define TLC59XX_BUFFERS_TOTAL       2
+
+/*---------------------------------------------------------/
+/- PRIVATE TYPEDEFS
+/---------------------------------------------------------*/
+typedef enum
+{
+    TLC59XX_STATE_IDLE      = 0 ,
+    TLC59XX_STATE_SHIFTING      ,   /* uDMA feeding SSI */
+    TLC59XX_STATE_LATCH_WAIT        /* shifted, waiting for the latch tick */
+}en_tlc59xx_state_t;
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+/* frames in shift order: last channel of the last chip first */
+static uint16_t_ gl_arr_u16_tlc59xx_buffers[TLC59XX_BUFFERS_TOTAL][TLC59XX_CHANNELS];
+static uint8_t_ gl_u8_tlc59xx_back_buffer = 0;
+
+static volatile en_tlc59xx_state_t gl_en_tlc59xx_state = TLC59XX_STATE_IDLE;
+static boolean gl_bool_tlc59xx_initialized = FALSE;
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   SSI2 interrupt callback, uDMA finished feeding the frame
+ */
+static void tlc59xx_dma_done(void)
+{
+    if(TRUE == udma_channel_int_clear(TLC59XX_DMA_CHANNEL))
+    {
+        gl_en_tlc59xx_state = TLC59XX_STATE_LATCH_WAIT;
+    }
+}
+
+/**
+ * @brief                       :   Latch timer callback, pulses XLAT once the last bit left the SSI
+ */
+static void tlc59xx_latch_tick(void)
+{
+    if(
+            (TLC59XX_STATE_LATCH_WAIT == gl_en_tlc59xx_state) &&
+            (FALSE == ssi_is_busy(TLC59XX_SSI_MODULE))
+            )
+    {
+        gpio_setPortMaskedVal(TLC59XX_CTRL_PORT, (1 << TLC59XX_XLAT_PIN), (1 << TLC59XX_XLAT_PIN));
+        gpio_setPortMaskedVal(TLC59XX_CTRL_PORT, (1 << TLC59XX_XLAT_PIN), LOW);
+
+        gl_en_tlc59xx_state = TLC59XX_STATE_IDLE;
+    }
+}
+
+/*---------------------------------------------------------/
+/- FUNCTION IMPLEMENTATION
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Initializes SSI2, its uDMA channel, the XLAT/BLANK pins and the latch timer,
+ *                                  all channels start off
+ *
+ * @return  TLC59XX_OK          :   In case of Successful Operation
+ *          TLC59XX_ERROR       :   In case of Failed Operation
+ */
+en_tlc59xx_error_t_ tlc59xx_init(void)
+{
+    en_tlc59xx_error_t_ en_tlc59xx_error_retval = TLC59XX_OK;
+    st_ssi_cfg_t st_ssi_cfg = {
+        .en_ssi_module          = TLC59XX_SSI_MODULE,
+        .en_ssi_clk_src         = SSI_CLK_SRC_PIOSC,
+        .u8_data_size           = TLC59XX_SSI_DATA_SIZE,
+        .u8_clk_prescale        = TLC59XX_SSI_PRESCALE,
+        .u8_serial_clk_rate     = TLC59XX_SSI_SCR,
+        .bool_tx_dma_enabled    = TRUE
+    };
+    st_timer_cfg_t st_timer_cfg = {
+        .en_timer       = TLC59XX_LATCH_TIMER,
+        .u32_period_us  = TLC59XX_US_PER_S / TLC59XX_LATCH_HZ,
+        .ptr_cbf        = tlc59xx_latch_tick
+    };
+    st_gpio_cfg_t st_gpio_cfg_xlat = {
+        .port = TLC59XX_CTRL_PORT,
+        .pin = TLC59XX_XLAT_PIN,
+        .current = PIN_CURRENT_2MA,
+        .pin_cfg = OUTPUT
+    };
+    st_gpio_cfg_t st_gpio_cfg_blank = st_gpio_cfg_xlat;
+    uint8_t_ u8_channel;
+
+    st_gpio_cfg_blank.pin = TLC59XX_BLANK_PIN;
+
+    for(u8_channel = 0; u8_channel < TLC59XX_CHANNELS; u8_channel++)
+    {
+        gl_arr_u16_tlc59xx_buffers[0][u8_channel] = 0;
+        gl_arr_u16_tlc59xx_buffers[1][u8_channel] = 0;
+    }
+
+    if(
+            (GPIO_OK != gpio_pin_init(&st_gpio_cfg_xlat))                                   ||
+            (GPIO_OK != gpio_pin_init(&st_gpio_cfg_blank))                                  ||
+            (GPIO_OK != gpio_setPortMaskedVal(TLC59XX_CTRL_PORT,
+                                              (1 << TLC59XX_XLAT_PIN) | (1 << TLC59XX_BLANK_PIN),
+                                              LOW))                                         ||
+            (UDMA_OK != udma_init())                                                        ||
+            (UDMA_OK != udma_channel_assign(TLC59XX_DMA_CHANNEL, TLC59XX_DMA_ENCODING))     ||
+            (SSI_OK != ssi_init(&st_ssi_cfg))                                               ||
+            (SSI_OK != ssi_set_callback(TLC59XX_SSI_MODULE, tlc59xx_dma_done))              ||
+            (TIMER_OK != timer_init_periodic(&st_timer_cfg))                                ||
+            (TIMER_OK != timer_start(TLC59XX_LATCH_TIMER))
+            )
+    {
+        en_tlc59xx_error_retval = TLC59XX_ERROR;
+    }
+    else
+    {
+        gl_bool_tlc59xx_initialized = TRUE;
+    }
+
+    return en_tlc59xx_error_retval;
+}
+
+/**
+ * @brief                       :   Sets the brightness of one channel in the back buffer
+ *
+ * @param[in]   u8_channel      :   Channel (0 -> TLC59XX_CHANNELS - 1), chip 0 channel 0 is 0
+ * @param[in]   u16_brightness  :   0 (off) -> TLC59XX_BRIGHTNESS_MAX (full)
+ *
+ * @return  TLC59XX_OK          :   In case of Successful Operation
+ *          TLC59XX_ERROR       :   In case of invalid channel or brightness
+ */
+en_tlc59xx_error_t_ tlc59xx_set_brightness(uint8_t_ u8_channel, uint16_t_ u16_brightness)
+{
+    en_tlc59xx_error_t_ en_tlc59xx_error_retval = TLC59XX_OK;
+
+    if((TLC59XX_CHANNELS <= u8_channel) || (TLC59XX_BRIGHTNESS_MAX < u16_brightness))
+    {
+        en_tlc59xx_error_retval = TLC59XX_ERROR;
+    }
+    else
+    {
+        // the first shifted value ends in the last channel of the last chip
+        gl_arr_u16_tlc59xx_buffers[gl_u8_tlc59xx_back_buffer][(TLC59XX_CHANNELS - 1) - u8_channel] = u16_brightness;
+    }
+
+    return en_tlc59xx_error_retval;
+}
+
+/**
+ * @brief                       :   Swaps the buffers and starts shifting the drawn frame (non-blocking),
+ *                                  the chips latch it on the next latch timer tick
+ *
+ * @return  TLC59XX_OK          :   In case of Successful Operation
+ *          TLC59XX_BUSY        :   Previous frame not latched yet, nothing swapped
+ *          TLC59XX_ERROR       :   In case driver isn't initialized
+ */
+en_tlc59xx_error_t_ tlc59xx_show(void)
+{
+    en_tlc59xx_error_t_ en_tlc59xx_error_retval = TLC59XX_OK;
+
+    if(FALSE == gl_bool_tlc59xx_initialized)
+    {
+        en_tlc59xx_error_retval = TLC59XX_ERROR;
+    }
+    else if(TLC59XX_STATE_IDLE != gl_en_tlc59xx_state)
+    {
+        en_tlc59xx_error_retval = TLC59XX_BUSY;
+    }
+    else
+    {
+        st_udma_transfer_t st_transfer = {
+            .ptr_src    = gl_arr_u16_tlc59xx_buffers[gl_u8_tlc59xx_back_buffer],
+            .ptr_dst    = ssi_get_data_reg(TLC59XX_SSI_MODULE),
+            .u16_items  = TLC59XX_CHANNELS,
+            .en_size    = UDMA_SIZE_16,
+            .en_src_inc = UDMA_INC_16,
+            .en_dst_inc = UDMA_INC_NONE,
+            .en_arb     = UDMA_ARB_4,
+            .en_mode    = UDMA_MODE_BASIC
+        };
+        uint8_t_ u8_channel;
+
+        // new back buffer continues from the shown frame
+        gl_u8_tlc59xx_back_buffer ^= 1;
+        for(u8_channel = 0; u8_channel < TLC59XX_CHANNELS; u8_channel++)
+        {
+            gl_arr_u16_tlc59xx_buffers[gl_u8_tlc59xx_back_buffer][u8_channel] =
+                    gl_arr_u16_tlc59xx_buffers[gl_u8_tlc59xx_back_buffer ^ 1][u8_channel];
+        }
+
+        gl_en_tlc59xx_state = TLC59XX_STATE_SHIFTING;
+
+        udma_transfer_set(TLC59XX_DMA_CHANNEL, UDMA_PRIMARY, &st_transfer);
+        udma_channel_enable(TLC59XX_DMA_CHANNEL, UDMA_PRIMARY);
+    }
+
+    return en_tlc59xx_error_retval;
+}
+
+/**
+ * @brief                       :   Checks whether a frame is being shifted or waits for its latch
+ *
+ * @return  TRUE                :   Frame in flight
+ *          FALSE               :   Idle
+ */
+boolean tlc59xx_is_busy(void)
+{
+    return (TLC59XX_STATE_IDLE != gl_en_tlc59xx_state);
+}
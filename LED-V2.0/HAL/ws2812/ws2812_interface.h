@@ -0,0 +1,96 @@
+/**
+ * @file    :   ws2812_interface.h
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Header File contains all WS2812 strip typedefs and functions' prototypes
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Strip data is streamed out of SSI0 TX (PA5) by uDMA, the CPU only encodes pixels.
+ *
+ * Encoding   : every strip bit is a 3 bit SSI symbol (0 -> 100, 1 -> 110),
+ *              4 strip bits (one nibble) per 12 bit SSI frame, 6 frames per GRB pixel
+ * SSI clock  : PIOSC 16 MHz / (2 * (1 + 2)) = 2.667 MHz -> 1.125 us per strip bit,
+ *              T0H = 375 ns, T1H = 750 ns
+ * Latch      : WS2812_RESET_FRAMES all-zero frames (>= 300 us low) end every buffer
+ * Throughput : 300 pixels -> (1800 + 67) frames * 4.5 us = 8.4 ms -> ~119 frames per second
+ */
+
+#ifndef WS2812_INTERFACE_H_
+#define WS2812_INTERFACE_H_
+
+#include "std.h"
+
+/*----------------------------------------------------------/
+/- MACROS
+/----------------------------------------------------------*/
+#define WS2812_PIXELS_MAX       300     /* Strip length */
+
+/*----------------------------------------------------------/
+/- ENUMS
+/----------------------------------------------------------*/
+typedef enum
+{
+    WS2812_OK               = 0 ,
+    WS2812_ERROR                ,
+    WS2812_BUSY                 ,
+}en_ws2812_error_t_;
+
+/*---------------------------------------------------------/
+/- FUNCTION PROTOTYPES
+/---------------------------------------------------------*/
+
+/**
+ * @brief                       :   Initializes SSI0, its uDMA channel and clears both frame buffers
+ *
+ * @return  WS2812_OK           :   In case of Successful Operation
+ *          WS2812_ERROR        :   In case of Failed Operation
+ */
+en_ws2812_error_t_ ws2812_init(void);
+
+/**
+ * @brief                       :   Encodes one pixel into the back buffer
+ *
+ * @param[in]   u16_pixel       :   Pixel index (0 -> WS2812_PIXELS_MAX - 1)
+ * @param[in]   u8_red          :   Red level
+ * @param[in]   u8_green        :   Green level
+ * @param[in]   u8_blue         :   Blue level
+ *
+ * @return  WS2812_OK           :   In case of Successful Operation
+ *          WS2812_ERROR        :   In case of invalid pixel index
+ */
+en_ws2812_error_t_ ws2812_set_pixel(uint16_t_ u16_pixel, uint8_t_ u8_red, uint8_t_ u8_green, uint8_t_ u8_blue);
+
+/**
+ * @brief                       :   Encodes the same color into every pixel of the back buffer
+ *
+ * @param[in]   u8_red          :   Red level
+ * @param[in]   u8_green        :   Green level
+ * @param[in]   u8_blue         :   Blue level
+ *
+ * @return  WS2812_OK           :   In case of Successful Operation
+ */
+en_ws2812_error_t_ ws2812_fill(uint8_t_ u8_red, uint8_t_ u8_green, uint8_t_ u8_blue);
+
+/**
+ * @brief                       :   Swaps the buffers and starts streaming the drawn frame (non-blocking)
+ *
+ * The new back buffer holds the frame shown before the previous one,
+ * applications are expected to draw every pixel of each frame.
+ *
+ * @return  WS2812_OK           :   In case of Successful Operation
+ *          WS2812_BUSY         :   Previous frame still streaming, nothing swapped
+ *          WS2812_ERROR        :   In case driver isn't initialized
+ */
+en_ws2812_error_t_ ws2812_show(void);
+
+/**
+ * @brief                       :   Checks whether a frame is still being streamed
+ *
+ * @return  TRUE                :   Transfer in progress
+ *          FALSE               :   Idle
+ */
+boolean ws2812_is_busy(void);
+
+#endif /* WS2812_INTERFACE_H_ */
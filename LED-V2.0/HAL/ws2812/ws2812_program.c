@@ -0,0 +1,268 @@
+/**
+ * @file    :   ws2812_program.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Program File contains all WS2812 strip functions' implementation
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "ws2812_interface.h"
+
+// private includes
+#include "ssi_interface.h"
+#include "udma_interface.h"
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define WS2812_SSI_MODULE           SSI_0
+#define WS2812_DMA_CHANNEL          UDMA_CH_SSI0_TX
+
+#define WS2812_SSI_DATA_SIZE        12      /* 4 strip bits per SSI frame */
+#define WS2812_SSI_PRESCALE         2
+#define WS2812_SSI_SCR              2
+
+#define WS2812_FRAMES_PER_PIXEL     6       /* 24 GRB bits / 4 */
+#define WS2812_RESET_FRAMES         67      /* 67 * 4.5 us >= 300 us low */
+#define WS2812_BUFFER_FRAMES        ((WS2812_PIXELS_MAX * WS2812_FRAMES_PER_PIXEL) + WS2812_RESET_FRAMES)
+
+#define WS2812_BUFFERS_TOTAL        2
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+/* Strip nibble -> 12 bit SSI frame, MSB first, 0 -> 100, 1 -> 110 */
+static const uint16_t_ gl_arr_u16_ws2812_nibble_lut[16] = {
+    0x924, 0x926, 0x934, 0x936, 0x9A4, 0x9A6, 0x9B4, 0x9B6,
+    0xD24, 0xD26, 0xD34, 0xD36, 0xDA4, 0xDA6, 0xDB4, 0xDB6
+};
+
+static uint16_t_ gl_arr_u16_ws2812_buffers[WS2812_BUFFERS_TOTAL][WS2812_BUFFER_FRAMES];
+
+static uint8_t_ gl_u8_ws2812_back_buffer = 0;
+
+static const uint16_t_ * gl_ptr_u16_ws2812_tx_buffer = NULL_PTR;
+static volatile uint16_t_ gl_u16_ws2812_next_frame = 0;
+static volatile boolean gl_bool_ws2812_busy = FALSE;
+static boolean gl_bool_ws2812_initialized = FALSE;
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Loads the next chunk of the streaming buffer into a control structure,
+ *                                  the last chunk is loaded in basic mode to stop the channel after it
+ *
+ * @param[in]   en_select       :   Primary or alternate control structure
+ */
+static void ws2812_load_chunk(en_udma_select_t en_select)
+{
+    uint16_t_ u16_remaining = WS2812_BUFFER_FRAMES - gl_u16_ws2812_next_frame;
+    st_udma_transfer_t st_transfer = {
+        .ptr_src    = &gl_ptr_u16_ws2812_tx_buffer[gl_u16_ws2812_next_frame],
+        .ptr_dst    = ssi_get_data_reg(WS2812_SSI_MODULE),
+        .u16_items  = (u16_remaining > UDMA_MAX_TRANSFER_ITEMS) ? UDMA_MAX_TRANSFER_ITEMS : u16_remaining,
+        .en_size    = UDMA_SIZE_16,
+        .en_src_inc = UDMA_INC_16,
+        .en_dst_inc = UDMA_INC_NONE,
+        .en_arb     = UDMA_ARB_4,       /* TX FIFO requests at half empty (4 of 8) */
+    };
+
+    st_transfer.en_mode = (u16_remaining > st_transfer.u16_items) ? UDMA_MODE_PING_PONG : UDMA_MODE_BASIC;
+
+    udma_transfer_set(WS2812_DMA_CHANNEL, en_select, &st_transfer);
+    gl_u16_ws2812_next_frame += st_transfer.u16_items;
+}
+
+/**
+ * @brief                       :   SSI0 interrupt callback, refills the control structure that completed
+ *                                  and releases the driver once the channel stopped
+ */
+static void ws2812_dma_done(void)
+{
+    udma_channel_int_clear(WS2812_DMA_CHANNEL);
+
+    if(WS2812_BUFFER_FRAMES > gl_u16_ws2812_next_frame)
+    {
+        if(UDMA_MODE_STOP == udma_transfer_get_mode(WS2812_DMA_CHANNEL, UDMA_PRIMARY))
+        {
+            ws2812_load_chunk(UDMA_PRIMARY);
+        }
+        else if(UDMA_MODE_STOP == udma_transfer_get_mode(WS2812_DMA_CHANNEL, UDMA_ALTERNATE))
+        {
+            ws2812_load_chunk(UDMA_ALTERNATE);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    if(FALSE == udma_channel_is_enabled(WS2812_DMA_CHANNEL))
+    {
+        gl_bool_ws2812_busy = FALSE;
+    }
+}
+
+/*---------------------------------------------------------/
+/- FUNCTION IMPLEMENTATION
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Initializes SSI0, its uDMA channel and clears both frame buffers
+ *
+ * @return  WS2812_OK           :   In case of Successful Operation
+ *          WS2812_ERROR        :   In case of Failed Operation
+ */
+en_ws2812_error_t_ ws2812_init(void)
+{
+    en_ws2812_error_t_ en_ws2812_error_retval = WS2812_OK;
+    st_ssi_cfg_t st_ssi_cfg = {
+        .en_ssi_module          = WS2812_SSI_MODULE,
+        .en_ssi_clk_src         = SSI_CLK_SRC_PIOSC,
+        .u8_data_size           = WS2812_SSI_DATA_SIZE,
+        .u8_clk_prescale        = WS2812_SSI_PRESCALE,
+        .u8_serial_clk_rate     = WS2812_SSI_SCR,
+        .bool_tx_dma_enabled    = TRUE
+    };
+    uint8_t_ u8_buffer_index;
+    uint16_t_ u16_frame_index;
+
+    // all pixels off, reset tails low
+    for(u8_buffer_index = 0; u8_buffer_index < WS2812_BUFFERS_TOTAL; u8_buffer_index++)
+    {
+        for(u16_frame_index = 0; u16_frame_index < WS2812_BUFFER_FRAMES; u16_frame_index++)
+        {
+            gl_arr_u16_ws2812_buffers[u8_buffer_index][u16_frame_index] =
+                    (u16_frame_index < (WS2812_PIXELS_MAX * WS2812_FRAMES_PER_PIXEL)) ?
+                    gl_arr_u16_ws2812_nibble_lut[0] : ZERO;
+        }
+    }
+
+    if(
+            (UDMA_OK != udma_init())                                            ||
+            (SSI_OK != ssi_init(&st_ssi_cfg))                                   ||
+            (SSI_OK != ssi_set_callback(WS2812_SSI_MODULE, ws2812_dma_done))
+            )
+    {
+        en_ws2812_error_retval = WS2812_ERROR;
+    }
+    else
+    {
+        gl_bool_ws2812_initialized = TRUE;
+    }
+
+    return en_ws2812_error_retval;
+}
+
+/**
+ * @brief                       :   Encodes one pixel into the back buffer
+ *
+ * @param[in]   u16_pixel       :   Pixel index (0 -> WS2812_PIXELS_MAX - 1)
+ * @param[in]   u8_red          :   Red level
+ * @param[in]   u8_green        :   Green level
+ * @param[in]   u8_blue         :   Blue level
+ *
+ * @return  WS2812_OK           :   In case of Successful Operation
+ *          WS2812_ERROR        :   In case of invalid pixel index
+ */
+en_ws2812_error_t_ ws2812_set_pixel(uint16_t_ u16_pixel, uint8_t_ u8_red, uint8_t_ u8_green, uint8_t_ u8_blue)
+{
+    en_ws2812_error_t_ en_ws2812_error_retval = WS2812_OK;
+
+    if(WS2812_PIXELS_MAX <= u16_pixel)
+    {
+        en_ws2812_error_retval = WS2812_ERROR;
+    }
+    else
+    {
+        uint16_t_ * ptr_u16_frames = &gl_arr_u16_ws2812_buffers[gl_u8_ws2812_back_buffer]
+                                                                [u16_pixel * WS2812_FRAMES_PER_PIXEL];
+
+        // GRB order, high nibble first
+        ptr_u16_frames[0] = gl_arr_u16_ws2812_nibble_lut[u8_green >> 4];
+        ptr_u16_frames[1] = gl_arr_u16_ws2812_nibble_lut[u8_green & 0x0F];
+        ptr_u16_frames[2] = gl_arr_u16_ws2812_nibble_lut[u8_red >> 4];
+        ptr_u16_frames[3] = gl_arr_u16_ws2812_nibble_lut[u8_red & 0x0F];
+        ptr_u16_frames[4] = gl_arr_u16_ws2812_nibble_lut[u8_blue >> 4];
+        ptr_u16_frames[5] = gl_arr_u16_ws2812_nibble_lut[u8_blue & 0x0F];
+    }
+
+    return en_ws2812_error_retval;
+}
+
+/**
+ * @brief                       :   Encodes the same color into every pixel of the back buffer
+ *
+ * @param[in]   u8_red          :   Red level
+ * @param[in]   u8_green        :   Green level
+ * @param[in]   u8_blue         :   Blue level
+ *
+ * @return  WS2812_OK           :   In case of Successful Operation
+ */
+en_ws2812_error_t_ ws2812_fill(uint8_t_ u8_red, uint8_t_ u8_green, uint8_t_ u8_blue)
+{
+    uint16_t_ u16_pixel;
+
+    for(u16_pixel = 0; u16_pixel < WS2812_PIXELS_MAX; u16_pixel++)
+    {
+        ws2812_set_pixel(u16_pixel, u8_red, u8_green, u8_blue);
+    }
+
+    return WS2812_OK;
+}
+
+/**
+ * @brief                       :   Swaps the buffers and starts streaming the drawn frame (non-blocking)
+ *
+ * The new back buffer holds the frame shown before the previous one,
+ * applications are expected to draw every pixel of each frame.
+ *
+ * @return  WS2812_OK           :   In case of Successful Operation
+ *          WS2812_BUSY         :   Previous frame still streaming, nothing swapped
+ *          WS2812_ERROR        :   In case driver isn't initialized
+ */
+en_ws2812_error_t_ ws2812_show(void)
+{
+    en_ws2812_error_t_ en_ws2812_error_retval = WS2812_OK;
+
+    if(FALSE == gl_bool_ws2812_initialized)
+    {
+        en_ws2812_error_retval = WS2812_ERROR;
+    }
+    else if(TRUE == gl_bool_ws2812_busy)
+    {
+        en_ws2812_error_retval = WS2812_BUSY;
+    }
+    else
+    {
+        // drawn buffer becomes the streaming one
+        gl_ptr_u16_ws2812_tx_buffer = gl_arr_u16_ws2812_buffers[gl_u8_ws2812_back_buffer];
+        gl_u8_ws2812_back_buffer ^= 1;
+
+        gl_bool_ws2812_busy = TRUE;
+        gl_u16_ws2812_next_frame = 0;
+
+        ws2812_load_chunk(UDMA_PRIMARY);
+        if(WS2812_BUFFER_FRAMES > gl_u16_ws2812_next_frame)
+        {
+            ws2812_load_chunk(UDMA_ALTERNATE);
+        }
+
+        udma_channel_enable(WS2812_DMA_CHANNEL, UDMA_PRIMARY);
+    }
+
+    return en_ws2812_error_retval;
+}
+
+/**
+ * @brief                       :   Checks whether a frame is still being streamed
+ *
+ * @return  TRUE                :   Transfer in progress
+ *          FALSE               :   Idle
+ */
+boolean ws2812_is_busy(void)
+{
+    return gl_bool_ws2812_busy;
+}
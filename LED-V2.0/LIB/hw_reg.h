@@ -0,0 +1,39 @@
+/**
+ * @file    :   hw_reg.h
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Header File contains the peripheral register access macro
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Every *_private.h register macro accesses its register through HW_REG. On target a register
+ * is its memory mapped address, the host simulation build (HW_SIM = 1) routes every access
+ * through the register model of SIM/sim instead. REGCOUNT_INSTRUMENTATION = 1 (with HW_SIM = 1)
+ * also passes the call site of every access to the model, for SIM/regcount's counters.
+ */
+
+#ifndef HW_REG_H_
+#define HW_REG_H_
+
+#include "std.h"
+
+#ifndef HW_SIM
+#define HW_SIM          0
+#endif
+
+#ifndef REGCOUNT_INSTRUMENTATION
+#define REGCOUNT_INSTRUMENTATION    0
+#endif
+
+#if HW_SIM && REGCOUNT_INSTRUMENTATION
+#include "sim_interface.h"
+#define HW_REG(ADDR)    (*sim_reg_at((uint32_t_)(ADDR), __FILE__, __LINE__))
+#elif HW_SIM
+#include "sim_interface.h"
+#define HW_REG(ADDR)    (*sim_reg((uint32_t_)(ADDR)))
+#else
+#define HW_REG(ADDR)    (*((volatile uint32_t_*)(ADDR)))
+#endif
+
+#endif /* HW_REG_H_ */
@@ -0,0 +1,59 @@
+/**
+ * @file    :   cpu_interface.h
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Header File contains all core interrupt masking and sleep functions' prototypes
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Sleep without a lost wake up: mask interrupts, check for pending work, cpu_wait_for_interrupt,
+ * unmask. WFI still wakes on an interrupt that becomes pending while masked, its handler runs
+ * once interrupts are unmasked.
+ */
+
+#ifndef CPU_INTERFACE_H_
+#define CPU_INTERFACE_H_
+
+/*----------------------------------------------------------/
+/- INCLUDES
+/----------------------------------------------------------*/
+#include "std.h"
+
+/*---------------------------------------------------------/
+/ FUNCTIONS PROTOTYPES
+/---------------------------------------------------------*/
+
+/**
+ * @brief                       :   Masks all configurable interrupts (PRIMASK)
+ */
+void cpu_irq_disable(void);
+
+/**
+ * @brief                       :   Unmasks interrupts, pending handlers run now
+ */
+void cpu_irq_enable(void);
+
+/**
+ * @brief                       :   Starts a critical section: masks interrupts, returns whether they
+ *                                  were masked already, so sections can nest and run in handlers
+ *
+ * @return  TRUE                :   Interrupts were masked
+ *          FALSE               :   Interrupts were unmasked
+ */
+boolean cpu_irq_save(void);
+
+/**
+ * @brief                       :   Ends a critical section: unmasks interrupts unless they were masked
+ *                                  when it started
+ *
+ * @param[in]   bool_masked     :   Value returned by cpu_irq_save
+ */
+void cpu_irq_restore(boolean bool_masked);
+
+/**
+ * @brief                       :   Sleeps (WFI) until an interrupt is pending, masked or not
+ */
+void cpu_wait_for_interrupt(void);
+
+#endif /* CPU_INTERFACE_H_ */
@@ -0,0 +1,69 @@
+/**
+ * @file    :   cpu_program.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Program File contains all core interrupt masking and sleep functions' implementation
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "TM4C123.h"
+
+#include "cpu_interface.h"
+
+/**
+ * @brief                       :   Masks all configurable interrupts (PRIMASK)
+ */
+void cpu_irq_disable(void)
+{
+    __disable_irq();
+}
+
+/**
+ * @brief                       :   Unmasks interrupts, pending handlers run now
+ */
+void cpu_irq_enable(void)
+{
+    __enable_irq();
+}
+
+/**
+ * @brief                       :   Starts a critical section: masks interrupts, returns whether they
+ *                                  were masked already, so sections can nest and run in handlers
+ *
+ * @return  TRUE                :   Interrupts were masked
+ *          FALSE               :   Interrupts were unmasked
+ */
+boolean cpu_irq_save(void)
+{
+    boolean bool_masked = (ZERO != __get_PRIMASK()) ? TRUE : FALSE;
+
+    __disable_irq();
+
+    return bool_masked;
+}
+
+/**
+ * @brief                       :   Ends a critical section: unmasks interrupts unless they were masked
+ *                                  when it started
+ *
+ * @param[in]   bool_masked     :   Value returned by cpu_irq_save
+ */
+void cpu_irq_restore(boolean bool_masked)
+{
+    if(FALSE == bool_masked)
+    {
+        __enable_irq();
+    }
+}
+
+/**
+ * @brief                       :   Sleeps (WFI) until an interrupt is pending, masked or not
+ */
+void cpu_wait_for_interrupt(void)
+{
+    // complete outstanding memory accesses before the core stops
+    __DSB();
+    __WFI();
+}
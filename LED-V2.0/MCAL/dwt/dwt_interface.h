@@ -0,0 +1,57 @@
+/**
+ * @file    :   dwt_interface.h
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Header File contains all DWT cycle counter typedefs and functions' prototypes
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Free running 32-bit core clock cycle counter of the Cortex-M4 debug unit,
+ * wraps every 2^32 / SysClk seconds (~86 s at 50 MHz), differences stay valid across a wrap.
+ */
+
+#ifndef DWT_INTERFACE_H_
+#define DWT_INTERFACE_H_
+
+/*----------------------------------------------------------/
+/- INCLUDES
+/----------------------------------------------------------*/
+#include "std.h"
+
+/*----------------------------------------------------------/
+/- ENUMS
+/----------------------------------------------------------*/
+typedef enum
+{
+    DWT_OK                  =   0   ,
+}en_dwt_error_t;
+
+/*---------------------------------------------------------/
+/ FUNCTIONS PROTOTYPES
+/---------------------------------------------------------*/
+
+/**
+ * @brief                       :   Enables the trace unit and starts the cycle counter from 0
+ *
+ * @return  DWT_OK              :   In case of Successful Operation
+ */
+en_dwt_error_t dwt_init(void);
+
+/**
+ * @brief                       :   Reads the cycle counter
+ *
+ * @return  core clock cycles since dwt_init (modulo 2^32)
+ */
+uint32_t_ dwt_get_cycles(void);
+
+/**
+ * @brief                       :   Converts a cycle count to microseconds at the current core clock
+ *
+ * @param[in]   u32_cycles      :   Cycle count (difference of two dwt_get_cycles)
+ *
+ * @return  microseconds
+ */
+uint32_t_ dwt_cycles_to_us(uint32_t_ u32_cycles);
+
+#endif /* DWT_INTERFACE_H_ */
@@ -0,0 +1,28 @@
+/**
+ * @file    :   dwt_private.h
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Header File contains all DWT cycle counter registers and private macros
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef DWT_PRIVATE_H_
+#define DWT_PRIVATE_H_
+
+#include "hw_reg.h"
+
+#define DEMCR                   HW_REG(0xE000EDFC) /* Debug Exception and Monitor Control */
+#define DWT_CTRL                HW_REG(0xE0001000) /* DWT Control */
+#define DWT_CYCCNT              HW_REG(0xE0001004) /* DWT Cycle Count */
+
+// DEMCR BITS
+#define DEMCR_TRCENA            24
+
+// DWT_CTRL BITS
+#define DWT_CTRL_CYCCNTENA      0
+
+#define DWT_US_PER_S            1000000UL
+
+#endif /* DWT_PRIVATE_H_ */
@@ -0,0 +1,54 @@
+/**
+ * @file    :   dwt_program.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Program File contains all DWT cycle counter functions' implementation
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "bit_math.h"
+
+#include "TM4C123.h"
+
+#include "dwt_interface.h"
+#include "dwt_private.h"
+
+/**
+ * @brief                       :   Enables the trace unit and starts the cycle counter from 0
+ *
+ * @return  DWT_OK              :   In case of Successful Operation
+ */
+en_dwt_error_t dwt_init(void)
+{
+    // DWT is only clocked with trace enabled
+    SET_BIT(DEMCR, DEMCR_TRCENA);
+
+    DWT_CYCCNT = 0;
+    SET_BIT(DWT_CTRL, DWT_CTRL_CYCCNTENA);
+
+    return DWT_OK;
+}
+
+/**
+ * @brief                       :   Reads the cycle counter
+ *
+ * @return  core clock cycles since dwt_init (modulo 2^32)
+ */
+uint32_t_ dwt_get_cycles(void)
+{
+    return DWT_CYCCNT;
+}
+
+/**
+ * @brief                       :   Converts a cycle count to microseconds at the current core clock
+ *
+ * @param[in]   u32_cycles      :   Cycle count (difference of two dwt_get_cycles)
+ *
+ * @return  microseconds
+ */
+uint32_t_ dwt_cycles_to_us(uint32_t_ u32_cycles)
+{
+    return (uint32_t_)(((uint64_t_) u32_cycles * DWT_US_PER_S) / SystemCoreClock);
+}
@@ -109,6 +109,7 @@ typedef struct
 	en_gpio_pin_cfg_t			pin_cfg		 ;
 	//en_gpio_pin_level_t 	init_val	 ; /* The initial pin value (LOW/HIGH) */
 	en_gpio_pin_current_t current		 ; /* The output current on the pin(s)(ignored if input) */
+	uint8_t_							alt_func	 ; /* The GPIOPCTL peripheral signal encoding (used with ALT_FUNCTION only) */
 }st_gpio_cfg_t;
 
 /*---------------------------------------------------------/
@@ -146,6 +147,39 @@ en_gpio_error_t gpio_pin_init  		 (st_gpio_cfg_t* pin_cfg);
  */
 en_gpio_error_t gpio_setPortVal		 (en_gpio_port_t en_a_port,  uint8_t_ u8_a_portVal);
 
+/** 
+ ** @breif Function to set the value of the masked pins of a port in a single write
+ *
+ * Uses the GPIODATA address masking so pins outside the mask are
+ * left untouched without a read-modify-write
+ *
+ ** @Parameters
+ *				[in]  en_a_port  	 : The port of the desired pins
+ *				[in]  u8_a_mask 	 : The pins to modify
+ *				[in]  u8_a_val		 : The values of the masked pins
+ *
+ ** @return	GPIO_OK           : If the operation is done successfully
+ *					GPIO_INVALID_PORT : If the passed port is not a valid port
+ *					GPIO_ERROR				: If any of the masked pins is not configured as an output pin
+ */
+en_gpio_error_t gpio_setPortMaskedVal(en_gpio_port_t en_a_port, uint8_t_ u8_a_mask, uint8_t_ u8_a_val);
+
+/** 
+ ** @breif Function to set the direction of the masked pins of a port
+ *
+ * Pins outside the mask keep their direction, the masked pins
+ * must already be initialized as digital pins
+ *
+ ** @Parameters
+ *				[in]  en_a_port  	 : The port of the desired pins
+ *				[in]  u8_a_mask 	 : The pins to modify
+ *				[in]  u8_a_dir		 : The directions of the masked pins (bit set -> output)
+ *
+ ** @return	GPIO_OK           : If the operation is done successfully
+ *					GPIO_INVALID_PORT : If the passed port is not a valid port
+ */
+en_gpio_error_t gpio_setPortMaskedDir(en_gpio_port_t en_a_port, uint8_t_ u8_a_mask, uint8_t_ u8_a_dir);
+
 /** 
  ** @breif Function to set the value of a given pin 
  *
@@ -197,6 +231,19 @@ en_gpio_error_t gpio_togPinVal 		 (en_gpio_port_t en_a_port, en_gpio_pin_t en_a_
  */
 en_gpio_error_t gpio_getPinVal 		 (en_gpio_port_t en_a_port, en_gpio_pin_t en_a_pin, en_gpio_pin_level_t* pu8_a_Val);
 
+/** 
+ ** @breif Function to get the value of all pins of a port in a single read
+ *
+ ** @Parameters
+ *				[in]  en_a_port  	 : The port to read
+ *				[out] pu8_a_val  	 : pointer to variable to store the port value (bit n = pin n)
+ *
+ ** @return	GPIO_OK          : If the operation is done successfully
+ *					GPIO_INVALID_PORT: If the passed port is not a valid port
+ *					GPIO_ERROR	     : If the passed pointer is a null pointer
+ */
+en_gpio_error_t gpio_getPortVal 		 (en_gpio_port_t en_a_port, uint8_t_* pu8_a_val);
+
 /** 
  ** @breif Function enable the GPIO interrupt for a given pin 
  *
@@ -223,6 +270,23 @@ en_gpio_error_t gpio_enableInt 		 (en_gpio_port_t en_a_port, en_gpio_pin_t en_a_
  */
 en_gpio_error_t gpio_disableInt		 (en_gpio_port_t en_a_port, en_gpio_pin_t en_a_pin);
 
+/** 
+ ** @breif Function to read and clear the raw interrupt status of a given pin
+ *
+ * The raw status latches edges even while the pin interrupt is masked
+ *
+ ** @Parameters
+ *				[in]  en_a_port  	 : The port of the desired pin
+ *				[in]  en_a_pin   	 : The desired pin 
+ *				[out] pb_a_pending : pointer to variable to store whether an edge was latched
+ *
+ ** @return	GPIO_OK          : If the operation is done successfully
+ *					GPIO_INVALID_PORT: If the passed port is not a valid port
+ *					GPIO_INVALID_PIN : If the passed pin is not a valid pin
+ *					GPIO_ERROR	     : If the passed pointer is a null pointer
+ */
+en_gpio_error_t gpio_clearRawInt(en_gpio_port_t en_a_port, en_gpio_pin_t en_a_pin, boolean* pb_a_pending);
+
 /**
  * @brief  Function to choose the trigger event for a given pin 
  *
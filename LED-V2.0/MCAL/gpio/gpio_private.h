@@ -1,6 +1,8 @@
 #ifndef GPIO_PRIVATE_H_
 #define GPIO_PRIVATE_H_
 
+#include "hw_reg.h"
+
 #define GPIO_APB
 
 #ifdef GPIO_APB
@@ -11,35 +13,39 @@
 #error "Please define a valid bus"
 #endif
 
-#define RCGCGPIO					*((volatile uint32_t_*) 0x400FE608) /* GPIO Run Mode Clock Gating Control */
-
-#define GPIODATA(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x3FC))		/* GPIO Data */
-#define GPIODIR(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x400))		/* GPIO Direction */
-#define GPIOIS(X)					*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x404))		/* GPIO Interrupt Sense */
-#define GPIOIBE(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x408))		/* GPIO Interrupt Both Edges */
-#define GPIOIEV(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x40C))		/* GPIO Interrupt Event */
-#define GPIOIM(X)					*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x410))		/* GPIO Interrupt Mask */
-#define GPIORIS(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x414))		/* GPIO Raw Interrupt Status */
-#define GPIOMIS(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x418))		/* GPIO Masked Interrupt Status */
-#define GPIOICR(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x41C))		/* GPIO Interrupt Clear */
-#define GPIOAFSEL(X)			*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x420))		/* GPIO Alternate Function Select */
-#define GPIODR2R(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x500))		/* GPIO 2-mA Drive Select */
-#define GPIODR4R(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x504))		/* GPIO 4-mA Drive Select */
-#define GPIODR8R(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x508))		/* GPIO 8-mA Drive Select */
-#define GPIOODR(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x50C))		/* GPIO Open Drain Select */
-#define GPIOPUR(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x510))		/*  */
-#define GPIOPDR(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x514))		/*  */
-#define GPIOSLR(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x518))		/* GPIO Slew Rate Control Select */
-#define GPIODEN(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x51C))		/* GPIO Digital Enable */
-#define GPIOLOCK(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x520))		/* GPIO Lock */
-#define GPIOCR(X)					*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x524))		/* GPIO Commit */
-#define GPIOAMSEL(X)			*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x528))		/* GPIO Analog Mode Select */
-#define GPIOPCTL(X)				*((volatile uint32_t_*)(GPIO_OFFSET(X)+0x52C))		/* GPIO Port Control */
+#define RCGCGPIO					HW_REG(0x400FE608) /* GPIO Run Mode Clock Gating Control */
+
+#define GPIODATA(X)				HW_REG(GPIO_OFFSET(X)+0x3FC)		/* GPIO Data */
+#define GPIODATA_MASKED(X, M)	HW_REG(GPIO_OFFSET(X)+((M)<<2))	/* GPIO Data, address bits [9:2] mask the written pins */
+#define GPIODIR(X)				HW_REG(GPIO_OFFSET(X)+0x400)		/* GPIO Direction */
+#define GPIOIS(X)					HW_REG(GPIO_OFFSET(X)+0x404)		/* GPIO Interrupt Sense */
+#define GPIOIBE(X)				HW_REG(GPIO_OFFSET(X)+0x408)		/* GPIO Interrupt Both Edges */
+#define GPIOIEV(X)				HW_REG(GPIO_OFFSET(X)+0x40C)		/* GPIO Interrupt Event */
+#define GPIOIM(X)					HW_REG(GPIO_OFFSET(X)+0x410)		/* GPIO Interrupt Mask */
+#define GPIORIS(X)				HW_REG(GPIO_OFFSET(X)+0x414)		/* GPIO Raw Interrupt Status */
+#define GPIOMIS(X)				HW_REG(GPIO_OFFSET(X)+0x418)		/* GPIO Masked Interrupt Status */
+#define GPIOICR(X)				HW_REG(GPIO_OFFSET(X)+0x41C)		/* GPIO Interrupt Clear */
+#define GPIOAFSEL(X)			HW_REG(GPIO_OFFSET(X)+0x420)		/* GPIO Alternate Function Select */
+#define GPIODR2R(X)				HW_REG(GPIO_OFFSET(X)+0x500)		/* GPIO 2-mA Drive Select */
+#define GPIODR4R(X)				HW_REG(GPIO_OFFSET(X)+0x504)		/* GPIO 4-mA Drive Select */
+#define GPIODR8R(X)				HW_REG(GPIO_OFFSET(X)+0x508)		/* GPIO 8-mA Drive Select */
+#define GPIOODR(X)				HW_REG(GPIO_OFFSET(X)+0x50C)		/* GPIO Open Drain Select */
+#define GPIOPUR(X)				HW_REG(GPIO_OFFSET(X)+0x510)		/*  */
+#define GPIOPDR(X)				HW_REG(GPIO_OFFSET(X)+0x514)		/*  */
+#define GPIOSLR(X)				HW_REG(GPIO_OFFSET(X)+0x518)		/* GPIO Slew Rate Control Select */
+#define GPIODEN(X)				HW_REG(GPIO_OFFSET(X)+0x51C)		/* GPIO Digital Enable */
+#define GPIOLOCK(X)				HW_REG(GPIO_OFFSET(X)+0x520)		/* GPIO Lock */
+#define GPIOCR(X)					HW_REG(GPIO_OFFSET(X)+0x524)		/* GPIO Commit */
+#define GPIOAMSEL(X)			HW_REG(GPIO_OFFSET(X)+0x528)		/* GPIO Analog Mode Select */
+#define GPIOPCTL(X)				HW_REG(GPIO_OFFSET(X)+0x52C)		/* GPIO Port Control */
 
 
 #define GPIO_INT_SENSE_MASK		1
 #define GPIO_INT_LEVEL_MASK		2
 
+#define GPIO_PCTL_PMC_MASK		0x0F	/* Port mux control field mask (one nibble per pin) */
+#define GPIO_PCTL_PMC_BITS		4			/* Port mux control field width */
+
 /** 
  ** @breif Function to validate the values of the given port and pin
  *
@@ -14,6 +14,7 @@
 
 #include "gpio_interface.h"
 #include "gpio_private.h"
+#include "trace_interface.h"
 
 
 gpio_cb arr_gpio_cbf[GPIO_PORT_TOTAL][GPIO_PIN_TOTAL] = {{NULL}};
@@ -130,6 +131,17 @@ en_gpio_error_t gpio_pin_init  (st_gpio_cfg_t* ptr_st_pin_cfg)
 					SET_BIT(GPIOODR(port), pin);
 					break;
 				}
+				case ALT_FUNCTION:
+				{
+					SET_BIT(GPIODEN(port), pin);
+					CLR_BIT(GPIOAMSEL(port), pin);
+					SET_BIT(GPIOAFSEL(port), pin);
+					
+					/* Route the pin to the requested peripheral signal */
+					GPIOPCTL(port) = (GPIOPCTL(port) & ~(GPIO_PCTL_PMC_MASK << (pin * GPIO_PCTL_PMC_BITS)))
+												 | ((ptr_st_pin_cfg->alt_func & GPIO_PCTL_PMC_MASK) << (pin * GPIO_PCTL_PMC_BITS));
+					break;
+				}
 				default: gpio_error_state = GPIO_INVALID_PIN_CFG;
 			}			
 			/* Set the pin drive strength */
@@ -199,6 +211,77 @@ en_gpio_error_t gpio_setPortVal		 (en_gpio_port_t en_a_port,  uint8_t_ u8_a_port
 	return gpio_error_state;
 }
 
+/** 
+ ** @breif Function to set the value of the masked pins of a port in a single write
+ *
+ * Uses the GPIODATA address masking so pins outside the mask are
+ * left untouched without a read-modify-write
+ *
+ ** @Parameters
+ *				[in]  en_a_port  	 : The port of the desired pins
+ *				[in]  u8_a_mask 	 : The pins to modify
+ *				[in]  u8_a_val		 : The values of the masked pins
+ *
+ ** @return	GPIO_OK           : If the operation is done successfully
+ *					GPIO_INVALID_PORT : If the passed port is not a valid port
+ *					GPIO_ERROR				: If any of the masked pins is not configured as an output pin
+ */
+en_gpio_error_t gpio_setPortMaskedVal(en_gpio_port_t en_a_port, uint8_t_ u8_a_mask, uint8_t_ u8_a_val)
+{
+	en_gpio_error_t gpio_error_state = GPIO_OK;
+	
+	/* Check whether the port is valid */
+	if(en_a_port < GPIO_PORT_TOTAL)
+	{
+		/* Check that all the masked pins are output pins */
+		if(u8_a_mask == (GPIODIR(en_a_port) & u8_a_mask))
+		{
+			GPIODATA_MASKED(en_a_port, u8_a_mask) = u8_a_val;
+		}
+		else
+		{
+			gpio_error_state = GPIO_ERROR;
+		}
+	}
+	else
+	{
+		gpio_error_state = GPIO_INVALID_PORT;
+	}
+
+	return gpio_error_state;
+}
+
+/** 
+ ** @breif Function to set the direction of the masked pins of a port
+ *
+ * Pins outside the mask keep their direction, the masked pins
+ * must already be initialized as digital pins
+ *
+ ** @Parameters
+ *				[in]  en_a_port  	 : The port of the desired pins
+ *				[in]  u8_a_mask 	 : The pins to modify
+ *				[in]  u8_a_dir		 : The directions of the masked pins (bit set -> output)
+ *
+ ** @return	GPIO_OK           : If the operation is done successfully
+ *					GPIO_INVALID_PORT : If the passed port is not a valid port
+ */
+en_gpio_error_t gpio_setPortMaskedDir(en_gpio_port_t en_a_port, uint8_t_ u8_a_mask, uint8_t_ u8_a_dir)
+{
+	en_gpio_error_t gpio_error_state = GPIO_OK;
+	
+	/* Check whether the port is valid */
+	if(en_a_port < GPIO_PORT_TOTAL)
+	{
+		GPIODIR(en_a_port) = (GPIODIR(en_a_port) & ~((uint32_t_) u8_a_mask)) | (u8_a_dir & u8_a_mask);
+	}
+	else
+	{
+		gpio_error_state = GPIO_INVALID_PORT;
+	}
+
+	return gpio_error_state;
+}
+
 /** 
  ** @breif Function to set the value of a given pin 
  *
@@ -325,6 +408,37 @@ en_gpio_error_t gpio_getPinVal (en_gpio_port_t en_a_port, en_gpio_pin_t en_a_pin
 	return gpio_error_state;
 }
 
+/** 
+ ** @breif Function to get the value of all pins of a port in a single read
+ *
+ ** @Parameters
+ *				[in]  en_a_port  	 : The port to read
+ *				[out] pu8_a_val  	 : pointer to variable to store the port value (bit n = pin n)
+ *
+ ** @return	GPIO_OK          : If the operation is done successfully
+ *					GPIO_INVALID_PORT: If the passed port is not a valid port
+ *					GPIO_ERROR	     : If the passed pointer is a null pointer
+ */
+en_gpio_error_t gpio_getPortVal (en_gpio_port_t en_a_port, uint8_t_* pu8_a_val)
+{
+	en_gpio_error_t gpio_error_state = GPIO_OK;
+	
+	if(NULL_PTR == pu8_a_val)
+	{
+		gpio_error_state = GPIO_ERROR;
+	}
+	else if(en_a_port < GPIO_PORT_TOTAL)
+	{
+		*pu8_a_val = (uint8_t_) GPIODATA(en_a_port);
+	}
+	else
+	{
+		gpio_error_state = GPIO_INVALID_PORT;
+	}
+
+	return gpio_error_state;
+}
+
 /** 
  ** @breif Function enable the GPIO interrupt for a given pin 
  *
@@ -386,6 +500,46 @@ en_gpio_error_t gpio_disableInt(en_gpio_port_t en_a_port, en_gpio_pin_t en_a_pin
 	return gpio_error_state;
 }
 
+/** 
+ ** @breif Function to read and clear the raw interrupt status of a given pin
+ *
+ * The raw status latches edges even while the pin interrupt is masked
+ *
+ ** @Parameters
+ *				[in]  en_a_port  	 : The port of the desired pin
+ *				[in]  en_a_pin   	 : The desired pin 
+ *				[out] pb_a_pending : pointer to variable to store whether an edge was latched
+ *
+ ** @return	GPIO_OK          : If the operation is done successfully
+ *					GPIO_INVALID_PORT: If the passed port is not a valid port
+ *					GPIO_INVALID_PIN : If the passed pin is not a valid pin
+ *					GPIO_ERROR	     : If the passed pointer is a null pointer
+ */
+en_gpio_error_t gpio_clearRawInt(en_gpio_port_t en_a_port, en_gpio_pin_t en_a_pin, boolean* pb_a_pending)
+{
+	en_gpio_error_t gpio_error_state = GPIO_OK;
+	
+	if(NULL_PTR != pb_a_pending)
+	{
+		gpio_error_state = port_pin_check(en_a_port, en_a_pin);
+		
+		if(GPIO_OK == gpio_error_state)
+		{
+			*pb_a_pending = (boolean) GET_BIT(GPIORIS(en_a_port), en_a_pin);
+			
+			/* write 1 to clear, other pins untouched */
+			GPIOICR(en_a_port) = (1UL << en_a_pin);
+		}
+		else { /* Do Nothing */}
+	}
+	else
+	{
+		gpio_error_state = GPIO_ERROR;
+	}
+	
+	return gpio_error_state;
+}
+
 /**
  * @brief  Function to choose the trigger event for a given pin 
  *
@@ -419,7 +573,7 @@ en_gpio_error_t gpio_setIntSense(en_gpio_port_t en_a_port, en_gpio_pin_t en_a_pi
 			
 			/* Configure the interrupt sense */
 			CLR_BIT(GPIOIS(en_a_port), en_a_pin);
-			if(GET_BIT(en_a_event, GPIO_INT_SENSE_MASK)) SET_BIT(GPIOIS(en_a_port), en_a_pin);
+			if(en_a_event & GPIO_INT_SENSE_MASK) SET_BIT(GPIOIS(en_a_port), en_a_pin);
 			else CLR_BIT(GPIOIS(en_a_port), en_a_pin);
 			
 			if(BOTH_EDGES == en_a_event)
@@ -430,7 +584,7 @@ en_gpio_error_t gpio_setIntSense(en_gpio_port_t en_a_port, en_gpio_pin_t en_a_pi
 			{
 				/* Configure the interrupt level */
 				CLR_BIT(GPIOIEV(en_a_port), en_a_pin);
-				if(GET_BIT(en_a_event, GPIO_INT_LEVEL_MASK)) SET_BIT(GPIOIEV(en_a_port), en_a_pin);
+				if(en_a_event & GPIO_INT_LEVEL_MASK) SET_BIT(GPIOIEV(en_a_port), en_a_pin);
 				else CLR_BIT(GPIOIEV(en_a_port), en_a_pin);
 			}
 			
@@ -473,7 +627,7 @@ en_gpio_error_t gpio_setIntCallback(en_gpio_port_t en_a_port, en_gpio_pin_t en_a
 {
 	en_gpio_error_t gpio_error_state;
 		
-	if(NULL_PTR == pv_a_cbf)
+	if(NULL_PTR != pv_a_cbf)
 	{
 		/* Validate the port and pin numbers */
 		gpio_error_state = port_pin_check(en_a_port, en_a_pin);
@@ -506,6 +660,7 @@ void GPIOA_Handler(void)
 	else if(GET_BIT(GPIOMIS(GPIO_PORT_A), GPIO_PIN_6)) pin = GPIO_PIN_6;
 	else if(GET_BIT(GPIOMIS(GPIO_PORT_A), GPIO_PIN_7)) pin = GPIO_PIN_7;
 	else{/* Do Nothing */}
+	TRACE(TRACE_EV_GPIO_ISR, GPIO_PORT_A, pin);
 	
 	/* Clear the interrupt flag */
 	SET_BIT(GPIOICR(GPIO_PORT_A), pin);
@@ -540,6 +695,7 @@ void GPIOB_Handler(void)
 	else if(GET_BIT(GPIOMIS(GPIO_PORT_B), GPIO_PIN_6)) pin = GPIO_PIN_6;
 	else if(GET_BIT(GPIOMIS(GPIO_PORT_B), GPIO_PIN_7)) pin = GPIO_PIN_7;
 	else{/* Do Nothing */}
+	TRACE(TRACE_EV_GPIO_ISR, GPIO_PORT_B, pin);
 
 	/* Clear the interrupt flag */
 	SET_BIT(GPIOICR(GPIO_PORT_B), pin);
@@ -574,6 +730,7 @@ void GPIOC_Handler(void)
 	else if(GET_BIT(GPIOMIS(GPIO_PORT_C), GPIO_PIN_6)) pin = GPIO_PIN_6;
 	else if(GET_BIT(GPIOMIS(GPIO_PORT_C), GPIO_PIN_7)) pin = GPIO_PIN_7;
 	else{/* Do Nothing */}
+	TRACE(TRACE_EV_GPIO_ISR, GPIO_PORT_C, pin);
 
 	/* Clear the interrupt flag */
 	SET_BIT(GPIOICR(GPIO_PORT_C), pin);
@@ -608,6 +765,7 @@ void GPIOD_Handler(void)
 	else if(GET_BIT(GPIOMIS(GPIO_PORT_D), GPIO_PIN_6)) pin = GPIO_PIN_6;
 	else if(GET_BIT(GPIOMIS(GPIO_PORT_D), GPIO_PIN_7)) pin = GPIO_PIN_7;
 	else{/* Do Nothing */}
+	TRACE(TRACE_EV_GPIO_ISR, GPIO_PORT_D, pin);
 
 	/* Clear the interrupt flag */
 	SET_BIT(GPIOICR(GPIO_PORT_D), pin);
@@ -643,6 +801,7 @@ void GPIOE_Handler(void)
 	else if(GET_BIT(GPIOMIS(GPIO_PORT_E), GPIO_PIN_6)) pin = GPIO_PIN_6;
 	else if(GET_BIT(GPIOMIS(GPIO_PORT_E), GPIO_PIN_7)) pin = GPIO_PIN_7;
 	else{/* Do Nothing */}
+	TRACE(TRACE_EV_GPIO_ISR, GPIO_PORT_E, pin);
 
 	/* Clear the interrupt flag */
 	SET_BIT(GPIOICR(GPIO_PORT_E), pin);
@@ -674,6 +833,7 @@ void GPIOF_Handler(void)
 	else if(GET_BIT(GPIOMIS(GPIO_PORT_F), GPIO_PIN_3)) pin = GPIO_PIN_3;
 	else if(GET_BIT(GPIOMIS(GPIO_PORT_F), GPIO_PIN_4)) pin = GPIO_PIN_4;
 	else{/* Do Nothing */}
+	TRACE(TRACE_EV_GPIO_ISR, GPIO_PORT_F, pin);
 
 	/* Clear the interrupt flag */
 	SET_BIT(GPIOICR(GPIO_PORT_F), pin);
@@ -0,0 +1,126 @@
+/**
+ * @file    :   ssi_interface.h
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Header File contains all SSI typedefs and functions' prototypes
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef SSI_INTERFACE_H_
+#define SSI_INTERFACE_H_
+
+/*----------------------------------------------------------/
+/- INCLUDES
+/----------------------------------------------------------*/
+#include "std.h"
+
+/*----------------------------------------------------------/
+/- PRIMITIVE TYPES
+/----------------------------------------------------------*/
+typedef void (*ssi_cb)(void);
+
+/*----------------------------------------------------------/
+/- ENUMS
+/----------------------------------------------------------*/
+typedef enum
+{
+    SSI_0       =   0   ,   /* CLK: PA2, TX: PA5 */
+    SSI_1               ,   /* CLK: PF2, TX: PF1 */
+    SSI_2               ,   /* CLK: PB4, TX: PB7 */
+    SSI_3               ,   /* CLK: PD0, TX: PD3 */
+    SSI_TOTAL
+}en_ssi_module_t;
+
+typedef enum
+{
+    SSI_CLK_SRC_SYS_CLK =   0   ,
+    SSI_CLK_SRC_PIOSC           ,
+    SSI_CLK_SRC_TOTAL
+}en_ssi_clk_src_t;
+
+typedef enum
+{
+    SSI_OK                  =   0   ,
+    SSI_INVALID_MODULE              ,
+    SSI_INVALID_CONFIG              ,
+    SSI_INVALID_ARGS                ,
+}en_ssi_error_t;
+
+/*----------------------------------------------------------/
+/- STRUCTURES
+/----------------------------------------------------------*/
+/**
+ * Master, Freescale SPI frame format (SPO = 0, SPH = 0), transmit only pins.
+ * Bit rate = SSI clock / (u8_clk_prescale * (1 + u8_serial_clk_rate))
+ */
+typedef struct
+{
+    en_ssi_module_t     en_ssi_module       ;
+    en_ssi_clk_src_t    en_ssi_clk_src      ;
+    uint8_t_            u8_data_size        ; /* Bits per frame (4 -> 16) */
+    uint8_t_            u8_clk_prescale     ; /* CPSDVSR, even value (2 -> 254) */
+    uint8_t_            u8_serial_clk_rate  ; /* SCR (0 -> 255) */
+    boolean             bool_tx_dma_enabled ; /* Transmit FIFO serviced by uDMA */
+}st_ssi_cfg_t;
+
+/*---------------------------------------------------------/
+/ FUNCTIONS PROTOTYPES
+/---------------------------------------------------------*/
+
+/**
+ * @brief                       :   Initializes an SSI module as master and muxes its CLK/TX pins
+ *
+ * @param[in]   ptr_st_ssi_cfg  :   Pointer to SSI configuration
+ *
+ * @return  SSI_OK              :   In case of Successful Operation
+ *          SSI_INVALID_MODULE  :   In case of invalid module
+ *          SSI_INVALID_CONFIG  :   In case of invalid configuration
+ *          SSI_INVALID_ARGS    :   In case of NULL pointer
+ */
+en_ssi_error_t ssi_init(const st_ssi_cfg_t * ptr_st_ssi_cfg);
+
+/**
+ * @brief                       :   Writes one frame to the transmit FIFO, waits for FIFO space
+ *
+ * @param[in]   en_ssi_module   :   SSI module
+ * @param[in]   u16_data        :   Frame to send (right justified)
+ *
+ * @return  SSI_OK              :   In case of Successful Operation
+ *          SSI_INVALID_MODULE  :   In case of invalid module
+ */
+en_ssi_error_t ssi_write(en_ssi_module_t en_ssi_module, uint16_t_ u16_data);
+
+/**
+ * @brief                       :   Checks whether the module is still shifting out frames
+ *
+ * @param[in]   en_ssi_module   :   SSI module
+ *
+ * @return  TRUE                :   Busy or transmit FIFO not empty
+ *          FALSE               :   Idle or invalid module
+ */
+boolean ssi_is_busy(en_ssi_module_t en_ssi_module);
+
+/**
+ * @brief                       :   Gets the data register address of a module (uDMA destination)
+ *
+ * @param[in]   en_ssi_module   :   SSI module
+ *
+ * @return  Data register address, NULL_PTR on invalid module
+ */
+volatile void * ssi_get_data_reg(en_ssi_module_t en_ssi_module);
+
+/**
+ * @brief                       :   Sets the function called from the module interrupt,
+ *                                  on TM4C123 this is where uDMA completion of the module's channels lands
+ *
+ * @param[in]   en_ssi_module   :   SSI module
+ * @param[in]   ptr_cbf         :   Callback, NULL_PTR disables the module interrupt
+ *
+ * @return  SSI_OK              :   In case of Successful Operation
+ *          SSI_INVALID_MODULE  :   In case of invalid module
+ */
+en_ssi_error_t ssi_set_callback(en_ssi_module_t en_ssi_module, ssi_cb ptr_cbf);
+
+#endif /* SSI_INTERFACE_H_ */
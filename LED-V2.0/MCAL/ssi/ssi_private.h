@@ -0,0 +1,56 @@
+/**
+ * @file    :   ssi_private.h
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Header File contains all SSI registers and private macros
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef SSI_PRIVATE_H_
+#define SSI_PRIVATE_H_
+
+#include "hw_reg.h"
+
+#define SSI_OFFSET(X)           (0x40008000 + ((X) * 0x1000))
+
+#define RCGCSSI                 HW_REG(0x400FE61C) /* SSI Run Mode Clock Gating Control */
+
+#define SSICR0(X)               HW_REG(SSI_OFFSET(X) + 0x000)    /* SSI Control 0 */
+#define SSICR1(X)               HW_REG(SSI_OFFSET(X) + 0x004)    /* SSI Control 1 */
+#define SSIDR(X)                HW_REG(SSI_OFFSET(X) + 0x008)    /* SSI Data */
+#define SSISR(X)                HW_REG(SSI_OFFSET(X) + 0x00C)    /* SSI Status */
+#define SSICPSR(X)              HW_REG(SSI_OFFSET(X) + 0x010)    /* SSI Clock Prescale */
+#define SSIDMACTL(X)            HW_REG(SSI_OFFSET(X) + 0x024)    /* SSI DMA Control */
+#define SSICC(X)                HW_REG(SSI_OFFSET(X) + 0xFC8)    /* SSI Clock Configuration */
+
+// SSICR0 BITS
+#define SSICR0_SCR_POS          8
+#define SSICR0_DSS_POS          0
+
+// SSICR1 BITS
+#define SSICR1_SSE              1
+#define SSICR1_MS               2
+
+// SSISR BITS
+#define SSISR_TFE               0
+#define SSISR_TNF               1
+#define SSISR_BSY               4
+
+// SSIDMACTL BITS
+#define SSIDMACTL_TXDMAE        1
+
+// SSICC values
+#define SSICC_CS_SYS_CLK        0x0
+#define SSICC_CS_PIOSC          0x5
+
+#define SSI_DATA_SIZE_MIN       4
+#define SSI_DATA_SIZE_MAX       16
+#define SSI_PRESCALE_MIN        2
+#define SSI_PRESCALE_MAX        254
+
+#define SSI_PCTL_SSI0_2         2   /* GPIOPCTL encoding for SSI0/1/2 signals */
+#define SSI_PCTL_SSI3           1   /* GPIOPCTL encoding for SSI3 signals on port D */
+
+#endif /* SSI_PRIVATE_H_ */
@@ -0,0 +1,233 @@
+/**
+ * @file    :   ssi_program.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Program File contains all SSI functions' implementation
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "bit_math.h"
+
+#include "TM4C123.h"
+
+#include "gpio_interface.h"
+
+#include "ssi_interface.h"
+#include "ssi_private.h"
+
+/* CLK and TX pins of every module */
+static const st_gpio_cfg_t gl_arr_st_ssi_clk_pins[SSI_TOTAL] = {
+    {.port = GPIO_PORT_A, .pin = GPIO_PIN_2, .pin_cfg = ALT_FUNCTION, .alt_func = SSI_PCTL_SSI0_2},
+    {.port = GPIO_PORT_F, .pin = GPIO_PIN_2, .pin_cfg = ALT_FUNCTION, .alt_func = SSI_PCTL_SSI0_2},
+    {.port = GPIO_PORT_B, .pin = GPIO_PIN_4, .pin_cfg = ALT_FUNCTION, .alt_func = SSI_PCTL_SSI0_2},
+    {.port = GPIO_PORT_D, .pin = GPIO_PIN_0, .pin_cfg = ALT_FUNCTION, .alt_func = SSI_PCTL_SSI3},
+};
+
+static const st_gpio_cfg_t gl_arr_st_ssi_tx_pins[SSI_TOTAL] = {
+    {.port = GPIO_PORT_A, .pin = GPIO_PIN_5, .pin_cfg = ALT_FUNCTION, .alt_func = SSI_PCTL_SSI0_2},
+    {.port = GPIO_PORT_F, .pin = GPIO_PIN_1, .pin_cfg = ALT_FUNCTION, .alt_func = SSI_PCTL_SSI0_2},
+    {.port = GPIO_PORT_B, .pin = GPIO_PIN_7, .pin_cfg = ALT_FUNCTION, .alt_func = SSI_PCTL_SSI0_2},
+    {.port = GPIO_PORT_D, .pin = GPIO_PIN_3, .pin_cfg = ALT_FUNCTION, .alt_func = SSI_PCTL_SSI3},
+};
+
+static const IRQn_Type gl_arr_ssi_irqn[SSI_TOTAL] = {SSI0_IRQn, SSI1_IRQn, SSI2_IRQn, SSI3_IRQn};
+
+static ssi_cb gl_arr_ssi_cbf[SSI_TOTAL] = {NULL_PTR};
+
+/**
+ * @brief                       :   Initializes an SSI module as master and muxes its CLK/TX pins
+ *
+ * @param[in]   ptr_st_ssi_cfg  :   Pointer to SSI configuration
+ *
+ * @return  SSI_OK              :   In case of Successful Operation
+ *          SSI_INVALID_MODULE  :   In case of invalid module
+ *          SSI_INVALID_CONFIG  :   In case of invalid configuration
+ *          SSI_INVALID_ARGS    :   In case of NULL pointer
+ */
+en_ssi_error_t ssi_init(const st_ssi_cfg_t * ptr_st_ssi_cfg)
+{
+    en_ssi_error_t en_ssi_error_retval = SSI_OK;
+
+    if(NULL_PTR == ptr_st_ssi_cfg)
+    {
+        en_ssi_error_retval = SSI_INVALID_ARGS;
+    }
+    else if(SSI_TOTAL <= ptr_st_ssi_cfg->en_ssi_module)
+    {
+        en_ssi_error_retval = SSI_INVALID_MODULE;
+    }
+    else if(
+            (SSI_CLK_SRC_TOTAL <= ptr_st_ssi_cfg->en_ssi_clk_src)       ||
+            (SSI_DATA_SIZE_MIN > ptr_st_ssi_cfg->u8_data_size)          ||
+            (SSI_DATA_SIZE_MAX < ptr_st_ssi_cfg->u8_data_size)          ||
+            (SSI_PRESCALE_MIN > ptr_st_ssi_cfg->u8_clk_prescale)        ||
+            (SSI_PRESCALE_MAX < ptr_st_ssi_cfg->u8_clk_prescale)        ||
+            (ZERO != (ptr_st_ssi_cfg->u8_clk_prescale & 1))             ||
+            (ptr_st_ssi_cfg->bool_tx_dma_enabled > TRUE)
+            )
+    {
+        en_ssi_error_retval = SSI_INVALID_CONFIG;
+    }
+    else
+    {
+        en_ssi_module_t en_ssi_module = ptr_st_ssi_cfg->en_ssi_module;
+        st_gpio_cfg_t st_gpio_cfg_pin;
+
+        // 1. enable module clock
+        SET_BIT(RCGCSSI, en_ssi_module);
+
+        // 2. mux CLK/TX pins
+        st_gpio_cfg_pin = gl_arr_st_ssi_clk_pins[en_ssi_module];
+        gpio_pin_init(&st_gpio_cfg_pin);
+        st_gpio_cfg_pin = gl_arr_st_ssi_tx_pins[en_ssi_module];
+        gpio_pin_init(&st_gpio_cfg_pin);
+
+        // 3. disable module while configuring, master mode
+        CLR_BIT(SSICR1(en_ssi_module), SSICR1_SSE);
+        SSICR1(en_ssi_module) = ZERO;
+
+        // 4. clock source and bit rate
+        SSICC(en_ssi_module) = (SSI_CLK_SRC_PIOSC == ptr_st_ssi_cfg->en_ssi_clk_src) ?
+                               SSICC_CS_PIOSC : SSICC_CS_SYS_CLK;
+        SSICPSR(en_ssi_module) = ptr_st_ssi_cfg->u8_clk_prescale;
+
+        // 5. freescale SPI, SPO = 0, SPH = 0
+        SSICR0(en_ssi_module) = ((uint32_t_) ptr_st_ssi_cfg->u8_serial_clk_rate << SSICR0_SCR_POS) |
+                                ((uint32_t_) (ptr_st_ssi_cfg->u8_data_size - 1) << SSICR0_DSS_POS);
+
+        // 6. transmit DMA
+        WRITE_BIT(SSIDMACTL(en_ssi_module), SSIDMACTL_TXDMAE, ptr_st_ssi_cfg->bool_tx_dma_enabled);
+
+        // 7. enable module
+        SET_BIT(SSICR1(en_ssi_module), SSICR1_SSE);
+    }
+
+    return en_ssi_error_retval;
+}
+
+/**
+ * @brief                       :   Writes one frame to the transmit FIFO, waits for FIFO space
+ *
+ * @param[in]   en_ssi_module   :   SSI module
+ * @param[in]   u16_data        :   Frame to send (right justified)
+ *
+ * @return  SSI_OK              :   In case of Successful Operation
+ *          SSI_INVALID_MODULE  :   In case of invalid module
+ */
+en_ssi_error_t ssi_write(en_ssi_module_t en_ssi_module, uint16_t_ u16_data)
+{
+    en_ssi_error_t en_ssi_error_retval = SSI_OK;
+
+    if(SSI_TOTAL <= en_ssi_module)
+    {
+        en_ssi_error_retval = SSI_INVALID_MODULE;
+    }
+    else
+    {
+        while(ZERO == GET_BIT(SSISR(en_ssi_module), SSISR_TNF));
+        SSIDR(en_ssi_module) = u16_data;
+    }
+
+    return en_ssi_error_retval;
+}
+
+/**
+ * @brief                       :   Checks whether the module is still shifting out frames
+ *
+ * @param[in]   en_ssi_module   :   SSI module
+ *
+ * @return  TRUE                :   Busy or transmit FIFO not empty
+ *          FALSE               :   Idle or invalid module
+ */
+boolean ssi_is_busy(en_ssi_module_t en_ssi_module)
+{
+    boolean bool_retval = FALSE;
+
+    if(SSI_TOTAL > en_ssi_module)
+    {
+        bool_retval = (GET_BIT(SSISR(en_ssi_module), SSISR_BSY) ||
+                       (ZERO == GET_BIT(SSISR(en_ssi_module), SSISR_TFE)));
+    }
+
+    return bool_retval;
+}
+
+/**
+ * @brief                       :   Gets the data register address of a module (uDMA destination)
+ *
+ * @param[in]   en_ssi_module   :   SSI module
+ *
+ * @return  Data register address, NULL_PTR on invalid module
+ */
+volatile void * ssi_get_data_reg(en_ssi_module_t en_ssi_module)
+{
+    volatile void * ptr_retval = NULL_PTR;
+
+    if(SSI_TOTAL > en_ssi_module)
+    {
+        ptr_retval = &SSIDR(en_ssi_module);
+    }
+
+    return ptr_retval;
+}
+
+/**
+ * @brief                       :   Sets the function called from the module interrupt,
+ *                                  on TM4C123 this is where uDMA completion of the module's channels lands
+ *
+ * @param[in]   en_ssi_module   :   SSI module
+ * @param[in]   ptr_cbf         :   Callback, NULL_PTR disables the module interrupt
+ *
+ * @return  SSI_OK              :   In case of Successful Operation
+ *          SSI_INVALID_MODULE  :   In case of invalid module
+ */
+en_ssi_error_t ssi_set_callback(en_ssi_module_t en_ssi_module, ssi_cb ptr_cbf)
+{
+    en_ssi_error_t en_ssi_error_retval = SSI_OK;
+
+    if(SSI_TOTAL <= en_ssi_module)
+    {
+        en_ssi_error_retval = SSI_INVALID_MODULE;
+    }
+    else
+    {
+        gl_arr_ssi_cbf[en_ssi_module] = ptr_cbf;
+
+        if(NULL_PTR != ptr_cbf)
+        {
+            NVIC_EnableIRQ(gl_arr_ssi_irqn[en_ssi_module]);
+            __enable_irq();
+        }
+        else
+        {
+            NVIC_DisableIRQ(gl_arr_ssi_irqn[en_ssi_module]);
+        }
+    }
+
+    return en_ssi_error_retval;
+}
+
+/*---------------------------------------------------------/
+/ INTERRUPT HANDLERS
+/---------------------------------------------------------*/
+void SSI0_Handler(void)
+{
+    if(NULL_PTR != gl_arr_ssi_cbf[SSI_0]) gl_arr_ssi_cbf[SSI_0]();
+}
+
+void SSI1_Handler(void)
+{
+    if(NULL_PTR != gl_arr_ssi_cbf[SSI_1]) gl_arr_ssi_cbf[SSI_1]();
+}
+
+void SSI2_Handler(void)
+{
+    if(NULL_PTR != gl_arr_ssi_cbf[SSI_2]) gl_arr_ssi_cbf[SSI_2]();
+}
+
+void SSI3_Handler(void)
+{
+    if(NULL_PTR != gl_arr_ssi_cbf[SSI_3]) gl_arr_ssi_cbf[SSI_3]();
+}
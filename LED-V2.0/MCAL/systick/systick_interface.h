@@ -7,7 +7,15 @@
 
 #include "std.h"
 
-#define SYS_CLOCK_MHZ   8
+/*
+ * Core clock, SystemCoreClock of the build: on target SystemInit (system_TM4C123.c) runs the PLL
+ * from the 16 MHz crystal, 400 MHz / 2 / SYSDIV 4 = 50 MHz, the register model runs at 16 MHz
+ */
+#if defined(HW_SIM) && HW_SIM
+#define SYS_CLOCK_MHZ   16
+#else
+#define SYS_CLOCK_MHZ   50
+#endif
 
 #if SYS_CLOCK_MHZ < 8
     #warning System clock below 8 MHZ is not supported by systick
@@ -73,4 +81,28 @@ en_systick_error_t systick_init(st_systick_cfg_t * ptr_st_systick_cfg);
  */
 en_systick_error_t systick_ms_delay(uint32_t_ uint32_ms_delay);
 
+/**
+ * @brief                      : Starts the free running time base (non-blocking), SysTick interrupts
+ *                               once per period and systick_get_ms counts the ms in between from
+ *                               the counter, so the period sets how often the time base wakes the core.
+ *                               systick_ms_delay is unavailable while the time base runs
+ *
+ * @param u32_period_ms        : Interrupt period in ms, up to 4194 ms from PIOSC / 4 and
+ *                               1048 ms from the 16 MHz system clock (24-bit counter)
+ *
+ * @return  ST_OK              :   In case of Successful Operation
+ *          ST_INVALID_ARGS    :   In case of Failed Operation (Period 0 or beyond the counter)
+ *          ST_INVALID_CONFIG  :   In case of Failed Operation (Systick not initialized)
+ */
+en_systick_error_t systick_tick_start(uint32_t_ u32_period_ms);
+
+/**
+ * @brief                      : Reads the ms elapsed since systick_tick_start, wraps after ~49 days
+ *                               (compare with unsigned subtraction). Call it with interrupts enabled,
+ *                               a wrap whose interrupt is held off isn't counted yet
+ *
+ * @return  ms count
+ */
+uint32_t_ systick_get_ms(void);
+
 #endif //SYSTICK_INTERFACE_H
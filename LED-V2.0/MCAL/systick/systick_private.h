@@ -11,6 +11,8 @@
 #ifndef SYSTICK_PRIVATE_H
 #define SYSTICK_PRIVATE_H
 
+#include "hw_reg.h"
+
 #define CORE_PERIPHERALS_BASE_ADDRESS 0xE000E000
 
 /**
@@ -18,7 +20,7 @@
  * ACCESS   :   R/W
  * RESET    :   0x0000.0004
  */
-#define STCTRL					*((volatile uint32_t_*) (CORE_PERIPHERALS_BASE_ADDRESS + 0x010))
+#define STCTRL					HW_REG(CORE_PERIPHERALS_BASE_ADDRESS + 0x010)
 
 // STCTRL BITS
 #define STCTRL_COUNT        16
@@ -29,6 +31,9 @@
 #define STLOAD_MIN_VALUE 0x00000001 // 24-bits countdown timer min value
 #define STLOAD_MAX_VALUE 0x00FFFFFF // 24-bits countdown timer max value
 
+#define ST_PIOSC_DIV        4       // systick PIOSC clock source is PIOSC / 4
+#define ST_KHZ_PER_MHZ      1000    // clock cycles per ms = clock in MHz * 1000
+
 /**
  * BRIEF    :   SysTick Reload Value Register
  * WIDTH    :   24-BITS
@@ -37,7 +42,7 @@
  * IMP NOTE :   in order to access this register correctly,
  *              the system clock must be faster than 8 MHz
  */
-#define STRELOAD				*((volatile uint32_t_*) (CORE_PERIPHERALS_BASE_ADDRESS + 0x014))
+#define STRELOAD				HW_REG(CORE_PERIPHERALS_BASE_ADDRESS + 0x014)
 
 /**
  * BRIEF    :   SysTick Current Value Register
@@ -45,6 +50,6 @@
  * ACCESS   :   R/W/C
  * RESET    :   -
  */
-#define STCURRENT				*((volatile uint32_t_*) (CORE_PERIPHERALS_BASE_ADDRESS + 0x018))
+#define STCURRENT				HW_REG(CORE_PERIPHERALS_BASE_ADDRESS + 0x018)
 
 #endif //SYSTICK_PRIVATE_H
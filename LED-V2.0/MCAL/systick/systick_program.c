@@ -11,9 +11,14 @@
 #include "systick_interface.h"
 #include "systick_private.h"
 #include "bit_math.h"
+#include "trace_interface.h"
 
 static boolean gl_systick_initialized = FALSE;
 static en_systick_clk_src_t gl_en_systick_clk_src;
+static boolean gl_systick_tick_running = FALSE;
+static volatile uint32_t_ gl_u32_systick_ms = 0;        // time of the last wrap
+static uint32_t_ gl_u32_systick_period_ms = 0;
+static uint32_t_ gl_u32_systick_cycles_per_ms = 0;
 
 /**
  * @brief                       : Initializes SYSTICK driver
@@ -72,7 +77,10 @@ en_systick_error_t systick_ms_delay(uint32_t_ uint32_ms_delay)
 {
     en_systick_error_t en_systick_error_retval = ST_OK;
 
-        if(FALSE == gl_systick_initialized)
+        if(
+                (FALSE == gl_systick_initialized) ||
+                (TRUE == gl_systick_tick_running)   // the delay would stop the tick
+                )
         {
             en_systick_error_retval = ST_INVALID_CONFIG;
         }
@@ -117,4 +125,101 @@ en_systick_error_t systick_ms_delay(uint32_t_ uint32_ms_delay)
         }
 
     return en_systick_error_retval;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief                      : Starts the free running time base (non-blocking), SysTick interrupts
+ *                               once per period and systick_get_ms counts the ms in between from
+ *                               the counter, so the period sets how often the time base wakes the core.
+ *                               systick_ms_delay is unavailable while the time base runs
+ *
+ * @param u32_period_ms        : Interrupt period in ms, up to 4194 ms from PIOSC / 4 and
+ *                               1048 ms from the 16 MHz system clock (24-bit counter)
+ *
+ * @return  ST_OK              :   In case of Successful Operation
+ *          ST_INVALID_ARGS    :   In case of Failed Operation (Period 0 or beyond the counter)
+ *          ST_INVALID_CONFIG  :   In case of Failed Operation (Systick not initialized)
+ */
+en_systick_error_t systick_tick_start(uint32_t_ u32_period_ms)
+{
+    en_systick_error_t en_systick_error_retval = ST_OK;
+
+    if(FALSE == gl_systick_initialized)
+    {
+        en_systick_error_retval = ST_INVALID_CONFIG;
+    }
+    else
+    {
+        // cycles per ms of the configured clock source, reload is counted down to 0 inclusive
+        uint32_t_ u32_cycles_per_ms = (CLK_SRC_PIOSC == gl_en_systick_clk_src) ?
+                                      ((PIOSC_MHZ * ST_KHZ_PER_MHZ) / ST_PIOSC_DIV) :
+                                      (SYS_CLOCK_MHZ * ST_KHZ_PER_MHZ);
+
+        if(
+                (ZERO == u32_period_ms) ||
+                (((STLOAD_MAX_VALUE + 1UL) / u32_cycles_per_ms) < u32_period_ms)
+                )
+        {
+            en_systick_error_retval = ST_INVALID_ARGS;
+        }
+        else
+        {
+            CLR_BIT(STCTRL, STCTRL_ENABLE);
+
+            STRELOAD = (u32_cycles_per_ms * u32_period_ms) - 1;
+            STCURRENT = ZERO;
+            gl_u32_systick_ms = 0;
+            gl_u32_systick_period_ms = u32_period_ms;
+            gl_u32_systick_cycles_per_ms = u32_cycles_per_ms;
+            gl_systick_tick_running = TRUE;
+
+            SET_BIT(STCTRL, STCTRL_INT_ENABLE);
+            SET_BIT(STCTRL, STCTRL_ENABLE);
+        }
+    }
+
+    return en_systick_error_retval;
+}
+
+/**
+ * @brief                      : Reads the ms elapsed since systick_tick_start, wraps after ~49 days
+ *                               (compare with unsigned subtraction). Call it with interrupts enabled,
+ *                               a wrap whose interrupt is held off isn't counted yet
+ *
+ * @return  ms count
+ */
+uint32_t_ systick_get_ms(void)
+{
+    uint32_t_ u32_wrap_ms;
+    uint32_t_ u32_current = 0;
+
+    // a wrap between the reads shows as a new wrap time or as COUNT (reading STCTRL clears it)
+    do
+    {
+        u32_wrap_ms = gl_u32_systick_ms;
+        if(TRUE == gl_systick_tick_running)
+        {
+            (void) GET_BIT(STCTRL, STCTRL_COUNT);
+            u32_current = STCURRENT;
+        }
+    }
+    while(
+            (u32_wrap_ms != gl_u32_systick_ms) ||
+            ((TRUE == gl_systick_tick_running) && (ZERO != GET_BIT(STCTRL, STCTRL_COUNT)))
+            );
+
+    return (TRUE == gl_systick_tick_running) ?
+           (u32_wrap_ms + ((((gl_u32_systick_period_ms * gl_u32_systick_cycles_per_ms) - 1) - u32_current) /
+                          gl_u32_systick_cycles_per_ms)) :
+           u32_wrap_ms;
+}
+
+/**
+ * @brief                      : SysTick interrupt handler, counts the time base periods
+ */
+void SysTick_Handler(void)
+{
+    gl_u32_systick_ms += gl_u32_systick_period_ms;
+
+    TRACE(TRACE_EV_SYSTICK, 0, gl_u32_systick_ms);
+}
@@ -0,0 +1,119 @@
+/**
+ * @file    :   timer_interface.h
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Header File contains all general purpose timer typedefs and functions' prototypes
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef TIMER_INTERFACE_H_
+#define TIMER_INTERFACE_H_
+
+/*----------------------------------------------------------/
+/- INCLUDES
+/----------------------------------------------------------*/
+#include "std.h"
+
+/*----------------------------------------------------------/
+/- PRIMITIVE TYPES
+/----------------------------------------------------------*/
+typedef void (*timer_cb)(void);
+
+/*----------------------------------------------------------/
+/- ENUMS
+/----------------------------------------------------------*/
+/* 16/32-bit timers, used concatenated (32-bit) */
+typedef enum
+{
+    TIMER_0     =   0   ,
+    TIMER_1             ,
+    TIMER_2             ,
+    TIMER_3             ,
+    TIMER_4             ,
+    TIMER_5             ,
+    TIMER_TOTAL
+}en_timer_t;
+
+typedef enum
+{
+    TIMER_OK                =   0   ,
+    TIMER_INVALID_TIMER             ,
+    TIMER_INVALID_CONFIG            ,
+    TIMER_INVALID_ARGS              ,
+}en_timer_error_t;
+
+/*----------------------------------------------------------/
+/- STRUCTURES
+/----------------------------------------------------------*/
+typedef struct
+{
+    en_timer_t  en_timer        ;
+    uint32_t_   u32_period_us   ; /* Time between callbacks, (1 -> 2^32 / SysClk MHz) us */
+    timer_cb    ptr_cbf         ; /* Called from the timeout interrupt */
+}st_timer_cfg_t;
+
+/*---------------------------------------------------------/
+/ FUNCTIONS PROTOTYPES
+/---------------------------------------------------------*/
+
+/**
+ * @brief                       :   Initializes a timer in 32-bit periodic mode with a timeout callback,
+ *                                  the timer is left stopped
+ *
+ * @param[in]   ptr_st_timer_cfg    :   Pointer to timer configuration
+ *
+ * @return  TIMER_OK                :   In case of Successful Operation
+ *          TIMER_INVALID_TIMER     :   In case of invalid timer
+ *          TIMER_INVALID_CONFIG    :   In case of invalid period or NULL callback
+ *          TIMER_INVALID_ARGS      :   In case of NULL pointer
+ */
+en_timer_error_t timer_init_periodic(const st_timer_cfg_t * ptr_st_timer_cfg);
+
+/**
+ * @brief                       :   Initializes a timer in 32-bit one-shot mode with a timeout callback,
+ *                                  each timer_start gives one callback a period later, then the timer stops
+ *
+ * @param[in]   ptr_st_timer_cfg    :   Pointer to timer configuration
+ *
+ * @return  TIMER_OK                :   In case of Successful Operation
+ *          TIMER_INVALID_TIMER     :   In case of invalid timer
+ *          TIMER_INVALID_CONFIG    :   In case of invalid period or NULL callback
+ *          TIMER_INVALID_ARGS      :   In case of NULL pointer
+ */
+en_timer_error_t timer_init_one_shot(const st_timer_cfg_t * ptr_st_timer_cfg);
+
+/**
+ * @brief                       :   Starts (or restarts from a full period) a timer
+ *
+ * @param[in]   en_timer        :   Timer
+ *
+ * @return  TIMER_OK            :   In case of Successful Operation
+ *          TIMER_INVALID_TIMER :   In case of invalid timer
+ */
+en_timer_error_t timer_start(en_timer_t en_timer);
+
+/**
+ * @brief                       :   Stops a timer, a time-out its callback didn't run for yet is dropped
+ *
+ * @param[in]   en_timer        :   Timer
+ *
+ * @return  TIMER_OK            :   In case of Successful Operation
+ *          TIMER_INVALID_TIMER :   In case of invalid timer
+ */
+en_timer_error_t timer_stop(en_timer_t en_timer);
+
+/**
+ * @brief                       :   Changes the period of a timer, applied on the next timeout
+ *
+ * @param[in]   en_timer        :   Timer
+ * @param[in]   u32_period_us   :   New period in us
+ *
+ * @return  TIMER_OK                :   In case of Successful Operation
+ *          TIMER_INVALID_TIMER     :   In case of invalid timer
+ *          TIMER_INVALID_CONFIG    :   In case of invalid period
+ */
+en_timer_error_t timer_set_period(en_timer_t en_timer, uint32_t_ u32_period_us);
+
+#endif /* TIMER_INTERFACE_H_ */
@@ -0,0 +1,43 @@
+/**
+ * @file    :   timer_private.h
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Header File contains all general purpose timer registers and private macros
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef TIMER_PRIVATE_H_
+#define TIMER_PRIVATE_H_
+
+#include "hw_reg.h"
+
+#define TIMER_OFFSET(X)         (0x40030000 + ((X) * 0x1000))
+
+#define RCGCTIMER               HW_REG(0x400FE604) /* 16/32-Bit Timer Run Mode Clock Gating Control */
+
+#define GPTMCFG(X)              HW_REG(TIMER_OFFSET(X) + 0x000)  /* GPTM Configuration */
+#define GPTMTAMR(X)             HW_REG(TIMER_OFFSET(X) + 0x004)  /* GPTM Timer A Mode */
+#define GPTMCTL(X)              HW_REG(TIMER_OFFSET(X) + 0x00C)  /* GPTM Control */
+#define GPTMIMR(X)              HW_REG(TIMER_OFFSET(X) + 0x018)  /* GPTM Interrupt Mask */
+#define GPTMICR(X)              HW_REG(TIMER_OFFSET(X) + 0x024)  /* GPTM Interrupt Clear */
+#define GPTMTAILR(X)            HW_REG(TIMER_OFFSET(X) + 0x028)  /* GPTM Timer A Interval Load */
+#define GPTMTAV(X)              HW_REG(TIMER_OFFSET(X) + 0x050)  /* GPTM Timer A Value */
+
+// GPTMCFG values
+#define GPTMCFG_32_BIT          0x0
+
+// GPTMTAMR values
+#define GPTMTAMR_ONE_SHOT       0x1     /* stops (clears TAEN) at the time-out */
+#define GPTMTAMR_PERIODIC       0x2
+
+// GPTMCTL BITS
+#define GPTMCTL_TAEN            0
+
+// GPTMIMR / GPTMICR BITS
+#define GPTM_TATO               0
+
+#define TIMER_US_PER_S          1000000UL
+
+#endif /* TIMER_PRIVATE_H_ */
@@ -0,0 +1,249 @@
+/**
+ * @file    :   timer_program.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Program File contains all general purpose timer functions' implementation
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "bit_math.h"
+
+#include "TM4C123.h"
+
+#include "timer_interface.h"
+#include "timer_private.h"
+
+static const IRQn_Type gl_arr_timer_irqn[TIMER_TOTAL] = {
+    TIMER0A_IRQn, TIMER1A_IRQn, TIMER2A_IRQn, TIMER3A_IRQn, TIMER4A_IRQn, TIMER5A_IRQn
+};
+
+static timer_cb gl_arr_timer_cbf[TIMER_TOTAL] = {NULL_PTR};
+
+/**
+ * @brief                       :   Converts a period in us to a timer interval load value
+ *
+ * @param[in]   u32_period_us   :   Period in us
+ * @param[out]  ptr_u32_load    :   Interval load value (ticks - 1)
+ *
+ * @return  TIMER_OK                :   In case of Successful Operation
+ *          TIMER_INVALID_CONFIG    :   In case the period is 0 or doesn't fit in 32 bits
+ */
+static en_timer_error_t timer_period_to_load(uint32_t_ u32_period_us, uint32_t_ * ptr_u32_load)
+{
+    en_timer_error_t en_timer_error_retval = TIMER_OK;
+    uint64_t_ u64_ticks = ((uint64_t_) SystemCoreClock * u32_period_us) / TIMER_US_PER_S;
+
+    if((ZERO == u64_ticks) || (0xFFFFFFFFUL < u64_ticks))
+    {
+        en_timer_error_retval = TIMER_INVALID_CONFIG;
+    }
+    else
+    {
+        *ptr_u32_load = (uint32_t_) (u64_ticks - 1);
+    }
+
+    return en_timer_error_retval;
+}
+
+/**
+ * @brief                       :   Initializes a timer in a 32-bit mode with a timeout callback,
+ *                                  the timer is left stopped
+ *
+ * @param[in]   ptr_st_timer_cfg    :   Pointer to timer configuration
+ * @param[in]   u32_mode            :   GPTMTAMR mode, GPTMTAMR_PERIODIC or GPTMTAMR_ONE_SHOT
+ *
+ * @return  TIMER_OK                :   In case of Successful Operation
+ *          TIMER_INVALID_TIMER     :   In case of invalid timer
+ *          TIMER_INVALID_CONFIG    :   In case of invalid period or NULL callback
+ *          TIMER_INVALID_ARGS      :   In case of NULL pointer
+ */
+static en_timer_error_t timer_init(const st_timer_cfg_t * ptr_st_timer_cfg, uint32_t_ u32_mode)
+{
+    en_timer_error_t en_timer_error_retval = TIMER_OK;
+    uint32_t_ u32_load = 0;
+
+    if(NULL_PTR == ptr_st_timer_cfg)
+    {
+        en_timer_error_retval = TIMER_INVALID_ARGS;
+    }
+    else if(TIMER_TOTAL <= ptr_st_timer_cfg->en_timer)
+    {
+        en_timer_error_retval = TIMER_INVALID_TIMER;
+    }
+    else if(NULL_PTR == ptr_st_timer_cfg->ptr_cbf)
+    {
+        en_timer_error_retval = TIMER_INVALID_CONFIG;
+    }
+    else
+    {
+        en_timer_error_retval = timer_period_to_load(ptr_st_timer_cfg->u32_period_us, &u32_load);
+    }
+
+    if(TIMER_OK == en_timer_error_retval)
+    {
+        en_timer_t en_timer = ptr_st_timer_cfg->en_timer;
+
+        // 1. enable module clock
+        SET_BIT(RCGCTIMER, en_timer);
+
+        // 2. disable timer while configuring
+        CLR_BIT(GPTMCTL(en_timer), GPTMCTL_TAEN);
+
+        // 3. 32-bit down counter
+        GPTMCFG(en_timer) = GPTMCFG_32_BIT;
+        GPTMTAMR(en_timer) = u32_mode;
+        GPTMTAILR(en_timer) = u32_load;
+
+        // 4. timeout interrupt
+        gl_arr_timer_cbf[en_timer] = ptr_st_timer_cfg->ptr_cbf;
+        GPTMICR(en_timer) = (1 << GPTM_TATO);
+        SET_BIT(GPTMIMR(en_timer), GPTM_TATO);
+
+        NVIC_EnableIRQ(gl_arr_timer_irqn[en_timer]);
+        __enable_irq();
+    }
+
+    return en_timer_error_retval;
+}
+
+/**
+ * @brief                       :   Initializes a timer in 32-bit periodic mode with a timeout callback,
+ *                                  the timer is left stopped
+ *
+ * @param[in]   ptr_st_timer_cfg    :   Pointer to timer configuration
+ *
+ * @return  TIMER_OK                :   In case of Successful Operation
+ *          TIMER_INVALID_TIMER     :   In case of invalid timer
+ *          TIMER_INVALID_CONFIG    :   In case of invalid period or NULL callback
+ *          TIMER_INVALID_ARGS      :   In case of NULL pointer
+ */
+en_timer_error_t timer_init_periodic(const st_timer_cfg_t * ptr_st_timer_cfg)
+{
+    return timer_init(ptr_st_timer_cfg, GPTMTAMR_PERIODIC);
+}
+
+/**
+ * @brief                       :   Initializes a timer in 32-bit one-shot mode with a timeout callback,
+ *                                  each timer_start gives one callback a period later, then the timer stops
+ *
+ * @param[in]   ptr_st_timer_cfg    :   Pointer to timer configuration
+ *
+ * @return  TIMER_OK                :   In case of Successful Operation
+ *          TIMER_INVALID_TIMER     :   In case of invalid timer
+ *          TIMER_INVALID_CONFIG    :   In case of invalid period or NULL callback
+ *          TIMER_INVALID_ARGS      :   In case of NULL pointer
+ */
+en_timer_error_t timer_init_one_shot(const st_timer_cfg_t * ptr_st_timer_cfg)
+{
+    return timer_init(ptr_st_timer_cfg, GPTMTAMR_ONE_SHOT);
+}
+
+/**
+ * @brief                       :   Starts (or restarts from a full period) a timer
+ *
+ * @param[in]   en_timer        :   Timer
+ *
+ * @return  TIMER_OK            :   In case of Successful Operation
+ *          TIMER_INVALID_TIMER :   In case of invalid timer
+ */
+en_timer_error_t timer_start(en_timer_t en_timer)
+{
+    en_timer_error_t en_timer_error_retval = TIMER_OK;
+
+    if(TIMER_TOTAL <= en_timer)
+    {
+        en_timer_error_retval = TIMER_INVALID_TIMER;
+    }
+    else
+    {
+        // writing the value register reloads the counter
+        GPTMTAV(en_timer) = GPTMTAILR(en_timer);
+        SET_BIT(GPTMCTL(en_timer), GPTMCTL_TAEN);
+    }
+
+    return en_timer_error_retval;
+}
+
+/**
+ * @brief                       :   Stops a timer, a time-out its callback didn't run for yet is dropped
+ *
+ * @param[in]   en_timer        :   Timer
+ *
+ * @return  TIMER_OK            :   In case of Successful Operation
+ *          TIMER_INVALID_TIMER :   In case of invalid timer
+ */
+en_timer_error_t timer_stop(en_timer_t en_timer)
+{
+    en_timer_error_t en_timer_error_retval = TIMER_OK;
+
+    if(TIMER_TOTAL <= en_timer)
+    {
+        en_timer_error_retval = TIMER_INVALID_TIMER;
+    }
+    else
+    {
+        CLR_BIT(GPTMCTL(en_timer), GPTMCTL_TAEN);
+        GPTMICR(en_timer) = (1 << GPTM_TATO);
+    }
+
+    return en_timer_error_retval;
+}
+
+/**
+ * @brief                       :   Changes the period of a timer, applied on the next timeout
+ *
+ * @param[in]   en_timer        :   Timer
+ * @param[in]   u32_period_us   :   New period in us
+ *
+ * @return  TIMER_OK                :   In case of Successful Operation
+ *          TIMER_INVALID_TIMER     :   In case of invalid timer
+ *          TIMER_INVALID_CONFIG    :   In case of invalid period
+ */
+en_timer_error_t timer_set_period(en_timer_t en_timer, uint32_t_ u32_period_us)
+{
+    en_timer_error_t en_timer_error_retval = TIMER_OK;
+    uint32_t_ u32_load = 0;
+
+    if(TIMER_TOTAL <= en_timer)
+    {
+        en_timer_error_retval = TIMER_INVALID_TIMER;
+    }
+    else
+    {
+        en_timer_error_retval = timer_period_to_load(u32_period_us, &u32_load);
+
+        if(TIMER_OK == en_timer_error_retval)
+        {
+            GPTMTAILR(en_timer) = u32_load;
+        }
+    }
+
+    return en_timer_error_retval;
+}
+
+/*---------------------------------------------------------/
+/ INTERRUPT HANDLERS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Common timeout handler, clears the flag and calls the timer callback
+ *
+ * @param[in]   en_timer        :   Timer that timed out
+ */
+static void timer_handler(en_timer_t en_timer)
+{
+    GPTMICR(en_timer) = (1 << GPTM_TATO);
+
+    if(NULL_PTR != gl_arr_timer_cbf[en_timer])
+    {
+        gl_arr_timer_cbf[en_timer]();
+    }
+}
+
+void TIMER0A_Handler(void) { timer_handler(TIMER_0); }
+void TIMER1A_Handler(void) { timer_handler(TIMER_1); }
+void TIMER2A_Handler(void) { timer_handler(TIMER_2); }
+void TIMER3A_Handler(void) { timer_handler(TIMER_3); }
+void TIMER4A_Handler(void) { timer_handler(TIMER_4); }
+void TIMER5A_Handler(void) { timer_handler(TIMER_5); }
@@ -0,0 +1,113 @@
+/**
+ * @file    :   trace_interface.h
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Header File contains all binary event trace typedefs and functions' prototypes
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Real-time event log for timing issues a debugger breakpoint would hide. Every trace point
+ * writes one 8 byte record (DWT cycle stamp, event, two arguments) into a RAM ring; the slot is
+ * reserved with one exclusive (LDREX/STREX) increment of the write index, so trace points are
+ * safe from any interrupt priority without masking interrupts. The oldest records are overwritten.
+ * Build with TRACE_INSTRUMENTATION = 1 to enable the trace points, they compile to nothing
+ * otherwise. TRACE_EVENTS_MASK (bit n = event n) drops events at compile time, e.g. the 1 ms
+ * SysTick which otherwise fills the ring in TRACE_RECORDS ms.
+ * To read the log halt the target, dump the RAM holding gl_st_trace (Keil: SAVE, gdb: dump)
+ * and run tools/trace_decode.py on the dump.
+ */
+
+#ifndef TRACE_INTERFACE_H_
+#define TRACE_INTERFACE_H_
+
+#include "std.h"
+
+/*----------------------------------------------------------/
+/- MACROS
+/----------------------------------------------------------*/
+#ifndef TRACE_INSTRUMENTATION
+#define TRACE_INSTRUMENTATION       0
+#endif
+
+#ifndef TRACE_EVENTS_MASK
+#define TRACE_EVENTS_MASK           0xFFFFFFFFUL    /* all events */
+#endif
+
+#ifndef TRACE_RECORDS
+#define TRACE_RECORDS               512             /* power of 2, 8 bytes each */
+#endif
+
+#define TRACE_MAGIC                 0x31435254UL    /* "TRC1", located by the decoder */
+
+/* record data word: event bits 0 -> 7, arg0 bits 8 -> 15, arg1 bits 16 -> 31 */
+#define TRACE_DATA_ARG0_POS         8
+#define TRACE_DATA_ARG1_POS         16
+
+/* trace point */
+#if TRACE_INSTRUMENTATION
+#define TRACE(EVENT, ARG0, ARG1)                                                    \
+    do                                                                              \
+    {                                                                               \
+        if(TRACE_EVENTS_MASK & (1UL << (EVENT)))                                    \
+        {                                                                           \
+            trace_write((uint32_t_)(EVENT)                                      |   \
+                        ((uint32_t_)(uint8_t_)(ARG0) << TRACE_DATA_ARG0_POS)    |   \
+                        ((uint32_t_)(uint16_t_)(ARG1) << TRACE_DATA_ARG1_POS));     \
+        }                                                                           \
+    }while(0)
+#else
+#define TRACE(EVENT, ARG0, ARG1)
+#endif
+
+/*----------------------------------------------------------/
+/- ENUMS
+/----------------------------------------------------------*/
+/* Events, tools/trace_decode.py reads the names and argument comments from this enum */
+typedef enum
+{
+    TRACE_EV_GPIO_ISR       = 0 ,   /* arg0: port, arg1: pin */
+    TRACE_EV_SYSTICK            ,   /* arg0: -, arg1: ms (low 16 bits) */
+    TRACE_EV_BTN_EDGE           ,   /* arg0: port, arg1: - */
+    TRACE_EV_BTN_EVENT          ,   /* arg0: event, arg1: port << 8 | pin */
+    TRACE_EV_LED_WRITE          ,   /* arg0: port, arg1: pins << 8 | levels */
+    TRACE_EV_APP_STATE          ,   /* arg0: state entered, arg1: - */
+    TRACE_EV_TOTAL
+}en_trace_event_t;
+
+/*----------------------------------------------------------/
+/- STRUCTS
+/----------------------------------------------------------*/
+typedef struct
+{
+    uint32_t_               u32_stamp                       ; /* DWT cycles */
+    uint32_t_               u32_data                        ; /* event and arguments */
+}st_trace_record_t;
+
+/* Everything the decoder needs, in one block of RAM */
+typedef struct
+{
+    uint32_t_               u32_magic                       ; /* TRACE_MAGIC */
+    uint32_t_               u32_records                     ; /* TRACE_RECORDS */
+    uint32_t_               u32_clock_hz                    ; /* core clock of the stamps */
+    volatile uint32_t_      u32_index                       ; /* records ever written */
+    st_trace_record_t       arr_st_records[TRACE_RECORDS]   ; /* record n in slot n % TRACE_RECORDS */
+}st_trace_buffer_t;
+
+/*---------------------------------------------------------/
+/ FUNCTIONS PROTOTYPES
+/---------------------------------------------------------*/
+
+/**
+ * @brief                       :   Starts the cycle counter and empties the ring
+ */
+void trace_init(void);
+
+/**
+ * @brief                       :   Appends one record, callable from any context, use the TRACE macro
+ *
+ * @param[in]   u32_data        :   Event and arguments, packed as in TRACE
+ */
+void trace_write(uint32_t_ u32_data);
+
+#endif /* TRACE_INTERFACE_H_ */
@@ -0,0 +1,21 @@
+/**
+ * @file    :   trace_private.h
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Header File contains all binary event trace private macros
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef TRACE_PRIVATE_H_
+#define TRACE_PRIVATE_H_
+
+#include "hw_reg.h"
+
+/* cycle counter of MCAL/dwt, read directly to keep trace points short */
+#define TRACE_DWT_CYCCNT        HW_REG(0xE0001004)
+
+#define TRACE_RECORDS_MASK      (TRACE_RECORDS - 1)
+
+#endif /* TRACE_PRIVATE_H_ */
@@ -0,0 +1,74 @@
+/**
+ * @file    :   trace_program.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Program File contains all binary event trace functions' implementation
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "TM4C123.h"
+
+#include "trace_interface.h"
+#include "trace_private.h"
+#include "dwt_interface.h"
+
+#if (TRACE_RECORDS & TRACE_RECORDS_MASK) != 0
+#error "TRACE_RECORDS must be a power of 2"
+#endif
+
+/*---------------------------------------------------------/
+/- GLOBAL VARIABLES
+/---------------------------------------------------------*/
+/*
+ * Not static so the dump can be located by symbol, the header is initialized statically
+ * so trace points before trace_init still decode
+ */
+st_trace_buffer_t gl_st_trace = {
+    .u32_magic      = TRACE_MAGIC,
+    .u32_records    = TRACE_RECORDS,
+    .u32_clock_hz   = 0,
+    .u32_index      = 0
+};
+
+/*---------------------------------------------------------/
+/- FUNCTION IMPLEMENTATION
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Starts the cycle counter and empties the ring
+ */
+void trace_init(void)
+{
+    dwt_init();
+
+    gl_st_trace.u32_clock_hz = SystemCoreClock;
+    gl_st_trace.u32_index = 0;
+}
+
+/**
+ * @brief                       :   Appends one record, callable from any context, use the TRACE macro
+ *
+ * @param[in]   u32_data        :   Event and arguments, packed as in TRACE
+ */
+void trace_write(uint32_t_ u32_data)
+{
+    uint32_t_ u32_index;
+    uint32_t_ u32_stamp;
+    st_trace_record_t * ptr_st_record;
+
+    /*
+     * Reserve the slot, an interrupt between LDREX and STREX fails the STREX and retries.
+     * Stamping inside the reservation keeps the stamps in index order.
+     */
+    do
+    {
+        u32_index = __LDREXW(&gl_st_trace.u32_index);
+        u32_stamp = TRACE_DWT_CYCCNT;
+    }
+    while(0 != __STREXW(u32_index + 1, &gl_st_trace.u32_index));
+
+    ptr_st_record = &gl_st_trace.arr_st_records[u32_index & TRACE_RECORDS_MASK];
+    ptr_st_record->u32_stamp = u32_stamp;
+    ptr_st_record->u32_data = u32_data;
+}
@@ -0,0 +1,112 @@
+/**
+ * @file    :   uart_interface.h
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Header File contains all UART typedefs and functions' prototypes
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * UART0 (RX: PA0, TX: PA1, the ICDI virtual COM port), 8N1, both directions serviced by uDMA,
+ * no call ever waits for the line.
+ * TX : uart_write copies into a ring buffer, uDMA sends it in contiguous chunks, the completion
+ *      interrupt starts the next chunk.
+ * RX : uDMA fills the two halves of a ring buffer in ping-pong mode, uart_read takes what was
+ *      received so far (including a partly filled half). Data the reader doesn't take within
+ *      UART_RX_BUFFER_SIZE bytes is overwritten and counted as an overrun.
+ */
+
+#ifndef UART_INTERFACE_H_
+#define UART_INTERFACE_H_
+
+/*----------------------------------------------------------/
+/- INCLUDES
+/----------------------------------------------------------*/
+#include "std.h"
+
+/*----------------------------------------------------------/
+/- MACROS
+/----------------------------------------------------------*/
+#define UART_TX_BUFFER_SIZE     256     /* power of 2 */
+#define UART_RX_BUFFER_SIZE     128     /* power of 2, two uDMA halves */
+
+/*----------------------------------------------------------/
+/- ENUMS
+/----------------------------------------------------------*/
+typedef enum
+{
+    UART_OK                 =   0   ,
+    UART_INVALID_CONFIG             ,
+    UART_INVALID_ARGS               ,
+}en_uart_error_t;
+
+/*----------------------------------------------------------/
+/- STRUCTURES
+/----------------------------------------------------------*/
+typedef struct
+{
+    uint32_t_           u32_baud_rate   ; /* up to SysClk / 8 */
+}st_uart_cfg_t;
+
+typedef struct
+{
+    uint32_t_           u32_tx_bytes    ; /* accepted by uart_write */
+    uint32_t_           u32_tx_dropped  ; /* refused by uart_write, TX ring full */
+    uint32_t_           u32_rx_bytes    ; /* taken by uart_read */
+    uint32_t_           u32_rx_overruns ; /* times unread data was overwritten */
+}st_uart_stats_t;
+
+/*---------------------------------------------------------/
+/ FUNCTIONS PROTOTYPES
+/---------------------------------------------------------*/
+
+/**
+ * @brief                       :   Initializes UART0 and its pins, starts uDMA reception
+ *
+ * @param[in]   ptr_st_uart_cfg :   Pointer to UART configuration
+ *
+ * @return  UART_OK             :   In case of Successful Operation
+ *          UART_INVALID_CONFIG :   In case of unreachable baud rate
+ *          UART_INVALID_ARGS   :   In case of NULL pointer
+ */
+en_uart_error_t uart_init(const st_uart_cfg_t * ptr_st_uart_cfg);
+
+/**
+ * @brief                       :   Queues bytes for transmission, never waits
+ *
+ * @param[in]   ptr_u8_data     :   Pointer to bytes to send
+ * @param[in]   u16_length      :   Number of bytes
+ *
+ * @return  bytes queued, less than u16_length when the TX ring is full
+ */
+uint16_t_ uart_write(const uint8_t_ * ptr_u8_data, uint16_t_ u16_length);
+
+/**
+ * @brief                       :   Takes received bytes, never waits
+ *
+ * @param[out]  ptr_u8_data     :   Pointer to store the bytes in
+ * @param[in]   u16_max         :   Size of the buffer
+ *
+ * @return  bytes taken, 0 when nothing was received
+ */
+uint16_t_ uart_read(uint8_t_ * ptr_u8_data, uint16_t_ u16_max);
+
+/**
+ * @brief                       :   Checks whether queued bytes are still being sent
+ *
+ * @return  TRUE                :   TX ring not empty or UART shifting
+ *          FALSE               :   All sent
+ */
+boolean uart_tx_busy(void);
+
+/**
+ * @brief                       :   Reads the byte counters
+ *
+ * @param[out]  ptr_st_stats    :   Pointer to store the counters in
+ *
+ * @return  UART_OK             :   In case of Successful Operation
+ *          UART_INVALID_ARGS   :   In case of NULL pointer
+ */
+en_uart_error_t uart_get_stats(st_uart_stats_t * ptr_st_stats);
+
+#endif /* UART_INTERFACE_H_ */
@@ -0,0 +1,62 @@
+/**
+ * @file    :   uart_private.h
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Header File contains all UART registers and private macros
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef UART_PRIVATE_H_
+#define UART_PRIVATE_H_
+
+#include "hw_reg.h"
+
+#define UART0_BASE_ADDRESS      0x4000C000
+
+#define RCGCUART                HW_REG(0x400FE618) /* UART Run Mode Clock Gating Control */
+
+#define UART0DR                 HW_REG(UART0_BASE_ADDRESS + 0x000)   /* UART Data */
+#define UART0FR                 HW_REG(UART0_BASE_ADDRESS + 0x018)   /* UART Flag */
+#define UART0IBRD               HW_REG(UART0_BASE_ADDRESS + 0x024)   /* UART Integer Baud-Rate Divisor */
+#define UART0FBRD               HW_REG(UART0_BASE_ADDRESS + 0x028)   /* UART Fractional Baud-Rate Divisor */
+#define UART0LCRH               HW_REG(UART0_BASE_ADDRESS + 0x02C)   /* UART Line Control */
+#define UART0CTL                HW_REG(UART0_BASE_ADDRESS + 0x030)   /* UART Control */
+#define UART0IFLS               HW_REG(UART0_BASE_ADDRESS + 0x034)   /* UART Interrupt FIFO Level Select */
+#define UART0DMACTL             HW_REG(UART0_BASE_ADDRESS + 0x048)   /* UART DMA Control */
+#define UART0CC                 HW_REG(UART0_BASE_ADDRESS + 0xFC8)   /* UART Clock Configuration */
+
+// UARTFR BITS
+#define UARTFR_BUSY             3
+
+// UARTLCRH BITS
+#define UARTLCRH_FEN            4
+#define UARTLCRH_WLEN_8         (0x3 << 5)
+
+// UARTCTL BITS
+#define UARTCTL_UARTEN          0
+#define UARTCTL_HSE             5
+#define UARTCTL_TXE             8
+#define UARTCTL_RXE             9
+
+// UARTIFLS values
+#define UARTIFLS_HALF           0x12    /* TX and RX at 1/2 FIFO */
+
+// UARTDMACTL BITS
+#define UARTDMACTL_RXDMAE       0
+#define UARTDMACTL_TXDMAE       1
+
+// UARTCC values
+#define UARTCC_CS_SYS_CLK       0x0
+
+#define UART_CLK_DIV            16      /* bit clock divisor, 8 with HSE */
+#define UART_CLK_DIV_HSE        8
+#define UART_FBRD_BITS          6       /* fractional divisor, 1/64 steps */
+#define UART_FBRD_MASK          0x3F
+
+#define UART_PCTL_UART0         1       /* GPIOPCTL encoding for U0RX (PA0) / U0TX (PA1) */
+
+#define UART_RX_HALF_SIZE       (UART_RX_BUFFER_SIZE / 2)
+
+#endif /* UART_PRIVATE_H_ */
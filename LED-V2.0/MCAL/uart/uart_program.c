@@ -0,0 +1,357 @@
+/**
+ * @file    :   uart_program.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Program File contains all UART functions' implementation
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "bit_math.h"
+
+#include "TM4C123.h"
+
+#include "gpio_interface.h"
+#include "udma_interface.h"
+
+#include "uart_interface.h"
+#include "uart_private.h"
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+/* TX ring, free running indices */
+static uint8_t_ gl_arr_u8_uart_tx[UART_TX_BUFFER_SIZE];
+static volatile uint16_t_ gl_u16_uart_tx_head = 0;     /* written by uart_write only */
+static volatile uint16_t_ gl_u16_uart_tx_tail = 0;     /* written by the UART interrupt only */
+static volatile uint16_t_ gl_u16_uart_tx_chunk = 0;    /* bytes handed to uDMA, 0: TX idle */
+
+/* RX ring, half 0 is filled by the primary structure, half 1 by the alternate one */
+static uint8_t_ gl_arr_u8_uart_rx[UART_RX_BUFFER_SIZE];
+static volatile uint32_t_ gl_u32_uart_rx_halves = 0;   /* completed halves, written by the UART interrupt only */
+static uint32_t_ gl_u32_uart_rx_read = 0;               /* bytes taken, written by uart_read only */
+
+static st_uart_stats_t gl_st_uart_stats;
+
+static const st_gpio_cfg_t gl_arr_st_uart_pins[] = {
+    {.port = GPIO_PORT_A, .pin = GPIO_PIN_0, .pin_cfg = ALT_FUNCTION, .alt_func = UART_PCTL_UART0},
+    {.port = GPIO_PORT_A, .pin = GPIO_PIN_1, .pin_cfg = ALT_FUNCTION, .alt_func = UART_PCTL_UART0},
+};
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Hands the next contiguous part of the TX ring to uDMA if TX is idle,
+ *                                  called with the UART interrupt masked or from it
+ */
+static void uart_tx_start(void)
+{
+    uint16_t_ u16_tail = gl_u16_uart_tx_tail;
+    uint16_t_ u16_start = u16_tail & (UART_TX_BUFFER_SIZE - 1);
+    uint16_t_ u16_length = gl_u16_uart_tx_head - u16_tail;
+
+    if((ZERO == gl_u16_uart_tx_chunk) && (ZERO != u16_length))
+    {
+        st_udma_transfer_t st_transfer = {
+            .ptr_src    = &gl_arr_u8_uart_tx[u16_start],
+            .ptr_dst    = &UART0DR,
+            .en_size    = UDMA_SIZE_8,
+            .en_src_inc = UDMA_INC_8,
+            .en_dst_inc = UDMA_INC_NONE,
+            .en_arb     = UDMA_ARB_4,   /* burst request at half empty FIFO: 8 free entries */
+            .en_mode    = UDMA_MODE_BASIC
+        };
+
+        // up to the end of the ring, the wrapped part follows in the next chunk
+        if(UART_TX_BUFFER_SIZE < (u16_start + u16_length))
+        {
+            u16_length = UART_TX_BUFFER_SIZE - u16_start;
+        }
+
+        st_transfer.u16_items = u16_length;
+        gl_u16_uart_tx_chunk = u16_length;
+
+        udma_transfer_set(UDMA_CH_UART0_TX, UDMA_PRIMARY, &st_transfer);
+        udma_channel_enable(UDMA_CH_UART0_TX, UDMA_PRIMARY);
+    }
+}
+
+/**
+ * @brief                       :   Points one RX control structure at its half again
+ *
+ * @param[in]   en_select       :   UDMA_PRIMARY (half 0) or UDMA_ALTERNATE (half 1)
+ */
+static void uart_rx_arm(en_udma_select_t en_select)
+{
+    st_udma_transfer_t st_transfer = {
+        .ptr_src    = &UART0DR,
+        .ptr_dst    = &gl_arr_u8_uart_rx[en_select * UART_RX_HALF_SIZE],
+        .u16_items  = UART_RX_HALF_SIZE,
+        .en_size    = UDMA_SIZE_8,
+        .en_src_inc = UDMA_INC_NONE,
+        .en_dst_inc = UDMA_INC_8,
+        .en_arb     = UDMA_ARB_1,       /* single requests, every byte leaves the FIFO at once */
+        .en_mode    = UDMA_MODE_PING_PONG
+    };
+
+    udma_transfer_set(UDMA_CH_UART0_RX, en_select, &st_transfer);
+}
+
+/**
+ * @brief                       :   Computes how many bytes uDMA wrote into the RX ring since init
+ *
+ * @return  bytes received (free running)
+ */
+static uint32_t_ uart_rx_written(void)
+{
+    uint32_t_ u32_halves;
+    uint16_t_ u16_remaining;
+
+    // retry if a half completed between the two reads
+    do
+    {
+        u32_halves = gl_u32_uart_rx_halves;
+        u16_remaining = udma_transfer_get_remaining(UDMA_CH_UART0_RX, (en_udma_select_t)(u32_halves & 1));
+    }
+    while(u32_halves != gl_u32_uart_rx_halves);
+
+    return (u32_halves * UART_RX_HALF_SIZE) + (UART_RX_HALF_SIZE - u16_remaining);
+}
+
+/*---------------------------------------------------------/
+/- FUNCTION IMPLEMENTATION
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Initializes UART0 and its pins, starts uDMA reception
+ *
+ * @param[in]   ptr_st_uart_cfg :   Pointer to UART configuration
+ *
+ * @return  UART_OK             :   In case of Successful Operation
+ *          UART_INVALID_CONFIG :   In case of unreachable baud rate
+ *          UART_INVALID_ARGS   :   In case of NULL pointer
+ */
+en_uart_error_t uart_init(const st_uart_cfg_t * ptr_st_uart_cfg)
+{
+    en_uart_error_t en_uart_error_retval = UART_OK;
+    uint32_t_ u32_clk_div = UART_CLK_DIV;
+
+    if(NULL_PTR == ptr_st_uart_cfg)
+    {
+        en_uart_error_retval = UART_INVALID_ARGS;
+    }
+    else if(
+            (ZERO == ptr_st_uart_cfg->u32_baud_rate) ||
+            ((SystemCoreClock / UART_CLK_DIV_HSE) < ptr_st_uart_cfg->u32_baud_rate)
+            )
+    {
+        en_uart_error_retval = UART_INVALID_CONFIG;
+    }
+    else
+    {
+        uint32_t_ u32_div64;
+        uint8_t_ u8_pin;
+
+        // high speed (8x oversampling) only when 16x can't reach the rate
+        if((SystemCoreClock / UART_CLK_DIV) < ptr_st_uart_cfg->u32_baud_rate)
+        {
+            u32_clk_div = UART_CLK_DIV_HSE;
+        }
+
+        // divisor in 1/64 steps, rounded: SysClk * 64 / (div * baud)
+        u32_div64 = ((SystemCoreClock * ((2UL << UART_FBRD_BITS) / u32_clk_div)) / ptr_st_uart_cfg->u32_baud_rate + 1) / 2;
+
+        // 1. enable module clock, uDMA and pins
+        SET_BIT(RCGCUART, 0);
+        udma_init();
+        udma_channel_assign(UDMA_CH_UART0_RX, 0);
+        udma_channel_assign(UDMA_CH_UART0_TX, 0);
+        for(u8_pin = 0; u8_pin < (sizeof(gl_arr_st_uart_pins) / sizeof(gl_arr_st_uart_pins[0])); u8_pin++)
+        {
+            st_gpio_cfg_t st_gpio_cfg_pin = gl_arr_st_uart_pins[u8_pin];
+            gpio_pin_init(&st_gpio_cfg_pin);
+        }
+
+        // 2. disable module while configuring
+        CLR_BIT(UART0CTL, UARTCTL_UARTEN);
+
+        // 3. baud rate, 8N1 with FIFOs, system clock, DMA requests at half FIFO
+        UART0IBRD = u32_div64 >> UART_FBRD_BITS;
+        UART0FBRD = u32_div64 & UART_FBRD_MASK;
+        UART0LCRH = UARTLCRH_WLEN_8 | (1 << UARTLCRH_FEN);
+        UART0CC = UARTCC_CS_SYS_CLK;
+        UART0IFLS = UARTIFLS_HALF;
+        UART0DMACTL = (1 << UARTDMACTL_RXDMAE) | (1 << UARTDMACTL_TXDMAE);
+
+        // 4. reset the rings and start reception into half 0
+        gl_u16_uart_tx_head = 0;
+        gl_u16_uart_tx_tail = 0;
+        gl_u16_uart_tx_chunk = 0;
+        gl_u32_uart_rx_halves = 0;
+        gl_u32_uart_rx_read = 0;
+        gl_st_uart_stats.u32_tx_bytes = 0;
+        gl_st_uart_stats.u32_tx_dropped = 0;
+        gl_st_uart_stats.u32_rx_bytes = 0;
+        gl_st_uart_stats.u32_rx_overruns = 0;
+
+        uart_rx_arm(UDMA_PRIMARY);
+        uart_rx_arm(UDMA_ALTERNATE);
+        udma_channel_enable(UDMA_CH_UART0_RX, UDMA_PRIMARY);
+
+        // 5. uDMA completion of both channels lands in the UART interrupt
+        NVIC_EnableIRQ(UART0_IRQn);
+        __enable_irq();
+
+        // 6. enable module
+        UART0CTL = (1 << UARTCTL_UARTEN) | (1 << UARTCTL_TXE) | (1 << UARTCTL_RXE) |
+                   ((UART_CLK_DIV_HSE == u32_clk_div) ? (1 << UARTCTL_HSE) : 0);
+    }
+
+    return en_uart_error_retval;
+}
+
+/**
+ * @brief                       :   Queues bytes for transmission, never waits
+ *
+ * @param[in]   ptr_u8_data     :   Pointer to bytes to send
+ * @param[in]   u16_length      :   Number of bytes
+ *
+ * @return  bytes queued, less than u16_length when the TX ring is full
+ */
+uint16_t_ uart_write(const uint8_t_ * ptr_u8_data, uint16_t_ u16_length)
+{
+    uint16_t_ u16_head = gl_u16_uart_tx_head;
+    uint16_t_ u16_free = UART_TX_BUFFER_SIZE - (uint16_t_)(u16_head - gl_u16_uart_tx_tail);
+    uint16_t_ u16_index;
+
+    if(NULL_PTR == ptr_u8_data)
+    {
+        u16_length = 0;
+    }
+    else if(u16_free < u16_length)
+    {
+        gl_st_uart_stats.u32_tx_dropped += u16_length - u16_free;
+        u16_length = u16_free;
+    }
+
+    for(u16_index = 0; u16_index < u16_length; u16_index++)
+    {
+        gl_arr_u8_uart_tx[(u16_head + u16_index) & (UART_TX_BUFFER_SIZE - 1)] = ptr_u8_data[u16_index];
+    }
+
+    /* publish after the bytes are written */
+    gl_u16_uart_tx_head = u16_head + u16_length;
+    gl_st_uart_stats.u32_tx_bytes += u16_length;
+
+    // the interrupt restarts TX itself while a chunk is in flight
+    NVIC_DisableIRQ(UART0_IRQn);
+    uart_tx_start();
+    NVIC_EnableIRQ(UART0_IRQn);
+
+    return u16_length;
+}
+
+/**
+ * @brief                       :   Takes received bytes, never waits
+ *
+ * @param[out]  ptr_u8_data     :   Pointer to store the bytes in
+ * @param[in]   u16_max         :   Size of the buffer
+ *
+ * @return  bytes taken, 0 when nothing was received
+ */
+uint16_t_ uart_read(uint8_t_ * ptr_u8_data, uint16_t_ u16_max)
+{
+    uint32_t_ u32_written = uart_rx_written();
+    uint32_t_ u32_available = u32_written - gl_u32_uart_rx_read;
+    uint16_t_ u16_count = 0;
+
+    if(UART_RX_BUFFER_SIZE < u32_available)
+    {
+        // the oldest bytes were overwritten, resynchronize on new data
+        gl_st_uart_stats.u32_rx_overruns++;
+        gl_u32_uart_rx_read = u32_written;
+        u32_available = 0;
+    }
+
+    if(NULL_PTR != ptr_u8_data)
+    {
+        for(u16_count = 0; (u16_count < u16_max) && (u16_count < u32_available); u16_count++)
+        {
+            ptr_u8_data[u16_count] = gl_arr_u8_uart_rx[(gl_u32_uart_rx_read + u16_count) & (UART_RX_BUFFER_SIZE - 1)];
+        }
+
+        gl_u32_uart_rx_read += u16_count;
+        gl_st_uart_stats.u32_rx_bytes += u16_count;
+    }
+
+    return u16_count;
+}
+
+/**
+ * @brief                       :   Checks whether queued bytes are still being sent
+ *
+ * @return  TRUE                :   TX ring not empty or UART shifting
+ *          FALSE               :   All sent
+ */
+boolean uart_tx_busy(void)
+{
+    return ((gl_u16_uart_tx_head != gl_u16_uart_tx_tail) || (ZERO != GET_BIT(UART0FR, UARTFR_BUSY)));
+}
+
+/**
+ * @brief                       :   Reads the byte counters
+ *
+ * @param[out]  ptr_st_stats    :   Pointer to store the counters in
+ *
+ * @return  UART_OK             :   In case of Successful Operation
+ *          UART_INVALID_ARGS   :   In case of NULL pointer
+ */
+en_uart_error_t uart_get_stats(st_uart_stats_t * ptr_st_stats)
+{
+    en_uart_error_t en_uart_error_retval = UART_OK;
+
+    if(NULL_PTR == ptr_st_stats)
+    {
+        en_uart_error_retval = UART_INVALID_ARGS;
+    }
+    else
+    {
+        *ptr_st_stats = gl_st_uart_stats;
+    }
+
+    return en_uart_error_retval;
+}
+
+/*---------------------------------------------------------/
+/ INTERRUPT HANDLERS
+/---------------------------------------------------------*/
+void UART0_Handler(void)
+{
+    en_udma_select_t en_next;
+
+    if(TRUE == udma_channel_int_clear(UDMA_CH_UART0_TX))
+    {
+        gl_u16_uart_tx_tail += gl_u16_uart_tx_chunk;
+        gl_u16_uart_tx_chunk = 0;
+        uart_tx_start();
+    }
+
+    if(TRUE == udma_channel_int_clear(UDMA_CH_UART0_RX))
+    {
+        // halves complete in turn, re-arm every completed one in that order
+        en_next = (en_udma_select_t)(gl_u32_uart_rx_halves & 1);
+        while(UDMA_MODE_STOP == udma_transfer_get_mode(UDMA_CH_UART0_RX, en_next))
+        {
+            uart_rx_arm(en_next);
+            gl_u32_uart_rx_halves++;
+            en_next = (en_udma_select_t)(gl_u32_uart_rx_halves & 1);
+        }
+
+        // both halves completed before this interrupt ran: the channel stopped
+        if(FALSE == udma_channel_is_enabled(UDMA_CH_UART0_RX))
+        {
+            udma_channel_enable(UDMA_CH_UART0_RX, en_next);
+        }
+    }
+}
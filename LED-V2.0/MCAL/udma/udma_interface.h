@@ -0,0 +1,209 @@
+/**
+ * @file    :   udma_interface.h
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Header File contains all uDMA typedefs and functions' prototypes
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef UDMA_INTERFACE_H_
+#define UDMA_INTERFACE_H_
+
+/*----------------------------------------------------------/
+/- INCLUDES
+/----------------------------------------------------------*/
+#include "std.h"
+
+/*----------------------------------------------------------/
+/- MACROS
+/----------------------------------------------------------*/
+#define UDMA_MAX_TRANSFER_ITEMS     1024    /* Max items per control structure (XFERSIZE is 10 bits) */
+
+/* Channel numbers for the default (encoding 0) channel assignments */
+#define UDMA_CH_UART0_RX            8
+#define UDMA_CH_UART0_TX            9
+#define UDMA_CH_SSI0_RX             10
+#define UDMA_CH_SSI0_TX             11
+
+/* Channel numbers for encoding 2 assignments (see udma_channel_assign) */
+#define UDMA_CH_SSI2_RX             12
+#define UDMA_CH_SSI2_TX             13
+#define UDMA_ENC_SSI2               2
+
+/*----------------------------------------------------------/
+/- ENUMS
+/----------------------------------------------------------*/
+typedef enum
+{
+    UDMA_PRIMARY    =   0   ,
+    UDMA_ALTERNATE          ,
+    UDMA_SELECT_TOTAL
+}en_udma_select_t;
+
+typedef enum
+{
+    UDMA_MODE_STOP          =   0   ,
+    UDMA_MODE_BASIC                 ,
+    UDMA_MODE_AUTO                  ,
+    UDMA_MODE_PING_PONG             ,
+    UDMA_MODE_TOTAL
+}en_udma_mode_t;
+
+typedef enum
+{
+    UDMA_SIZE_8     =   0   ,
+    UDMA_SIZE_16            ,
+    UDMA_SIZE_32            ,
+    UDMA_SIZE_TOTAL
+}en_udma_size_t;
+
+typedef enum
+{
+    UDMA_INC_8      =   0   ,
+    UDMA_INC_16             ,
+    UDMA_INC_32             ,
+    UDMA_INC_NONE           ,
+    UDMA_INC_TOTAL
+}en_udma_inc_t;
+
+typedef enum
+{
+    UDMA_ARB_1      =   0   ,
+    UDMA_ARB_2              ,
+    UDMA_ARB_4              ,
+    UDMA_ARB_8              ,
+    UDMA_ARB_16             ,
+    UDMA_ARB_32             ,
+    UDMA_ARB_64             ,
+    UDMA_ARB_128            ,
+    UDMA_ARB_256            ,
+    UDMA_ARB_512            ,
+    UDMA_ARB_1024           ,
+    UDMA_ARB_TOTAL
+}en_udma_arb_t;
+
+typedef enum
+{
+    UDMA_OK                 =   0   ,
+    UDMA_INVALID_CHANNEL            ,
+    UDMA_INVALID_ARGS               ,
+    UDMA_NOT_INITIALIZED
+}en_udma_error_t;
+
+/*----------------------------------------------------------/
+/- STRUCTURES
+/----------------------------------------------------------*/
+typedef struct
+{
+    const volatile void *   ptr_src         ; /* Start address of the source */
+    volatile void *         ptr_dst         ; /* Start address of the destination */
+    uint16_t_               u16_items       ; /* Number of items to transfer (1 -> UDMA_MAX_TRANSFER_ITEMS) */
+    en_udma_size_t          en_size         ; /* Item size (same for source and destination) */
+    en_udma_inc_t           en_src_inc      ; /* Source address increment */
+    en_udma_inc_t           en_dst_inc      ; /* Destination address increment */
+    en_udma_arb_t           en_arb          ; /* Items transferred before re-arbitration */
+    en_udma_mode_t          en_mode         ; /* Transfer mode */
+}st_udma_transfer_t;
+
+/*---------------------------------------------------------/
+/ FUNCTIONS PROTOTYPES
+/---------------------------------------------------------*/
+
+/**
+ * @brief                       :   Enables the uDMA controller and installs its channel control table
+ *
+ * @return  UDMA_OK             :   In case of Successful Operation
+ */
+en_udma_error_t udma_init(void);
+
+/**
+ * @brief                       :   Selects which peripheral drives a channel (DMACHMAPn encoding)
+ *
+ * @param[in]   u8_channel      :   uDMA channel number (0 -> 31)
+ * @param[in]   u8_encoding     :   Channel encoding (0 -> 15), 0 is the reset assignment
+ *
+ * @return  UDMA_OK                 :   In case of Successful Operation
+ *          UDMA_INVALID_CHANNEL    :   In case of invalid channel number
+ *          UDMA_INVALID_ARGS       :   In case of invalid encoding
+ */
+en_udma_error_t udma_channel_assign(uint8_t_ u8_channel, uint8_t_ u8_encoding);
+
+/**
+ * @brief                       :   Programs a channel control structure, does not enable the channel
+ *
+ * @param[in]   u8_channel      :   uDMA channel number (0 -> 31)
+ * @param[in]   en_select       :   Primary or alternate control structure
+ * @param[in]   ptr_st_transfer :   Pointer to the transfer description
+ *
+ * @return  UDMA_OK                 :   In case of Successful Operation
+ *          UDMA_INVALID_CHANNEL    :   In case of invalid channel number
+ *          UDMA_INVALID_ARGS       :   In case of NULL pointer or out of range transfer fields
+ *          UDMA_NOT_INITIALIZED    :   In case udma_init wasn't called
+ */
+en_udma_error_t udma_transfer_set(uint8_t_ u8_channel, en_udma_select_t en_select, const st_udma_transfer_t * ptr_st_transfer);
+
+/**
+ * @brief                       :   Enables a channel so it starts servicing its peripheral requests
+ *
+ * @param[in]   u8_channel      :   uDMA channel number (0 -> 31)
+ * @param[in]   en_select       :   Control structure to start with
+ *
+ * @return  UDMA_OK                 :   In case of Successful Operation
+ *          UDMA_INVALID_CHANNEL    :   In case of invalid channel number
+ */
+en_udma_error_t udma_channel_enable(uint8_t_ u8_channel, en_udma_select_t en_select);
+
+/**
+ * @brief                       :   Disables a channel
+ *
+ * @param[in]   u8_channel      :   uDMA channel number (0 -> 31)
+ *
+ * @return  UDMA_OK                 :   In case of Successful Operation
+ *          UDMA_INVALID_CHANNEL    :   In case of invalid channel number
+ */
+en_udma_error_t udma_channel_disable(uint8_t_ u8_channel);
+
+/**
+ * @brief                       :   Checks whether a channel is still enabled (transfer in progress)
+ *
+ * @param[in]   u8_channel      :   uDMA channel number (0 -> 31)
+ *
+ * @return  TRUE                :   Channel enabled
+ *          FALSE               :   Channel disabled (done) or invalid channel
+ */
+boolean udma_channel_is_enabled(uint8_t_ u8_channel);
+
+/**
+ * @brief                       :   Reads the current mode of a control structure,
+ *                                  UDMA_MODE_STOP means the structure completed its transfer
+ *
+ * @param[in]   u8_channel      :   uDMA channel number (0 -> 31)
+ * @param[in]   en_select       :   Primary or alternate control structure
+ *
+ * @return  en_udma_mode_t      :   Current mode (UDMA_MODE_STOP on invalid args)
+ */
+en_udma_mode_t udma_transfer_get_mode(uint8_t_ u8_channel, en_udma_select_t en_select);
+
+/**
+ * @brief                       :   Reads the items a control structure still has to transfer
+ *
+ * @param[in]   u8_channel      :   uDMA channel number (0 -> 31)
+ * @param[in]   en_select       :   Primary or alternate control structure
+ *
+ * @return  items left, 0 once the structure completed (or on invalid args)
+ */
+uint16_t_ udma_transfer_get_remaining(uint8_t_ u8_channel, en_udma_select_t en_select);
+
+/**
+ * @brief                       :   Checks and clears the channel completion interrupt flag
+ *
+ * @param[in]   u8_channel      :   uDMA channel number (0 -> 31)
+ *
+ * @return  TRUE                :   Channel completion flag was set (now cleared)
+ *          FALSE               :   Flag not set or invalid channel
+ */
+boolean udma_channel_int_clear(uint8_t_ u8_channel);
+
+#endif /* UDMA_INTERFACE_H_ */
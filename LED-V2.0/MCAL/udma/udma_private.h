@@ -0,0 +1,61 @@
+/**
+ * @file    :   udma_private.h
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Header File contains all uDMA registers and private macros
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef UDMA_PRIVATE_H_
+#define UDMA_PRIVATE_H_
+
+#include "hw_reg.h"
+
+#define UDMA_BASE_ADDRESS       0x400FF000
+
+#define RCGCDMA                 HW_REG(0x400FE60C) /* uDMA Run Mode Clock Gating Control */
+
+#define DMACFG                  HW_REG(UDMA_BASE_ADDRESS + 0x004)   /* DMA Configuration */
+#define DMACTLBASE              HW_REG(UDMA_BASE_ADDRESS + 0x008)   /* DMA Channel Control Base Pointer */
+#define DMAUSEBURSTCLR          HW_REG(UDMA_BASE_ADDRESS + 0x01C)   /* DMA Channel Useburst Clear */
+#define DMAREQMASKCLR           HW_REG(UDMA_BASE_ADDRESS + 0x024)   /* DMA Channel Request Mask Clear */
+#define DMAENASET               HW_REG(UDMA_BASE_ADDRESS + 0x028)   /* DMA Channel Enable Set */
+#define DMAENACLR               HW_REG(UDMA_BASE_ADDRESS + 0x02C)   /* DMA Channel Enable Clear */
+#define DMAALTSET               HW_REG(UDMA_BASE_ADDRESS + 0x030)   /* DMA Channel Primary Alternate Set */
+#define DMAALTCLR               HW_REG(UDMA_BASE_ADDRESS + 0x034)   /* DMA Channel Primary Alternate Clear */
+#define DMAERRCLR               HW_REG(UDMA_BASE_ADDRESS + 0x04C)   /* DMA Bus Error Clear */
+#define DMACHIS                 HW_REG(UDMA_BASE_ADDRESS + 0x504)   /* DMA Channel Interrupt Status */
+#define DMACHMAP(X)             HW_REG(UDMA_BASE_ADDRESS + 0x510 + ((X) * 4))  /* DMA Channel Map Select X (8 channels each) */
+
+// DMACFG BITS
+#define DMACFG_MASTEN           0
+
+// DMACHCTL (channel control word) fields
+#define DMACHCTL_DSTINC_POS     30
+#define DMACHCTL_DSTSIZE_POS    28
+#define DMACHCTL_SRCINC_POS     26
+#define DMACHCTL_SRCSIZE_POS    24
+#define DMACHCTL_ARBSIZE_POS    14
+#define DMACHCTL_XFERSIZE_POS   4
+#define DMACHCTL_XFERSIZE_MASK  0x3FF   /* items - 1 */
+#define DMACHCTL_XFERMODE_MASK  0x7
+
+#define DMACHMAP_CHANNELS       8       /* channels per DMACHMAP register */
+#define DMACHMAP_FIELD_BITS     4
+#define DMACHMAP_FIELD_MASK     0xF
+
+#define UDMA_CHANNELS_TOTAL     32
+#define UDMA_CTL_TABLE_ALIGN    1024    /* DMACTLBASE must be 1024 byte aligned */
+
+/* One channel control structure entry in the control table */
+typedef struct
+{
+    volatile uint32_t_ u32_src_end  ; /* Source end pointer (address of last item) */
+    volatile uint32_t_ u32_dst_end  ; /* Destination end pointer (address of last item) */
+    volatile uint32_t_ u32_control  ; /* Channel control word */
+    volatile uint32_t_ u32_reserved ;
+}st_udma_ctl_entry_t;
+
+#endif /* UDMA_PRIVATE_H_ */
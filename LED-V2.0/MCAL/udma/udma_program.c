@@ -0,0 +1,292 @@
+/**
+ * @file    :   udma_program.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Program File contains all uDMA functions' implementation
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "bit_math.h"
+
+#include "udma_interface.h"
+#include "udma_private.h"
+
+/* Primary structures occupy entries 0 -> 31, alternate structures entries 32 -> 63 */
+static st_udma_ctl_entry_t gl_arr_st_udma_ctl_table[UDMA_SELECT_TOTAL * UDMA_CHANNELS_TOTAL]
+        __attribute__((aligned(UDMA_CTL_TABLE_ALIGN)));
+
+static boolean gl_bool_udma_initialized = FALSE;
+
+/**
+ * @brief                       :   Enables the uDMA controller and installs its channel control table
+ *
+ * @return  UDMA_OK             :   In case of Successful Operation
+ */
+en_udma_error_t udma_init(void)
+{
+    // enable module clock
+    SET_BIT(RCGCDMA, 0);
+
+    // enable controller and install control table
+    SET_BIT(DMACFG, DMACFG_MASTEN);
+    DMACTLBASE = (uint32_t_) gl_arr_st_udma_ctl_table;
+
+    gl_bool_udma_initialized = TRUE;
+
+    return UDMA_OK;
+}
+
+/**
+ * @brief                       :   Selects which peripheral drives a channel (DMACHMAPn encoding)
+ *
+ * @param[in]   u8_channel      :   uDMA channel number (0 -> 31)
+ * @param[in]   u8_encoding     :   Channel encoding (0 -> 15), 0 is the reset assignment
+ *
+ * @return  UDMA_OK                 :   In case of Successful Operation
+ *          UDMA_INVALID_CHANNEL    :   In case of invalid channel number
+ *          UDMA_INVALID_ARGS       :   In case of invalid encoding
+ */
+en_udma_error_t udma_channel_assign(uint8_t_ u8_channel, uint8_t_ u8_encoding)
+{
+    en_udma_error_t en_udma_error_retval = UDMA_OK;
+
+    if(UDMA_CHANNELS_TOTAL <= u8_channel)
+    {
+        en_udma_error_retval = UDMA_INVALID_CHANNEL;
+    }
+    else if(DMACHMAP_FIELD_MASK < u8_encoding)
+    {
+        en_udma_error_retval = UDMA_INVALID_ARGS;
+    }
+    else
+    {
+        uint8_t_ u8_shift = (u8_channel % DMACHMAP_CHANNELS) * DMACHMAP_FIELD_BITS;
+
+        DMACHMAP(u8_channel / DMACHMAP_CHANNELS) =
+                (DMACHMAP(u8_channel / DMACHMAP_CHANNELS) & ~((uint32_t_) DMACHMAP_FIELD_MASK << u8_shift)) |
+                ((uint32_t_) u8_encoding << u8_shift);
+    }
+
+    return en_udma_error_retval;
+}
+
+/**
+ * @brief                       :   Programs a channel control structure, does not enable the channel
+ *
+ * @param[in]   u8_channel      :   uDMA channel number (0 -> 31)
+ * @param[in]   en_select       :   Primary or alternate control structure
+ * @param[in]   ptr_st_transfer :   Pointer to the transfer description
+ *
+ * @return  UDMA_OK                 :   In case of Successful Operation
+ *          UDMA_INVALID_CHANNEL    :   In case of invalid channel number
+ *          UDMA_INVALID_ARGS       :   In case of NULL pointer or out of range transfer fields
+ *          UDMA_NOT_INITIALIZED    :   In case udma_init wasn't called
+ */
+en_udma_error_t udma_transfer_set(uint8_t_ u8_channel, en_udma_select_t en_select, const st_udma_transfer_t * ptr_st_transfer)
+{
+    en_udma_error_t en_udma_error_retval = UDMA_OK;
+
+    if(FALSE == gl_bool_udma_initialized)
+    {
+        en_udma_error_retval = UDMA_NOT_INITIALIZED;
+    }
+    else if(UDMA_CHANNELS_TOTAL <= u8_channel)
+    {
+        en_udma_error_retval = UDMA_INVALID_CHANNEL;
+    }
+    else if(
+            (NULL_PTR == ptr_st_transfer)                               ||
+            (UDMA_SELECT_TOTAL <= en_select)                            ||
+            (ZERO == ptr_st_transfer->u16_items)                        ||
+            (UDMA_MAX_TRANSFER_ITEMS < ptr_st_transfer->u16_items)      ||
+            (UDMA_SIZE_TOTAL <= ptr_st_transfer->en_size)               ||
+            (UDMA_INC_TOTAL <= ptr_st_transfer->en_src_inc)             ||
+            (UDMA_INC_TOTAL <= ptr_st_transfer->en_dst_inc)             ||
+            (UDMA_ARB_TOTAL <= ptr_st_transfer->en_arb)                 ||
+            (UDMA_MODE_TOTAL <= ptr_st_transfer->en_mode)
+            )
+    {
+        en_udma_error_retval = UDMA_INVALID_ARGS;
+    }
+    else
+    {
+        st_udma_ctl_entry_t * ptr_st_entry = &gl_arr_st_udma_ctl_table[(en_select * UDMA_CHANNELS_TOTAL) + u8_channel];
+        uint32_t_ u32_last_item = ptr_st_transfer->u16_items - 1;
+
+        // end pointers point at the last item, unless the address doesn't increment
+        ptr_st_entry->u32_src_end = (uint32_t_) ptr_st_transfer->ptr_src;
+        if(UDMA_INC_NONE != ptr_st_transfer->en_src_inc)
+        {
+            ptr_st_entry->u32_src_end += (u32_last_item << ptr_st_transfer->en_src_inc);
+        }
+
+        ptr_st_entry->u32_dst_end = (uint32_t_) ptr_st_transfer->ptr_dst;
+        if(UDMA_INC_NONE != ptr_st_transfer->en_dst_inc)
+        {
+            ptr_st_entry->u32_dst_end += (u32_last_item << ptr_st_transfer->en_dst_inc);
+        }
+
+        ptr_st_entry->u32_control =
+                ((uint32_t_) ptr_st_transfer->en_dst_inc    << DMACHCTL_DSTINC_POS)     |
+                ((uint32_t_) ptr_st_transfer->en_size       << DMACHCTL_DSTSIZE_POS)    |
+                ((uint32_t_) ptr_st_transfer->en_src_inc    << DMACHCTL_SRCINC_POS)     |
+                ((uint32_t_) ptr_st_transfer->en_size       << DMACHCTL_SRCSIZE_POS)    |
+                ((uint32_t_) ptr_st_transfer->en_arb        << DMACHCTL_ARBSIZE_POS)    |
+                (u32_last_item                              << DMACHCTL_XFERSIZE_POS)   |
+                ((uint32_t_) ptr_st_transfer->en_mode);
+    }
+
+    return en_udma_error_retval;
+}
+
+/**
+ * @brief                       :   Enables a channel so it starts servicing its peripheral requests
+ *
+ * @param[in]   u8_channel      :   uDMA channel number (0 -> 31)
+ * @param[in]   en_select       :   Control structure to start with
+ *
+ * @return  UDMA_OK                 :   In case of Successful Operation
+ *          UDMA_INVALID_CHANNEL    :   In case of invalid channel number
+ */
+en_udma_error_t udma_channel_enable(uint8_t_ u8_channel, en_udma_select_t en_select)
+{
+    en_udma_error_t en_udma_error_retval = UDMA_OK;
+
+    if(UDMA_CHANNELS_TOTAL <= u8_channel)
+    {
+        en_udma_error_retval = UDMA_INVALID_CHANNEL;
+    }
+    else
+    {
+        // single + burst requests, peripheral requests unmasked
+        DMAUSEBURSTCLR  = (1UL << u8_channel);
+        DMAREQMASKCLR   = (1UL << u8_channel);
+
+        if(UDMA_ALTERNATE == en_select)
+        {
+            DMAALTSET = (1UL << u8_channel);
+        }
+        else
+        {
+            DMAALTCLR = (1UL << u8_channel);
+        }
+
+        DMAENASET = (1UL << u8_channel);
+    }
+
+    return en_udma_error_retval;
+}
+
+/**
+ * @brief                       :   Disables a channel
+ *
+ * @param[in]   u8_channel      :   uDMA channel number (0 -> 31)
+ *
+ * @return  UDMA_OK                 :   In case of Successful Operation
+ *          UDMA_INVALID_CHANNEL    :   In case of invalid channel number
+ */
+en_udma_error_t udma_channel_disable(uint8_t_ u8_channel)
+{
+    en_udma_error_t en_udma_error_retval = UDMA_OK;
+
+    if(UDMA_CHANNELS_TOTAL <= u8_channel)
+    {
+        en_udma_error_retval = UDMA_INVALID_CHANNEL;
+    }
+    else
+    {
+        DMAENACLR = (1UL << u8_channel);
+    }
+
+    return en_udma_error_retval;
+}
+
+/**
+ * @brief                       :   Checks whether a channel is still enabled (transfer in progress)
+ *
+ * @param[in]   u8_channel      :   uDMA channel number (0 -> 31)
+ *
+ * @return  TRUE                :   Channel enabled
+ *          FALSE               :   Channel disabled (done) or invalid channel
+ */
+boolean udma_channel_is_enabled(uint8_t_ u8_channel)
+{
+    boolean bool_retval = FALSE;
+
+    if(UDMA_CHANNELS_TOTAL > u8_channel)
+    {
+        // DMAENASET reads back the enable state of every channel
+        bool_retval = (boolean) GET_BIT(DMAENASET, u8_channel);
+    }
+
+    return bool_retval;
+}
+
+/**
+ * @brief                       :   Reads the current mode of a control structure,
+ *                                  UDMA_MODE_STOP means the structure completed its transfer
+ *
+ * @param[in]   u8_channel      :   uDMA channel number (0 -> 31)
+ * @param[in]   en_select       :   Primary or alternate control structure
+ *
+ * @return  en_udma_mode_t      :   Current mode (UDMA_MODE_STOP on invalid args)
+ */
+en_udma_mode_t udma_transfer_get_mode(uint8_t_ u8_channel, en_udma_select_t en_select)
+{
+    en_udma_mode_t en_udma_mode_retval = UDMA_MODE_STOP;
+
+    if((UDMA_CHANNELS_TOTAL > u8_channel) && (UDMA_SELECT_TOTAL > en_select))
+    {
+        en_udma_mode_retval = (en_udma_mode_t)
+                (gl_arr_st_udma_ctl_table[(en_select * UDMA_CHANNELS_TOTAL) + u8_channel].u32_control
+                 & DMACHCTL_XFERMODE_MASK);
+    }
+
+    return en_udma_mode_retval;
+}
+
+/**
+ * @brief                       :   Reads the items a control structure still has to transfer
+ *
+ * @param[in]   u8_channel      :   uDMA channel number (0 -> 31)
+ * @param[in]   en_select       :   Primary or alternate control structure
+ *
+ * @return  items left, 0 once the structure completed (or on invalid args)
+ */
+uint16_t_ udma_transfer_get_remaining(uint8_t_ u8_channel, en_udma_select_t en_select)
+{
+    uint16_t_ u16_remaining = 0;
+
+    if(UDMA_MODE_STOP != udma_transfer_get_mode(u8_channel, en_select))
+    {
+        // the controller writes XFERSIZE back after every arbitration
+        u16_remaining = (uint16_t_)(((gl_arr_st_udma_ctl_table[(en_select * UDMA_CHANNELS_TOTAL) + u8_channel].u32_control
+                                      >> DMACHCTL_XFERSIZE_POS) & DMACHCTL_XFERSIZE_MASK) + 1);
+    }
+
+    return u16_remaining;
+}
+
+/**
+ * @brief                       :   Checks and clears the channel completion interrupt flag
+ *
+ * @param[in]   u8_channel      :   uDMA channel number (0 -> 31)
+ *
+ * @return  TRUE                :   Channel completion flag was set (now cleared)
+ *          FALSE               :   Flag not set or invalid channel
+ */
+boolean udma_channel_int_clear(uint8_t_ u8_channel)
+{
+    boolean bool_retval = FALSE;
+
+    if((UDMA_CHANNELS_TOTAL > u8_channel) && (GET_BIT(DMACHIS, u8_channel)))
+    {
+        // write 1 to clear
+        DMACHIS = (1UL << u8_channel);
+        bool_retval = TRUE;
+    }
+
+    return bool_retval;
+}
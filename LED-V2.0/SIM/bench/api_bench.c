@@ -0,0 +1,662 @@
+/**
+ * @file    :   api_bench.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Host program: register access cost of the MCAL and HAL entry points
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * usage : api_bench [out.json]
+ *
+ * Runs every case of gl_arr_st_api_bench_cases on SIM/sim: the model is reset, the case's
+ * setup runs once, then its body API_BENCH_ITERATIONS times. A case reports the register
+ * accesses (bus accesses on target) and the virtual time of one body. Both are exact and
+ * the same on every host, so a change of either is a change of the driver.
+ * Writes JSON (stdout without a file) and a table on stderr; compare two reports with
+ * tools/bench_compare.py, the reference report is SIM/bench/api_bench_baseline.json.
+ *
+ * Built with REGCOUNT_INSTRUMENTATION = 1 (target api_regcount) it also dumps each case's
+ * accesses by call site and register on stderr: reads, writes, read modify writes, repeats.
+ *
+ * A body gets its iteration number, cases alternate arguments with it (e.g. high/low) so
+ * the drivers' caches see the pattern of a real caller.
+ */
+
+#include "hw_reg.h"
+#include "sim_interface.h"
+
+#include "gpio_interface.h"
+#include "led_interface.h"
+#include "btn_interface.h"
+#include "systick_interface.h"
+#include "timer_interface.h"
+#include "tlc59xx_interface.h"
+#include "led_frame_interface.h"
+
+#if REGCOUNT_INSTRUMENTATION
+#include "regcount_interface.h"
+#endif
+
+#include <stdio.h>
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define API_BENCH_ITERATIONS        64
+#define API_BENCH_TIMER_PERIOD_US   1000        /* timers are benchmarked stopped, never time out */
+#define API_BENCH_WAIT_NS           1000ULL     /* polling step of cases waiting for the hardware */
+#define API_BENCH_BTNS_MAX          45          /* one button per pin of ports A -> E and PF0 -> PF4 */
+#define API_BENCH_FRAME_LEDS_MAX    45          /* LED_FRAME_LEDS_MAX less PF5 -> PF7, which don't exist */
+#define API_BENCH_FRAME_HZ          1000
+
+/*---------------------------------------------------------/
+/- STRUCTS
+/---------------------------------------------------------*/
+typedef struct
+{
+    const char *            ptr_str_name    ; /* <function>/<argument pattern> */
+    void                    (*ptr_setup)(void); /* NULL_PTR: none */
+    void                    (*ptr_body)(uint32_t_ u32_iteration);
+}st_api_bench_case_t;
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+static st_btn_config_t_ gl_st_api_bench_btn = {
+    .en_btn_port        = BTN_PORT_F,
+    .en_btn_pin         = BTN_PIN_4,
+    .en_btn_pull_type   = BTN_INTERNAL_PULL_UP
+};
+
+/* button i on port i / 8, pin i % 8, for the sweeps over the button count */
+static st_btn_config_t_ gl_arr_st_api_bench_btns[API_BENCH_BTNS_MAX];
+static uint8_t_ gl_u8_api_bench_btns = 0;
+
+/* per-button debounce the port-wide vertical counter replaced: one pin read and one
+   integrator per button, saturating at BTN_DEBOUNCE_SAMPLES */
+static uint8_t_ gl_arr_u8_api_bench_integrators[API_BENCH_BTNS_MAX];
+
+/* logical LED i on port i / 8, pin i % 8, for the sweep over the frame size */
+static st_led_frame_map_t_ gl_arr_st_api_bench_frame_map[API_BENCH_FRAME_LEDS_MAX];
+static uint8_t_ gl_u8_api_bench_frame_leds = 0;
+
+/*---------------------------------------------------------/
+/- SETUPS
+/---------------------------------------------------------*/
+static void api_bench_tick(void)
+{
+    /* Do Nothing */
+}
+
+static void api_bench_setup_output(void)
+{
+    st_gpio_cfg_t st_gpio_cfg = {.port = GPIO_PORT_F, .pin = GPIO_PIN_1, .pin_cfg = OUTPUT};
+
+    gpio_pin_init(&st_gpio_cfg);
+}
+
+static void api_bench_setup_input(void)
+{
+    st_gpio_cfg_t st_gpio_cfg = {.port = GPIO_PORT_F, .pin = GPIO_PIN_4, .pin_cfg = INPUT_PULL_UP};
+
+    gpio_pin_init(&st_gpio_cfg);
+}
+
+static void api_bench_setup_led(void)
+{
+    led_init(LED_PORT_F, LED_PIN_1);
+    led_init(LED_PORT_F, LED_PIN_2);
+    led_init(LED_PORT_F, LED_PIN_3);
+}
+
+static void api_bench_setup_btn(void)
+{
+    btn_init(&gl_st_api_bench_btn);
+}
+
+/**
+ * @brief                       :   Registers the first u8_count buttons of the sweep, all held down, and
+ *                                  ticks them past their debounce so every used port keeps sampling
+ */
+static void api_bench_setup_btns(uint8_t_ u8_count)
+{
+    st_gpio_cfg_t st_gpio_cfg = {.port = GPIO_PORT_F, .pin = GPIO_PIN_4, .pin_cfg = INPUT_PULL_UP};
+    uint8_t_ u8_btn;
+
+    // registration outlives sim_init, the pins of the previous cases are released first,
+    // their port clocks back on (the model reset gated them)
+    gpio_pin_init(&st_gpio_cfg);
+    btn_deinit(&gl_st_api_bench_btn);
+    for(u8_btn = 0; u8_btn < gl_u8_api_bench_btns; u8_btn++)
+    {
+        st_gpio_cfg.port = (en_gpio_port_t) gl_arr_st_api_bench_btns[u8_btn].en_btn_port;
+        st_gpio_cfg.pin = (en_gpio_pin_t) gl_arr_st_api_bench_btns[u8_btn].en_btn_pin;
+        gpio_pin_init(&st_gpio_cfg);
+        btn_deinit(&gl_arr_st_api_bench_btns[u8_btn]);
+        gl_arr_u8_api_bench_integrators[u8_btn] = 0;
+    }
+
+    for(u8_btn = 0; u8_btn < u8_count; u8_btn++)
+    {
+        gl_arr_st_api_bench_btns[u8_btn].en_btn_port = (en_btn_port_t_)(u8_btn / BTN_PIN_TOTAL);
+        gl_arr_st_api_bench_btns[u8_btn].en_btn_pin = (en_btn_pin_t_)(u8_btn % BTN_PIN_TOTAL);
+        gl_arr_st_api_bench_btns[u8_btn].en_btn_pull_type = BTN_INTERNAL_PULL_UP;
+        btn_init(&gl_arr_st_api_bench_btns[u8_btn]);
+        sim_pin_drive(u8_btn / BTN_PIN_TOTAL, u8_btn % BTN_PIN_TOTAL, SIM_PIN_LOW);
+    }
+
+    for(u8_btn = 0; u8_btn <= BTN_DEBOUNCE_SAMPLES; u8_btn++)
+    {
+        btn_tick();
+    }
+
+    gl_u8_api_bench_btns = u8_count;
+}
+
+static void api_bench_setup_btns_1(void)  { api_bench_setup_btns(1);  }
+static void api_bench_setup_btns_8(void)  { api_bench_setup_btns(8);  }
+static void api_bench_setup_btns_16(void) { api_bench_setup_btns(16); }
+static void api_bench_setup_btns_24(void) { api_bench_setup_btns(24); }
+static void api_bench_setup_btns_32(void) { api_bench_setup_btns(32); }
+static void api_bench_setup_btns_40(void) { api_bench_setup_btns(40); }
+static void api_bench_setup_btns_45(void) { api_bench_setup_btns(45); }
+
+static void api_bench_setup_frame(uint8_t_ u8_count)
+{
+    st_led_frame_cfg_t_ st_led_frame_cfg = {
+        .ptr_st_map = gl_arr_st_api_bench_frame_map,
+        .u8_leds_count = u8_count,
+        .en_timer = TIMER_3,
+        .u16_refresh_hz = API_BENCH_FRAME_HZ
+    };
+    uint8_t_ u8_led;
+
+    for(u8_led = 0; u8_led < u8_count; u8_led++)
+    {
+        gl_arr_st_api_bench_frame_map[u8_led].en_led_port = (en_led_port_t_)(u8_led / LED_PIN_TOTAL);
+        gl_arr_st_api_bench_frame_map[u8_led].en_led_pin = (en_led_pin_t_)(u8_led % LED_PIN_TOTAL);
+    }
+
+    led_frame_init(&st_led_frame_cfg);
+    gl_u8_api_bench_frame_leds = u8_count;
+}
+
+static void api_bench_setup_frame_1(void)  { api_bench_setup_frame(1);  }
+static void api_bench_setup_frame_8(void)  { api_bench_setup_frame(8);  }
+static void api_bench_setup_frame_16(void) { api_bench_setup_frame(16); }
+static void api_bench_setup_frame_24(void) { api_bench_setup_frame(24); }
+static void api_bench_setup_frame_32(void) { api_bench_setup_frame(32); }
+static void api_bench_setup_frame_40(void) { api_bench_setup_frame(40); }
+static void api_bench_setup_frame_45(void) { api_bench_setup_frame(45); }
+
+static void api_bench_setup_systick(void)
+{
+    st_systick_cfg_t st_systick_cfg = {.bool_systick_int_enabled = FALSE, .en_systick_clk_src = CLK_SRC_SYS_CLK};
+
+    systick_init(&st_systick_cfg);
+}
+
+static void api_bench_setup_timer(void)
+{
+    st_timer_cfg_t st_timer_cfg = {.en_timer = TIMER_1, .u32_period_us = API_BENCH_TIMER_PERIOD_US, .ptr_cbf = api_bench_tick};
+
+    timer_init_periodic(&st_timer_cfg);
+}
+
+static void api_bench_setup_tlc59xx(void)
+{
+    tlc59xx_init();
+}
+
+/*---------------------------------------------------------/
+/- BODIES
+/---------------------------------------------------------*/
+/* GPIO */
+static void api_bench_gpio_pin_init_output(uint32_t_ u32_iteration)
+{
+    st_gpio_cfg_t st_gpio_cfg = {.port = GPIO_PORT_F, .pin = GPIO_PIN_1, .pin_cfg = OUTPUT};
+
+    (void) u32_iteration;
+
+    gpio_pin_init(&st_gpio_cfg);
+}
+
+static void api_bench_gpio_pin_init_pull_up(uint32_t_ u32_iteration)
+{
+    st_gpio_cfg_t st_gpio_cfg = {.port = GPIO_PORT_F, .pin = GPIO_PIN_4, .pin_cfg = INPUT_PULL_UP};
+
+    (void) u32_iteration;
+
+    gpio_pin_init(&st_gpio_cfg);
+}
+
+static void api_bench_gpio_pin_init_alt_func(uint32_t_ u32_iteration)
+{
+    st_gpio_cfg_t st_gpio_cfg = {.port = GPIO_PORT_A, .pin = GPIO_PIN_0, .pin_cfg = ALT_FUNCTION, .alt_func = 1};
+
+    (void) u32_iteration;
+
+    gpio_pin_init(&st_gpio_cfg);
+}
+
+static void api_bench_gpio_pin_init_invalid(uint32_t_ u32_iteration)
+{
+    st_gpio_cfg_t st_gpio_cfg = {.port = GPIO_PORT_F, .pin = GPIO_PIN_TOTAL, .pin_cfg = OUTPUT};
+
+    (void) u32_iteration;
+
+    gpio_pin_init(&st_gpio_cfg);
+}
+
+static void api_bench_gpio_set_pin_same(uint32_t_ u32_iteration)
+{
+    (void) u32_iteration;
+
+    gpio_setPinVal(GPIO_PORT_F, GPIO_PIN_1, HIGH);
+}
+
+static void api_bench_gpio_set_pin_toggle(uint32_t_ u32_iteration)
+{
+    gpio_setPinVal(GPIO_PORT_F, GPIO_PIN_1, (en_gpio_pin_level_t)(u32_iteration & 1));
+}
+
+static void api_bench_gpio_set_pin_invalid(uint32_t_ u32_iteration)
+{
+    (void) u32_iteration;
+
+    gpio_setPinVal(GPIO_PORT_TOTAL, GPIO_PIN_1, HIGH);
+}
+
+static void api_bench_gpio_tog_pin(uint32_t_ u32_iteration)
+{
+    (void) u32_iteration;
+
+    gpio_togPinVal(GPIO_PORT_F, GPIO_PIN_1);
+}
+
+static void api_bench_gpio_get_pin(uint32_t_ u32_iteration)
+{
+    en_gpio_pin_level_t en_level;
+
+    (void) u32_iteration;
+
+    gpio_getPinVal(GPIO_PORT_F, GPIO_PIN_4, &en_level);
+}
+
+static void api_bench_gpio_set_port(uint32_t_ u32_iteration)
+{
+    gpio_setPortVal(GPIO_PORT_F, (uint8_t_)(u32_iteration << 1));
+}
+
+static void api_bench_gpio_set_port_masked(uint32_t_ u32_iteration)
+{
+    gpio_setPortMaskedVal(GPIO_PORT_F, (1 << GPIO_PIN_1), (uint8_t_)((u32_iteration & 1) << GPIO_PIN_1));
+}
+
+static void api_bench_gpio_get_port(uint32_t_ u32_iteration)
+{
+    uint8_t_ u8_value;
+
+    (void) u32_iteration;
+
+    gpio_getPortVal(GPIO_PORT_F, &u8_value);
+}
+
+static void api_bench_gpio_set_int_sense(uint32_t_ u32_iteration)
+{
+    gpio_setIntSense(GPIO_PORT_F, GPIO_PIN_4, (ZERO == (u32_iteration & 1)) ? FALLING_EDGE : BOTH_EDGES);
+}
+
+/* LED */
+static void api_bench_led_init(uint32_t_ u32_iteration)
+{
+    (void) u32_iteration;
+
+    led_init(LED_PORT_F, LED_PIN_1);
+}
+
+static void api_bench_led_on_same(uint32_t_ u32_iteration)
+{
+    (void) u32_iteration;
+
+    led_on(LED_PORT_F, LED_PIN_1);
+}
+
+static void api_bench_led_on_off(uint32_t_ u32_iteration)
+{
+    if(ZERO == (u32_iteration & 1))
+    {
+        led_on(LED_PORT_F, LED_PIN_1);
+    }
+    else
+    {
+        led_off(LED_PORT_F, LED_PIN_1);
+    }
+}
+
+static void api_bench_led_toggle(uint32_t_ u32_iteration)
+{
+    (void) u32_iteration;
+
+    led_toggle(LED_PORT_F, LED_PIN_1);
+}
+
+static void api_bench_led_write_port(uint32_t_ u32_iteration)
+{
+    led_write_port(LED_PORT_F, 0x0E, (uint8_t_)((u32_iteration & 0x07) << 1));
+}
+
+static void api_bench_led_stage_commit(uint32_t_ u32_iteration)
+{
+    led_stage(LED_PORT_F, LED_PIN_1, (en_led_state_t_)(u32_iteration & 1));
+    led_stage(LED_PORT_F, LED_PIN_2, (en_led_state_t_)((u32_iteration >> 1) & 1));
+    led_stage(LED_PORT_F, LED_PIN_3, (en_led_state_t_)((u32_iteration >> 2) & 1));
+    led_commit(LED_PORT_F);
+}
+
+/* Button */
+static void api_bench_btn_init(uint32_t_ u32_iteration)
+{
+    (void) u32_iteration;
+
+    btn_init(&gl_st_api_bench_btn);
+}
+
+static void api_bench_btn_read(uint32_t_ u32_iteration)
+{
+    en_btn_state_t_ en_state;
+
+    (void) u32_iteration;
+
+    btn_read(&gl_st_api_bench_btn, &en_state);
+}
+
+static void api_bench_btn_read_port(uint32_t_ u32_iteration)
+{
+    uint8_t_ u8_pressed;
+    uint8_t_ u8_changed;
+
+    (void) u32_iteration;
+
+    btn_read_port(BTN_PORT_F, &u8_pressed, &u8_changed);
+}
+
+static void api_bench_btn_tick(uint32_t_ u32_iteration)
+{
+    (void) u32_iteration;
+
+    btn_tick();
+}
+
+static void api_bench_btn_read_all(uint32_t_ u32_iteration)
+{
+    uint64_t_ u64_pressed;
+
+    (void) u32_iteration;
+
+    btn_read_all(&u64_pressed);
+}
+
+static void api_bench_btn_read_pins(uint32_t_ u32_iteration)
+{
+    en_gpio_pin_level_t en_level;
+    uint8_t_ u8_btn;
+
+    (void) u32_iteration;
+
+    // the snapshot btn_read_all replaces: every button pin read on its own
+    for(u8_btn = 0; u8_btn < gl_u8_api_bench_btns; u8_btn++)
+    {
+        gpio_getPinVal((en_gpio_port_t) gl_arr_st_api_bench_btns[u8_btn].en_btn_port,
+                       (en_gpio_pin_t) gl_arr_st_api_bench_btns[u8_btn].en_btn_pin, &en_level);
+    }
+}
+
+static void api_bench_btn_per_button_tick(uint32_t_ u32_iteration)
+{
+    en_gpio_pin_level_t en_level;
+    uint8_t_ u8_btn;
+
+    (void) u32_iteration;
+
+    // one tick of the per-button debounce, pull ups: pressed reads low
+    for(u8_btn = 0; u8_btn < gl_u8_api_bench_btns; u8_btn++)
+    {
+        gpio_getPinVal((en_gpio_port_t) gl_arr_st_api_bench_btns[u8_btn].en_btn_port,
+                       (en_gpio_pin_t) gl_arr_st_api_bench_btns[u8_btn].en_btn_pin, &en_level);
+
+        if(LOW == en_level)
+        {
+            gl_arr_u8_api_bench_integrators[u8_btn] += (BTN_DEBOUNCE_SAMPLES > gl_arr_u8_api_bench_integrators[u8_btn]) ? 1 : 0;
+        }
+        else
+        {
+            gl_arr_u8_api_bench_integrators[u8_btn] -= (ZERO < gl_arr_u8_api_bench_integrators[u8_btn]) ? 1 : 0;
+        }
+    }
+}
+
+/* SysTick */
+static void api_bench_systick_init_sys_clk(uint32_t_ u32_iteration)
+{
+    st_systick_cfg_t st_systick_cfg = {.bool_systick_int_enabled = FALSE, .en_systick_clk_src = CLK_SRC_SYS_CLK};
+
+    (void) u32_iteration;
+
+    systick_init(&st_systick_cfg);
+}
+
+static void api_bench_systick_init_piosc_int(uint32_t_ u32_iteration)
+{
+    st_systick_cfg_t st_systick_cfg = {.bool_systick_int_enabled = TRUE, .en_systick_clk_src = CLK_SRC_PIOSC};
+
+    (void) u32_iteration;
+
+    systick_init(&st_systick_cfg);
+}
+
+static void api_bench_systick_ms_delay(uint32_t_ u32_iteration)
+{
+    (void) u32_iteration;
+
+    systick_ms_delay(1);
+}
+
+/* Timer */
+static void api_bench_timer_init_periodic(uint32_t_ u32_iteration)
+{
+    (void) u32_iteration;
+
+    api_bench_setup_timer();
+}
+
+static void api_bench_timer_start_stop(uint32_t_ u32_iteration)
+{
+    (void) u32_iteration;
+
+    timer_start(TIMER_1);
+    timer_stop(TIMER_1);
+}
+
+static void api_bench_timer_set_period(uint32_t_ u32_iteration)
+{
+    timer_set_period(TIMER_1, API_BENCH_TIMER_PERIOD_US + u32_iteration);
+}
+
+/* TLC59xx */
+static void api_bench_tlc59xx_show_96(uint32_t_ u32_iteration)
+{
+    uint8_t_ u8_channel;
+
+    // one latched frame per call: packing, shift and the wait for the latch tick
+    for(u8_channel = 0; u8_channel < TLC59XX_CHANNELS; u8_channel++)
+    {
+        tlc59xx_set_brightness(u8_channel, (uint16_t_)((u32_iteration * 97UL + u8_channel) & TLC59XX_BRIGHTNESS_MAX));
+    }
+    tlc59xx_show();
+
+    while(TRUE == tlc59xx_is_busy())
+    {
+        sim_run_for(API_BENCH_WAIT_NS);
+    }
+}
+
+/* LED frame */
+static void api_bench_led_frame_commit(uint32_t_ u32_iteration)
+{
+    uint8_t_ u8_led;
+
+    // one shown frame per call, every LED changes: drawing, commit and the refresh tick's
+    // port writes, the virtual time includes the wait for the tick
+    for(u8_led = 0; u8_led < gl_u8_api_bench_frame_leds; u8_led++)
+    {
+        led_frame_set(u8_led, (en_led_state_t_)(u32_iteration & 1));
+    }
+    led_frame_commit();
+
+    while(TRUE == led_frame_is_pending())
+    {
+        sim_run_for(API_BENCH_WAIT_NS);
+    }
+}
+
+static const st_api_bench_case_t gl_arr_st_api_bench_cases[] =
+{
+    {"gpio_pin_init/output",            NULL_PTR,                   api_bench_gpio_pin_init_output      },
+    {"gpio_pin_init/input_pull_up",     NULL_PTR,                   api_bench_gpio_pin_init_pull_up     },
+    {"gpio_pin_init/alt_function",      NULL_PTR,                   api_bench_gpio_pin_init_alt_func    },
+    {"gpio_pin_init/invalid_pin",       NULL_PTR,                   api_bench_gpio_pin_init_invalid     },
+    {"gpio_setPinVal/same_level",       api_bench_setup_output,     api_bench_gpio_set_pin_same         },
+    {"gpio_setPinVal/alternating",      api_bench_setup_output,     api_bench_gpio_set_pin_toggle       },
+    {"gpio_setPinVal/invalid_port",     NULL_PTR,                   api_bench_gpio_set_pin_invalid      },
+    {"gpio_togPinVal/output",           api_bench_setup_output,     api_bench_gpio_tog_pin              },
+    {"gpio_getPinVal/input",            api_bench_setup_input,      api_bench_gpio_get_pin              },
+    {"gpio_setPortVal/counting",        api_bench_setup_led,        api_bench_gpio_set_port             },
+    {"gpio_setPortMaskedVal/one_pin",   api_bench_setup_output,     api_bench_gpio_set_port_masked      },
+    {"gpio_getPortVal/port",            api_bench_setup_input,      api_bench_gpio_get_port             },
+    {"gpio_setIntSense/alternating",    api_bench_setup_input,      api_bench_gpio_set_int_sense        },
+    {"led_init/one_pin",                NULL_PTR,                   api_bench_led_init                  },
+    {"led_on/same_state",               api_bench_setup_led,        api_bench_led_on_same               },
+    {"led_on/alternating_off",          api_bench_setup_led,        api_bench_led_on_off                },
+    {"led_toggle/one_pin",              api_bench_setup_led,        api_bench_led_toggle                },
+    {"led_write_port/three_pins",       api_bench_setup_led,        api_bench_led_write_port            },
+    {"led_stage/three_pins_commit",     api_bench_setup_led,        api_bench_led_stage_commit          },
+    {"btn_init/pull_up",                NULL_PTR,                   api_bench_btn_init                  },
+    {"btn_read/released",               api_bench_setup_btn,        api_bench_btn_read                  },
+    {"btn_read_port/released",          api_bench_setup_btn,        api_bench_btn_read_port             },
+    {"btn_tick/one_port",               api_bench_setup_btn,        api_bench_btn_tick                  },
+    {"systick_init/sys_clk",            NULL_PTR,                   api_bench_systick_init_sys_clk      },
+    {"systick_init/piosc_int",          NULL_PTR,                   api_bench_systick_init_piosc_int    },
+    {"systick_ms_delay/1ms",            api_bench_setup_systick,    api_bench_systick_ms_delay          },
+    {"timer_init_periodic/1ms",         NULL_PTR,                   api_bench_timer_init_periodic       },
+    {"timer_start/then_stop",           api_bench_setup_timer,      api_bench_timer_start_stop          },
+    {"timer_set_period/changing",       api_bench_setup_timer,      api_bench_timer_set_period          },
+    {"tlc59xx_show/96_channels_latched",api_bench_setup_tlc59xx,    api_bench_tlc59xx_show_96           },
+    /* debounce of 1 -> 45 held buttons: port-wide vertical counter vs one integrator per button */
+    {"btn_tick/1_buttons_held",         api_bench_setup_btns_1,     api_bench_btn_tick                  },
+    {"btn_tick/8_buttons_held",         api_bench_setup_btns_8,     api_bench_btn_tick                  },
+    {"btn_tick/16_buttons_held",        api_bench_setup_btns_16,    api_bench_btn_tick                  },
+    {"btn_tick/24_buttons_held",        api_bench_setup_btns_24,    api_bench_btn_tick                  },
+    {"btn_tick/32_buttons_held",        api_bench_setup_btns_32,    api_bench_btn_tick                  },
+    {"btn_tick/40_buttons_held",        api_bench_setup_btns_40,    api_bench_btn_tick                  },
+    {"btn_tick/45_buttons_held",        api_bench_setup_btns_45,    api_bench_btn_tick                  },
+    {"per_button_tick/1_buttons_held",  api_bench_setup_btns_1,     api_bench_btn_per_button_tick       },
+    {"per_button_tick/8_buttons_held",  api_bench_setup_btns_8,     api_bench_btn_per_button_tick       },
+    {"per_button_tick/16_buttons_held", api_bench_setup_btns_16,    api_bench_btn_per_button_tick       },
+    {"per_button_tick/24_buttons_held", api_bench_setup_btns_24,    api_bench_btn_per_button_tick       },
+    {"per_button_tick/32_buttons_held", api_bench_setup_btns_32,    api_bench_btn_per_button_tick       },
+    {"per_button_tick/40_buttons_held", api_bench_setup_btns_40,    api_bench_btn_per_button_tick       },
+    {"per_button_tick/45_buttons_held", api_bench_setup_btns_45,    api_bench_btn_per_button_tick       },
+    /* snapshot of every button: one read per used port vs one per pin */
+    {"btn_read_all/1_buttons_held",     api_bench_setup_btns_1,     api_bench_btn_read_all              },
+    {"btn_read_all/8_buttons_held",     api_bench_setup_btns_8,     api_bench_btn_read_all              },
+    {"btn_read_all/32_buttons_held",    api_bench_setup_btns_32,    api_bench_btn_read_all              },
+    {"btn_read_all/45_buttons_held",    api_bench_setup_btns_45,    api_bench_btn_read_all              },
+    {"gpio_getPinVal/32_buttons_held",  api_bench_setup_btns_32,    api_bench_btn_read_pins             },
+    /* frame commit to shown, 1 -> 45 logical LEDs */
+    {"led_frame_commit/1_leds",         api_bench_setup_frame_1,    api_bench_led_frame_commit          },
+    {"led_frame_commit/8_leds",         api_bench_setup_frame_8,    api_bench_led_frame_commit          },
+    {"led_frame_commit/16_leds",        api_bench_setup_frame_16,   api_bench_led_frame_commit          },
+    {"led_frame_commit/24_leds",        api_bench_setup_frame_24,   api_bench_led_frame_commit          },
+    {"led_frame_commit/32_leds",        api_bench_setup_frame_32,   api_bench_led_frame_commit          },
+    {"led_frame_commit/40_leds",        api_bench_setup_frame_40,   api_bench_led_frame_commit          },
+    {"led_frame_commit/45_leds",        api_bench_setup_frame_45,   api_bench_led_frame_commit          },
+};
+
+#define API_BENCH_CASES             (sizeof(gl_arr_st_api_bench_cases) / sizeof(gl_arr_st_api_bench_cases[0]))
+
+/*---------------------------------------------------------/
+/- MAIN
+/---------------------------------------------------------*/
+int main(int argc, char * argv[])
+{
+    const st_api_bench_case_t * ptr_st_case;
+    FILE * ptr_file = stdout;
+    uint64_t_ u64_accesses;
+    uint64_t_ u64_ns;
+    uint32_t_ u32_case;
+    uint32_t_ u32_iteration;
+    int exit_code = 0;
+
+    if(2 < argc)
+    {
+        fprintf(stderr, "usage: %s [out.json]\n", argv[0]);
+        exit_code = 1;
+    }
+    else if((2 == argc) && (NULL_PTR == (ptr_file = fopen(argv[1], "w"))))
+    {
+        fprintf(stderr, "can't create %s\n", argv[1]);
+        exit_code = 1;
+    }
+    else
+    {
+        fprintf(ptr_file, "{\n  \"machine\": \"sim\",\n  \"iterations\": %d,\n  \"results\": [", API_BENCH_ITERATIONS);
+        fprintf(stderr, "# %-34s %14s %14s\n", "case", "accesses/call", "sim_ns/call");
+
+        for(u32_case = 0; u32_case < API_BENCH_CASES; u32_case++)
+        {
+            ptr_st_case = &gl_arr_st_api_bench_cases[u32_case];
+
+            sim_init();
+
+            if(NULL_PTR != ptr_st_case->ptr_setup)
+            {
+                ptr_st_case->ptr_setup();
+            }
+
+            u64_accesses = sim_access_count();
+            u64_ns = sim_now_ns();
+#if REGCOUNT_INSTRUMENTATION
+            regcount_start();
+#endif
+
+            for(u32_iteration = 0; u32_iteration < API_BENCH_ITERATIONS; u32_iteration++)
+            {
+                ptr_st_case->ptr_body(u32_iteration);
+            }
+
+#if REGCOUNT_INSTRUMENTATION
+            regcount_stop();
+            regcount_dump(ptr_st_case->ptr_str_name);
+#endif
+            u64_accesses = sim_access_count() - u64_accesses;
+            u64_ns = sim_now_ns() - u64_ns;
+
+            fprintf(ptr_file, "%s\n    {\"name\": \"%s\", \"accesses_per_call\": %.2f, \"sim_ns_per_call\": %.2f}",
+                    (ZERO == u32_case) ? "" : ",", ptr_st_case->ptr_str_name,
+                    (double) u64_accesses / API_BENCH_ITERATIONS, (double) u64_ns / API_BENCH_ITERATIONS);
+            fprintf(stderr, "  %-34s %14.2f %14.2f\n", ptr_st_case->ptr_str_name,
+                    (double) u64_accesses / API_BENCH_ITERATIONS, (double) u64_ns / API_BENCH_ITERATIONS);
+        }
+
+        fprintf(ptr_file, "\n  ]\n}\n");
+
+        if(stdout != ptr_file)
+        {
+            fclose(ptr_file);
+        }
+    }
+
+    return exit_code;
+}
@@ -0,0 +1,67 @@
+/**
+ * @file    :   TM4C123.h
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Host simulation stand-in of the TM4C123 CMSIS device header
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Found before the Keil device header in the HW_SIM = 1 build. Provides what the drivers use
+ * from CMSIS: the IRQ numbers, NVIC enable/disable, PRIMASK, the barrier/sleep intrinsics and
+ * SystemCoreClock, mapped onto SIM/sim.
+ */
+
+#ifndef TM4C123_H
+#define TM4C123_H
+
+#include <stdint.h>
+
+#include "sim_interface.h"
+
+typedef enum
+{
+    SysTick_IRQn            =  -1,
+    GPIOA_IRQn              =   0,
+    GPIOB_IRQn              =   1,
+    GPIOC_IRQn              =   2,
+    GPIOD_IRQn              =   3,
+    GPIOE_IRQn              =   4,
+    UART0_IRQn              =   5,
+    UART1_IRQn              =   6,
+    SSI0_IRQn               =   7,
+    TIMER0A_IRQn            =  19,
+    TIMER0B_IRQn            =  20,
+    TIMER1A_IRQn            =  21,
+    TIMER1B_IRQn            =  22,
+    TIMER2A_IRQn            =  23,
+    TIMER2B_IRQn            =  24,
+    GPIOF_IRQn              =  30,
+    SSI1_IRQn               =  34,
+    TIMER3A_IRQn            =  35,
+    UDMA_IRQn               =  46,
+    UDMAERR_IRQn            =  47,
+    SSI2_IRQn               =  57,
+    SSI3_IRQn               =  58,
+    TIMER4A_IRQn            =  70,
+    TIMER5A_IRQn            =  92,
+}IRQn_Type;
+
+extern uint32_t SystemCoreClock;
+
+static inline void NVIC_EnableIRQ(IRQn_Type IRQn)       { sim_nvic_enable((sint32_t_) IRQn, TRUE); }
+static inline void NVIC_DisableIRQ(IRQn_Type IRQn)      { sim_nvic_enable((sint32_t_) IRQn, FALSE); }
+
+static inline void __enable_irq(void)                   { sim_irq_mask(FALSE); }
+static inline void __disable_irq(void)                  { sim_irq_mask(TRUE); }
+static inline uint32_t __get_PRIMASK(void)              { return (uint32_t) sim_irq_is_masked(); }
+
+static inline void __DSB(void)                          { }
+static inline void __ISB(void)                          { }
+static inline void __WFI(void)                          { sim_wfi(); }
+
+/* single core, no interrupt between the two halves: the store always succeeds */
+static inline uint32_t __LDREXW(volatile uint32_t_ * addr)              { return (uint32_t) *addr; }
+static inline uint32_t __STREXW(uint32_t value, volatile uint32_t_ * addr) { *addr = value; return 0; }
+
+#endif /* TM4C123_H */
@@ -0,0 +1,76 @@
+/**
+ * @file    :   startup_sim.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Host simulation stand-in of the startup file: vector table and system clock
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Like startup_TM4C123.s every handler defaults to Default_Handler, a driver defining the
+ * handler replaces it at link time.
+ */
+
+#include "TM4C123.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define SIM_WEAK_HANDLER            __attribute__((weak, alias("Default_Handler")))
+#define SIM_VECTOR(IRQN)            [SIM_IRQ_BASE + (IRQN)]
+
+/* reset clock: PIOSC */
+uint32_t SystemCoreClock = 16000000UL;
+
+/**
+ * @brief                       :   Interrupt without handler, the target would spin here forever
+ */
+void Default_Handler(void)
+{
+    fprintf(stderr, "sim: enabled interrupt without handler\n");
+    exit(1);
+}
+
+void SysTick_Handler(void)  SIM_WEAK_HANDLER;
+void GPIOA_Handler(void)    SIM_WEAK_HANDLER;
+void GPIOB_Handler(void)    SIM_WEAK_HANDLER;
+void GPIOC_Handler(void)    SIM_WEAK_HANDLER;
+void GPIOD_Handler(void)    SIM_WEAK_HANDLER;
+void GPIOE_Handler(void)    SIM_WEAK_HANDLER;
+void UART0_Handler(void)    SIM_WEAK_HANDLER;
+void SSI0_Handler(void)     SIM_WEAK_HANDLER;
+void TIMER0A_Handler(void)  SIM_WEAK_HANDLER;
+void TIMER1A_Handler(void)  SIM_WEAK_HANDLER;
+void TIMER2A_Handler(void)  SIM_WEAK_HANDLER;
+void GPIOF_Handler(void)    SIM_WEAK_HANDLER;
+void SSI1_Handler(void)     SIM_WEAK_HANDLER;
+void TIMER3A_Handler(void)  SIM_WEAK_HANDLER;
+void UDMA_Handler(void)     SIM_WEAK_HANDLER;
+void UDMAERR_Handler(void)  SIM_WEAK_HANDLER;
+void SSI2_Handler(void)     SIM_WEAK_HANDLER;
+void SSI3_Handler(void)     SIM_WEAK_HANDLER;
+void TIMER4A_Handler(void)  SIM_WEAK_HANDLER;
+void TIMER5A_Handler(void)  SIM_WEAK_HANDLER;
+
+void (* const gl_arr_sim_vectors[SIM_VECTORS])(void) = {
+    SIM_VECTOR(SysTick_IRQn)    = SysTick_Handler,
+    SIM_VECTOR(GPIOA_IRQn)      = GPIOA_Handler,
+    SIM_VECTOR(GPIOB_IRQn)      = GPIOB_Handler,
+    SIM_VECTOR(GPIOC_IRQn)      = GPIOC_Handler,
+    SIM_VECTOR(GPIOD_IRQn)      = GPIOD_Handler,
+    SIM_VECTOR(GPIOE_IRQn)      = GPIOE_Handler,
+    SIM_VECTOR(UART0_IRQn)      = UART0_Handler,
+    SIM_VECTOR(SSI0_IRQn)       = SSI0_Handler,
+    SIM_VECTOR(TIMER0A_IRQn)    = TIMER0A_Handler,
+    SIM_VECTOR(TIMER1A_IRQn)    = TIMER1A_Handler,
+    SIM_VECTOR(TIMER2A_IRQn)    = TIMER2A_Handler,
+    SIM_VECTOR(GPIOF_IRQn)      = GPIOF_Handler,
+    SIM_VECTOR(SSI1_IRQn)       = SSI1_Handler,
+    SIM_VECTOR(TIMER3A_IRQn)    = TIMER3A_Handler,
+    SIM_VECTOR(UDMA_IRQn)       = UDMA_Handler,
+    SIM_VECTOR(UDMAERR_IRQn)    = UDMAERR_Handler,
+    SIM_VECTOR(SSI2_IRQn)       = SSI2_Handler,
+    SIM_VECTOR(SSI3_IRQn)       = SSI3_Handler,
+    SIM_VECTOR(TIMER4A_IRQn)    = TIMER4A_Handler,
+    SIM_VECTOR(TIMER5A_IRQn)    = TIMER5A_Handler,
+};
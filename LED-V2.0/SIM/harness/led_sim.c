@@ -0,0 +1,284 @@
+/**
+ * @file    :   led_sim.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Host program: the whole firmware on the register model, driven by an input script
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * usage : led_sim script [out.vcd]
+ *
+ * Runs main.c unmodified (app_init, app_start and every driver) on SIM/sim. The firmware idles
+ * in WFI, which jumps the virtual clock to the next SysTick, timer or scripted event, so seconds
+ * of button presses simulate in milliseconds. Every output pin change is printed with its virtual
+ * time, the optional VCD holds every pin.
+ *
+ * Script, one command per line, times in ms from reset, '#' starts a comment:
+ *   <ms> press   <pin> <hold_ms>           drive the pin low for hold_ms, then release it
+ *                                          (a button to ground, read through its pull up)
+ *   <ms> drive   <pin> low|high|release    drive the pin from outside
+ *   <ms> end                               stop, else LED_SIM_TAIL_MS after the last event
+ * pin: PA0 -> PF7
+ */
+
+#include "sim_interface.h"
+#include "vcd_interface.h"
+
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/* the firmware's main becomes firmware_main, called once the model is set up */
+#define main firmware_main
+#include "main.c"
+#undef main
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define LED_SIM_NS_PER_MS           1000000ULL
+#define LED_SIM_LINE_MAX            128
+#define LED_SIM_TAIL_MS             1000        /* run after the last event of a script without end */
+#define LED_SIM_WALL_S              60          /* firmware spinning without register accesses */
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+static st_sim_port_state_t_ gl_arr_st_led_sim_ports[SIM_GPIO_PORTS];   // states last printed
+static struct timespec gl_st_led_sim_wall_start;
+static boolean gl_bool_led_sim_vcd = FALSE;
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Port listener, prints the output pins that changed level
+ */
+static void led_sim_port_changed(uint8_t_ u8_port, const st_sim_port_state_t_ * ptr_st_state)
+{
+    st_sim_port_state_t_ * ptr_st_printed = &gl_arr_st_led_sim_ports[u8_port];
+    uint8_t_ u8_changed = (uint8_t_)((((ptr_st_printed->u8_levels ^ ptr_st_state->u8_levels) & ptr_st_printed->u8_dir) |
+                                      (~ptr_st_printed->u8_dir)) & ptr_st_state->u8_dir);
+    uint8_t_ u8_pin;
+
+    for(u8_pin = 0; u8_pin < SIM_GPIO_PINS; u8_pin++)
+    {
+        if(ZERO != (u8_changed & (1 << u8_pin)))
+        {
+            printf("%12.3f ms  P%c%d = %d\n", (double) sim_now_ns() / LED_SIM_NS_PER_MS,
+                   'A' + u8_port, u8_pin, (ptr_st_state->u8_levels >> u8_pin) & 1);
+        }
+    }
+
+    *ptr_st_printed = *ptr_st_state;
+}
+
+/**
+ * @brief                       :   End of the simulation, closes the dump and prints the speed up
+ */
+static void led_sim_end(void)
+{
+    struct timespec st_wall_end;
+    double f64_wall_ms;
+
+    if(TRUE == gl_bool_led_sim_vcd)
+    {
+        vcd_close();
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &st_wall_end);
+    f64_wall_ms = ((double)(st_wall_end.tv_sec - gl_st_led_sim_wall_start.tv_sec) * 1e3) +
+                  ((double)(st_wall_end.tv_nsec - gl_st_led_sim_wall_start.tv_nsec) / 1e6);
+
+    printf("# %.3f ms simulated in %.3f ms (%.0fx real time)\n",
+           (double) sim_now_ns() / LED_SIM_NS_PER_MS, f64_wall_ms,
+           ((double) sim_now_ns() / LED_SIM_NS_PER_MS) / ((f64_wall_ms > 0) ? f64_wall_ms : 1));
+    fflush(stdout);
+}
+
+/**
+ * @brief                       :   Wall clock limit, the firmware stopped advancing the virtual clock
+ */
+static void led_sim_stuck(int signal_number)
+{
+    static const char arr_c_message[] = "led_sim: no register access for too long, firmware spinning?\n";
+
+    (void) signal_number;
+    write(STDERR_FILENO, arr_c_message, sizeof(arr_c_message) - 1);
+    _exit(2);
+}
+
+/**
+ * @brief                       :   Parses a pin name, PA0 -> PF7
+ *
+ * @return  TRUE                :   Valid pin
+ *          FALSE               :   Invalid pin
+ */
+static boolean led_sim_parse_pin(const char * ptr_str_pin, uint8_t_ * ptr_u8_port, uint8_t_ * ptr_u8_pin)
+{
+    boolean bool_valid = FALSE;
+
+    if(
+            ('P' == ptr_str_pin[0])                                                     &&
+            ('A' <= ptr_str_pin[1]) && (('A' + SIM_GPIO_PORTS) > ptr_str_pin[1])        &&
+            ('0' <= ptr_str_pin[2]) && (('0' + SIM_GPIO_PINS) > ptr_str_pin[2])         &&
+            ('\0' == ptr_str_pin[3])
+            )
+    {
+        *ptr_u8_port = (uint8_t_)(ptr_str_pin[1] - 'A');
+        *ptr_u8_pin = (uint8_t_)(ptr_str_pin[2] - '0');
+        bool_valid = TRUE;
+    }
+
+    return bool_valid;
+}
+
+/**
+ * @brief                       :   Loads a script: schedules its pin drives and finds its end
+ *
+ * @param[in]   ptr_str_path    :   Script path
+ * @param[out]  ptr_u64_end_ns  :   Pointer to store the end time in
+ *
+ * @return  TRUE                :   Script loaded
+ *          FALSE               :   Unreadable file or invalid line (reported)
+ */
+static boolean led_sim_load(const char * ptr_str_path, uint64_t_ * ptr_u64_end_ns)
+{
+    FILE * ptr_file = fopen(ptr_str_path, "r");
+    char arr_c_line[LED_SIM_LINE_MAX];
+    char arr_c_command[16];
+    char arr_c_pin[8];
+    char arr_c_arg[16];
+    unsigned long long u64_ms = 0;
+    unsigned long long u64_last_ms = 0;
+    unsigned long u32_hold_ms;
+    unsigned int u32_line = 0;
+    uint8_t_ u8_port;
+    uint8_t_ u8_pin;
+    int fields;
+    boolean bool_valid = (NULL_PTR != ptr_file);
+    boolean bool_end = FALSE;
+    en_sim_error_t_ en_sim_error;
+
+    if(FALSE == bool_valid)
+    {
+        fprintf(stderr, "can't open %s\n", ptr_str_path);
+    }
+
+    while((TRUE == bool_valid) && (FALSE == bool_end) && (NULL_PTR != fgets(arr_c_line, sizeof(arr_c_line), ptr_file)))
+    {
+        u32_line++;
+        arr_c_line[strcspn(arr_c_line, "#\r\n")] = '\0';
+
+        fields = sscanf(arr_c_line, "%llu %15s %7s %15s", &u64_ms, arr_c_command, arr_c_pin, arr_c_arg);
+        en_sim_error = SIM_OK;
+
+        if(fields <= 0)
+        {
+            // blank or comment line
+            continue;
+        }
+        else if((2 == fields) && (0 == strcmp(arr_c_command, "end")))
+        {
+            bool_end = TRUE;
+        }
+        else if((4 == fields) && (TRUE == led_sim_parse_pin(arr_c_pin, &u8_port, &u8_pin)) &&
+                (0 == strcmp(arr_c_command, "press")) && (1 == sscanf(arr_c_arg, "%lu", &u32_hold_ms)))
+        {
+            en_sim_error |= sim_pin_schedule(u64_ms * LED_SIM_NS_PER_MS, u8_port, u8_pin, SIM_PIN_LOW);
+            en_sim_error |= sim_pin_schedule((u64_ms + u32_hold_ms) * LED_SIM_NS_PER_MS, u8_port, u8_pin, SIM_PIN_RELEASE);
+            u64_ms += u32_hold_ms;
+        }
+        else if((4 == fields) && (TRUE == led_sim_parse_pin(arr_c_pin, &u8_port, &u8_pin)) &&
+                (0 == strcmp(arr_c_command, "drive")))
+        {
+            en_sim_error = sim_pin_schedule(u64_ms * LED_SIM_NS_PER_MS, u8_port, u8_pin,
+                                            (0 == strcmp(arr_c_arg, "low"))     ? SIM_PIN_LOW      :
+                                            (0 == strcmp(arr_c_arg, "high"))    ? SIM_PIN_HIGH     :
+                                            (0 == strcmp(arr_c_arg, "release")) ? SIM_PIN_RELEASE  : SIM_PIN_DRIVE_TOTAL);
+        }
+        else
+        {
+            en_sim_error = SIM_ERROR;
+        }
+
+        if(SIM_OK != en_sim_error)
+        {
+            fprintf(stderr, "%s:%u: invalid command or too many events\n", ptr_str_path, u32_line);
+            bool_valid = FALSE;
+        }
+        else if(u64_ms > u64_last_ms)
+        {
+            u64_last_ms = u64_ms;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    if(NULL_PTR != ptr_file)
+    {
+        fclose(ptr_file);
+    }
+
+    *ptr_u64_end_ns = (TRUE == bool_end) ? (u64_ms * LED_SIM_NS_PER_MS) :
+                                           ((u64_last_ms + LED_SIM_TAIL_MS) * LED_SIM_NS_PER_MS);
+
+    return bool_valid;
+}
+
+/*---------------------------------------------------------/
+/- MAIN
+/---------------------------------------------------------*/
+int main(int argc, char * argv[])
+{
+    uint64_t_ u64_end_ns = 0;
+    uint8_t_ u8_port;
+    int exit_code = 0;
+
+    sim_init();
+
+    if((2 > argc) || (3 < argc))
+    {
+        fprintf(stderr, "usage: %s script [out.vcd]\n", argv[0]);
+        exit_code = 1;
+    }
+    else if(FALSE == led_sim_load(argv[1], &u64_end_ns))
+    {
+        exit_code = 1;
+    }
+    else if((3 == argc) && (VCD_OK != vcd_open(argv[2])))
+    {
+        fprintf(stderr, "can't create %s\n", argv[2]);
+        exit_code = 1;
+    }
+    else
+    {
+        gl_bool_led_sim_vcd = (3 == argc);
+
+        for(u8_port = 0; u8_port < SIM_GPIO_PORTS; u8_port++)
+        {
+            sim_port_get_state(u8_port, &gl_arr_st_led_sim_ports[u8_port]);
+        }
+        sim_add_port_listener(led_sim_port_changed);
+
+        // the firmware never returns: the end handler reports and exits
+        sim_set_end(u64_end_ns, led_sim_end);
+
+        signal(SIGALRM, led_sim_stuck);
+        alarm(LED_SIM_WALL_S);
+        clock_gettime(CLOCK_MONOTONIC, &gl_st_led_sim_wall_start);
+
+        firmware_main();
+
+        fprintf(stderr, "led_sim: firmware main returned at %llu ns\n", sim_now_ns());
+        led_sim_end();
+        exit_code = 1;
+    }
+
+    return exit_code;
+}
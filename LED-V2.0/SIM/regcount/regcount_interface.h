@@ -0,0 +1,94 @@
+/**
+ * @file    :   regcount_interface.h
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Header File contains all register access counters' typedefs and functions' prototypes
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Host counters of the drivers' register accesses by register and call site, fed by the register
+ * model (SIM/sim). Build with HW_SIM = 1 and REGCOUNT_INSTRUMENTATION = 1: HW_REG then passes
+ * __FILE__/__LINE__ of every access, without it every access counts for an unknown site.
+ *
+ * An access is a write when the model sees the register change, else a read. A read then a
+ * write of the same register by the same site (SET_BIT, CLR_BIT: REG = REG | x) is a read
+ * modify write. Two reads in a row of the same register by the same site are a repeat: a
+ * polling loop, or a read modify write that wrote the value back unchanged.
+ * A compound assignment (WRITE_BIT: REG |= x) is one access, it counts as a write only.
+ */
+
+#ifndef REGCOUNT_INTERFACE_H_
+#define REGCOUNT_INTERFACE_H_
+
+#include "std.h"
+
+/*----------------------------------------------------------/
+/- MACROS
+/----------------------------------------------------------*/
+#define REGCOUNT_SITES_MAX          512     /* distinct (site, register) pairs */
+
+/*----------------------------------------------------------/
+/- ENUMS
+/----------------------------------------------------------*/
+typedef enum
+{
+    REGCOUNT_OK             = 0 ,
+    REGCOUNT_ERROR              ,
+}en_regcount_error_t_;
+
+/*----------------------------------------------------------/
+/- STRUCTS
+/----------------------------------------------------------*/
+typedef struct
+{
+    uint32_t_               u32_reads       ;
+    uint32_t_               u32_writes      ;
+    uint32_t_               u32_rmws        ; /* read then write by the same site, also counted in reads and writes */
+    uint32_t_               u32_repeats     ; /* read again by the same site, also counted in reads */
+}st_regcount_counts_t_;
+
+/*---------------------------------------------------------/
+/- FUNCTION PROTOTYPES
+/---------------------------------------------------------*/
+
+/**
+ * @brief                       :   Clears the counters and starts counting, call after sim_init
+ */
+void regcount_start(void);
+
+/**
+ * @brief                       :   Stops counting, the counters keep their values
+ */
+void regcount_stop(void);
+
+/**
+ * @brief                       :   Reads the counters of every site and register
+ *
+ * @param[out]  ptr_st_counts   :   Pointer to store the totals in
+ *
+ * @return  REGCOUNT_OK         :   In case of Successful Operation
+ *          REGCOUNT_ERROR      :   In case of NULL pointer
+ */
+en_regcount_error_t_ regcount_get_totals(st_regcount_counts_t_ * ptr_st_counts);
+
+/**
+ * @brief                       :   Reads the counters of one register, every site
+ *
+ * @param[in]   u32_addr        :   Register address
+ * @param[out]  ptr_st_counts   :   Pointer to store the counts in, all 0 for a register not accessed
+ *
+ * @return  REGCOUNT_OK         :   In case of Successful Operation
+ *          REGCOUNT_ERROR      :   In case of NULL pointer
+ */
+en_regcount_error_t_ regcount_get_register(uint32_t_ u32_addr, st_regcount_counts_t_ * ptr_st_counts);
+
+/**
+ * @brief                       :   Prints the counters on stderr: one line per site and register
+ *                                  in source order, then the totals
+ *
+ * @param[in]   ptr_str_title   :   Title line, NULL_PTR: none
+ */
+void regcount_dump(const char * ptr_str_title);
+
+#endif /* REGCOUNT_INTERFACE_H_ */
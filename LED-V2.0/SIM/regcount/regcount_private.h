@@ -0,0 +1,28 @@
+/**
+ * @file    :   regcount_private.h
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Header File contains all register access counters' private macros and typedefs
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef REGCOUNT_PRIVATE_H_
+#define REGCOUNT_PRIVATE_H_
+
+#define REGCOUNT_HASH               1024        /* power of 2, > REGCOUNT_SITES_MAX */
+#define REGCOUNT_HASH_MASK          (REGCOUNT_HASH - 1)
+#define REGCOUNT_SITE_NONE          0xFFFF
+
+#define REGCOUNT_FILE_UNKNOWN       "?"
+
+typedef struct
+{
+    const char *            ptr_str_file    ;
+    uint32_t_               u32_line        ;
+    uint32_t_               u32_addr        ;
+    st_regcount_counts_t_   st_counts       ;
+}st_regcount_site_t;
+
+#endif /* REGCOUNT_PRIVATE_H_ */
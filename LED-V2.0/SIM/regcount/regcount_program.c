@@ -0,0 +1,291 @@
+/**
+ * @file    :   regcount_program.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Program File contains all register access counters' functions' implementation
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "sim_interface.h"
+
+#include "regcount_interface.h"
+#include "regcount_private.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+static st_regcount_site_t gl_arr_st_regcount_sites[REGCOUNT_SITES_MAX];
+static uint16_t_ gl_u16_regcount_sites_used = 0;
+static uint16_t_ gl_arr_u16_regcount_hash[REGCOUNT_HASH];
+
+static st_regcount_site_t * gl_ptr_st_regcount_last = NULL_PTR;    // site of the previous access
+static boolean gl_bool_regcount_last_write = FALSE;
+static boolean gl_bool_regcount_full_reported = FALSE;
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Finds the counters of a site and register, creating them
+ *
+ * @return  site, NULL_PTR when REGCOUNT_SITES_MAX are used
+ */
+static st_regcount_site_t * regcount_site(const char * ptr_str_file, uint32_t_ u32_line, uint32_t_ u32_addr)
+{
+    uint32_t_ u32_hash = (((u32_addr >> 2) ^ (u32_line * 40503UL)) * 2654435761UL) & REGCOUNT_HASH_MASK;
+    st_regcount_site_t * ptr_st_site = NULL_PTR;
+    st_regcount_site_t * ptr_st_candidate;
+
+    while((NULL_PTR == ptr_st_site) && (REGCOUNT_SITE_NONE != gl_arr_u16_regcount_hash[u32_hash]))
+    {
+        ptr_st_candidate = &gl_arr_st_regcount_sites[gl_arr_u16_regcount_hash[u32_hash]];
+
+        // __FILE__ of one file may be a different string in each translation unit
+        if(
+                (u32_addr == ptr_st_candidate->u32_addr) && (u32_line == ptr_st_candidate->u32_line) &&
+                ((ptr_str_file == ptr_st_candidate->ptr_str_file) || (0 == strcmp(ptr_str_file, ptr_st_candidate->ptr_str_file)))
+                )
+        {
+            ptr_st_site = ptr_st_candidate;
+        }
+        else
+        {
+            u32_hash = (u32_hash + 1) & REGCOUNT_HASH_MASK;
+        }
+    }
+
+    if((NULL_PTR == ptr_st_site) && (REGCOUNT_SITES_MAX > gl_u16_regcount_sites_used))
+    {
+        gl_arr_u16_regcount_hash[u32_hash] = gl_u16_regcount_sites_used;
+        ptr_st_site = &gl_arr_st_regcount_sites[gl_u16_regcount_sites_used++];
+        ptr_st_site->ptr_str_file = ptr_str_file;
+        ptr_st_site->u32_line = u32_line;
+        ptr_st_site->u32_addr = u32_addr;
+        ptr_st_site->st_counts = (st_regcount_counts_t_){ 0 };
+    }
+
+    return ptr_st_site;
+}
+
+/**
+ * @brief                       :   Access listener of the register model, counts one access
+ */
+static void regcount_access(uint32_t_ u32_addr, const char * ptr_str_file, uint32_t_ u32_line, boolean bool_write)
+{
+    st_regcount_site_t * ptr_st_site = regcount_site((NULL_PTR == ptr_str_file) ? REGCOUNT_FILE_UNKNOWN : ptr_str_file,
+                                                     u32_line, u32_addr);
+
+    if(NULL_PTR == ptr_st_site)
+    {
+        if(FALSE == gl_bool_regcount_full_reported)
+        {
+            fprintf(stderr, "regcount: more than %d sites, later ones not counted\n", REGCOUNT_SITES_MAX);
+            gl_bool_regcount_full_reported = TRUE;
+        }
+    }
+    else
+    {
+        if(TRUE == bool_write)
+        {
+            ptr_st_site->st_counts.u32_writes++;
+        }
+        else
+        {
+            ptr_st_site->st_counts.u32_reads++;
+        }
+
+        if((ptr_st_site == gl_ptr_st_regcount_last) && (FALSE == gl_bool_regcount_last_write))
+        {
+            if(TRUE == bool_write)
+            {
+                ptr_st_site->st_counts.u32_rmws++;
+            }
+            else
+            {
+                ptr_st_site->st_counts.u32_repeats++;
+            }
+        }
+    }
+
+    gl_ptr_st_regcount_last = ptr_st_site;
+    gl_bool_regcount_last_write = bool_write;
+}
+
+/**
+ * @brief                       :   Adds counts to a total
+ */
+static void regcount_add(st_regcount_counts_t_ * ptr_st_total, const st_regcount_counts_t_ * ptr_st_counts)
+{
+    ptr_st_total->u32_reads += ptr_st_counts->u32_reads;
+    ptr_st_total->u32_writes += ptr_st_counts->u32_writes;
+    ptr_st_total->u32_rmws += ptr_st_counts->u32_rmws;
+    ptr_st_total->u32_repeats += ptr_st_counts->u32_repeats;
+}
+
+/**
+ * @brief                       :   qsort order of the dump: file, line, register
+ */
+static int regcount_compare(const void * ptr_a, const void * ptr_b)
+{
+    const st_regcount_site_t * ptr_st_a = *(const st_regcount_site_t * const *) ptr_a;
+    const st_regcount_site_t * ptr_st_b = *(const st_regcount_site_t * const *) ptr_b;
+    int order = strcmp(ptr_st_a->ptr_str_file, ptr_st_b->ptr_str_file);
+
+    if(0 == order)
+    {
+        order = (ptr_st_a->u32_line > ptr_st_b->u32_line) - (ptr_st_a->u32_line < ptr_st_b->u32_line);
+    }
+
+    if(0 == order)
+    {
+        order = (ptr_st_a->u32_addr > ptr_st_b->u32_addr) - (ptr_st_a->u32_addr < ptr_st_b->u32_addr);
+    }
+
+    return order;
+}
+
+/*---------------------------------------------------------/
+/- FUNCTION IMPLEMENTATION
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Clears the counters and starts counting, call after sim_init
+ */
+void regcount_start(void)
+{
+    uint16_t_ u16_index;
+
+    // an access pending in the model belongs to whatever ran before
+    sim_set_access_listener(NULL_PTR);
+
+    for(u16_index = 0; u16_index < REGCOUNT_HASH; u16_index++)
+    {
+        gl_arr_u16_regcount_hash[u16_index] = REGCOUNT_SITE_NONE;
+    }
+    gl_u16_regcount_sites_used = 0;
+    gl_ptr_st_regcount_last = NULL_PTR;
+    gl_bool_regcount_last_write = FALSE;
+    gl_bool_regcount_full_reported = FALSE;
+
+    sim_set_access_listener(regcount_access);
+}
+
+/**
+ * @brief                       :   Stops counting, the counters keep their values
+ */
+void regcount_stop(void)
+{
+    // counts the last access
+    sim_set_access_listener(NULL_PTR);
+}
+
+/**
+ * @brief                       :   Reads the counters of every site and register
+ *
+ * @param[out]  ptr_st_counts   :   Pointer to store the totals in
+ *
+ * @return  REGCOUNT_OK         :   In case of Successful Operation
+ *          REGCOUNT_ERROR      :   In case of NULL pointer
+ */
+en_regcount_error_t_ regcount_get_totals(st_regcount_counts_t_ * ptr_st_counts)
+{
+    en_regcount_error_t_ en_regcount_error_retval = REGCOUNT_OK;
+    uint16_t_ u16_site;
+
+    if(NULL_PTR == ptr_st_counts)
+    {
+        en_regcount_error_retval = REGCOUNT_ERROR;
+    }
+    else
+    {
+        *ptr_st_counts = (st_regcount_counts_t_){ 0 };
+
+        for(u16_site = 0; u16_site < gl_u16_regcount_sites_used; u16_site++)
+        {
+            regcount_add(ptr_st_counts, &gl_arr_st_regcount_sites[u16_site].st_counts);
+        }
+    }
+
+    return en_regcount_error_retval;
+}
+
+/**
+ * @brief                       :   Reads the counters of one register, every site
+ *
+ * @param[in]   u32_addr        :   Register address
+ * @param[out]  ptr_st_counts   :   Pointer to store the counts in, all 0 for a register not accessed
+ *
+ * @return  REGCOUNT_OK         :   In case of Successful Operation
+ *          REGCOUNT_ERROR      :   In case of NULL pointer
+ */
+en_regcount_error_t_ regcount_get_register(uint32_t_ u32_addr, st_regcount_counts_t_ * ptr_st_counts)
+{
+    en_regcount_error_t_ en_regcount_error_retval = REGCOUNT_OK;
+    uint16_t_ u16_site;
+
+    if(NULL_PTR == ptr_st_counts)
+    {
+        en_regcount_error_retval = REGCOUNT_ERROR;
+    }
+    else
+    {
+        *ptr_st_counts = (st_regcount_counts_t_){ 0 };
+
+        for(u16_site = 0; u16_site < gl_u16_regcount_sites_used; u16_site++)
+        {
+            if(u32_addr == gl_arr_st_regcount_sites[u16_site].u32_addr)
+            {
+                regcount_add(ptr_st_counts, &gl_arr_st_regcount_sites[u16_site].st_counts);
+            }
+        }
+    }
+
+    return en_regcount_error_retval;
+}
+
+/**
+ * @brief                       :   Prints the counters on stderr: one line per site and register
+ *                                  in source order, then the totals
+ *
+ * @param[in]   ptr_str_title   :   Title line, NULL_PTR: none
+ */
+void regcount_dump(const char * ptr_str_title)
+{
+    static const st_regcount_site_t * arr_ptr_st_sorted[REGCOUNT_SITES_MAX];
+    const st_regcount_site_t * ptr_st_site;
+    const char * ptr_str_base;
+    st_regcount_counts_t_ st_total;
+    uint16_t_ u16_site;
+
+    for(u16_site = 0; u16_site < gl_u16_regcount_sites_used; u16_site++)
+    {
+        arr_ptr_st_sorted[u16_site] = &gl_arr_st_regcount_sites[u16_site];
+    }
+    qsort(arr_ptr_st_sorted, gl_u16_regcount_sites_used, sizeof(arr_ptr_st_sorted[0]), regcount_compare);
+
+    if(NULL_PTR != ptr_str_title)
+    {
+        fprintf(stderr, "# %s\n", ptr_str_title);
+    }
+    fprintf(stderr, "#   %-28s %-10s %8s %8s %8s %8s\n", "site", "register", "reads", "writes", "rmw", "repeats");
+
+    for(u16_site = 0; u16_site < gl_u16_regcount_sites_used; u16_site++)
+    {
+        ptr_st_site = arr_ptr_st_sorted[u16_site];
+        ptr_str_base = strrchr(ptr_st_site->ptr_str_file, '/');
+        ptr_str_base = (NULL_PTR == ptr_str_base) ? ptr_st_site->ptr_str_file : (ptr_str_base + 1);
+
+        fprintf(stderr, "    %-22s:%-5lu 0x%08lX %8lu %8lu %8lu %8lu\n", ptr_str_base, ptr_st_site->u32_line,
+                ptr_st_site->u32_addr, ptr_st_site->st_counts.u32_reads, ptr_st_site->st_counts.u32_writes,
+                ptr_st_site->st_counts.u32_rmws, ptr_st_site->st_counts.u32_repeats);
+    }
+
+    regcount_get_totals(&st_total);
+    fprintf(stderr, "    %-28s %-10s %8lu %8lu %8lu %8lu\n", "total", "", st_total.u32_reads, st_total.u32_writes,
+            st_total.u32_rmws, st_total.u32_repeats);
+}
@@ -0,0 +1,308 @@
+/**
+ * @file    :   sim_interface.h
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Header File contains all host peripheral simulation typedefs and functions' prototypes
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Host (HW_SIM = 1) model of the TM4C123 registers behind HW_REG, driven by a virtual clock.
+ * The drivers run unmodified: every register access goes through sim_reg, which returns the
+ * register's slot in the model. A write through the returned pointer is detected at the next
+ * model entry (any register access, clock advance or pin drive) by comparing each slot with
+ * the value the model last saw, so peripheral side effects follow every write before the
+ * drivers can observe anything else. A write of the value a register already reads is not
+ * seen (a no-op for every modelled register except a GPIO data latch behind an input pin).
+ *
+ * Modelled: GPIO ports A -> F (APB) data/direction/pulls/digital enable, edge and level
+ * interrupts; SysTick (COUNT flag, reload, exception); 16/32-bit timers 0 -> 5 timer A periodic
+ * time-out and its interrupt; the DWT cycle counter; SYSCTL PRxxx reading as their RCGCxxx;
+ * UART0 at its programmed baud rate with both directions on uDMA (basic and ping-pong 8-bit
+ * transfers, completion on the UART interrupt), without FIFOs: TX takes the next byte when the
+ * last one is sent, a received byte without an enabled RX transfer is lost. SSI0 -> SSI3 as
+ * masters at their programmed bit rate, TX on uDMA (basic and ping-pong 8/16-bit transfers,
+ * completion on the SSI interrupt), without FIFO either: the next frame starts when the last one
+ * ended, back to back.
+ * Every other register is plain memory (the other uDMA channels never complete).
+ * Every register access costs SIM_ACCESS_NS of virtual time, interrupts are taken at register
+ * accesses and clock advances, not nested, SysTick first then the lowest IRQ number.
+ * WFI jumps the clock to the next scheduled event: timer, SysTick, pin drive, UART byte or SSI frame, so a firmware
+ * idling in WFI runs much faster than real time. Code spinning without register accesses
+ * doesn't advance the clock.
+ * An access listener (SIM/regcount) is told of every access with its call site, as a write
+ * when the register changed by the next model entry, else as a read.
+ */
+
+#ifndef SIM_INTERFACE_H_
+#define SIM_INTERFACE_H_
+
+#include "std.h"
+
+/*----------------------------------------------------------/
+/- MACROS
+/----------------------------------------------------------*/
+#define SIM_GPIO_PORTS              6       /* A -> F */
+#define SIM_GPIO_PINS               8
+#define SIM_ACCESS_NS               63      /* one bus access at 16 MHz */
+#define SIM_EVENTS_MAX              256     /* scheduled pin drives */
+#define SIM_IRQS                    139     /* NVIC interrupt lines of the TM4C123 */
+#define SIM_IRQ_BASE                16      /* exception number of IRQ 0 */
+#define SIM_VECTORS                 (SIM_IRQ_BASE + SIM_IRQS)
+#define SIM_LISTENERS_MAX           4
+#define SIM_UART_RX_MAX             1024    /* bytes queued on U0RX */
+#define SIM_TIME_NEVER              0xFFFFFFFFFFFFFFFFULL
+
+/*----------------------------------------------------------/
+/- ENUMS
+/----------------------------------------------------------*/
+typedef enum
+{
+    SIM_OK                  = 0 ,
+    SIM_ERROR                   ,
+}en_sim_error_t_;
+
+/* External drive of a pin, what a button or a test bench does to it */
+typedef enum
+{
+    SIM_PIN_LOW             = 0 ,
+    SIM_PIN_HIGH                ,
+    SIM_PIN_RELEASE             ,   /* not driven: pulls decide, else floating */
+    SIM_PIN_DRIVE_TOTAL
+}en_sim_pin_drive_t_;
+
+/*----------------------------------------------------------/
+/- STRUCTS
+/----------------------------------------------------------*/
+/* Externally visible state of a port */
+typedef struct
+{
+    uint8_t_                u8_levels       ; /* pin levels, 1: high */
+    uint8_t_                u8_driven       ; /* 1: driven by the port, an external drive or a pull, 0: floating */
+    uint8_t_                u8_dir          ; /* GPIODIR, 1: output */
+}st_sim_port_state_t_;
+
+/* Called on every change of a port's state, at sim_now_ns */
+typedef void (*sim_port_listener_t_)(uint8_t_ u8_port, const st_sim_port_state_t_ * ptr_st_state);
+
+/* Called for every register access once the model knows whether it wrote (value changed) */
+typedef void (*sim_access_listener_t_)(uint32_t_ u32_addr, const char * ptr_str_file, uint32_t_ u32_line, boolean bool_write);
+
+/* Called for every byte UART0 sent, at sim_now_ns once its stop bit ended */
+typedef void (*sim_uart_listener_t_)(uint8_t_ u8_byte);
+
+/* Called for every frame an SSI module sent, at sim_now_ns once its last bit ended */
+typedef void (*sim_ssi_listener_t_)(uint8_t_ u8_module, uint16_t_ u16_frame);
+
+/* Called when the clock reaches the end time, the process exits after it returns */
+typedef void (*sim_end_handler_t_)(void);
+
+/*----------------------------------------------------------/
+/- EXTERNS
+/----------------------------------------------------------*/
+/* exception handlers by exception number (IRQ n: SIM_IRQ_BASE + n), defined with the device's startup code */
+extern void (* const gl_arr_sim_vectors[SIM_VECTORS])(void);
+
+/*---------------------------------------------------------/
+/- FUNCTION PROTOTYPES
+/---------------------------------------------------------*/
+
+/**
+ * @brief                       :   Resets the model to its power on state at virtual time 0
+ */
+void sim_init(void);
+
+/**
+ * @brief                       :   Register access of HW_REG, commits pending writes, spends one
+ *                                  bus access and returns the register's slot holding its read value
+ *
+ * @param[in]   u32_addr        :   Register address
+ *
+ * @return  pointer to the register's slot
+ */
+volatile uint32_t_ * sim_reg(uint32_t_ u32_addr);
+
+/**
+ * @brief                       :   sim_reg of a call site, HW_REG of the REGCOUNT_INSTRUMENTATION build
+ *
+ * @param[in]   u32_addr        :   Register address
+ * @param[in]   ptr_str_file    :   Source file of the access, NULL_PTR: unknown
+ * @param[in]   u32_line        :   Source line of the access
+ *
+ * @return  pointer to the register's slot
+ */
+volatile uint32_t_ * sim_reg_at(uint32_t_ u32_addr, const char * ptr_str_file, uint32_t_ u32_line);
+
+/**
+ * @brief                       :   Sets the listener of register accesses, the pending access goes to
+ *                                  the previous listener first
+ *
+ * @param[in]   ptr_listener    :   Listener, NULL_PTR: none
+ */
+void sim_set_access_listener(sim_access_listener_t_ ptr_listener);
+
+/**
+ * @brief                       :   Reads the virtual time
+ *
+ * @return  nanoseconds since sim_init
+ */
+uint64_t_ sim_now_ns(void);
+
+/**
+ * @brief                       :   Reads the virtual time the core spent in WFI, the clock skipped to
+ *                                  the next event (the handlers waking it run awake)
+ *
+ * @return  nanoseconds asleep since sim_init
+ */
+uint64_t_ sim_asleep_ns(void);
+
+/**
+ * @brief                       :   Reads the number of register accesses
+ *
+ * @return  accesses through sim_reg since sim_init, interrupt handlers' included
+ */
+uint64_t_ sim_access_count(void);
+
+/**
+ * @brief                       :   Reads the number of times an interrupt handler was entered
+ *
+ * @param[in]   s32_irq         :   IRQ number, -1 (SysTick_IRQn) for SysTick
+ *
+ * @return  entries since sim_init, 0 for an invalid IRQ number
+ */
+uint32_t_ sim_irq_entries(sint32_t_ s32_irq);
+
+/**
+ * @brief                       :   Advances the virtual clock, applying scheduled events and
+ *                                  taking interrupts on the way
+ *
+ * @param[in]   u64_ns          :   Nanoseconds to advance
+ */
+void sim_run_for(uint64_t_ u64_ns);
+
+/**
+ * @brief                       :   Drives a pin from outside now
+ *
+ * @param[in]   u8_port         :   Port (0 -> SIM_GPIO_PORTS - 1)
+ * @param[in]   u8_pin          :   Pin (0 -> SIM_GPIO_PINS - 1)
+ * @param[in]   en_drive        :   Drive
+ *
+ * @return  SIM_OK              :   In case of Successful Operation
+ *          SIM_ERROR           :   In case of invalid port/pin/drive
+ */
+en_sim_error_t_ sim_pin_drive(uint8_t_ u8_port, uint8_t_ u8_pin, en_sim_pin_drive_t_ en_drive);
+
+/**
+ * @brief                       :   Schedules an external pin drive, applied when the clock reaches it
+ *
+ * @param[in]   u64_at_ns       :   Virtual time of the drive
+ * @param[in]   u8_port         :   Port (0 -> SIM_GPIO_PORTS - 1)
+ * @param[in]   u8_pin          :   Pin (0 -> SIM_GPIO_PINS - 1)
+ * @param[in]   en_drive        :   Drive
+ *
+ * @return  SIM_OK              :   In case of Successful Operation
+ *          SIM_ERROR           :   In case of invalid arguments, a time in the past or a full queue
+ */
+en_sim_error_t_ sim_pin_schedule(uint64_t_ u64_at_ns, uint8_t_ u8_port, uint8_t_ u8_pin, en_sim_pin_drive_t_ en_drive);
+
+/**
+ * @brief                       :   Reads the state of a port
+ *
+ * @param[in]   u8_port         :   Port (0 -> SIM_GPIO_PORTS - 1)
+ * @param[out]  ptr_st_state    :   Pointer to store the state in
+ *
+ * @return  SIM_OK              :   In case of Successful Operation
+ *          SIM_ERROR           :   In case of invalid port or NULL pointer
+ */
+en_sim_error_t_ sim_port_get_state(uint8_t_ u8_port, st_sim_port_state_t_ * ptr_st_state);
+
+/**
+ * @brief                       :   Adds a listener of port state changes
+ *
+ * @param[in]   ptr_listener    :   Listener
+ *
+ * @return  SIM_OK              :   In case of Successful Operation
+ *          SIM_ERROR           :   In case of NULL pointer or SIM_LISTENERS_MAX listeners already
+ */
+en_sim_error_t_ sim_add_port_listener(sim_port_listener_t_ ptr_listener);
+
+/**
+ * @brief                       :   Removes a listener added with sim_add_port_listener
+ *
+ * @param[in]   ptr_listener    :   Listener
+ */
+void sim_remove_port_listener(sim_port_listener_t_ ptr_listener);
+
+/**
+ * @brief                       :   Sets the listener of the bytes UART0 sends
+ *
+ * @param[in]   ptr_listener    :   Listener, NULL_PTR: none
+ */
+void sim_set_uart_listener(sim_uart_listener_t_ ptr_listener);
+
+/**
+ * @brief                       :   Queues bytes on U0RX, sent back to back at UART0's baud rate
+ *                                  from now, or after the bytes already queued
+ *
+ * @param[in]   ptr_u8_data     :   Pointer to bytes
+ * @param[in]   u16_length      :   Number of bytes
+ *
+ * @return  SIM_OK              :   In case of Successful Operation
+ *          SIM_ERROR           :   In case of NULL pointer, baud rate not programmed or a full queue
+ */
+en_sim_error_t_ sim_uart_receive(const uint8_t_ * ptr_u8_data, uint16_t_ u16_length);
+
+/**
+ * @brief                       :   Reads the number of bytes UART0 received without a uDMA transfer
+ *                                  to take them
+ *
+ * @return  bytes lost since sim_init
+ */
+uint32_t_ sim_uart_rx_lost(void);
+
+/**
+ * @brief                       :   Sets the listener of the frames the SSI modules send
+ *
+ * @param[in]   ptr_listener    :   Listener, NULL_PTR: none
+ */
+void sim_set_ssi_listener(sim_ssi_listener_t_ ptr_listener);
+
+/**
+ * @brief                       :   Sets when the simulation ends, for a firmware that never returns:
+ *                                  once the clock reaches the end the handler runs and the process exits
+ *
+ * @param[in]   u64_at_ns       :   End time, SIM_TIME_NEVER: no end
+ * @param[in]   ptr_end         :   Handler, NULL_PTR: none
+ */
+void sim_set_end(uint64_t_ u64_at_ns, sim_end_handler_t_ ptr_end);
+
+/**
+ * @brief                       :   NVIC enable/disable of an interrupt line, used by the device header
+ *
+ * @param[in]   s32_irq         :   IRQ number
+ * @param[in]   bool_enable     :   TRUE: enable, FALSE: disable
+ */
+void sim_nvic_enable(sint32_t_ s32_irq, boolean bool_enable);
+
+/**
+ * @brief                       :   PRIMASK, used by the device header, unmasking takes pending interrupts
+ *
+ * @param[in]   bool_masked     :   TRUE: interrupts masked
+ */
+void sim_irq_mask(boolean bool_masked);
+
+/**
+ * @brief                       :   PRIMASK read, used by the device header
+ *
+ * @return  TRUE                :   Interrupts masked
+ *          FALSE               :   Interrupts unmasked
+ */
+boolean sim_irq_is_masked(void);
+
+/**
+ * @brief                       :   WFI, used by the device header: advances the clock to the next
+ *                                  event until an interrupt is pending (masked or not) or was taken
+ */
+void sim_wfi(void);
+
+#endif /* SIM_INTERFACE_H_ */
@@ -0,0 +1,263 @@
+/**
+ * @file    :   sim_private.h
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Header File contains all host peripheral simulation private macros and typedefs
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef SIM_PRIVATE_H_
+#define SIM_PRIVATE_H_
+
+/* register slots, every register the drivers touched */
+#define SIM_REGS_MAX                512
+#define SIM_REGS_HASH               1024        /* power of 2, > SIM_REGS_MAX */
+#define SIM_REGS_HASH_MASK          (SIM_REGS_HASH - 1)
+#define SIM_SLOT_NONE               0xFFFF
+
+#define SIM_NS_PER_S                1000000000ULL
+
+/* system control */
+#define SIM_RCGCGPIO                0x400FE608
+#define SIM_RCGC_FIRST              0x400FE600  /* RCGCWD */
+#define SIM_RCGC_END                0x400FE680
+#define SIM_PR_OFFSET               0x400       /* PRxxx peripheral ready = RCGCxxx + 0x400 */
+#define SIM_PIOSC_HZ                16000000UL
+
+/* SysTick */
+#define SIM_STCTRL                  0xE000E010
+#define SIM_STRELOAD                0xE000E014
+#define SIM_STCURRENT               0xE000E018
+#define SIM_STCTRL_ENABLE           (1UL << 0)
+#define SIM_STCTRL_TICKINT          (1UL << 1)
+#define SIM_STCTRL_CLKSOURCE        (1UL << 2)  /* 1: system clock, 0: PIOSC / 4 */
+#define SIM_STCTRL_BITS             (SIM_STCTRL_ENABLE | SIM_STCTRL_TICKINT | SIM_STCTRL_CLKSOURCE)
+#define SIM_STCTRL_COUNT            (1UL << 16)
+#define SIM_STRELOAD_MASK           0x00FFFFFFUL
+#define SIM_ST_PIOSC_DIV            4
+#define SIM_SYSTICK_EXCEPTION       15
+
+/* DWT cycle counter */
+#define SIM_DWT_CTRL                0xE0001000
+#define SIM_DWT_CYCCNT              0xE0001004
+#define SIM_DWT_CYCCNTENA           (1UL << 0)
+#define SIM_DWT_CYCCNT_MASK         0xFFFFFFFFUL    /* 32 bit counter, uint32_t_ is wider on the host */
+
+/* 16/32-bit timers, timer A periodic count down */
+#define SIM_TIMERS                  6
+#define SIM_TIMER_BASE              0x40030000
+#define SIM_TIMER_SIZE              0x1000
+#define SIM_TIMER_MASK              (SIM_TIMER_SIZE - 1)
+#define SIM_GPTM_TAMR               0x004
+#define SIM_GPTM_CTL                0x00C
+#define SIM_GPTM_IMR                0x018
+#define SIM_GPTM_RIS                0x01C
+#define SIM_GPTM_MIS                0x020
+#define SIM_GPTM_ICR                0x024
+#define SIM_GPTM_TAILR              0x028
+#define SIM_GPTM_TAR                0x048
+#define SIM_GPTM_TAV                0x050
+#define SIM_GPTM_TAMR_MODE          0x3UL
+#define SIM_GPTM_TAMR_ONE_SHOT      0x1UL
+#define SIM_GPTM_TAEN               (1UL << 0)
+#define SIM_GPTM_TATO               (1UL << 0)
+
+/* GPIO ports on the APB aperture */
+#define SIM_GPIO_APB_LOW            0x40004000  /* ports A -> D */
+#define SIM_GPIO_APB_HIGH           0x40024000  /* ports E -> F */
+#define SIM_GPIO_APB_LOW_PORTS      4
+#define SIM_GPIO_PORT_SIZE          0x1000
+#define SIM_GPIO_PORT_MASK          (SIM_GPIO_PORT_SIZE - 1)
+
+/* GPIO register offsets */
+#define SIM_GPIO_DATA_END           0x400       /* 0x000 -> 0x3FC: data, address bits [9:2] mask */
+#define SIM_GPIO_DATA_MASK_POS      2
+#define SIM_GPIO_DIR                0x400
+#define SIM_GPIO_IS                 0x404
+#define SIM_GPIO_IBE                0x408
+#define SIM_GPIO_IEV                0x40C
+#define SIM_GPIO_IM                 0x410
+#define SIM_GPIO_RIS                0x414
+#define SIM_GPIO_MIS                0x418
+#define SIM_GPIO_ICR                0x41C
+#define SIM_GPIO_PUR                0x510
+#define SIM_GPIO_PDR                0x514
+#define SIM_GPIO_DEN                0x51C
+
+#define SIM_PINS_MASK               0xFF
+
+/* UART0, 8N1 frames through uDMA only */
+#define SIM_UART0_BASE              0x4000C000
+#define SIM_UART0_FR                (SIM_UART0_BASE + 0x018)
+#define SIM_UART0_IBRD              (SIM_UART0_BASE + 0x024)
+#define SIM_UART0_FBRD              (SIM_UART0_BASE + 0x028)
+#define SIM_UART0_CTL               (SIM_UART0_BASE + 0x030)
+#define SIM_UART0_DMACTL            (SIM_UART0_BASE + 0x048)
+#define SIM_UART0_IRQ               5
+#define SIM_UARTFR_BUSY             (1UL << 3)
+#define SIM_UARTFR_RXFE             (1UL << 4)
+#define SIM_UARTFR_TXFE             (1UL << 7)
+#define SIM_UARTCTL_UARTEN          (1UL << 0)
+#define SIM_UARTCTL_HSE             (1UL << 5)
+#define SIM_UARTCTL_TXE             (1UL << 8)
+#define SIM_UARTCTL_RXE             (1UL << 9)
+#define SIM_UARTDMACTL_RXDMAE       (1UL << 0)
+#define SIM_UARTDMACTL_TXDMAE       (1UL << 1)
+#define SIM_UART_CLK_DIV            16
+#define SIM_UART_CLK_DIV_HSE        8
+#define SIM_UART_FBRD_BITS          6
+#define SIM_UART_FBRD_MASK          0x3F
+#define SIM_UART_FRAME_BITS         10          /* start, 8 data, stop */
+
+/* SSI0 -> SSI3, master frames through uDMA only */
+#define SIM_SSIS                    4
+#define SIM_SSI_BASE                0x40008000
+#define SIM_SSI_SIZE                0x1000
+#define SIM_SSI_MASK                (SIM_SSI_SIZE - 1)
+#define SIM_SSI_CR0                 0x000
+#define SIM_SSI_CR1                 0x004
+#define SIM_SSI_SR                  0x00C
+#define SIM_SSI_CPSR                0x010
+#define SIM_SSI_DMACTL              0x024
+#define SIM_SSI_CC                  0xFC8
+#define SIM_SSICR0_DSS_MASK         0xFUL       /* bits per frame - 1 */
+#define SIM_SSICR0_SCR_POS          8
+#define SIM_SSICR0_SCR_MASK         0xFFUL
+#define SIM_SSICR1_SSE              (1UL << 1)
+#define SIM_SSISR_TFE               (1UL << 0)
+#define SIM_SSISR_TNF               (1UL << 1)
+#define SIM_SSISR_BSY               (1UL << 4)
+#define SIM_SSIDMACTL_TXDMAE        (1UL << 1)
+#define SIM_SSICC_PIOSC             0x5
+#define SIM_SSICPSR_MASK            0xFFUL
+
+/* uDMA controller */
+#define SIM_UDMA_BASE               0x400FF000
+#define SIM_UDMA_END                (SIM_UDMA_BASE + 0x1000)
+#define SIM_DMACFG                  (SIM_UDMA_BASE + 0x004)
+#define SIM_DMACTLBASE              (SIM_UDMA_BASE + 0x008)
+#define SIM_DMAENASET               (SIM_UDMA_BASE + 0x028)
+#define SIM_DMAENACLR               (SIM_UDMA_BASE + 0x02C)
+#define SIM_DMAALTSET               (SIM_UDMA_BASE + 0x030)
+#define SIM_DMAALTCLR               (SIM_UDMA_BASE + 0x034)
+#define SIM_DMACHIS                 (SIM_UDMA_BASE + 0x504)
+#define SIM_DMACFG_MASTEN           (1UL << 0)
+#define SIM_UDMA_CHANNELS           32
+#define SIM_UDMA_CH_UART0_RX        8
+#define SIM_UDMA_CH_UART0_TX        9
+#define SIM_UDMA_UART0_CHANNELS     ((1UL << SIM_UDMA_CH_UART0_RX) | (1UL << SIM_UDMA_CH_UART0_TX))
+/* DMACHIS reads with the software channel's bit set, which no driver uses, so a write-1-to-clear of
+   exactly the pending bits differs from the value read and is seen */
+#define SIM_DMACHIS_READ_MARK       (1UL << 31)
+#define SIM_UDMA_MODE_MASK          0x7
+#define SIM_UDMA_MODE_STOP          0
+#define SIM_UDMA_MODE_PING_PONG     3
+#define SIM_UDMA_XFERSIZE_POS       4
+#define SIM_UDMA_XFERSIZE_MASK      0x3FFUL
+#define SIM_UDMA_SIZE_POS           24          /* SRCSIZE, the drivers set DSTSIZE the same */
+#define SIM_UDMA_SIZE_MASK          0x3
+#define SIM_UDMA_SIZE_8             0
+#define SIM_UDMA_SIZE_16            1
+#define SIM_UDMA_SRCINC_POS         26
+#define SIM_UDMA_DSTINC_POS         30
+#define SIM_UDMA_INC_MASK           0x3
+#define SIM_UDMA_INC_NONE           3
+
+/* scheduled event kinds */
+typedef enum
+{
+    SIM_EVENT_PIN_DRIVE     = 0 ,
+}en_sim_event_kind_t;
+
+typedef struct
+{
+    uint32_t_               u32_addr        ;
+    uint32_t_               u32_value       ; /* what the drivers read and write */
+    uint32_t_               u32_seen        ; /* value the model last saw, a difference is a write */
+}st_sim_slot_t;
+
+typedef struct
+{
+    uint8_t_                u8_latch        ; /* data register, drives the output pins */
+    uint8_t_                u8_input        ; /* external drive levels */
+    uint8_t_                u8_input_driven ; /* pins driven externally */
+    uint8_t_                u8_ris          ; /* raw interrupt status */
+    st_sim_port_state_t_    st_state        ; /* last evaluated pin state */
+}st_sim_gpio_t;
+
+/* A count down at a fixed clock: SysTick, a timer A */
+typedef struct
+{
+    boolean                 bool_running    ;
+    uint32_t_               u32_hz          ; /* counter clock */
+    uint64_t_               u64_ticks       ; /* ticks from the start value to the wrap (value + 1) */
+    uint64_t_               u64_start_ns    ; /* time the count started */
+    uint64_t_               u64_wrap_ns     ; /* time it wraps, SIM_TIME_NEVER: never */
+}st_sim_counter_t;
+
+typedef struct
+{
+    uint32_t_               u32_ctrl        ; /* SIM_STCTRL_BITS as written */
+    boolean                 bool_count      ; /* COUNT, wrapped since last read */
+    boolean                 bool_pending    ; /* exception pending */
+    st_sim_counter_t        st_counter      ;
+}st_sim_systick_t;
+
+typedef struct
+{
+    uint32_t_               u32_ris         ; /* raw interrupt status */
+    st_sim_counter_t        st_counter      ;
+}st_sim_timer_t;
+
+typedef struct
+{
+    boolean                 bool_running    ;
+    uint32_t_               u32_base        ; /* CYCCNT at u64_start_ns */
+    uint64_t_               u64_start_ns    ;
+}st_sim_dwt_t;
+
+/* Channel control structure, the layout udma_private.h writes into the control table */
+typedef struct
+{
+    uint32_t_               u32_src_end     ;
+    uint32_t_               u32_dst_end     ;
+    uint32_t_               u32_control     ;
+    uint32_t_               u32_reserved    ;
+}st_sim_udma_entry_t;
+
+typedef struct
+{
+    uint32_t_               u32_enabled     ; /* DMAENASET */
+    uint32_t_               u32_alt         ; /* DMAALTSET, alternate structure active */
+    uint32_t_               u32_chis        ; /* DMACHIS, transfer completed */
+}st_sim_udma_t;
+
+typedef struct
+{
+    uint8_t_                u8_tx_byte      ; /* shifting out */
+    uint64_t_               u64_tx_done_ns  ; /* its stop bit ends, SIM_TIME_NEVER: TX idle */
+    uint8_t_                arr_u8_rx[SIM_UART_RX_MAX] ; /* bytes coming in on U0RX, a ring */
+    uint16_t_               u16_rx_head     ;
+    uint16_t_               u16_rx_count    ;
+    uint64_t_               u64_rx_done_ns  ; /* next one is complete, SIM_TIME_NEVER: none coming */
+    uint32_t_               u32_rx_lost     ;
+}st_sim_uart_t;
+
+typedef struct
+{
+    uint16_t_               u16_tx_frame    ; /* shifting out */
+    uint64_t_               u64_tx_done_ns  ; /* its last bit ends, SIM_TIME_NEVER: TX idle */
+}st_sim_ssi_t;
+
+typedef struct
+{
+    uint64_t_               u64_at_ns       ;
+    en_sim_event_kind_t     en_kind         ;
+    uint8_t_                u8_port         ;
+    uint8_t_                u8_pin          ;
+    en_sim_pin_drive_t_     en_drive        ;
+}st_sim_event_t;
+
+#endif /* SIM_PRIVATE_H_ */
@@ -0,0 +1,1830 @@
+/**
+ * @file    :   sim_program.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Program File contains all host peripheral simulation functions' implementation
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "sim_interface.h"
+#include "sim_private.h"
+
+// SystemCoreClock, the clock of the timers and of the cycle counter
+#include "TM4C123.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+static st_sim_slot_t gl_arr_st_sim_slots[SIM_REGS_MAX];
+static uint16_t_ gl_u16_sim_slots_used = 0;
+static uint16_t_ gl_arr_u16_sim_slot_hash[SIM_REGS_HASH];
+
+static st_sim_gpio_t gl_arr_st_sim_gpio[SIM_GPIO_PORTS];
+static uint8_t_ gl_u8_sim_gated_reported = 0;   // ports already reported accessed without clock
+
+static st_sim_systick_t gl_st_sim_systick;
+static st_sim_timer_t gl_arr_st_sim_timers[SIM_TIMERS];
+static st_sim_dwt_t gl_st_sim_dwt;
+static st_sim_udma_t gl_st_sim_udma;
+static st_sim_uart_t gl_st_sim_uart;
+static sim_uart_listener_t_ gl_ptr_sim_uart_listener = NULL_PTR;
+static st_sim_ssi_t gl_arr_st_sim_ssi[SIM_SSIS];
+static sim_ssi_listener_t_ gl_ptr_sim_ssi_listener = NULL_PTR;
+
+static st_sim_event_t gl_arr_st_sim_events[SIM_EVENTS_MAX];     // sorted by time
+static uint16_t_ gl_u16_sim_events_count = 0;
+
+static uint64_t_ gl_u64_sim_now_ns = 0;
+static uint64_t_ gl_u64_sim_asleep_ns = 0;
+static boolean gl_bool_sim_asleep = FALSE;     // in WFI, the clock skips to the next event
+static uint64_t_ gl_u64_sim_accesses = 0;
+static uint64_t_ gl_u64_sim_end_ns = SIM_TIME_NEVER;
+static sim_end_handler_t_ gl_ptr_sim_end = NULL_PTR;
+
+static boolean gl_arr_bool_sim_nvic_enabled[SIM_IRQS];
+static boolean gl_bool_sim_irq_masked = FALSE;
+static boolean gl_bool_sim_in_isr = FALSE;
+static uint32_t_ gl_u32_sim_taken = 0;          // exceptions taken, tells WFI one was
+static uint32_t_ gl_arr_u32_sim_entries[SIM_VECTORS];
+
+static sim_port_listener_t_ gl_arr_ptr_sim_listeners[SIM_LISTENERS_MAX];
+
+/* last register access, told to the access listener once the next model entry shows a write */
+static sim_access_listener_t_ gl_ptr_sim_access_listener = NULL_PTR;
+static st_sim_slot_t * gl_ptr_st_sim_access_slot = NULL_PTR;
+static const char * gl_ptr_str_sim_access_file = NULL_PTR;
+static uint32_t_ gl_u32_sim_access_line = 0;
+
+/* NVIC line of each GPIO port */
+static const uint8_t_ gl_arr_u8_sim_gpio_irqs[SIM_GPIO_PORTS] = { 0, 1, 2, 3, 4, 30 };
+
+/* NVIC line of each timer A */
+static const uint8_t_ gl_arr_u8_sim_timer_irqs[SIM_TIMERS] = { 19, 21, 23, 35, 70, 92 };
+
+/* SSI0 -> SSI3 interrupt lines and TX uDMA channels (SSI2/SSI3: encoding 2) */
+static const uint8_t_ gl_arr_u8_sim_ssi_irqs[SIM_SSIS] = { 7, 34, 57, 58 };
+static const uint8_t_ gl_arr_u8_sim_ssi_tx_channels[SIM_SSIS] = { 11, 25, 13, 15 };
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+static void sim_commit(void);
+
+/**
+ * @brief                       :   Finds the slot of a register, creating it with its reset value 0
+ *
+ * @param[in]   u32_addr        :   Register address
+ *
+ * @return  slot
+ */
+static st_sim_slot_t * sim_slot(uint32_t_ u32_addr)
+{
+    uint32_t_ u32_hash = ((u32_addr >> 2) * 2654435761UL) & SIM_REGS_HASH_MASK;
+    st_sim_slot_t * ptr_st_slot = NULL_PTR;
+
+    while((NULL_PTR == ptr_st_slot) && (SIM_SLOT_NONE != gl_arr_u16_sim_slot_hash[u32_hash]))
+    {
+        if(u32_addr == gl_arr_st_sim_slots[gl_arr_u16_sim_slot_hash[u32_hash]].u32_addr)
+        {
+            ptr_st_slot = &gl_arr_st_sim_slots[gl_arr_u16_sim_slot_hash[u32_hash]];
+        }
+        else
+        {
+            u32_hash = (u32_hash + 1) & SIM_REGS_HASH_MASK;
+        }
+    }
+
+    if(NULL_PTR == ptr_st_slot)
+    {
+        if(SIM_REGS_MAX <= gl_u16_sim_slots_used)
+        {
+            fprintf(stderr, "sim: more than %d registers accessed\n", SIM_REGS_MAX);
+            exit(1);
+        }
+
+        gl_arr_u16_sim_slot_hash[u32_hash] = gl_u16_sim_slots_used;
+        ptr_st_slot = &gl_arr_st_sim_slots[gl_u16_sim_slots_used++];
+        ptr_st_slot->u32_addr = u32_addr;
+        ptr_st_slot->u32_value = 0;
+        ptr_st_slot->u32_seen = 0;
+    }
+
+    return ptr_st_slot;
+}
+
+/**
+ * @brief                       :   Reads a plain register of the model
+ */
+static uint32_t_ sim_reg_value(uint32_t_ u32_addr)
+{
+    return sim_slot(u32_addr)->u32_value;
+}
+
+/**
+ * @brief                       :   Sets a register from the model side, not seen as a driver write
+ */
+static void sim_reg_set(uint32_t_ u32_addr, uint32_t_ u32_value)
+{
+    st_sim_slot_t * ptr_st_slot = sim_slot(u32_addr);
+
+    ptr_st_slot->u32_value = u32_value;
+    ptr_st_slot->u32_seen = u32_value;
+}
+
+/**
+ * @brief                       :   Maps an address to its GPIO port
+ *
+ * @param[in]   u32_addr        :   Register address
+ * @param[out]  ptr_u8_port     :   Pointer to store the port in
+ *
+ * @return  TRUE                :   GPIO register
+ *          FALSE               :   Other register
+ */
+static boolean sim_gpio_port_of(uint32_t_ u32_addr, uint8_t_ * ptr_u8_port)
+{
+    boolean bool_gpio = TRUE;
+
+    if((SIM_GPIO_APB_LOW <= u32_addr) &&
+       ((SIM_GPIO_APB_LOW + (SIM_GPIO_APB_LOW_PORTS * SIM_GPIO_PORT_SIZE)) > u32_addr))
+    {
+        *ptr_u8_port = (uint8_t_)((u32_addr - SIM_GPIO_APB_LOW) / SIM_GPIO_PORT_SIZE);
+    }
+    else if((SIM_GPIO_APB_HIGH <= u32_addr) &&
+            ((SIM_GPIO_APB_HIGH + ((SIM_GPIO_PORTS - SIM_GPIO_APB_LOW_PORTS) * SIM_GPIO_PORT_SIZE)) > u32_addr))
+    {
+        *ptr_u8_port = (uint8_t_)(SIM_GPIO_APB_LOW_PORTS + ((u32_addr - SIM_GPIO_APB_HIGH) / SIM_GPIO_PORT_SIZE));
+    }
+    else
+    {
+        bool_gpio = FALSE;
+    }
+
+    return bool_gpio;
+}
+
+/**
+ * @brief                       :   Base address of a GPIO port
+ */
+static uint32_t_ sim_gpio_base(uint8_t_ u8_port)
+{
+    return (SIM_GPIO_APB_LOW_PORTS > u8_port) ?
+           (SIM_GPIO_APB_LOW + (u8_port * SIM_GPIO_PORT_SIZE)) :
+           (SIM_GPIO_APB_HIGH + ((u8_port - SIM_GPIO_APB_LOW_PORTS) * SIM_GPIO_PORT_SIZE));
+}
+
+/**
+ * @brief                       :   Re-evaluates the pins of a port, latches interrupt conditions
+ *                                  and reports a changed state to the listener
+ *
+ * @param[in]   u8_port         :   Port
+ */
+static void sim_gpio_eval(uint8_t_ u8_port)
+{
+    st_sim_gpio_t * ptr_st_gpio = &gl_arr_st_sim_gpio[u8_port];
+    uint32_t_ u32_base = sim_gpio_base(u8_port);
+    uint8_t_ u8_dir = (uint8_t_) sim_reg_value(u32_base + SIM_GPIO_DIR);
+    uint8_t_ u8_pur = (uint8_t_) sim_reg_value(u32_base + SIM_GPIO_PUR);
+    uint8_t_ u8_pdr = (uint8_t_) sim_reg_value(u32_base + SIM_GPIO_PDR);
+    uint8_t_ u8_is = (uint8_t_) sim_reg_value(u32_base + SIM_GPIO_IS);
+    uint8_t_ u8_ibe = (uint8_t_) sim_reg_value(u32_base + SIM_GPIO_IBE);
+    uint8_t_ u8_iev = (uint8_t_) sim_reg_value(u32_base + SIM_GPIO_IEV);
+    uint8_t_ u8_inputs = (uint8_t_) ~u8_dir;
+    st_sim_port_state_t_ st_state;
+    uint8_t_ u8_changed;
+    uint8_t_ u8_rising;
+    uint8_t_ u8_listener;
+
+    // outputs drive the latch, inputs follow the external drive, else their pull
+    st_state.u8_dir = u8_dir;
+    st_state.u8_levels = (uint8_t_)((ptr_st_gpio->u8_latch & u8_dir) |
+                                    (ptr_st_gpio->u8_input & ptr_st_gpio->u8_input_driven & u8_inputs) |
+                                    (u8_pur & ~ptr_st_gpio->u8_input_driven & u8_inputs));
+    st_state.u8_driven = (uint8_t_)(u8_dir | ((ptr_st_gpio->u8_input_driven | u8_pur | u8_pdr) & u8_inputs));
+
+    u8_changed = st_state.u8_levels ^ ptr_st_gpio->st_state.u8_levels;
+    u8_rising = u8_changed & st_state.u8_levels;
+
+    // edge sensed pins: both edges, else the IEV edge
+    ptr_st_gpio->u8_ris |= (uint8_t_)(u8_changed & ~u8_is & (u8_ibe | ~(u8_rising ^ u8_iev)));
+    // level sensed pins: while at the IEV level
+    ptr_st_gpio->u8_ris |= (uint8_t_)(u8_is & ~(st_state.u8_levels ^ u8_iev));
+
+    if(
+            (st_state.u8_levels != ptr_st_gpio->st_state.u8_levels) ||
+            (st_state.u8_driven != ptr_st_gpio->st_state.u8_driven) ||
+            (st_state.u8_dir != ptr_st_gpio->st_state.u8_dir)
+            )
+    {
+        ptr_st_gpio->st_state = st_state;
+
+        for(u8_listener = 0; u8_listener < SIM_LISTENERS_MAX; u8_listener++)
+        {
+            if(NULL_PTR != gl_arr_ptr_sim_listeners[u8_listener])
+            {
+                gl_arr_ptr_sim_listeners[u8_listener](u8_port, &ptr_st_gpio->st_state);
+            }
+        }
+    }
+}
+
+/**
+ * @brief                       :   Side effects of a driver write to a GPIO register
+ *
+ * @param[in]   u8_port         :   Port
+ * @param[in]   u32_offset      :   Register offset in the port
+ * @param[in]   u32_value       :   Written value
+ */
+static void sim_gpio_write(uint8_t_ u8_port, uint32_t_ u32_offset, uint32_t_ u32_value)
+{
+    st_sim_gpio_t * ptr_st_gpio = &gl_arr_st_sim_gpio[u8_port];
+    uint32_t_ u32_base = sim_gpio_base(u8_port);
+    uint8_t_ u8_mask;
+
+    if(SIM_GPIO_DATA_END > u32_offset)
+    {
+        // only the pins selected by the address bits are written
+        u8_mask = (uint8_t_)(u32_offset >> SIM_GPIO_DATA_MASK_POS);
+        ptr_st_gpio->u8_latch = (uint8_t_)((ptr_st_gpio->u8_latch & ~u8_mask) | (u32_value & u8_mask));
+    }
+    else if(SIM_GPIO_ICR == u32_offset)
+    {
+        ptr_st_gpio->u8_ris &= (uint8_t_) ~u32_value;
+    }
+    else if(SIM_GPIO_PUR == u32_offset)
+    {
+        // setting a pull up clears the pin's pull down and the other way round
+        sim_reg_set(u32_base + SIM_GPIO_PDR, sim_reg_value(u32_base + SIM_GPIO_PDR) & ~u32_value);
+    }
+    else if(SIM_GPIO_PDR == u32_offset)
+    {
+        sim_reg_set(u32_base + SIM_GPIO_PUR, sim_reg_value(u32_base + SIM_GPIO_PUR) & ~u32_value);
+    }
+    else
+    {
+        /* plain register */
+    }
+
+    sim_gpio_eval(u8_port);
+}
+
+/**
+ * @brief                       :   Refreshes the value a GPIO register reads
+ *
+ * @param[in]   u8_port         :   Port
+ * @param[in]   ptr_st_slot     :   Register slot
+ */
+static void sim_gpio_read(uint8_t_ u8_port, st_sim_slot_t * ptr_st_slot)
+{
+    st_sim_gpio_t * ptr_st_gpio = &gl_arr_st_sim_gpio[u8_port];
+    uint32_t_ u32_offset = ptr_st_slot->u32_addr & SIM_GPIO_PORT_MASK;
+    uint32_t_ u32_base = sim_gpio_base(u8_port);
+
+    if(ZERO == (sim_reg_value(SIM_RCGCGPIO) & (1UL << u8_port)))
+    {
+        // a bus fault on the target
+        if(ZERO == (gl_u8_sim_gated_reported & (1 << u8_port)))
+        {
+            gl_u8_sim_gated_reported |= (uint8_t_)(1 << u8_port);
+            fprintf(stderr, "sim: GPIO port %c accessed with its clock gated (RCGCGPIO)\n", 'A' + u8_port);
+        }
+    }
+
+    if(SIM_GPIO_DATA_END > u32_offset)
+    {
+        ptr_st_slot->u32_value = ptr_st_gpio->st_state.u8_levels &
+                                 sim_reg_value(u32_base + SIM_GPIO_DEN) &
+                                 (u32_offset >> SIM_GPIO_DATA_MASK_POS);
+    }
+    else if(SIM_GPIO_RIS == u32_offset)
+    {
+        ptr_st_slot->u32_value = ptr_st_gpio->u8_ris;
+    }
+    else if(SIM_GPIO_MIS == u32_offset)
+    {
+        ptr_st_slot->u32_value = ptr_st_gpio->u8_ris & sim_reg_value(u32_base + SIM_GPIO_IM);
+    }
+    else if(SIM_GPIO_ICR == u32_offset)
+    {
+        ptr_st_slot->u32_value = 0;
+    }
+    else
+    {
+        /* plain register */
+    }
+
+    ptr_st_slot->u32_seen = ptr_st_slot->u32_value;
+}
+
+/**
+ * @brief                       :   Converts counter ticks to nanoseconds, rounded up so a wrap is never early
+ */
+static uint64_t_ sim_ticks_to_ns(uint64_t_ u64_ticks, uint32_t_ u32_hz)
+{
+    // split so ticks * 10^9 can't overflow
+    return ((u64_ticks / u32_hz) * SIM_NS_PER_S) + ((((u64_ticks % u32_hz) * SIM_NS_PER_S) + u32_hz - 1) / u32_hz);
+}
+
+/**
+ * @brief                       :   Converts nanoseconds to elapsed counter ticks
+ */
+static uint64_t_ sim_ns_to_ticks(uint64_t_ u64_ns, uint32_t_ u32_hz)
+{
+    return ((u64_ns / SIM_NS_PER_S) * u32_hz) + (((u64_ns % SIM_NS_PER_S) * u32_hz) / SIM_NS_PER_S);
+}
+
+/**
+ * @brief                       :   Starts a count down
+ *
+ * @param[out]  ptr_st_counter  :   Counter
+ * @param[in]   u64_at_ns       :   Time the count starts, a wrap time keeps reloads free of drift
+ * @param[in]   u32_hz          :   Counter clock
+ * @param[in]   u64_ticks       :   Ticks to the wrap, start value + 1, 0: never wraps
+ */
+static void sim_counter_start(st_sim_counter_t * ptr_st_counter, uint64_t_ u64_at_ns, uint32_t_ u32_hz, uint64_t_ u64_ticks)
+{
+    ptr_st_counter->bool_running = TRUE;
+    ptr_st_counter->u32_hz = u32_hz;
+    ptr_st_counter->u64_ticks = u64_ticks;
+    ptr_st_counter->u64_start_ns = u64_at_ns;
+    ptr_st_counter->u64_wrap_ns = (ZERO == u64_ticks) ? SIM_TIME_NEVER : (u64_at_ns + sim_ticks_to_ns(u64_ticks, u32_hz));
+}
+
+/**
+ * @brief                       :   Reads the value of a running count down
+ */
+static uint32_t_ sim_counter_value(const st_sim_counter_t * ptr_st_counter)
+{
+    uint64_t_ u64_elapsed = sim_ns_to_ticks(gl_u64_sim_now_ns - ptr_st_counter->u64_start_ns, ptr_st_counter->u32_hz);
+
+    return (uint32_t_)((u64_elapsed < ptr_st_counter->u64_ticks) ? (ptr_st_counter->u64_ticks - 1 - u64_elapsed) : 0);
+}
+
+/**
+ * @brief                       :   (Re)starts SysTick from STRELOAD, the drivers clear STCURRENT before
+ *                                  enabling so a count always starts at the reload value
+ *
+ * @param[in]   u64_at_ns       :   Time the count starts
+ */
+static void sim_systick_start(uint64_t_ u64_at_ns)
+{
+    uint32_t_ u32_hz = (ZERO != (gl_st_sim_systick.u32_ctrl & SIM_STCTRL_CLKSOURCE)) ?
+                       SystemCoreClock : (SIM_PIOSC_HZ / SIM_ST_PIOSC_DIV);
+    uint32_t_ u32_reload = sim_reg_value(SIM_STRELOAD) & SIM_STRELOAD_MASK;
+
+    // a reload of 0 stops the counter at its next wrap
+    sim_counter_start(&gl_st_sim_systick.st_counter, u64_at_ns, u32_hz, (ZERO == u32_reload) ? 0 : (u32_reload + 1ULL));
+}
+
+/**
+ * @brief                       :   SysTick reached 0: sets COUNT, pends the exception and reloads
+ */
+static void sim_systick_wrap(void)
+{
+    gl_st_sim_systick.bool_count = TRUE;
+
+    if(ZERO != (gl_st_sim_systick.u32_ctrl & SIM_STCTRL_TICKINT))
+    {
+        gl_st_sim_systick.bool_pending = TRUE;
+    }
+
+    // a changed STRELOAD applies from here
+    sim_systick_start(gl_st_sim_systick.st_counter.u64_wrap_ns);
+}
+
+/**
+ * @brief                       :   Side effects of a driver write to a SysTick register
+ */
+static void sim_systick_write(uint32_t_ u32_addr, uint32_t_ u32_value)
+{
+    uint32_t_ u32_changed;
+
+    if(SIM_STCTRL == u32_addr)
+    {
+        // COUNT is read only
+        u32_changed = (u32_value ^ gl_st_sim_systick.u32_ctrl) & SIM_STCTRL_BITS;
+        gl_st_sim_systick.u32_ctrl = u32_value & SIM_STCTRL_BITS;
+
+        if(ZERO != (gl_st_sim_systick.u32_ctrl & SIM_STCTRL_ENABLE))
+        {
+            if(ZERO != (u32_changed & (SIM_STCTRL_ENABLE | SIM_STCTRL_CLKSOURCE)))
+            {
+                sim_systick_start(gl_u64_sim_now_ns);
+            }
+        }
+        else if(TRUE == gl_st_sim_systick.st_counter.bool_running)
+        {
+            // stopped, STCURRENT holds its value
+            sim_reg_set(SIM_STCURRENT, sim_counter_value(&gl_st_sim_systick.st_counter));
+            gl_st_sim_systick.st_counter.bool_running = FALSE;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+    else if(SIM_STCURRENT == u32_addr)
+    {
+        // any write clears the counter and COUNT
+        gl_st_sim_systick.bool_count = FALSE;
+        sim_reg_set(SIM_STCURRENT, 0);
+
+        if(TRUE == gl_st_sim_systick.st_counter.bool_running)
+        {
+            sim_systick_start(gl_u64_sim_now_ns);
+        }
+    }
+    else
+    {
+        /* plain register */
+    }
+}
+
+/**
+ * @brief                       :   Refreshes the value a SysTick register reads, reading STCTRL clears COUNT
+ */
+static void sim_systick_read(st_sim_slot_t * ptr_st_slot)
+{
+    if(SIM_STCTRL == ptr_st_slot->u32_addr)
+    {
+        ptr_st_slot->u32_value = gl_st_sim_systick.u32_ctrl | ((TRUE == gl_st_sim_systick.bool_count) ? SIM_STCTRL_COUNT : 0);
+        gl_st_sim_systick.bool_count = FALSE;
+    }
+    else if((SIM_STCURRENT == ptr_st_slot->u32_addr) && (TRUE == gl_st_sim_systick.st_counter.bool_running))
+    {
+        ptr_st_slot->u32_value = sim_counter_value(&gl_st_sim_systick.st_counter);
+    }
+    else
+    {
+        /* plain register */
+    }
+}
+
+/**
+ * @brief                       :   Maps an address to its timer
+ *
+ * @return  TRUE                :   Timer register
+ *          FALSE               :   Other register
+ */
+static boolean sim_timer_of(uint32_t_ u32_addr, uint8_t_ * ptr_u8_timer)
+{
+    boolean bool_timer = FALSE;
+
+    if((SIM_TIMER_BASE <= u32_addr) && ((SIM_TIMER_BASE + (SIM_TIMERS * SIM_TIMER_SIZE)) > u32_addr))
+    {
+        *ptr_u8_timer = (uint8_t_)((u32_addr - SIM_TIMER_BASE) / SIM_TIMER_SIZE);
+        bool_timer = TRUE;
+    }
+
+    return bool_timer;
+}
+
+/**
+ * @brief                       :   Timer A reached 0: latches the time-out, reloads GPTMTAILR, a one-shot
+ *                                  timer stops and clears TAEN
+ */
+static void sim_timer_timeout(uint8_t_ u8_timer)
+{
+    st_sim_timer_t * ptr_st_timer = &gl_arr_st_sim_timers[u8_timer];
+    uint32_t_ u32_base = SIM_TIMER_BASE + (u8_timer * SIM_TIMER_SIZE);
+
+    ptr_st_timer->u32_ris |= SIM_GPTM_TATO;
+
+    if(SIM_GPTM_TAMR_ONE_SHOT == (sim_reg_value(u32_base + SIM_GPTM_TAMR) & SIM_GPTM_TAMR_MODE))
+    {
+        ptr_st_timer->st_counter.bool_running = FALSE;
+        sim_reg_set(u32_base + SIM_GPTM_TAV, sim_reg_value(u32_base + SIM_GPTM_TAILR));
+        sim_reg_set(u32_base + SIM_GPTM_CTL, sim_reg_value(u32_base + SIM_GPTM_CTL) & ~SIM_GPTM_TAEN);
+    }
+    else
+    {
+        sim_counter_start(&ptr_st_timer->st_counter, ptr_st_timer->st_counter.u64_wrap_ns,
+                          SystemCoreClock, sim_reg_value(u32_base + SIM_GPTM_TAILR) + 1ULL);
+    }
+}
+
+/**
+ * @brief                       :   Side effects of a driver write to a timer register
+ */
+static void sim_timer_write(uint8_t_ u8_timer, uint32_t_ u32_offset, uint32_t_ u32_value)
+{
+    st_sim_timer_t * ptr_st_timer = &gl_arr_st_sim_timers[u8_timer];
+    uint32_t_ u32_base = SIM_TIMER_BASE + (u8_timer * SIM_TIMER_SIZE);
+
+    if(SIM_GPTM_CTL == u32_offset)
+    {
+        if((ZERO != (u32_value & SIM_GPTM_TAEN)) && (FALSE == ptr_st_timer->st_counter.bool_running))
+        {
+            // counts down from GPTMTAV
+            sim_counter_start(&ptr_st_timer->st_counter, gl_u64_sim_now_ns,
+                              SystemCoreClock, sim_reg_value(u32_base + SIM_GPTM_TAV) + 1ULL);
+        }
+        else if((ZERO == (u32_value & SIM_GPTM_TAEN)) && (TRUE == ptr_st_timer->st_counter.bool_running))
+        {
+            sim_reg_set(u32_base + SIM_GPTM_TAV, sim_counter_value(&ptr_st_timer->st_counter));
+            ptr_st_timer->st_counter.bool_running = FALSE;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+    else if(SIM_GPTM_ICR == u32_offset)
+    {
+        ptr_st_timer->u32_ris &= ~u32_value;
+    }
+    else if((SIM_GPTM_TAV == u32_offset) && (TRUE == ptr_st_timer->st_counter.bool_running))
+    {
+        sim_counter_start(&ptr_st_timer->st_counter, gl_u64_sim_now_ns, SystemCoreClock, u32_value + 1ULL);
+    }
+    else
+    {
+        /* plain register, a GPTMTAILR write applies at the next time-out */
+    }
+}
+
+/**
+ * @brief                       :   Refreshes the value a timer register reads
+ */
+static void sim_timer_read(uint8_t_ u8_timer, st_sim_slot_t * ptr_st_slot)
+{
+    st_sim_timer_t * ptr_st_timer = &gl_arr_st_sim_timers[u8_timer];
+    uint32_t_ u32_offset = ptr_st_slot->u32_addr & SIM_TIMER_MASK;
+    uint32_t_ u32_base = SIM_TIMER_BASE + (u8_timer * SIM_TIMER_SIZE);
+
+    if(SIM_GPTM_RIS == u32_offset)
+    {
+        ptr_st_slot->u32_value = ptr_st_timer->u32_ris;
+    }
+    else if(SIM_GPTM_MIS == u32_offset)
+    {
+        ptr_st_slot->u32_value = ptr_st_timer->u32_ris & sim_reg_value(u32_base + SIM_GPTM_IMR);
+    }
+    else if(SIM_GPTM_ICR == u32_offset)
+    {
+        ptr_st_slot->u32_value = 0;
+    }
+    else if(((SIM_GPTM_TAV == u32_offset) || (SIM_GPTM_TAR == u32_offset)) && (TRUE == ptr_st_timer->st_counter.bool_running))
+    {
+        ptr_st_slot->u32_value = sim_counter_value(&ptr_st_timer->st_counter);
+    }
+    else
+    {
+        /* plain register */
+    }
+}
+
+/**
+ * @brief                       :   Reads the DWT cycle counter, SystemCoreClock cycles of virtual time modulo 2^32
+ */
+static uint32_t_ sim_dwt_cycles(void)
+{
+    return (uint32_t_)((gl_st_sim_dwt.u32_base +
+                        sim_ns_to_ticks(gl_u64_sim_now_ns - gl_st_sim_dwt.u64_start_ns, SystemCoreClock)) & SIM_DWT_CYCCNT_MASK);
+}
+
+/**
+ * @brief                       :   Side effects of a driver write to a DWT register
+ */
+static void sim_dwt_write(uint32_t_ u32_addr, uint32_t_ u32_value)
+{
+    if(SIM_DWT_CTRL == u32_addr)
+    {
+        if((ZERO != (u32_value & SIM_DWT_CYCCNTENA)) && (FALSE == gl_st_sim_dwt.bool_running))
+        {
+            gl_st_sim_dwt.u32_base = sim_reg_value(SIM_DWT_CYCCNT);
+            gl_st_sim_dwt.u64_start_ns = gl_u64_sim_now_ns;
+            gl_st_sim_dwt.bool_running = TRUE;
+        }
+        else if((ZERO == (u32_value & SIM_DWT_CYCCNTENA)) && (TRUE == gl_st_sim_dwt.bool_running))
+        {
+            sim_reg_set(SIM_DWT_CYCCNT, sim_dwt_cycles());
+            gl_st_sim_dwt.bool_running = FALSE;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+    else if(SIM_DWT_CYCCNT == u32_addr)
+    {
+        gl_st_sim_dwt.u32_base = u32_value;
+        gl_st_sim_dwt.u64_start_ns = gl_u64_sim_now_ns;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+/**
+ * @brief                       :   Time of one UART0 frame at the programmed baud rate
+ *
+ * @return  nanoseconds, 0: baud rate not programmed
+ */
+static uint64_t_ sim_uart_frame_ns(void)
+{
+    uint64_t_ u64_div64 = (sim_reg_value(SIM_UART0_IBRD) << SIM_UART_FBRD_BITS) +
+                          (sim_reg_value(SIM_UART0_FBRD) & SIM_UART_FBRD_MASK);
+    uint64_t_ u64_clk_div = (ZERO != (sim_reg_value(SIM_UART0_CTL) & SIM_UARTCTL_HSE)) ?
+                            SIM_UART_CLK_DIV_HSE : SIM_UART_CLK_DIV;
+
+    // baud = SysClk * 64 / (div * divisor64)
+    return (SIM_UART_FRAME_BITS * u64_clk_div * u64_div64 * SIM_NS_PER_S) /
+           ((uint64_t_) SystemCoreClock << SIM_UART_FBRD_BITS);
+}
+
+/**
+ * @brief                       :   Checks that a UART0 direction runs with its uDMA channel enabled
+ *
+ * @param[in]   u32_ctl_dir     :   SIM_UARTCTL_TXE or SIM_UARTCTL_RXE
+ * @param[in]   u32_dmae        :   SIM_UARTDMACTL_TXDMAE or SIM_UARTDMACTL_RXDMAE
+ * @param[in]   u8_channel      :   uDMA channel of the direction
+ *
+ * @return  TRUE                :   Bytes move through the channel
+ *          FALSE               :   Direction, its requests, the channel or the controller off
+ */
+static boolean sim_uart_dma_ready(uint32_t_ u32_ctl_dir, uint32_t_ u32_dmae, uint8_t_ u8_channel)
+{
+    uint32_t_ u32_ctl = sim_reg_value(SIM_UART0_CTL);
+
+    return (
+            (ZERO != (gl_st_sim_udma.u32_enabled & (1UL << u8_channel)))    &&
+            (ZERO != (u32_ctl & SIM_UARTCTL_UARTEN))                        &&
+            (ZERO != (u32_ctl & u32_ctl_dir))                               &&
+            (ZERO != (sim_reg_value(SIM_UART0_DMACTL) & u32_dmae))          &&
+            (ZERO != (sim_reg_value(SIM_DMACFG) & SIM_DMACFG_MASTEN))       &&
+            (ZERO != sim_uart_frame_ns())
+            ) ? TRUE : FALSE;
+}
+
+/**
+ * @brief                       :   Moves one 8 or 16-bit item through the active control structure of a
+ *                                  channel; at the end of the transfer the structure reads STOP, the
+ *                                  completion is flagged and a ping-pong transfer goes on with the
+ *                                  other structure unless it is stopped too, else the channel is disabled
+ *
+ * @param[in]       u8_channel  :   uDMA channel
+ * @param[in,out]   ptr_u16_item:   Item, read from the source, written to the destination
+ *                                  (the side that doesn't increment is the peripheral)
+ */
+static void sim_udma_item(uint8_t_ u8_channel, uint16_t_ * ptr_u16_item)
+{
+    st_sim_udma_entry_t * ptr_st_table = (st_sim_udma_entry_t *) sim_reg_value(SIM_DMACTLBASE);
+    uint32_t_ u32_mask = 1UL << u8_channel;
+    st_sim_udma_entry_t * ptr_st_entry =
+            &ptr_st_table[((ZERO != (gl_st_sim_udma.u32_alt & u32_mask)) ? SIM_UDMA_CHANNELS : 0) + u8_channel];
+    uint32_t_ u32_control = ptr_st_entry->u32_control;
+    uint32_t_ u32_left = ((u32_control >> SIM_UDMA_XFERSIZE_POS) & SIM_UDMA_XFERSIZE_MASK) + 1;
+    uint32_t_ u32_src_inc = (u32_control >> SIM_UDMA_SRCINC_POS) & SIM_UDMA_INC_MASK;
+    uint32_t_ u32_dst_inc = (u32_control >> SIM_UDMA_DSTINC_POS) & SIM_UDMA_INC_MASK;
+    boolean bool_16_bit = (SIM_UDMA_SIZE_16 == ((u32_control >> SIM_UDMA_SIZE_POS) & SIM_UDMA_SIZE_MASK));
+    uint32_t_ u32_addr;
+
+    // end pointers address the last item
+    if(SIM_UDMA_INC_NONE != u32_src_inc)
+    {
+        u32_addr = ptr_st_entry->u32_src_end - ((u32_left - 1) << u32_src_inc);
+        *ptr_u16_item = (TRUE == bool_16_bit) ? *(const uint16_t_ *) u32_addr : *(const uint8_t_ *) u32_addr;
+    }
+    if(SIM_UDMA_INC_NONE != u32_dst_inc)
+    {
+        u32_addr = ptr_st_entry->u32_dst_end - ((u32_left - 1) << u32_dst_inc);
+        if(TRUE == bool_16_bit)
+        {
+            *(uint16_t_ *) u32_addr = *ptr_u16_item;
+        }
+        else
+        {
+            *(uint8_t_ *) u32_addr = (uint8_t_) *ptr_u16_item;
+        }
+    }
+
+    if(1 < u32_left)
+    {
+        ptr_st_entry->u32_control = (u32_control & ~(SIM_UDMA_XFERSIZE_MASK << SIM_UDMA_XFERSIZE_POS)) |
+                                    ((u32_left - 2) << SIM_UDMA_XFERSIZE_POS);
+    }
+    else
+    {
+        ptr_st_entry->u32_control = u32_control & ~((SIM_UDMA_XFERSIZE_MASK << SIM_UDMA_XFERSIZE_POS) | SIM_UDMA_MODE_MASK);
+        gl_st_sim_udma.u32_chis |= u32_mask;
+
+        if(SIM_UDMA_MODE_PING_PONG == (u32_control & SIM_UDMA_MODE_MASK))
+        {
+            gl_st_sim_udma.u32_alt ^= u32_mask;
+            ptr_st_entry = &ptr_st_table[((ZERO != (gl_st_sim_udma.u32_alt & u32_mask)) ? SIM_UDMA_CHANNELS : 0) + u8_channel];
+        }
+
+        if(SIM_UDMA_MODE_STOP == (ptr_st_entry->u32_control & SIM_UDMA_MODE_MASK))
+        {
+            gl_st_sim_udma.u32_enabled &= ~u32_mask;
+        }
+    }
+}
+
+/**
+ * @brief                       :   Side effects of a driver write to a uDMA register
+ */
+static void sim_udma_write(uint32_t_ u32_addr, uint32_t_ u32_value)
+{
+    if(SIM_DMAENASET == u32_addr)
+    {
+        gl_st_sim_udma.u32_enabled |= u32_value;
+    }
+    else if(SIM_DMAENACLR == u32_addr)
+    {
+        gl_st_sim_udma.u32_enabled &= ~u32_value;
+    }
+    else if(SIM_DMAALTSET == u32_addr)
+    {
+        gl_st_sim_udma.u32_alt |= u32_value;
+    }
+    else if(SIM_DMAALTCLR == u32_addr)
+    {
+        gl_st_sim_udma.u32_alt &= ~u32_value;
+    }
+    else if(SIM_DMACHIS == u32_addr)
+    {
+        gl_st_sim_udma.u32_chis &= ~u32_value;
+    }
+    else
+    {
+        /* plain register */
+    }
+}
+
+/**
+ * @brief                       :   Refreshes the value a uDMA register reads, the *CLR registers read 0
+ */
+static void sim_udma_read(st_sim_slot_t * ptr_st_slot)
+{
+    if(SIM_DMAENASET == ptr_st_slot->u32_addr)
+    {
+        ptr_st_slot->u32_value = gl_st_sim_udma.u32_enabled;
+    }
+    else if(SIM_DMAALTSET == ptr_st_slot->u32_addr)
+    {
+        ptr_st_slot->u32_value = gl_st_sim_udma.u32_alt;
+    }
+    else if(SIM_DMACHIS == ptr_st_slot->u32_addr)
+    {
+        ptr_st_slot->u32_value = gl_st_sim_udma.u32_chis | SIM_DMACHIS_READ_MARK;
+    }
+    else if((SIM_DMAENACLR == ptr_st_slot->u32_addr) || (SIM_DMAALTCLR == ptr_st_slot->u32_addr))
+    {
+        ptr_st_slot->u32_value = 0;
+    }
+    else
+    {
+        /* plain register */
+    }
+}
+
+/**
+ * @brief                       :   Starts sending the next byte of the TX transfer if TX is idle
+ *
+ * @param[in]   u64_at_ns       :   Time the byte starts, the end of the previous one keeps the line busy
+ */
+static void sim_uart_tx_next(uint64_t_ u64_at_ns)
+{
+    uint16_t_ u16_item;
+
+    if(
+            (SIM_TIME_NEVER == gl_st_sim_uart.u64_tx_done_ns)                                                   &&
+            (TRUE == sim_uart_dma_ready(SIM_UARTCTL_TXE, SIM_UARTDMACTL_TXDMAE, SIM_UDMA_CH_UART0_TX))
+            )
+    {
+        sim_udma_item(SIM_UDMA_CH_UART0_TX, &u16_item);
+        gl_st_sim_uart.u8_tx_byte = (uint8_t_) u16_item;
+        gl_st_sim_uart.u64_tx_done_ns = u64_at_ns + sim_uart_frame_ns();
+    }
+}
+
+/**
+ * @brief                       :   A byte was sent: tells the listener, starts the next one
+ */
+static void sim_uart_tx_done(void)
+{
+    uint64_t_ u64_done_ns = gl_st_sim_uart.u64_tx_done_ns;
+
+    gl_st_sim_uart.u64_tx_done_ns = SIM_TIME_NEVER;
+
+    if(NULL_PTR != gl_ptr_sim_uart_listener)
+    {
+        gl_ptr_sim_uart_listener(gl_st_sim_uart.u8_tx_byte);
+    }
+
+    sim_uart_tx_next(u64_done_ns);
+}
+
+/**
+ * @brief                       :   A byte was received: the RX transfer takes it, else it is lost
+ */
+static void sim_uart_rx_done(void)
+{
+    uint16_t_ u16_byte = gl_st_sim_uart.arr_u8_rx[gl_st_sim_uart.u16_rx_head];
+
+    gl_st_sim_uart.u16_rx_head = (gl_st_sim_uart.u16_rx_head + 1) % SIM_UART_RX_MAX;
+    gl_st_sim_uart.u16_rx_count--;
+
+    if(TRUE == sim_uart_dma_ready(SIM_UARTCTL_RXE, SIM_UARTDMACTL_RXDMAE, SIM_UDMA_CH_UART0_RX))
+    {
+        sim_udma_item(SIM_UDMA_CH_UART0_RX, &u16_byte);
+    }
+    else
+    {
+        gl_st_sim_uart.u32_rx_lost++;
+    }
+
+    gl_st_sim_uart.u64_rx_done_ns = (ZERO == gl_st_sim_uart.u16_rx_count) ?
+                                    SIM_TIME_NEVER : (gl_st_sim_uart.u64_rx_done_ns + sim_uart_frame_ns());
+}
+
+/**
+ * @brief                       :   Maps an address to its SSI module
+ *
+ * @param[in]   u32_addr        :   Register address
+ * @param[out]  ptr_u8_ssi      :   Pointer to store the module in
+ *
+ * @return  TRUE                :   SSI register
+ *          FALSE               :   Other register
+ */
+static boolean sim_ssi_of(uint32_t_ u32_addr, uint8_t_ * ptr_u8_ssi)
+{
+    boolean bool_retval = FALSE;
+
+    if((SIM_SSI_BASE <= u32_addr) && ((SIM_SSI_BASE + (SIM_SSIS * SIM_SSI_SIZE)) > u32_addr))
+    {
+        *ptr_u8_ssi = (uint8_t_) ((u32_addr - SIM_SSI_BASE) / SIM_SSI_SIZE);
+        bool_retval = TRUE;
+    }
+
+    return bool_retval;
+}
+
+/**
+ * @brief                       :   Time of one frame of an SSI module at its programmed bit rate
+ *
+ * @param[in]   u8_ssi          :   SSI module
+ *
+ * @return  nanoseconds, 0: bit rate not programmed
+ */
+static uint64_t_ sim_ssi_frame_ns(uint8_t_ u8_ssi)
+{
+    uint32_t_ u32_base = SIM_SSI_BASE + (u8_ssi * SIM_SSI_SIZE);
+    uint32_t_ u32_cr0 = sim_reg_value(u32_base + SIM_SSI_CR0);
+    uint64_t_ u64_bits = (u32_cr0 & SIM_SSICR0_DSS_MASK) + 1;
+    uint64_t_ u64_clk_div = (sim_reg_value(u32_base + SIM_SSI_CPSR) & SIM_SSICPSR_MASK) *
+                            (((u32_cr0 >> SIM_SSICR0_SCR_POS) & SIM_SSICR0_SCR_MASK) + 1);
+    uint64_t_ u64_hz = (SIM_SSICC_PIOSC == sim_reg_value(u32_base + SIM_SSI_CC)) ? SIM_PIOSC_HZ : SystemCoreClock;
+
+    // bit rate = SSI clock / (CPSDVSR * (1 + SCR))
+    return (u64_bits * u64_clk_div * SIM_NS_PER_S) / u64_hz;
+}
+
+/**
+ * @brief                       :   Starts sending the next frame of an SSI module's TX transfer if it is idle
+ *
+ * @param[in]   u8_ssi          :   SSI module
+ * @param[in]   u64_at_ns       :   Time the frame starts, the end of the previous one keeps the line busy
+ */
+static void sim_ssi_tx_next(uint8_t_ u8_ssi, uint64_t_ u64_at_ns)
+{
+    st_sim_ssi_t * ptr_st_ssi = &gl_arr_st_sim_ssi[u8_ssi];
+    uint32_t_ u32_base = SIM_SSI_BASE + (u8_ssi * SIM_SSI_SIZE);
+    uint8_t_ u8_channel = gl_arr_u8_sim_ssi_tx_channels[u8_ssi];
+
+    if(
+            (SIM_TIME_NEVER == ptr_st_ssi->u64_tx_done_ns)                                      &&
+            (ZERO != (gl_st_sim_udma.u32_enabled & (1UL << u8_channel)))                        &&
+            (ZERO != (sim_reg_value(u32_base + SIM_SSI_CR1) & SIM_SSICR1_SSE))                  &&
+            (ZERO != (sim_reg_value(u32_base + SIM_SSI_DMACTL) & SIM_SSIDMACTL_TXDMAE))         &&
+            (ZERO != (sim_reg_value(SIM_DMACFG) & SIM_DMACFG_MASTEN))                           &&
+            (ZERO != sim_ssi_frame_ns(u8_ssi))
+            )
+    {
+        sim_udma_item(u8_channel, &ptr_st_ssi->u16_tx_frame);
+        ptr_st_ssi->u16_tx_frame &= (uint16_t_) ((2UL << (sim_reg_value(u32_base + SIM_SSI_CR0) & SIM_SSICR0_DSS_MASK)) - 1);
+        ptr_st_ssi->u64_tx_done_ns = u64_at_ns + sim_ssi_frame_ns(u8_ssi);
+    }
+}
+
+/**
+ * @brief                       :   A frame was sent: tells the listener, starts the next one
+ *
+ * @param[in]   u8_ssi          :   SSI module
+ */
+static void sim_ssi_tx_done(uint8_t_ u8_ssi)
+{
+    st_sim_ssi_t * ptr_st_ssi = &gl_arr_st_sim_ssi[u8_ssi];
+    uint64_t_ u64_done_ns = ptr_st_ssi->u64_tx_done_ns;
+
+    ptr_st_ssi->u64_tx_done_ns = SIM_TIME_NEVER;
+
+    if(NULL_PTR != gl_ptr_sim_ssi_listener)
+    {
+        gl_ptr_sim_ssi_listener(u8_ssi, ptr_st_ssi->u16_tx_frame);
+    }
+
+    sim_ssi_tx_next(u8_ssi, u64_done_ns);
+}
+
+/**
+ * @brief                       :   Tells the access listener about the last register access, a write
+ *                                  when its slot changed since it was read
+ */
+static void sim_access_resolve(void)
+{
+    st_sim_slot_t * ptr_st_slot = gl_ptr_st_sim_access_slot;
+
+    if(NULL_PTR != ptr_st_slot)
+    {
+        gl_ptr_st_sim_access_slot = NULL_PTR;
+
+        if(NULL_PTR != gl_ptr_sim_access_listener)
+        {
+            gl_ptr_sim_access_listener(ptr_st_slot->u32_addr, gl_ptr_str_sim_access_file, gl_u32_sim_access_line,
+                                       (ptr_st_slot->u32_value != ptr_st_slot->u32_seen));
+        }
+    }
+}
+
+/**
+ * @brief                       :   Applies the side effects of every driver write since the last commit
+ */
+static void sim_commit(void)
+{
+    uint16_t_ u16_slot;
+    uint8_t_ u8_unit;
+    st_sim_slot_t * ptr_st_slot;
+
+    sim_access_resolve();
+
+    for(u16_slot = 0; u16_slot < gl_u16_sim_slots_used; u16_slot++)
+    {
+        ptr_st_slot = &gl_arr_st_sim_slots[u16_slot];
+
+        if(ptr_st_slot->u32_value != ptr_st_slot->u32_seen)
+        {
+            ptr_st_slot->u32_seen = ptr_st_slot->u32_value;
+
+            if(TRUE == sim_gpio_port_of(ptr_st_slot->u32_addr, &u8_unit))
+            {
+                sim_gpio_write(u8_unit, ptr_st_slot->u32_addr & SIM_GPIO_PORT_MASK, ptr_st_slot->u32_value);
+            }
+            else if(TRUE == sim_timer_of(ptr_st_slot->u32_addr, &u8_unit))
+            {
+                sim_timer_write(u8_unit, ptr_st_slot->u32_addr & SIM_TIMER_MASK, ptr_st_slot->u32_value);
+            }
+            else if((SIM_STCTRL <= ptr_st_slot->u32_addr) && (SIM_STCURRENT >= ptr_st_slot->u32_addr))
+            {
+                sim_systick_write(ptr_st_slot->u32_addr, ptr_st_slot->u32_value);
+            }
+            else if((SIM_UDMA_BASE <= ptr_st_slot->u32_addr) && (SIM_UDMA_END > ptr_st_slot->u32_addr))
+            {
+                sim_udma_write(ptr_st_slot->u32_addr, ptr_st_slot->u32_value);
+            }
+            else
+            {
+                sim_dwt_write(ptr_st_slot->u32_addr, ptr_st_slot->u32_value);
+            }
+        }
+    }
+
+    // a write may have enabled TX
+    sim_uart_tx_next(gl_u64_sim_now_ns);
+    for(u8_unit = 0; u8_unit < SIM_SSIS; u8_unit++)
+    {
+        sim_ssi_tx_next(u8_unit, gl_u64_sim_now_ns);
+    }
+}
+
+/**
+ * @brief                       :   Refreshes the value a register reads
+ *
+ * @param[in]   ptr_st_slot     :   Register slot
+ */
+static void sim_read(st_sim_slot_t * ptr_st_slot)
+{
+    uint32_t_ u32_addr = ptr_st_slot->u32_addr;
+    uint8_t_ u8_unit;
+
+    if(TRUE == sim_gpio_port_of(u32_addr, &u8_unit))
+    {
+        sim_gpio_read(u8_unit, ptr_st_slot);
+    }
+    else if(TRUE == sim_timer_of(u32_addr, &u8_unit))
+    {
+        sim_timer_read(u8_unit, ptr_st_slot);
+    }
+    else if((SIM_STCTRL <= u32_addr) && (SIM_STCURRENT >= u32_addr))
+    {
+        sim_systick_read(ptr_st_slot);
+    }
+    else if((SIM_DWT_CYCCNT == u32_addr) && (TRUE == gl_st_sim_dwt.bool_running))
+    {
+        ptr_st_slot->u32_value = sim_dwt_cycles();
+    }
+    else if((SIM_UDMA_BASE <= u32_addr) && (SIM_UDMA_END > u32_addr))
+    {
+        sim_udma_read(ptr_st_slot);
+    }
+    else if(SIM_UART0_FR == u32_addr)
+    {
+        // uDMA keeps the RX FIFO empty
+        ptr_st_slot->u32_value = SIM_UARTFR_RXFE |
+                                 ((SIM_TIME_NEVER == gl_st_sim_uart.u64_tx_done_ns) ? SIM_UARTFR_TXFE : SIM_UARTFR_BUSY);
+    }
+    else if((TRUE == sim_ssi_of(u32_addr, &u8_unit)) && (SIM_SSI_SR == (u32_addr & SIM_SSI_MASK)))
+    {
+        // uDMA keeps the TX FIFO empty, the frame shifting out keeps the module busy
+        ptr_st_slot->u32_value = SIM_SSISR_TFE | SIM_SSISR_TNF |
+                                 ((SIM_TIME_NEVER == gl_arr_st_sim_ssi[u8_unit].u64_tx_done_ns) ? 0 : SIM_SSISR_BSY);
+    }
+    else if((SIM_RCGC_FIRST + SIM_PR_OFFSET <= u32_addr) && (SIM_RCGC_END + SIM_PR_OFFSET > u32_addr))
+    {
+        // peripherals are ready as soon as their clock runs
+        ptr_st_slot->u32_value = sim_reg_value(u32_addr - SIM_PR_OFFSET);
+    }
+    else
+    {
+        /* plain register */
+    }
+
+    ptr_st_slot->u32_seen = ptr_st_slot->u32_value;
+}
+
+/**
+ * @brief                       :   Reads the level of an interrupt line
+ *
+ * @param[in]   u16_irq         :   IRQ number
+ *
+ * @return  TRUE                :   Asserted
+ *          FALSE               :   Idle or not modelled
+ */
+static boolean sim_irq_line(uint16_t_ u16_irq)
+{
+    boolean bool_asserted = FALSE;
+    uint8_t_ u8_unit;
+
+    for(u8_unit = 0; u8_unit < SIM_GPIO_PORTS; u8_unit++)
+    {
+        if(gl_arr_u8_sim_gpio_irqs[u8_unit] == u16_irq)
+        {
+            bool_asserted = (ZERO != (gl_arr_st_sim_gpio[u8_unit].u8_ris &
+                                      sim_reg_value(sim_gpio_base(u8_unit) + SIM_GPIO_IM)));
+        }
+    }
+
+    for(u8_unit = 0; u8_unit < SIM_TIMERS; u8_unit++)
+    {
+        if(gl_arr_u8_sim_timer_irqs[u8_unit] == u16_irq)
+        {
+            bool_asserted = (ZERO != (gl_arr_st_sim_timers[u8_unit].u32_ris & SIM_GPTM_TATO &
+                                      sim_reg_value(SIM_TIMER_BASE + (u8_unit * SIM_TIMER_SIZE) + SIM_GPTM_IMR)));
+        }
+    }
+
+    // uDMA completions of a peripheral's channels raise the peripheral's line
+    if(SIM_UART0_IRQ == u16_irq)
+    {
+        bool_asserted = (ZERO != (gl_st_sim_udma.u32_chis & SIM_UDMA_UART0_CHANNELS));
+    }
+
+    for(u8_unit = 0; u8_unit < SIM_SSIS; u8_unit++)
+    {
+        if(gl_arr_u8_sim_ssi_irqs[u8_unit] == u16_irq)
+        {
+            bool_asserted = (ZERO != (gl_st_sim_udma.u32_chis & (1UL << gl_arr_u8_sim_ssi_tx_channels[u8_unit])));
+        }
+    }
+
+    return bool_asserted;
+}
+
+/**
+ * @brief                       :   Finds the pending exception to take next: SysTick, then the lowest
+ *                                  enabled and asserted IRQ
+ *
+ * @param[out]  ptr_u16_vector  :   Pointer to store its exception number in
+ *
+ * @return  TRUE                :   An exception is pending
+ *          FALSE               :   None
+ */
+static boolean sim_pending(uint16_t_ * ptr_u16_vector)
+{
+    boolean bool_pending = gl_st_sim_systick.bool_pending;
+    uint16_t_ u16_irq;
+
+    *ptr_u16_vector = SIM_SYSTICK_EXCEPTION;
+
+    for(u16_irq = 0; (FALSE == bool_pending) && (SIM_IRQS > u16_irq); u16_irq++)
+    {
+        if((TRUE == gl_arr_bool_sim_nvic_enabled[u16_irq]) && (TRUE == sim_irq_line(u16_irq)))
+        {
+            *ptr_u16_vector = SIM_IRQ_BASE + u16_irq;
+            bool_pending = TRUE;
+        }
+    }
+
+    return bool_pending;
+}
+
+/**
+ * @brief                       :   Takes every pending exception unless masked or already in a handler
+ */
+static void sim_dispatch(void)
+{
+    uint16_t_ u16_vector;
+
+    while((FALSE == gl_bool_sim_irq_masked) && (FALSE == gl_bool_sim_in_isr) && (TRUE == sim_pending(&u16_vector)))
+    {
+        if(SIM_SYSTICK_EXCEPTION == u16_vector)
+        {
+            // cleared on entry, a wrap during the handler pends it again
+            gl_st_sim_systick.bool_pending = FALSE;
+        }
+
+        gl_bool_sim_in_isr = TRUE;
+        gl_arr_sim_vectors[u16_vector]();
+        sim_commit();
+        gl_bool_sim_in_isr = FALSE;
+        gl_u32_sim_taken++;
+        gl_arr_u32_sim_entries[u16_vector]++;
+    }
+}
+
+/**
+ * @brief                       :   Applies an external pin drive
+ */
+static void sim_pin_apply(uint8_t_ u8_port, uint8_t_ u8_pin, en_sim_pin_drive_t_ en_drive)
+{
+    st_sim_gpio_t * ptr_st_gpio = &gl_arr_st_sim_gpio[u8_port];
+    uint8_t_ u8_mask = (uint8_t_)(1 << u8_pin);
+
+    if(SIM_PIN_RELEASE == en_drive)
+    {
+        ptr_st_gpio->u8_input_driven &= (uint8_t_) ~u8_mask;
+    }
+    else
+    {
+        ptr_st_gpio->u8_input_driven |= u8_mask;
+        ptr_st_gpio->u8_input = (uint8_t_)((ptr_st_gpio->u8_input & ~u8_mask) | ((SIM_PIN_HIGH == en_drive) ? u8_mask : 0));
+    }
+
+    sim_gpio_eval(u8_port);
+}
+
+/**
+ * @brief                       :   Time of the next scheduled event: pin drive, SysTick wrap, timer
+ *                                  time-out, UART byte or the end
+ *
+ * @return  virtual time, SIM_TIME_NEVER: nothing scheduled
+ */
+static uint64_t_ sim_next_event_ns(void)
+{
+    uint64_t_ u64_next_ns = gl_u64_sim_end_ns;
+    uint8_t_ u8_timer;
+    uint8_t_ u8_ssi;
+
+    if((ZERO != gl_u16_sim_events_count) && (gl_arr_st_sim_events[0].u64_at_ns < u64_next_ns))
+    {
+        u64_next_ns = gl_arr_st_sim_events[0].u64_at_ns;
+    }
+
+    if((TRUE == gl_st_sim_systick.st_counter.bool_running) && (gl_st_sim_systick.st_counter.u64_wrap_ns < u64_next_ns))
+    {
+        u64_next_ns = gl_st_sim_systick.st_counter.u64_wrap_ns;
+    }
+
+    for(u8_timer = 0; u8_timer < SIM_TIMERS; u8_timer++)
+    {
+        if((TRUE == gl_arr_st_sim_timers[u8_timer].st_counter.bool_running) &&
+           (gl_arr_st_sim_timers[u8_timer].st_counter.u64_wrap_ns < u64_next_ns))
+        {
+            u64_next_ns = gl_arr_st_sim_timers[u8_timer].st_counter.u64_wrap_ns;
+        }
+    }
+
+    if(gl_st_sim_uart.u64_tx_done_ns < u64_next_ns)
+    {
+        u64_next_ns = gl_st_sim_uart.u64_tx_done_ns;
+    }
+
+    if(gl_st_sim_uart.u64_rx_done_ns < u64_next_ns)
+    {
+        u64_next_ns = gl_st_sim_uart.u64_rx_done_ns;
+    }
+
+    for(u8_ssi = 0; u8_ssi < SIM_SSIS; u8_ssi++)
+    {
+        if(gl_arr_st_sim_ssi[u8_ssi].u64_tx_done_ns < u64_next_ns)
+        {
+            u64_next_ns = gl_arr_st_sim_ssi[u8_ssi].u64_tx_done_ns;
+        }
+    }
+
+    return u64_next_ns;
+}
+
+/**
+ * @brief                       :   Applies the events due at the current time, ends the simulation at its end
+ */
+static void sim_fire_due(void)
+{
+    st_sim_event_t st_event;
+    uint16_t_ u16_event;
+    uint8_t_ u8_timer;
+    uint8_t_ u8_ssi;
+
+    while((ZERO != gl_u16_sim_events_count) && (gl_arr_st_sim_events[0].u64_at_ns <= gl_u64_sim_now_ns))
+    {
+        st_event = gl_arr_st_sim_events[0];
+        for(u16_event = 1; u16_event < gl_u16_sim_events_count; u16_event++)
+        {
+            gl_arr_st_sim_events[u16_event - 1] = gl_arr_st_sim_events[u16_event];
+        }
+        gl_u16_sim_events_count--;
+
+        sim_pin_apply(st_event.u8_port, st_event.u8_pin, st_event.en_drive);
+        sim_dispatch();
+    }
+
+    if((TRUE == gl_st_sim_systick.st_counter.bool_running) && (gl_st_sim_systick.st_counter.u64_wrap_ns <= gl_u64_sim_now_ns))
+    {
+        sim_systick_wrap();
+    }
+
+    for(u8_timer = 0; u8_timer < SIM_TIMERS; u8_timer++)
+    {
+        if((TRUE == gl_arr_st_sim_timers[u8_timer].st_counter.bool_running) &&
+           (gl_arr_st_sim_timers[u8_timer].st_counter.u64_wrap_ns <= gl_u64_sim_now_ns))
+        {
+            sim_timer_timeout(u8_timer);
+        }
+    }
+
+    if(gl_st_sim_uart.u64_tx_done_ns <= gl_u64_sim_now_ns)
+    {
+        sim_uart_tx_done();
+    }
+
+    if(gl_st_sim_uart.u64_rx_done_ns <= gl_u64_sim_now_ns)
+    {
+        sim_uart_rx_done();
+    }
+
+    for(u8_ssi = 0; u8_ssi < SIM_SSIS; u8_ssi++)
+    {
+        if(gl_arr_st_sim_ssi[u8_ssi].u64_tx_done_ns <= gl_u64_sim_now_ns)
+        {
+            sim_ssi_tx_done(u8_ssi);
+        }
+    }
+
+    sim_dispatch();
+
+    if(gl_u64_sim_end_ns <= gl_u64_sim_now_ns)
+    {
+        if(NULL_PTR != gl_ptr_sim_end)
+        {
+            gl_ptr_sim_end();
+        }
+        exit(0);
+    }
+}
+
+/**
+ * @brief                       :   Moves the clock forward with nothing running, counted as asleep in WFI
+ *
+ * @param[in]   u64_to_ns       :   Target time, later than now
+ */
+static void sim_skip_to(uint64_t_ u64_to_ns)
+{
+    if(TRUE == gl_bool_sim_asleep)
+    {
+        gl_u64_sim_asleep_ns += u64_to_ns - gl_u64_sim_now_ns;
+    }
+
+    gl_u64_sim_now_ns = u64_to_ns;
+}
+
+/**
+ * @brief                       :   Moves the clock to a later time, applying the events due on the way
+ *
+ * @param[in]   u64_to_ns       :   Target time
+ */
+static void sim_advance_to(uint64_t_ u64_to_ns)
+{
+    uint64_t_ u64_next_ns;
+
+    sim_commit();
+    sim_dispatch();
+
+    for(u64_next_ns = sim_next_event_ns(); u64_next_ns <= u64_to_ns; u64_next_ns = sim_next_event_ns())
+    {
+        // a handler may already have run the clock past it
+        if(u64_next_ns > gl_u64_sim_now_ns)
+        {
+            sim_skip_to(u64_next_ns);
+        }
+
+        sim_fire_due();
+    }
+
+    if(u64_to_ns > gl_u64_sim_now_ns)
+    {
+        sim_skip_to(u64_to_ns);
+    }
+}
+
+/*---------------------------------------------------------/
+/- FUNCTION IMPLEMENTATION
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Resets the model to its power on state at virtual time 0
+ */
+void sim_init(void)
+{
+    uint16_t_ u16_index;
+
+    for(u16_index = 0; u16_index < SIM_REGS_HASH; u16_index++)
+    {
+        gl_arr_u16_sim_slot_hash[u16_index] = SIM_SLOT_NONE;
+    }
+    gl_u16_sim_slots_used = 0;
+
+    for(u16_index = 0; u16_index < SIM_GPIO_PORTS; u16_index++)
+    {
+        gl_arr_st_sim_gpio[u16_index] = (st_sim_gpio_t){ 0 };
+    }
+    gl_u8_sim_gated_reported = 0;
+
+    gl_st_sim_systick = (st_sim_systick_t){ 0 };
+    for(u16_index = 0; u16_index < SIM_TIMERS; u16_index++)
+    {
+        gl_arr_st_sim_timers[u16_index] = (st_sim_timer_t){ 0 };
+    }
+    gl_st_sim_dwt = (st_sim_dwt_t){ 0 };
+    gl_st_sim_udma = (st_sim_udma_t){ 0 };
+    gl_st_sim_uart = (st_sim_uart_t){ 0 };
+    gl_st_sim_uart.u64_tx_done_ns = SIM_TIME_NEVER;
+    gl_st_sim_uart.u64_rx_done_ns = SIM_TIME_NEVER;
+    gl_ptr_sim_uart_listener = NULL_PTR;
+    for(u16_index = 0; u16_index < SIM_SSIS; u16_index++)
+    {
+        gl_arr_st_sim_ssi[u16_index] = (st_sim_ssi_t){ 0 };
+        gl_arr_st_sim_ssi[u16_index].u64_tx_done_ns = SIM_TIME_NEVER;
+    }
+    gl_ptr_sim_ssi_listener = NULL_PTR;
+
+    // SysTick clock source resets to the system clock
+    gl_st_sim_systick.u32_ctrl = SIM_STCTRL_CLKSOURCE;
+
+    for(u16_index = 0; u16_index < SIM_IRQS; u16_index++)
+    {
+        gl_arr_bool_sim_nvic_enabled[u16_index] = FALSE;
+    }
+    for(u16_index = 0; u16_index < SIM_VECTORS; u16_index++)
+    {
+        gl_arr_u32_sim_entries[u16_index] = 0;
+    }
+    gl_bool_sim_irq_masked = FALSE;
+    gl_bool_sim_in_isr = FALSE;
+    gl_u32_sim_taken = 0;
+
+    for(u16_index = 0; u16_index < SIM_LISTENERS_MAX; u16_index++)
+    {
+        gl_arr_ptr_sim_listeners[u16_index] = NULL_PTR;
+    }
+
+    gl_u16_sim_events_count = 0;
+    gl_u64_sim_now_ns = 0;
+    gl_u64_sim_asleep_ns = 0;
+    gl_bool_sim_asleep = FALSE;
+    gl_u64_sim_accesses = 0;
+    gl_u64_sim_end_ns = SIM_TIME_NEVER;
+    gl_ptr_sim_end = NULL_PTR;
+
+    gl_ptr_sim_access_listener = NULL_PTR;
+    gl_ptr_st_sim_access_slot = NULL_PTR;
+}
+
+/**
+ * @brief                       :   Register access of HW_REG, commits pending writes, spends one
+ *                                  bus access and returns the register's slot holding its read value
+ *
+ * @param[in]   u32_addr        :   Register address
+ *
+ * @return  pointer to the register's slot
+ */
+volatile uint32_t_ * sim_reg(uint32_t_ u32_addr)
+{
+    return sim_reg_at(u32_addr, NULL_PTR, 0);
+}
+
+/**
+ * @brief                       :   sim_reg of a call site, HW_REG of the REGCOUNT_INSTRUMENTATION build
+ *
+ * @param[in]   u32_addr        :   Register address
+ * @param[in]   ptr_str_file    :   Source file of the access, NULL_PTR: unknown
+ * @param[in]   u32_line        :   Source line of the access
+ *
+ * @return  pointer to the register's slot
+ */
+volatile uint32_t_ * sim_reg_at(uint32_t_ u32_addr, const char * ptr_str_file, uint32_t_ u32_line)
+{
+    st_sim_slot_t * ptr_st_slot;
+
+    gl_u64_sim_accesses++;
+    sim_advance_to(gl_u64_sim_now_ns + SIM_ACCESS_NS);
+
+    ptr_st_slot = sim_slot(u32_addr);
+    sim_read(ptr_st_slot);
+
+    if(NULL_PTR != gl_ptr_sim_access_listener)
+    {
+        gl_ptr_st_sim_access_slot = ptr_st_slot;
+        gl_ptr_str_sim_access_file = ptr_str_file;
+        gl_u32_sim_access_line = u32_line;
+    }
+
+    return &ptr_st_slot->u32_value;
+}
+
+/**
+ * @brief                       :   Sets the listener of register accesses, the pending access goes to
+ *                                  the previous listener first
+ *
+ * @param[in]   ptr_listener    :   Listener, NULL_PTR: none
+ */
+void sim_set_access_listener(sim_access_listener_t_ ptr_listener)
+{
+    sim_access_resolve();
+    gl_ptr_sim_access_listener = ptr_listener;
+}
+
+/**
+ * @brief                       :   Reads the virtual time
+ *
+ * @return  nanoseconds since sim_init
+ */
+uint64_t_ sim_now_ns(void)
+{
+    return gl_u64_sim_now_ns;
+}
+
+/**
+ * @brief                       :   Reads the virtual time the core spent in WFI, the clock skipped to
+ *                                  the next event (the handlers waking it run awake)
+ *
+ * @return  nanoseconds asleep since sim_init
+ */
+uint64_t_ sim_asleep_ns(void)
+{
+    return gl_u64_sim_asleep_ns;
+}
+
+/**
+ * @brief                       :   Reads the number of register accesses
+ *
+ * @return  accesses through sim_reg since sim_init, interrupt handlers' included
+ */
+uint64_t_ sim_access_count(void)
+{
+    return gl_u64_sim_accesses;
+}
+
+/**
+ * @brief                       :   Reads the number of times an interrupt handler was entered
+ *
+ * @param[in]   s32_irq         :   IRQ number, -1 (SysTick_IRQn) for SysTick
+ *
+ * @return  entries since sim_init, 0 for an invalid IRQ number
+ */
+uint32_t_ sim_irq_entries(sint32_t_ s32_irq)
+{
+    uint32_t_ u32_entries = 0;
+
+    if(((SIM_SYSTICK_EXCEPTION - SIM_IRQ_BASE) <= s32_irq) && (SIM_IRQS > s32_irq))
+    {
+        u32_entries = gl_arr_u32_sim_entries[SIM_IRQ_BASE + s32_irq];
+    }
+
+    return u32_entries;
+}
+
+/**
+ * @brief                       :   Advances the virtual clock, applying scheduled events and
+ *                                  taking interrupts on the way
+ *
+ * @param[in]   u64_ns          :   Nanoseconds to advance
+ */
+void sim_run_for(uint64_t_ u64_ns)
+{
+    sim_advance_to(gl_u64_sim_now_ns + u64_ns);
+    sim_dispatch();
+}
+
+/**
+ * @brief                       :   Drives a pin from outside now
+ *
+ * @param[in]   u8_port         :   Port (0 -> SIM_GPIO_PORTS - 1)
+ * @param[in]   u8_pin          :   Pin (0 -> SIM_GPIO_PINS - 1)
+ * @param[in]   en_drive        :   Drive
+ *
+ * @return  SIM_OK              :   In case of Successful Operation
+ *          SIM_ERROR           :   In case of invalid port/pin/drive
+ */
+en_sim_error_t_ sim_pin_drive(uint8_t_ u8_port, uint8_t_ u8_pin, en_sim_pin_drive_t_ en_drive)
+{
+    en_sim_error_t_ en_sim_error_retval = SIM_OK;
+
+    if((SIM_GPIO_PORTS <= u8_port) || (SIM_GPIO_PINS <= u8_pin) || (SIM_PIN_DRIVE_TOTAL <= en_drive))
+    {
+        en_sim_error_retval = SIM_ERROR;
+    }
+    else
+    {
+        sim_commit();
+        sim_pin_apply(u8_port, u8_pin, en_drive);
+        sim_dispatch();
+    }
+
+    return en_sim_error_retval;
+}
+
+/**
+ * @brief                       :   Schedules an external pin drive, applied when the clock reaches it
+ *
+ * @param[in]   u64_at_ns       :   Virtual time of the drive
+ * @param[in]   u8_port         :   Port (0 -> SIM_GPIO_PORTS - 1)
+ * @param[in]   u8_pin          :   Pin (0 -> SIM_GPIO_PINS - 1)
+ * @param[in]   en_drive        :   Drive
+ *
+ * @return  SIM_OK              :   In case of Successful Operation
+ *          SIM_ERROR           :   In case of invalid arguments, a time in the past or a full queue
+ */
+en_sim_error_t_ sim_pin_schedule(uint64_t_ u64_at_ns, uint8_t_ u8_port, uint8_t_ u8_pin, en_sim_pin_drive_t_ en_drive)
+{
+    en_sim_error_t_ en_sim_error_retval = SIM_OK;
+    uint16_t_ u16_event;
+
+    if(
+            (SIM_GPIO_PORTS <= u8_port) || (SIM_GPIO_PINS <= u8_pin) || (SIM_PIN_DRIVE_TOTAL <= en_drive)   ||
+            (gl_u64_sim_now_ns > u64_at_ns) || (SIM_EVENTS_MAX <= gl_u16_sim_events_count)
+            )
+    {
+        en_sim_error_retval = SIM_ERROR;
+    }
+    else
+    {
+        // insert after the events at the same time so drives apply in scheduling order
+        for(u16_event = gl_u16_sim_events_count;
+            (ZERO != u16_event) && (gl_arr_st_sim_events[u16_event - 1].u64_at_ns > u64_at_ns);
+            u16_event--)
+        {
+            gl_arr_st_sim_events[u16_event] = gl_arr_st_sim_events[u16_event - 1];
+        }
+
+        gl_arr_st_sim_events[u16_event].u64_at_ns = u64_at_ns;
+        gl_arr_st_sim_events[u16_event].en_kind = SIM_EVENT_PIN_DRIVE;
+        gl_arr_st_sim_events[u16_event].u8_port = u8_port;
+        gl_arr_st_sim_events[u16_event].u8_pin = u8_pin;
+        gl_arr_st_sim_events[u16_event].en_drive = en_drive;
+        gl_u16_sim_events_count++;
+    }
+
+    return en_sim_error_retval;
+}
+
+/**
+ * @brief                       :   Reads the state of a port
+ *
+ * @param[in]   u8_port         :   Port (0 -> SIM_GPIO_PORTS - 1)
+ * @param[out]  ptr_st_state    :   Pointer to store the state in
+ *
+ * @return  SIM_OK              :   In case of Successful Operation
+ *          SIM_ERROR           :   In case of invalid port or NULL pointer
+ */
+en_sim_error_t_ sim_port_get_state(uint8_t_ u8_port, st_sim_port_state_t_ * ptr_st_state)
+{
+    en_sim_error_t_ en_sim_error_retval = SIM_OK;
+
+    if((SIM_GPIO_PORTS <= u8_port) || (NULL_PTR == ptr_st_state))
+    {
+        en_sim_error_retval = SIM_ERROR;
+    }
+    else
+    {
+        sim_commit();
+        *ptr_st_state = gl_arr_st_sim_gpio[u8_port].st_state;
+    }
+
+    return en_sim_error_retval;
+}
+
+/**
+ * @brief                       :   Adds a listener of port state changes
+ *
+ * @param[in]   ptr_listener    :   Listener
+ *
+ * @return  SIM_OK              :   In case of Successful Operation
+ *          SIM_ERROR           :   In case of NULL pointer or SIM_LISTENERS_MAX listeners already
+ */
+en_sim_error_t_ sim_add_port_listener(sim_port_listener_t_ ptr_listener)
+{
+    en_sim_error_t_ en_sim_error_retval = SIM_ERROR;
+    uint8_t_ u8_listener;
+
+    sim_commit();
+
+    for(u8_listener = 0; (NULL_PTR != ptr_listener) && (SIM_ERROR == en_sim_error_retval) && (u8_listener < SIM_LISTENERS_MAX); u8_listener++)
+    {
+        if(NULL_PTR == gl_arr_ptr_sim_listeners[u8_listener])
+        {
+            gl_arr_ptr_sim_listeners[u8_listener] = ptr_listener;
+            en_sim_error_retval = SIM_OK;
+        }
+    }
+
+    return en_sim_error_retval;
+}
+
+/**
+ * @brief                       :   Removes a listener added with sim_add_port_listener
+ *
+ * @param[in]   ptr_listener    :   Listener
+ */
+void sim_remove_port_listener(sim_port_listener_t_ ptr_listener)
+{
+    uint8_t_ u8_listener;
+
+    sim_commit();
+
+    for(u8_listener = 0; u8_listener < SIM_LISTENERS_MAX; u8_listener++)
+    {
+        if(ptr_listener == gl_arr_ptr_sim_listeners[u8_listener])
+        {
+            gl_arr_ptr_sim_listeners[u8_listener] = NULL_PTR;
+        }
+    }
+}
+
+/**
+ * @brief                       :   Sets the listener of the bytes UART0 sends
+ *
+ * @param[in]   ptr_listener    :   Listener, NULL_PTR: none
+ */
+void sim_set_uart_listener(sim_uart_listener_t_ ptr_listener)
+{
+    gl_ptr_sim_uart_listener = ptr_listener;
+}
+
+/**
+ * @brief                       :   Queues bytes on U0RX, sent back to back at UART0's baud rate
+ *                                  from now, or after the bytes already queued
+ *
+ * @param[in]   ptr_u8_data     :   Pointer to bytes
+ * @param[in]   u16_length      :   Number of bytes
+ *
+ * @return  SIM_OK              :   In case of Successful Operation
+ *          SIM_ERROR           :   In case of NULL pointer, baud rate not programmed or a full queue
+ */
+en_sim_error_t_ sim_uart_receive(const uint8_t_ * ptr_u8_data, uint16_t_ u16_length)
+{
+    en_sim_error_t_ en_sim_error_retval = SIM_OK;
+    uint16_t_ u16_index;
+
+    sim_commit();
+
+    if(
+            (NULL_PTR == ptr_u8_data)                                       ||
+            (ZERO == sim_uart_frame_ns())                                   ||
+            ((SIM_UART_RX_MAX - gl_st_sim_uart.u16_rx_count) < u16_length)
+            )
+    {
+        en_sim_error_retval = SIM_ERROR;
+    }
+    else
+    {
+        for(u16_index = 0; u16_index < u16_length; u16_index++)
+        {
+            gl_st_sim_uart.arr_u8_rx[(gl_st_sim_uart.u16_rx_head + gl_st_sim_uart.u16_rx_count) % SIM_UART_RX_MAX] =
+                    ptr_u8_data[u16_index];
+            gl_st_sim_uart.u16_rx_count++;
+        }
+
+        if((SIM_TIME_NEVER == gl_st_sim_uart.u64_rx_done_ns) && (ZERO != gl_st_sim_uart.u16_rx_count))
+        {
+            gl_st_sim_uart.u64_rx_done_ns = gl_u64_sim_now_ns + sim_uart_frame_ns();
+        }
+    }
+
+    return en_sim_error_retval;
+}
+
+/**
+ * @brief                       :   Reads the number of bytes UART0 received without a uDMA transfer
+ *                                  to take them
+ *
+ * @return  bytes lost since sim_init
+ */
+uint32_t_ sim_uart_rx_lost(void)
+{
+    return gl_st_sim_uart.u32_rx_lost;
+}
+
+/**
+ * @brief                       :   Sets the listener of the frames the SSI modules send
+ *
+ * @param[in]   ptr_listener    :   Listener, NULL_PTR: none
+ */
+void sim_set_ssi_listener(sim_ssi_listener_t_ ptr_listener)
+{
+    gl_ptr_sim_ssi_listener = ptr_listener;
+}
+
+/**
+ * @brief                       :   Sets when the simulation ends, for a firmware that never returns:
+ *                                  once the clock reaches the end the handler runs and the process exits
+ *
+ * @param[in]   u64_at_ns       :   End time, SIM_TIME_NEVER: no end
+ * @param[in]   ptr_end         :   Handler, NULL_PTR: none
+ */
+void sim_set_end(uint64_t_ u64_at_ns, sim_end_handler_t_ ptr_end)
+{
+    gl_u64_sim_end_ns = u64_at_ns;
+    gl_ptr_sim_end = ptr_end;
+}
+
+/**
+ * @brief                       :   NVIC enable/disable of an interrupt line, used by the device header
+ *
+ * @param[in]   s32_irq         :   IRQ number
+ * @param[in]   bool_enable     :   TRUE: enable, FALSE: disable
+ */
+void sim_nvic_enable(sint32_t_ s32_irq, boolean bool_enable)
+{
+    if((0 <= s32_irq) && (SIM_IRQS > s32_irq))
+    {
+        sim_commit();
+        gl_arr_bool_sim_nvic_enabled[s32_irq] = bool_enable;
+        sim_dispatch();
+    }
+}
+
+/**
+ * @brief                       :   PRIMASK, used by the device header, unmasking takes pending interrupts
+ *
+ * @param[in]   bool_masked     :   TRUE: interrupts masked
+ */
+void sim_irq_mask(boolean bool_masked)
+{
+    sim_commit();
+    gl_bool_sim_irq_masked = bool_masked;
+    sim_dispatch();
+}
+
+/**
+ * @brief                       :   PRIMASK read, used by the device header
+ *
+ * @return  TRUE                :   Interrupts masked
+ *          FALSE               :   Interrupts unmasked
+ */
+boolean sim_irq_is_masked(void)
+{
+    return gl_bool_sim_irq_masked;
+}
+
+/**
+ * @brief                       :   WFI, used by the device header: advances the clock to the next
+ *                                  event until an interrupt is pending (masked or not) or was taken
+ */
+void sim_wfi(void)
+{
+    uint32_t_ u32_taken = gl_u32_sim_taken;
+    uint16_t_ u16_vector;
+
+    sim_commit();
+    sim_dispatch();
+
+    while((u32_taken == gl_u32_sim_taken) && (FALSE == sim_pending(&u16_vector)))
+    {
+        if(SIM_TIME_NEVER == sim_next_event_ns())
+        {
+            // the target would sleep forever
+            fprintf(stderr, "sim: WFI at %llu ns with nothing left to wake the core\n", gl_u64_sim_now_ns);
+            exit(1);
+        }
+
+        gl_bool_sim_asleep = TRUE;
+        sim_advance_to(sim_next_event_ns());
+        gl_bool_sim_asleep = FALSE;
+    }
+}
@@ -0,0 +1,235 @@
+/**
+ * @file    :   test_app_sleep.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Host test: the sleeping main loop over one hour of scripted presses
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Runs main.c on the register model for one simulated hour of presses of SW1 (PF4) at pseudo
+ * random intervals: bursts shorter and longer than the 1 s on-time, and idle minutes. Checks:
+ *  - every LED change against a model of the app's state table: each press shows the next color
+ *    within the debounce latency, a color left alone goes off 1 s after it came on,
+ *  - the wake up counters: one timeout wake per on-time that elapsed, button wakes for the presses,
+ *  - the loop sleeps: the SysTick time base wakes it every TEST_TIME_BASE_MS, the button tick runs
+ *    only around presses, and it wakes once per interrupt and no more,
+ *  - the core is asleep for all but TEST_AWAKE_MAX_PPM of the hour, from the model's virtual clock.
+ */
+
+#include "sim_interface.h"
+#include "test_interface.h"
+#include "TM4C123.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* the firmware's main becomes firmware_main, called once the model is set up */
+#define main firmware_main
+#include "main.c"
+#undef main
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define TEST_NS_PER_MS              1000000ULL
+
+#define TEST_PORT_F                 5
+#define TEST_BTN_PIN                4
+#define TEST_PRESSES_MAX            120         /* two pin events each, within the model's queue */
+#define TEST_FIRST_MS               500
+#define TEST_HOLD_MS                80
+#define TEST_HOUR_MS                3600000UL
+#define TEST_TAIL_MS                2000        /* after the last press */
+
+#define TEST_RED                    (1 << 1)    /* PF1 */
+#define TEST_BLUE                   (1 << 2)    /* PF2 */
+#define TEST_GREEN                  (1 << 3)    /* PF3 */
+#define TEST_ALL                    (TEST_RED | TEST_BLUE | TEST_GREEN)
+#define TEST_COLORS                 5           /* RED -> GREEN -> BLUE -> ALL -> OFF */
+
+#define TEST_LATENCY_MIN_MS         20          /* press to LED change: 4 samples of the tick restarted by the edge */
+#define TEST_LATENCY_MAX_MS         21
+#define TEST_ON_MS                  1000        /* COLOR_ON_MS */
+#define TEST_TOLERANCE_MS           1           /* interrupt and loop pass */
+#define TEST_TIME_BASE_MS           50          /* APP_TIME_BASE_MS */
+#define TEST_BTN_TICK_MS            5           /* BTN_TICK_MS */
+#define TEST_PRESS_TICKS            ((TEST_HOLD_MS + 60) / TEST_BTN_TICK_MS)   /* press, hold, release debounce */
+#define TEST_PRESS_WAKES            (TEST_PRESS_TICKS + 3)  /* ticks, both edges, the timeout */
+#define TEST_AWAKE_MAX_PPM          20          /* of the hour, at the model's access timing */
+
+#define TEST_CHANGES_MAX            (2 * TEST_PRESSES_MAX)
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+static const uint8_t_ gl_arr_u8_test_colors[TEST_COLORS] = { TEST_RED, TEST_GREEN, TEST_BLUE, TEST_ALL, 0 };
+
+static uint32_t_ gl_arr_u32_test_presses_ms[TEST_PRESSES_MAX];
+static uint8_t_ gl_u8_test_presses = 0;
+static uint64_t_ gl_arr_u64_test_changes_ns[TEST_CHANGES_MAX];
+static uint8_t_ gl_arr_u8_test_changes_leds[TEST_CHANGES_MAX];
+static uint16_t_ gl_u16_test_changes = 0;
+static uint8_t_ gl_u8_test_leds = 0;
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Port listener, stamps every change of the lit RGB LEDs
+ */
+static void test_port_changed(uint8_t_ u8_port, const st_sim_port_state_t_ * ptr_st_state)
+{
+    uint8_t_ u8_leds = ptr_st_state->u8_levels & ptr_st_state->u8_dir & TEST_ALL;
+
+    if((TEST_PORT_F == u8_port) && (u8_leds != gl_u8_test_leds))
+    {
+        if(TEST_CHANGES_MAX > gl_u16_test_changes)
+        {
+            gl_arr_u64_test_changes_ns[gl_u16_test_changes] = sim_now_ns();
+            gl_arr_u8_test_changes_leds[gl_u16_test_changes] = u8_leds;
+        }
+        gl_u16_test_changes++;
+        gl_u8_test_leds = u8_leds;
+    }
+}
+
+/**
+ * @brief                       :   Checks the next LED change: its color and its time window
+ *
+ * @return  time of the change in ns, 0 when there is none
+ */
+static uint64_t_ test_check_change(uint16_t_ * ptr_u16_change, uint8_t_ u8_leds, uint64_t_ u64_min_ns, uint64_t_ u64_max_ns)
+{
+    uint64_t_ u64_at_ns = 0;
+
+    TEST_CHECK(*ptr_u16_change < gl_u16_test_changes);
+    if(*ptr_u16_change < gl_u16_test_changes)
+    {
+        u64_at_ns = gl_arr_u64_test_changes_ns[*ptr_u16_change];
+        TEST_CHECK_EQ(gl_arr_u8_test_changes_leds[*ptr_u16_change], u8_leds);
+        TEST_CHECK_RANGE(u64_at_ns, u64_min_ns, u64_max_ns);
+        (*ptr_u16_change)++;
+    }
+
+    return u64_at_ns;
+}
+
+/**
+ * @brief                       :   End of the simulation, replays the presses on a model of the state
+ *                                  table and checks the LED changes and wake up counters
+ */
+static void test_end(void)
+{
+    st_app_wake_stats_t st_wake_stats;
+    uint64_t_ u64_entered_ns = 0;
+    uint64_t_ u64_next_press_ns;
+    uint64_t_ u64_now_ms = sim_now_ns() / TEST_NS_PER_MS;
+    uint64_t_ u64_asleep_ms = sim_asleep_ns() / TEST_NS_PER_MS;
+    uint64_t_ u64_awake_us = (sim_now_ns() - sim_asleep_ns()) / 1000ULL;
+    uint64_t_ u64_wakes;
+    uint32_t_ u32_timeouts = 0;
+    uint16_t_ u16_change = 0;
+    uint8_t_ u8_press;
+    uint8_t_ u8_color;
+    uint8_t_ u8_leds = 0;
+
+    for(u8_press = 0; u8_press < gl_u8_test_presses; u8_press++)
+    {
+        // OFF after ALL timed out doesn't change the pins
+        u8_color = gl_arr_u8_test_colors[u8_press % TEST_COLORS];
+        if(u8_color != u8_leds)
+        {
+            u64_entered_ns = test_check_change(&u16_change, u8_color,
+                                               (gl_arr_u32_test_presses_ms[u8_press] + TEST_LATENCY_MIN_MS) * TEST_NS_PER_MS,
+                                               (gl_arr_u32_test_presses_ms[u8_press] + TEST_LATENCY_MAX_MS) * TEST_NS_PER_MS);
+            u8_leds = u8_color;
+        }
+
+        // a color left alone for its on-time goes off before the next press shows
+        u64_next_press_ns = (u8_press < (gl_u8_test_presses - 1)) ?
+                            ((gl_arr_u32_test_presses_ms[u8_press + 1] + TEST_LATENCY_MIN_MS) * TEST_NS_PER_MS) :
+                            SIM_TIME_NEVER;
+        if((0 != u8_color) && ((u64_entered_ns + (TEST_ON_MS * TEST_NS_PER_MS)) < u64_next_press_ns))
+        {
+            test_check_change(&u16_change, 0, u64_entered_ns + ((TEST_ON_MS - TEST_TOLERANCE_MS) * TEST_NS_PER_MS),
+                              u64_entered_ns + ((TEST_ON_MS + TEST_TOLERANCE_MS) * TEST_NS_PER_MS));
+            u8_leds = 0;
+            u32_timeouts++;
+        }
+    }
+    TEST_CHECK_EQ(gl_u16_test_changes, u16_change);
+
+    app_get_wake_stats(&st_wake_stats);
+    u64_wakes = st_wake_stats.arr_u32_wakes[APP_WAKE_BUTTON] + st_wake_stats.arr_u32_wakes[APP_WAKE_TIMEOUT] +
+                st_wake_stats.arr_u32_wakes[APP_WAKE_CONSOLE] + st_wake_stats.arr_u32_wakes[APP_WAKE_IDLE];
+    printf("%llu ms simulated, %u presses, wakes: button %lu, timeout %lu, console %lu, idle %lu (%.2f /s)\n",
+           u64_now_ms, gl_u8_test_presses,
+           st_wake_stats.arr_u32_wakes[APP_WAKE_BUTTON], st_wake_stats.arr_u32_wakes[APP_WAKE_TIMEOUT],
+           st_wake_stats.arr_u32_wakes[APP_WAKE_CONSOLE], st_wake_stats.arr_u32_wakes[APP_WAKE_IDLE],
+           (double) u64_wakes * 1000.0 / (double) u64_now_ms);
+    printf("asleep %llu ms, awake %llu us (%.1f ppm), SysTick %lu, button tick %lu\n",
+           u64_asleep_ms, u64_awake_us, (double) u64_awake_us * 1000.0 / (double) u64_now_ms,
+           sim_irq_entries(SysTick_IRQn), sim_irq_entries(TIMER2A_IRQn));
+
+    TEST_CHECK_EQ(st_wake_stats.arr_u32_wakes[APP_WAKE_TIMEOUT], u32_timeouts);
+    TEST_CHECK_RANGE(st_wake_stats.arr_u32_wakes[APP_WAKE_BUTTON], gl_u8_test_presses, 3 * gl_u8_test_presses);
+    TEST_CHECK_EQ(st_wake_stats.arr_u32_wakes[APP_WAKE_CONSOLE], 0);
+    TEST_CHECK(ZERO != st_wake_stats.arr_u32_wakes[APP_WAKE_IDLE]);
+
+    // the periodic wakes: the time base, and the button tick only around presses
+    // SysTick starts during init, after the first ns
+    TEST_CHECK_RANGE(sim_irq_entries(SysTick_IRQn), (u64_now_ms / TEST_TIME_BASE_MS) - 1, u64_now_ms / TEST_TIME_BASE_MS);
+    TEST_CHECK_RANGE(sim_irq_entries(TIMER2A_IRQn), gl_u8_test_presses, gl_u8_test_presses * TEST_PRESS_TICKS);
+    TEST_CHECK_RANGE(u64_wakes, (u64_now_ms / TEST_TIME_BASE_MS) - 1,
+                     (u64_now_ms / TEST_TIME_BASE_MS) + (gl_u8_test_presses * TEST_PRESS_WAKES));
+
+    // us awake per s of the hour
+    TEST_CHECK_RANGE(u64_now_ms, TEST_HOUR_MS, TEST_HOUR_MS);
+    TEST_CHECK_RANGE(u64_awake_us * 1000ULL, 0, TEST_AWAKE_MAX_PPM * u64_now_ms);
+
+    exit(test_result("test_app_sleep"));
+}
+
+/*---------------------------------------------------------/
+/- MAIN
+/---------------------------------------------------------*/
+int main(void)
+{
+    uint32_t_ u32_seed = 7;
+    uint32_t_ u32_at_ms = TEST_FIRST_MS;
+
+    sim_init();
+
+    while((TEST_PRESSES_MAX > gl_u8_test_presses) && ((TEST_HOUR_MS - TEST_TAIL_MS) > u32_at_ms))
+    {
+        gl_arr_u32_test_presses_ms[gl_u8_test_presses++] = u32_at_ms;
+        TEST_CHECK(SIM_OK == sim_pin_schedule(u32_at_ms * TEST_NS_PER_MS, TEST_PORT_F, TEST_BTN_PIN, SIM_PIN_LOW));
+        TEST_CHECK(SIM_OK == sim_pin_schedule((u32_at_ms + TEST_HOLD_MS) * TEST_NS_PER_MS, TEST_PORT_F, TEST_BTN_PIN,
+                                              SIM_PIN_RELEASE));
+
+        // 200 -> 899 ms or 1100 -> 2499 ms: clear of the 1 s on-time either way, or 30 -> 99 s idle (LCG)
+        u32_seed = (u32_seed * 1103515245UL) + 12345UL;
+        switch((u32_seed >> 16) & 3)
+        {
+            case 0:
+                u32_at_ms += 200 + ((u32_seed >> 18) % 700);
+                break;
+            case 1:
+                u32_at_ms += 1100 + ((u32_seed >> 18) % 1400);
+                break;
+            default:
+                u32_at_ms += 30000 + ((u32_seed >> 18) % 70000);
+                break;
+        }
+    }
+
+    sim_add_port_listener(test_port_changed);
+
+    // the firmware never returns: the end handler checks and exits
+    sim_set_end(TEST_HOUR_MS * TEST_NS_PER_MS, test_end);
+    firmware_main();
+
+    TEST_CHECK(FALSE);
+    return test_result("test_app_sleep");
+}
@@ -0,0 +1,192 @@
+/**
+ * @file    :   test_app_states.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Host test: every transition of the app state table, button and timeout paths
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Builds app.c into the test to reach its state machine, runs app_init on the register model,
+ * then for every state of gl_arr_st_app_states and both inputs enters the state and checks
+ * against the test's own table:
+ *  - the RGB LEDs on PF1-3 show the state's colors,
+ *  - timeout path: app_timeout_due turns TRUE COLOR_ON_MS after a timed state was entered, not
+ *    a ms earlier, never in an untimed one, and app_dispatch(APP_INPUT_TIMEOUT) takes the state
+ *    to its next one and clears the timeout,
+ *  - button path: app_dispatch(APP_INPUT_PRESS) a ms before the state's timeout takes the
+ *    state to its next one, whose timeout runs from the press (the old one doesn't end it).
+ * Every row of the state table is covered once per input.
+ */
+
+#include "sim_interface.h"
+#include "test_interface.h"
+
+#include <stdio.h>
+
+/* the app's private state machine */
+#include "app.c"
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define TEST_NS_PER_MS              1000000ULL
+
+#define TEST_PORT_F                 5
+#define TEST_RED                    (1 << 1)    /* PF1 */
+#define TEST_BLUE                   (1 << 2)    /* PF2 */
+#define TEST_GREEN                  (1 << 3)    /* PF3 */
+#define TEST_ALL                    (TEST_RED | TEST_BLUE | TEST_GREEN)
+#define TEST_OFF                    0
+
+#define TEST_ON_MS                  1000        /* COLOR_ON_MS */
+#define TEST_MARGIN_MS              1           /* timer interrupt on the ms of the timeout */
+
+#define TEST_STATES                 (sizeof(gl_arr_st_test_states) / sizeof(gl_arr_st_test_states[0]))
+
+/*---------------------------------------------------------/
+/- STRUCTS
+/---------------------------------------------------------*/
+typedef struct
+{
+    const char *            ptr_str_name                    ;
+    en_app_state_t          en_state                        ;
+    uint8_t_                u8_leds                         ;
+    uint16_t_               u16_on_ms                       ;   /* 0: no timeout */
+    en_app_state_t          arr_en_next[APP_INPUTS_TOTAL]   ;   /* on press, on timeout */
+}st_test_state_t_;
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+static const st_test_state_t_ gl_arr_st_test_states[] = {
+    { "ALL_OFF",    ALL_OFF,    TEST_OFF,   0,          { RED_ON,   ALL_OFF    } },
+    { "RED_ON",     RED_ON,     TEST_RED,   TEST_ON_MS, { GREEN_ON, RED_DONE   } },
+    { "RED_DONE",   RED_DONE,   TEST_OFF,   0,          { GREEN_ON, RED_DONE   } },
+    { "GREEN_ON",   GREEN_ON,   TEST_GREEN, TEST_ON_MS, { BLUE_ON,  GREEN_DONE } },
+    { "GREEN_DONE", GREEN_DONE, TEST_OFF,   0,          { BLUE_ON,  GREEN_DONE } },
+    { "BLUE_ON",    BLUE_ON,    TEST_BLUE,  TEST_ON_MS, { ALL_ON,   BLUE_DONE  } },
+    { "BLUE_DONE",  BLUE_DONE,  TEST_OFF,   0,          { ALL_ON,   BLUE_DONE  } },
+    { "ALL_ON",     ALL_ON,     TEST_ALL,   TEST_ON_MS, { ALL_OFF,  ALL_DONE   } },
+    { "ALL_DONE",   ALL_DONE,   TEST_OFF,   0,          { ALL_OFF,  ALL_DONE   } },
+};
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Lit RGB LEDs
+ */
+static uint8_t_ test_leds(void)
+{
+    st_sim_port_state_t_ st_state = {0};
+
+    sim_port_get_state(TEST_PORT_F, &st_state);
+
+    return st_state.u8_levels & st_state.u8_dir & TEST_ALL;
+}
+
+/**
+ * @brief                       :   Row of the test table of a state
+ */
+static const st_test_state_t_ * test_row(en_app_state_t en_state)
+{
+    const st_test_state_t_ * ptr_st_row = NULL_PTR;
+    uint8_t_ u8_row;
+
+    for(u8_row = 0; u8_row < TEST_STATES; u8_row++)
+    {
+        ptr_st_row = (en_state == gl_arr_st_test_states[u8_row].en_state) ? &gl_arr_st_test_states[u8_row] : ptr_st_row;
+    }
+
+    return ptr_st_row;
+}
+
+/**
+ * @brief                       :   Checks the state left by a transition: state, LEDs, timeout cleared
+ */
+static void test_arrived(const st_test_state_t_ * ptr_st_from, en_app_input_t en_input)
+{
+    const st_test_state_t_ * ptr_st_to = test_row(ptr_st_from->arr_en_next[en_input]);
+
+    printf("  %-10s --%-7s--> %-10s\n", ptr_st_from->ptr_str_name,
+           (APP_INPUT_PRESS == en_input) ? "press" : "timeout", ptr_st_to->ptr_str_name);
+
+    TEST_CHECK_EQ(gl_en_app_state, ptr_st_to->en_state);
+    TEST_CHECK_EQ(test_leds(), ptr_st_to->u8_leds);
+    TEST_CHECK(FALSE == app_timeout_due());
+}
+
+/*---------------------------------------------------------/
+/- MAIN
+/---------------------------------------------------------*/
+int main(void)
+{
+    const st_test_state_t_ * ptr_st_row;
+    const st_test_state_t_ * ptr_st_next;
+    uint8_t_ u8_row;
+
+    sim_init();
+
+    TEST_CHECK(APP_OK == app_init());
+    TEST_CHECK_EQ(TEST_STATES, STATES_TOTAL);
+
+    for(u8_row = 0; u8_row < TEST_STATES; u8_row++)
+    {
+        ptr_st_row = &gl_arr_st_test_states[u8_row];
+
+        // timeout path
+        TEST_CHECK(APP_OK == app_enter(ptr_st_row->en_state));
+        TEST_CHECK_EQ(test_leds(), ptr_st_row->u8_leds);
+
+        if(ZERO != ptr_st_row->u16_on_ms)
+        {
+            sim_run_for((ptr_st_row->u16_on_ms - TEST_MARGIN_MS) * TEST_NS_PER_MS);
+            TEST_CHECK(FALSE == app_timeout_due());
+            TEST_CHECK_EQ(test_leds(), ptr_st_row->u8_leds);
+
+            sim_run_for(2 * TEST_MARGIN_MS * TEST_NS_PER_MS);
+            TEST_CHECK(TRUE == app_timeout_due());
+        }
+        else
+        {
+            sim_run_for(2 * TEST_ON_MS * TEST_NS_PER_MS);
+            TEST_CHECK(FALSE == app_timeout_due());
+        }
+
+        app_dispatch(APP_INPUT_TIMEOUT);
+        test_arrived(ptr_st_row, APP_INPUT_TIMEOUT);
+
+        // button path, pressed a ms before the timeout
+        TEST_CHECK(APP_OK == app_enter(ptr_st_row->en_state));
+
+        if(ZERO != ptr_st_row->u16_on_ms)
+        {
+            sim_run_for((ptr_st_row->u16_on_ms - TEST_MARGIN_MS) * TEST_NS_PER_MS);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        app_dispatch(APP_INPUT_PRESS);
+        test_arrived(ptr_st_row, APP_INPUT_PRESS);
+
+        // the next state's timeout runs from the press
+        ptr_st_next = test_row(ptr_st_row->arr_en_next[APP_INPUT_PRESS]);
+        sim_run_for(2 * TEST_MARGIN_MS * TEST_NS_PER_MS);
+        TEST_CHECK(FALSE == app_timeout_due());
+
+        if(ZERO != ptr_st_next->u16_on_ms)
+        {
+            sim_run_for((ptr_st_next->u16_on_ms - (2 * TEST_MARGIN_MS)) * TEST_NS_PER_MS);
+            TEST_CHECK(TRUE == app_timeout_due());
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    return test_result("test_app_states");
+}
@@ -0,0 +1,180 @@
+/**
+ * @file    :   test_btn_bounce.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Host test: the tick-sampled button debouncer against contact bounce traces
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Replays bounce traces on SW1 (PF4, pull up) through the btn driver and its tick timer.
+ * A trace is a list of edge times; the pin alternates between pressed (driven low) and
+ * released from the first edge on. After each trace has settled:
+ *  - a press trace gives exactly one press edge and event, a release trace one release,
+ *  - a glitch trace (pulses shorter than the debounce window) gives nothing,
+ *  - btn_read returns at once, also while the button is pressed.
+ * Before the traces, a button on an invalid pin or on SW1's pin is refused and left deactivated.
+ */
+
+#include "sim_interface.h"
+#include "test_interface.h"
+#include "btn_interface.h"
+
+#include <stdio.h>
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define TEST_US                     1000ULL     /* ns */
+#define TEST_MS                     1000000ULL  /* ns */
+
+#define TEST_PORT_F                 5
+#define TEST_BTN_PIN                4
+#define TEST_EDGES_MAX              24
+#define TEST_SETTLE_NS              (100 * TEST_MS)     /* after the last edge, beyond the debounce window */
+#define TEST_READ_MAX_NS            (10 * TEST_US)      /* btn_read, non blocking */
+
+#define TEST_TRACES                 (sizeof(gl_arr_st_test_traces) / sizeof(gl_arr_st_test_traces[0]))
+
+/*---------------------------------------------------------/
+/- ENUMS
+/---------------------------------------------------------*/
+typedef enum
+{
+    TEST_TRACE_PRESS        = 0 ,   /* released -> pressed */
+    TEST_TRACE_RELEASE          ,   /* pressed -> released */
+    TEST_TRACE_GLITCH           ,   /* released -> released */
+}en_test_trace_t_;
+
+/*---------------------------------------------------------/
+/- STRUCTS
+/---------------------------------------------------------*/
+typedef struct
+{
+    const char *            ptr_str_name                    ;
+    en_test_trace_t_        en_trace                        ;
+    uint8_t_                u8_edges                        ;
+    uint16_t_               arr_u16_edges_us[TEST_EDGES_MAX];   /* from the first edge */
+}st_test_trace_t_;
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+static const st_test_trace_t_ gl_arr_st_test_traces[] = {
+    { "clean press",            TEST_TRACE_PRESS,   1,  { 0 } },
+    { "clean release",          TEST_TRACE_RELEASE, 1,  { 0 } },
+    { "short bounce press",     TEST_TRACE_PRESS,   5,  { 0, 150, 300, 420, 800 } },
+    { "short bounce release",   TEST_TRACE_RELEASE, 5,  { 0, 200, 350, 900, 1500 } },
+    { "8 ms chatter press",     TEST_TRACE_PRESS,   17, { 0, 480, 960, 1500, 2000, 2450, 3000, 3600, 4100,
+                                                          4700, 5200, 5800, 6300, 6900, 7400, 7800, 8000 } },
+    { "8 ms chatter release",   TEST_TRACE_RELEASE, 17, { 0, 510, 1000, 1490, 2020, 2500, 3010, 3480, 4000,
+                                                          4520, 5000, 5490, 6010, 6500, 7000, 7550, 8000 } },
+    { "decaying bounce press",  TEST_TRACE_PRESS,   9,  { 0, 30, 90, 180, 400, 1100, 2600, 4900, 9000 } },
+    { "decaying bounce release",TEST_TRACE_RELEASE, 9,  { 0, 40, 100, 220, 500, 1300, 3000, 6000, 11000 } },
+    { "2 ms glitch",            TEST_TRACE_GLITCH,  2,  { 0, 2000 } },
+    { "9 ms glitch",            TEST_TRACE_GLITCH,  2,  { 0, 9000 } },
+    { "noise burst",            TEST_TRACE_GLITCH,  10, { 0, 100, 400, 450, 1200, 1300, 2000, 2600, 2700, 3000 } },
+};
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Counts the queued press and release events, emptying the queue
+ *                                  (clicks are not counted)
+ */
+static void test_count_events(uint8_t_ * ptr_u8_presses, uint8_t_ * ptr_u8_releases)
+{
+    st_btn_event_t_ st_event;
+
+    *ptr_u8_presses = 0;
+    *ptr_u8_releases = 0;
+
+    while(BTN_STATUS_OK == btn_event_get(&st_event))
+    {
+        if(BTN_EVENT_PRESS == st_event.en_btn_event)
+        {
+            (*ptr_u8_presses)++;
+        }
+        else if(BTN_EVENT_RELEASE == st_event.en_btn_event)
+        {
+            (*ptr_u8_releases)++;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+}
+
+/*---------------------------------------------------------/
+/- MAIN
+/---------------------------------------------------------*/
+int main(void)
+{
+    st_btn_config_t_ st_btn = {
+        .en_btn_port = BTN_PORT_F,
+        .en_btn_pin = BTN_PIN_4,
+        .en_btn_pull_type = BTN_INTERNAL_PULL_UP
+    };
+    st_btn_config_t_ st_btn_refused = {
+        .en_btn_port = BTN_PORT_F,
+        .en_btn_pin = BTN_PIN_TOTAL,
+        .en_btn_pull_type = BTN_INTERNAL_PULL_UP
+    };
+    const st_test_trace_t_ * ptr_st_trace;
+    en_btn_state_t_ en_state = BTN_STATE_NOT_PRESSED;
+    en_btn_state_t_ en_expected;
+    en_sim_pin_drive_t_ en_drive;
+    uint64_t_ u64_start_ns;
+    uint8_t_ u8_trace;
+    uint8_t_ u8_edge;
+    uint8_t_ u8_edges = 0;
+    uint8_t_ u8_presses;
+    uint8_t_ u8_releases;
+
+    sim_init();
+
+    TEST_CHECK(BTN_STATUS_INVALID_STATE == btn_init(&st_btn_refused));
+    TEST_CHECK(BTN_STATUS_OK == btn_init(&st_btn));
+    sim_run_for(TEST_SETTLE_NS);
+
+    // SW1's pin is taken
+    st_btn_refused.en_btn_pin = BTN_PIN_4;
+    TEST_CHECK(BTN_STATUS_NO_INSTANCE == btn_init(&st_btn_refused));
+    TEST_CHECK(BTN_STATUS_DEACTIVATED == btn_read(&st_btn_refused, &en_state));
+
+    for(u8_trace = 0; u8_trace < TEST_TRACES; u8_trace++)
+    {
+        ptr_st_trace = &gl_arr_st_test_traces[u8_trace];
+        printf("%s\n", ptr_st_trace->ptr_str_name);
+
+        // the pin alternates from the level before the trace
+        en_drive = (TEST_TRACE_RELEASE == ptr_st_trace->en_trace) ? SIM_PIN_RELEASE : SIM_PIN_LOW;
+        u64_start_ns = sim_now_ns();
+        for(u8_edge = 0; u8_edge < ptr_st_trace->u8_edges; u8_edge++)
+        {
+            TEST_CHECK(SIM_OK == sim_pin_schedule(u64_start_ns + (ptr_st_trace->arr_u16_edges_us[u8_edge] * TEST_US),
+                                                  TEST_PORT_F, TEST_BTN_PIN, en_drive));
+            en_drive = (SIM_PIN_LOW == en_drive) ? SIM_PIN_RELEASE : SIM_PIN_LOW;
+        }
+        sim_run_for((ptr_st_trace->arr_u16_edges_us[ptr_st_trace->u8_edges - 1] * TEST_US) + TEST_SETTLE_NS);
+
+        // never blocks, even pressed
+        u64_start_ns = sim_now_ns();
+        TEST_CHECK(BTN_STATUS_OK == btn_read(&st_btn, &en_state));
+        TEST_CHECK_RANGE(sim_now_ns() - u64_start_ns, 0, TEST_READ_MAX_NS);
+        TEST_CHECK(BTN_STATUS_OK == btn_read_edges(&st_btn, &u8_edges));
+
+        en_expected = (TEST_TRACE_PRESS == ptr_st_trace->en_trace) ? BTN_STATE_PRESSED : BTN_STATE_NOT_PRESSED;
+        TEST_CHECK_EQ(en_state, en_expected);
+
+        test_count_events(&u8_presses, &u8_releases);
+        TEST_CHECK_EQ(u8_presses, (TEST_TRACE_PRESS == ptr_st_trace->en_trace) ? 1 : 0);
+        TEST_CHECK_EQ(u8_releases, (TEST_TRACE_RELEASE == ptr_st_trace->en_trace) ? 1 : 0);
+        TEST_CHECK_EQ(u8_edges, (TEST_TRACE_PRESS == ptr_st_trace->en_trace)   ? BTN_EDGE_PRESS   :
+                                (TEST_TRACE_RELEASE == ptr_st_trace->en_trace) ? BTN_EDGE_RELEASE : BTN_EDGE_NONE);
+    }
+
+    return test_result("test_btn_bounce");
+}
@@ -0,0 +1,200 @@
+/**
+ * @file    :   test_btn_events.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Host test: the button event sequence and its timestamps for timed press patterns
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Drives clean edges on SW1 (PF4, pull up) with a 500 ms long press, a 200 ms repeat and a 250 ms
+ * multi-click window, takes the events every ms and checks per scenario:
+ *  - the exact PRESS/RELEASE/CLICK/DOUBLE_CLICK/LONG_PRESS/HOLD_REPEAT sequence,
+ *  - each timestamp within one tick of its nominal time and each event taken within one tick of
+ *    its timestamp,
+ *  - nothing more once the button settled, and no button tick while it stays settled.
+ * Nominal times are from the scenario's first edge, a debounced edge is TEST_DEBOUNCE_MS after
+ * the pin edge. The btn time base stands still while the tick is stopped, timestamps are checked
+ * from the first event's, and again from the first press after a CLICK (the tick stopped in
+ * between).
+ */
+
+#include "sim_interface.h"
+#include "test_interface.h"
+#include "btn_interface.h"
+#include "TM4C123.h"
+
+#include <stdio.h>
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define TEST_MS                     1000000ULL  /* ns */
+
+#define TEST_PORT_F                 5
+#define TEST_BTN_PIN                4
+#define TEST_EDGES_MAX              4
+#define TEST_EVENTS_MAX             8
+#define TEST_DEBOUNCE_MS            (BTN_DEBOUNCE_SAMPLES * BTN_TICK_MS)
+#define TEST_TOL_MS                 BTN_TICK_MS         /* sampling phase of the tick */
+#define TEST_SETTLE_MS              1000                /* after the last nominal event */
+
+#define TEST_LONG_PRESS_MS          500
+#define TEST_REPEAT_MS              200
+#define TEST_MULTI_CLICK_MS         250
+
+#define TEST_SCENARIOS              (sizeof(gl_arr_st_test_scenarios) / sizeof(gl_arr_st_test_scenarios[0]))
+
+/*---------------------------------------------------------/
+/- STRUCTS
+/---------------------------------------------------------*/
+typedef struct
+{
+    en_btn_event_t_         en_event                        ;
+    uint16_t_               u16_ms                          ;   /* nominal time */
+}st_test_event_t_;
+
+typedef struct
+{
+    const char *            ptr_str_name                    ;
+    uint8_t_                u8_edges                        ;
+    uint16_t_               arr_u16_edges_ms[TEST_EDGES_MAX];   /* press, release, press ... */
+    uint8_t_                u8_events                       ;
+    st_test_event_t_        arr_st_events[TEST_EVENTS_MAX]  ;
+}st_test_scenario_t_;
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+static const st_test_scenario_t_ gl_arr_st_test_scenarios[] = {
+    { "single click", 2, { 0, 100 }, 3, {
+        { BTN_EVENT_PRESS,          20 },
+        { BTN_EVENT_RELEASE,        120 },
+        { BTN_EVENT_CLICK,          120 + TEST_MULTI_CLICK_MS } } },
+    { "double click", 4, { 0, 100, 200, 300 }, 5, {
+        { BTN_EVENT_PRESS,          20 },
+        { BTN_EVENT_RELEASE,        120 },
+        { BTN_EVENT_PRESS,          220 },
+        { BTN_EVENT_RELEASE,        320 },
+        { BTN_EVENT_DOUBLE_CLICK,   320 } } },
+    { "two clicks apart", 4, { 0, 100, 400, 500 }, 6, {
+        { BTN_EVENT_PRESS,          20 },
+        { BTN_EVENT_RELEASE,        120 },
+        { BTN_EVENT_CLICK,          120 + TEST_MULTI_CLICK_MS },
+        { BTN_EVENT_PRESS,          420 },
+        { BTN_EVENT_RELEASE,        520 },
+        { BTN_EVENT_CLICK,          520 + TEST_MULTI_CLICK_MS } } },
+    { "long press", 2, { 0, 1000 }, 5, {
+        { BTN_EVENT_PRESS,          20 },
+        { BTN_EVENT_LONG_PRESS,     20 + TEST_LONG_PRESS_MS },
+        { BTN_EVENT_HOLD_REPEAT,    20 + TEST_LONG_PRESS_MS + TEST_REPEAT_MS },
+        { BTN_EVENT_HOLD_REPEAT,    20 + TEST_LONG_PRESS_MS + (2 * TEST_REPEAT_MS) },
+        { BTN_EVENT_RELEASE,        1020 } } },
+    { "click then long press", 4, { 0, 100, 200, 1000 }, 7, {
+        { BTN_EVENT_PRESS,          20 },
+        { BTN_EVENT_RELEASE,        120 },
+        { BTN_EVENT_PRESS,          220 },
+        { BTN_EVENT_CLICK,          220 + TEST_LONG_PRESS_MS },     /* the first press, before the long one */
+        { BTN_EVENT_LONG_PRESS,     220 + TEST_LONG_PRESS_MS },
+        { BTN_EVENT_HOLD_REPEAT,    220 + TEST_LONG_PRESS_MS + TEST_REPEAT_MS },
+        { BTN_EVENT_RELEASE,        1020 } } },
+};
+
+static const char * const gl_arr_str_test_events[BTN_EVENT_TOTAL] = {
+    "PRESS", "RELEASE", "CLICK", "DOUBLE_CLICK", "LONG_PRESS", "HOLD_REPEAT"
+};
+
+/*---------------------------------------------------------/
+/- MAIN
+/---------------------------------------------------------*/
+int main(void)
+{
+    st_btn_config_t_ st_btn = {
+        .en_btn_port = BTN_PORT_F,
+        .en_btn_pin = BTN_PIN_4,
+        .en_btn_pull_type = BTN_INTERNAL_PULL_UP,
+        .u16_btn_long_press_ms = TEST_LONG_PRESS_MS,
+        .u16_btn_repeat_ms = TEST_REPEAT_MS,
+        .u16_btn_multi_click_ms = TEST_MULTI_CLICK_MS,
+        .u16_btn_holdoff_ms = TEST_DEBOUNCE_MS
+    };
+    const st_test_scenario_t_ * ptr_st_scenario;
+    st_btn_event_t_ st_event;
+    en_sim_pin_drive_t_ en_drive;
+    uint64_t_ u64_start_ns;
+    uint32_t_ u32_start_ms = 0;
+    boolean bool_settled;
+    uint32_t_ u32_ticks;
+    uint32_t_ u32_now_ms;
+    uint32_t_ u32_end_ms;
+    uint8_t_ u8_scenario;
+    uint8_t_ u8_edge;
+    uint8_t_ u8_events;
+
+    sim_init();
+
+    TEST_CHECK(BTN_STATUS_OK == btn_init(&st_btn));
+    sim_run_for(TEST_SETTLE_MS * TEST_MS);
+
+    for(u8_scenario = 0; u8_scenario < TEST_SCENARIOS; u8_scenario++)
+    {
+        ptr_st_scenario = &gl_arr_st_test_scenarios[u8_scenario];
+        printf("%s\n", ptr_st_scenario->ptr_str_name);
+
+        u64_start_ns = sim_now_ns();
+
+        en_drive = SIM_PIN_LOW;
+        for(u8_edge = 0; u8_edge < ptr_st_scenario->u8_edges; u8_edge++)
+        {
+            TEST_CHECK(SIM_OK == sim_pin_schedule(u64_start_ns + (ptr_st_scenario->arr_u16_edges_ms[u8_edge] * TEST_MS),
+                                                  TEST_PORT_F, TEST_BTN_PIN, en_drive));
+            en_drive = (SIM_PIN_LOW == en_drive) ? SIM_PIN_RELEASE : SIM_PIN_LOW;
+        }
+
+        u32_end_ms = ptr_st_scenario->arr_st_events[ptr_st_scenario->u8_events - 1].u16_ms + TEST_SETTLE_MS;
+        u8_events = 0;
+        bool_settled = TRUE;
+        for(u32_now_ms = 1; u32_now_ms <= u32_end_ms; u32_now_ms++)
+        {
+            sim_run_for(TEST_MS);
+
+            while(BTN_STATUS_OK == btn_event_get(&st_event))
+            {
+                // btn time base at the first edge, the tick restarted on it
+                if((TRUE == bool_settled) && (BTN_EVENT_PRESS == st_event.en_btn_event) &&
+                   (u8_events < ptr_st_scenario->u8_events))
+                {
+                    u32_start_ms = st_event.u32_time_ms - ptr_st_scenario->arr_st_events[u8_events].u16_ms;
+                }
+                bool_settled = ((BTN_EVENT_CLICK == st_event.en_btn_event) ||
+                                (BTN_EVENT_DOUBLE_CLICK == st_event.en_btn_event));
+
+                printf("  %-12s %4lu ms\n", gl_arr_str_test_events[st_event.en_btn_event],
+                       st_event.u32_time_ms - u32_start_ms);
+
+                TEST_CHECK(&st_btn == st_event.ptr_st_btn);
+                TEST_CHECK_RANGE(st_event.u32_time_ms, u32_start_ms + u32_now_ms - TEST_TOL_MS, u32_start_ms + u32_now_ms);
+
+                if(u8_events < ptr_st_scenario->u8_events)
+                {
+                    TEST_CHECK_EQ(st_event.en_btn_event, ptr_st_scenario->arr_st_events[u8_events].en_event);
+                    TEST_CHECK_RANGE(st_event.u32_time_ms - u32_start_ms,
+                                     ptr_st_scenario->arr_st_events[u8_events].u16_ms - TEST_TOL_MS,
+                                     ptr_st_scenario->arr_st_events[u8_events].u16_ms + TEST_TOL_MS);
+                }
+                u8_events++;
+            }
+        }
+
+        TEST_CHECK_EQ(u8_events, ptr_st_scenario->u8_events);
+
+        // settled: the tick timer stays stopped
+        u32_ticks = sim_irq_entries(TIMER2A_IRQn);
+        sim_run_for(TEST_SETTLE_MS * TEST_MS);
+        TEST_CHECK_EQ(sim_irq_entries(TIMER2A_IRQn), u32_ticks);
+    }
+
+    TEST_CHECK_EQ(btn_event_dropped(), 0);
+
+    return test_result("test_btn_events");
+}
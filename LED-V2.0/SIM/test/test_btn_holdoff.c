@@ -0,0 +1,143 @@
+/**
+ * @file    :   test_btn_holdoff.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Host test: button edge interrupt holdoff under a 1 MHz edge burst
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * SW1 (PF4) with a TEST_HOLDOFF_MS holdoff gets a 1 MHz square wave for TEST_BURST_NS, then
+ * stays pressed. The port F handler may only be entered once per holdoff window of the burst,
+ * the suppressed edges must be counted, and the press must still be debounced once the burst
+ * stops: masking edges loses no transition. The release afterwards must be seen as well.
+ */
+
+#include "sim_interface.h"
+#include "test_interface.h"
+#include "btn_interface.h"
+
+#include <stdio.h>
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define TEST_US                     1000ULL     /* ns */
+#define TEST_MS                     1000000ULL  /* ns */
+
+#define TEST_PORT_F                 5
+#define TEST_BTN_PIN                4
+#define TEST_GPIOF_IRQ              30
+
+#define TEST_HOLDOFF_MS             20
+#define TEST_BURST_START_NS         (50 * TEST_MS)
+#define TEST_BURST_NS               (60 * TEST_MS)
+#define TEST_EDGE_NS                (500)                       /* 1 MHz square wave */
+#define TEST_AHEAD_NS               (50 * TEST_US)              /* pin drives queued ahead of the clock */
+#define TEST_SETTLE_NS              (100 * TEST_MS)
+
+/* the first edge, then at most one per window once it re-arms */
+#define TEST_ENTRIES_MAX            (1 + ((TEST_BURST_NS + (TEST_HOLDOFF_MS * TEST_MS) - 1) / (TEST_HOLDOFF_MS * TEST_MS)))
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+static uint64_t_ gl_u64_test_next_edge_ns = 0;
+static uint64_t_ gl_u64_test_burst_end_ns = 0;     // 0: burst not started
+static boolean gl_bool_test_low = FALSE;
+static boolean gl_bool_test_schedule_failed = FALSE;
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Queues the burst edges due in the next TEST_AHEAD_NS, the model only
+ *                                  holds SIM_EVENTS_MAX pin drives; the burst ends pressed
+ */
+static void test_schedule_burst(void)
+{
+    while((gl_u64_test_burst_end_ns > gl_u64_test_next_edge_ns) &&
+          ((sim_now_ns() + TEST_AHEAD_NS) > gl_u64_test_next_edge_ns))
+    {
+        gl_bool_test_low = (TRUE == gl_bool_test_low) ? FALSE : TRUE;
+        if(SIM_OK != sim_pin_schedule(gl_u64_test_next_edge_ns, TEST_PORT_F, TEST_BTN_PIN,
+                                      (TRUE == gl_bool_test_low) ? SIM_PIN_LOW : SIM_PIN_RELEASE))
+        {
+            gl_bool_test_schedule_failed = TRUE;
+        }
+        gl_u64_test_next_edge_ns += TEST_EDGE_NS;
+    }
+
+    if((ZERO != gl_u64_test_burst_end_ns) && (gl_u64_test_burst_end_ns <= gl_u64_test_next_edge_ns) &&
+       (FALSE == gl_bool_test_low))
+    {
+        gl_bool_test_low = TRUE;
+        sim_pin_schedule(gl_u64_test_next_edge_ns, TEST_PORT_F, TEST_BTN_PIN, SIM_PIN_LOW);
+    }
+}
+
+/**
+ * @brief                       :   Port listener, keeps the burst queued ahead of the clock
+ */
+static void test_port_changed(uint8_t_ u8_port, const st_sim_port_state_t_ * ptr_st_state)
+{
+    (void) u8_port;
+    (void) ptr_st_state;
+
+    test_schedule_burst();
+}
+
+/*---------------------------------------------------------/
+/- MAIN
+/---------------------------------------------------------*/
+int main(void)
+{
+    st_btn_config_t_ st_btn = {
+        .en_btn_port = BTN_PORT_F,
+        .en_btn_pin = BTN_PIN_4,
+        .en_btn_pull_type = BTN_INTERNAL_PULL_UP,
+        .u16_btn_holdoff_ms = TEST_HOLDOFF_MS
+    };
+    en_btn_state_t_ en_state = BTN_STATE_NOT_PRESSED;
+    uint32_t_ u32_entries;
+    uint32_t_ u32_suppressed = 0;
+    uint8_t_ u8_edges = 0;
+
+    sim_init();
+
+    TEST_CHECK(BTN_STATUS_OK == btn_init(&st_btn));
+    sim_add_port_listener(test_port_changed);
+
+    // burst, then pressed long enough to debounce after the last holdoff
+    sim_run_for(TEST_BURST_START_NS);
+    gl_u64_test_next_edge_ns = sim_now_ns();
+    gl_u64_test_burst_end_ns = gl_u64_test_next_edge_ns + TEST_BURST_NS;
+    test_schedule_burst();
+    sim_run_for(TEST_BURST_NS + TEST_SETTLE_NS);
+
+    u32_entries = sim_irq_entries(TEST_GPIOF_IRQ);
+    btn_read_suppressed(&st_btn, &u32_suppressed);
+    printf("%llu edges in %llu ms: %lu handler entries, %lu suppressed holdoff ticks\n",
+           TEST_BURST_NS / TEST_EDGE_NS, TEST_BURST_NS / TEST_MS, u32_entries, u32_suppressed);
+
+    TEST_CHECK(FALSE == gl_bool_test_schedule_failed);
+    TEST_CHECK_RANGE(u32_entries, 1, TEST_ENTRIES_MAX);
+    TEST_CHECK(ZERO != u32_suppressed);
+
+    TEST_CHECK(BTN_STATUS_OK == btn_read(&st_btn, &en_state));
+    TEST_CHECK_EQ(en_state, BTN_STATE_PRESSED);
+    TEST_CHECK(BTN_STATUS_OK == btn_read_edges(&st_btn, &u8_edges));
+    TEST_CHECK(ZERO != (u8_edges & BTN_EDGE_PRESS));
+
+    // a clean release after the burst is still seen
+    sim_remove_port_listener(test_port_changed);
+    sim_pin_drive(TEST_PORT_F, TEST_BTN_PIN, SIM_PIN_RELEASE);
+    sim_run_for(TEST_SETTLE_NS);
+
+    TEST_CHECK(BTN_STATUS_OK == btn_read(&st_btn, &en_state));
+    TEST_CHECK_EQ(en_state, BTN_STATE_NOT_PRESSED);
+    TEST_CHECK(BTN_STATUS_OK == btn_read_edges(&st_btn, &u8_edges));
+    TEST_CHECK_EQ(u8_edges, BTN_EDGE_RELEASE);
+
+    return test_result("test_btn_holdoff");
+}
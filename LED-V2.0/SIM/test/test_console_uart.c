@@ -0,0 +1,261 @@
+/**
+ * @file    :   test_console_uart.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Host test: the UART0 console of the whole firmware, through the uDMA model
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Runs main.c on the register model and types commands on U0RX, like a terminal would: each
+ * command is sent once the previous answer ended with the prompt. Checks:
+ *  - every answer: command output, usage and error lines, the color command's LEDs,
+ *  - a command without a line end runs after the idle time, a too long line is refused,
+ *    commands pasted back to back all run,
+ *  - pickup: the answer starts within one period of the app's time base (the SysTick wake the
+ *    console is polled on, received bytes raise no interrupt) of the command's last byte,
+ *  - throughput: the bytes of an answer leave back to back, one frame each (115107 baud, the
+ *    closest 16 MHz reaches to 115200), across TX ring wraps and uDMA chunks,
+ *  - no byte was dropped on TX nor lost or overrun on RX.
+ */
+
+#include "sim_interface.h"
+#include "test_interface.h"
+#include "console_interface.h"
+#include "uart_interface.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* the firmware's main becomes firmware_main, called once the model is set up */
+#define main firmware_main
+#include "main.c"
+#undef main
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define TEST_NS_PER_MS              1000000ULL
+
+#define TEST_FRAME_NS               86875ULL    /* 10 bits, 16 MHz / (16 x 556 / 64) = 115107 baud */
+#define TEST_TIME_BASE_NS           (50 * TEST_NS_PER_MS)   /* APP_TIME_BASE_MS */
+#define TEST_PICKUP_MAX_NS          (TEST_TIME_BASE_NS + TEST_FRAME_NS + 50000ULL)  /* time base + frame + code */
+#define TEST_IDLE_MIN_NS            (CONSOLE_IDLE_MS * TEST_NS_PER_MS)
+#define TEST_IDLE_MAX_NS            ((2 * TEST_TIME_BASE_NS) + (2 * TEST_NS_PER_MS))   /* picked up, then idle on the next wake */
+#define TEST_TAIL_MS                10          /* after the last answer */
+#define TEST_END_MS                 2000        /* the whole script, else a step hung */
+
+#define TEST_PORT_F                 5
+#define TEST_RGB                    0x0E        /* PF1 -> PF3 */
+#define TEST_GREEN                  (1 << 3)    /* PF3 */
+
+#define TEST_PROMPT                 "> "
+#define TEST_OUT_MAX                1024
+
+/*---------------------------------------------------------/
+/- PRIVATE TYPES
+/---------------------------------------------------------*/
+typedef struct
+{
+    const char *            ptr_str_input   ; /* typed */
+    uint8_t_                u8_prompts      ; /* prompts ending the answer */
+    const char *            ptr_str_expect  ; /* part of the answer */
+    boolean                 bool_idle_end   ; /* ended by the idle time, not a line end */
+    uint8_t_                u8_leds         ; /* RGB LEDs after the answer */
+}st_test_step_t;
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+static const st_test_step_t gl_arr_st_test_steps[] = {
+    { "btn\r",                  1, "presses 0\r\nedges_suppressed 0\r\nevents_dropped 0\r\n> ", FALSE, 0           },
+    { "color green\r\n",        1, "> ",                                                         FALSE, TEST_GREEN  },
+    { "color\r",                1, "usage: color <off|red|green|blue|all> : enter the color state\r\n> ",
+                                                                                                 FALSE, TEST_GREEN  },
+    { "colour red\r",           1, "unknown command, try help\r\n> ",                            FALSE, TEST_GREEN  },
+    { "help\r",                 1, "help\r\ncolor <off|red|green|blue|all> : enter the color state\r\n"
+                                   "btn : button counters\r\nstats : uptime, wake ups, LED/UART counters\r\n> ",
+                                                                                                 FALSE, TEST_GREEN  },
+    { "color off",              1, "\r\n> ",                                                     TRUE,  0           },
+    { "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\r",
+                                1, "line too long\r\n> ",                                        FALSE, 0           },
+    { "btn\rcolor red\rbtn\r",  3, "events_dropped 0\r\n> > presses 0\r\n",                     FALSE, (1 << 1)    },
+    { "stats\r",                1, "uart_tx_dropped 0\r\n",                                      FALSE, (1 << 1)    },
+    { "stats\r",                1, "uart_rx_overruns 0\r\n",                                     FALSE, (1 << 1)    },
+};
+
+#define TEST_STEPS                  (sizeof(gl_arr_st_test_steps) / sizeof(gl_arr_st_test_steps[0]))
+
+static uint8_t_ gl_u8_test_step = 0;
+static boolean gl_bool_test_booted = FALSE;
+static char gl_arr_c_test_out[TEST_OUT_MAX + 1];
+static uint16_t_ gl_u16_test_out = 0;
+static uint16_t_ gl_u16_test_line = 0;         // where the answer's current line starts
+static uint8_t_ gl_u8_test_prompts = 0;
+static uint64_t_ gl_u64_test_sent_ns = 0;       // first command of the step's input received
+static uint64_t_ gl_u64_test_last_ns = 0;       // last byte of the answer so far
+static uint32_t_ gl_u32_test_bytes = 0;
+static uint64_t_ gl_u64_test_busy_ns = 0;       // line time of the answers
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Types the input of the current step
+ */
+static void test_send(void)
+{
+    const char * ptr_str_input = gl_arr_st_test_steps[gl_u8_test_step].ptr_str_input;
+    uint16_t_ u16_length = (uint16_t_) strlen(ptr_str_input);
+    uint16_t_ u16_command = (uint16_t_) strcspn(ptr_str_input, "\r\n");
+
+    gl_u16_test_out = 0;
+    gl_u16_test_line = 0;
+    gl_u8_test_prompts = 0;
+    // the first command ends with its line end, else (idle time) with the input
+    if(u16_command < u16_length)
+    {
+        u16_command++;
+    }
+    gl_u64_test_sent_ns = sim_now_ns() + (u16_command * TEST_FRAME_NS);
+
+    TEST_CHECK(SIM_OK == sim_uart_receive((const uint8_t_ *) ptr_str_input, u16_length));
+}
+
+/**
+ * @brief                       :   Checks the answer of the current step
+ */
+static void test_answer(void)
+{
+    const st_test_step_t * ptr_st_step = &gl_arr_st_test_steps[gl_u8_test_step];
+    st_sim_port_state_t_ st_port;
+
+    gl_arr_c_test_out[gl_u16_test_out] = '\0';
+    if(NULL_PTR == strstr(gl_arr_c_test_out, ptr_st_step->ptr_str_expect))
+    {
+        printf("step %u (%s): answer\n%s\n", gl_u8_test_step, ptr_st_step->ptr_str_input, gl_arr_c_test_out);
+        TEST_CHECK(FALSE);
+    }
+
+    sim_port_get_state(TEST_PORT_F, &st_port);
+    TEST_CHECK_EQ(st_port.u8_levels & st_port.u8_dir & TEST_RGB, ptr_st_step->u8_leds);
+}
+
+/**
+ * @brief                       :   End of the simulation: checks every step ran and nothing was lost
+ */
+static void test_end(void)
+{
+    st_uart_stats_t st_uart_stats;
+
+    TEST_CHECK_EQ(gl_u8_test_step, TEST_STEPS);
+
+    uart_get_stats(&st_uart_stats);
+    TEST_CHECK_EQ(st_uart_stats.u32_tx_dropped, 0);
+    TEST_CHECK_EQ(st_uart_stats.u32_rx_overruns, 0);
+    TEST_CHECK_EQ(sim_uart_rx_lost(), 0);
+    TEST_CHECK(st_uart_stats.u32_tx_bytes > UART_TX_BUFFER_SIZE);
+    TEST_CHECK(st_uart_stats.u32_rx_bytes > UART_RX_BUFFER_SIZE);
+
+    printf("%u steps, %lu bytes answered, %.0f bytes/s while answering, tx %lu rx %lu\n",
+           gl_u8_test_step, gl_u32_test_bytes,
+           (double) (gl_u32_test_bytes - gl_u8_test_step) * 1e9 / (double) gl_u64_test_busy_ns,
+           st_uart_stats.u32_tx_bytes, st_uart_stats.u32_rx_bytes);
+
+    exit(test_result("test_console_uart"));
+}
+
+/**
+ * @brief                       :   UART listener: collects the answer, checks its timing, types the
+ *                                  next step once the answer ended with its prompts
+ */
+static void test_uart_byte(uint8_t_ u8_byte)
+{
+    uint64_t_ u64_now_ns = sim_now_ns();
+    const st_test_step_t * ptr_st_step = &gl_arr_st_test_steps[gl_u8_test_step];
+
+    if(TEST_OUT_MAX > gl_u16_test_out)
+    {
+        gl_arr_c_test_out[gl_u16_test_out++] = (char) u8_byte;
+    }
+
+    if(TRUE == gl_bool_test_booted)
+    {
+        if(1 == gl_u16_test_out)
+        {
+            // the first byte ends one frame after it started
+            if(TRUE == ptr_st_step->bool_idle_end)
+            {
+                TEST_CHECK_RANGE(u64_now_ns - gl_u64_test_sent_ns, TEST_IDLE_MIN_NS, TEST_IDLE_MAX_NS);
+            }
+            else
+            {
+                TEST_CHECK_RANGE(u64_now_ns - gl_u64_test_sent_ns, TEST_FRAME_NS, TEST_PICKUP_MAX_NS);
+            }
+        }
+        else
+        {
+            // back to back
+            TEST_CHECK_EQ(u64_now_ns - gl_u64_test_last_ns, TEST_FRAME_NS);
+            gl_u64_test_busy_ns += u64_now_ns - gl_u64_test_last_ns;
+        }
+        gl_u32_test_bytes++;
+    }
+    gl_u64_test_last_ns = u64_now_ns;
+
+    if('\n' == u8_byte)
+    {
+        gl_u16_test_line = gl_u16_test_out;
+    }
+
+    // the prompt starts a line ("<off|...|all> " of a usage doesn't)
+    if(
+            ((gl_u16_test_line + 2) == gl_u16_test_out)                                 &&
+            (0 == memcmp(&gl_arr_c_test_out[gl_u16_test_line], TEST_PROMPT, 2))
+            )
+    {
+        gl_u16_test_line = gl_u16_test_out;
+        gl_u8_test_prompts++;
+
+        if(FALSE == gl_bool_test_booted)
+        {
+            // "\r\n> " of console_init
+            gl_bool_test_booted = TRUE;
+            test_send();
+        }
+        else if(ptr_st_step->u8_prompts == gl_u8_test_prompts)
+        {
+            test_answer();
+
+            gl_u8_test_step++;
+            if(TEST_STEPS > gl_u8_test_step)
+            {
+                test_send();
+            }
+            else
+            {
+                sim_set_end(u64_now_ns + (TEST_TAIL_MS * TEST_NS_PER_MS), test_end);
+            }
+        }
+        else
+        {
+            /* more answers to come */
+        }
+    }
+}
+
+/*---------------------------------------------------------/
+/- MAIN
+/---------------------------------------------------------*/
+int main(void)
+{
+    sim_init();
+    sim_set_uart_listener(test_uart_byte);
+    sim_set_end(TEST_END_MS * TEST_NS_PER_MS, test_end);
+
+    firmware_main();
+
+    TEST_CHECK(FALSE);
+    return test_result("test_console_uart");
+}
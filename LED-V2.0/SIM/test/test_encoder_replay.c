@@ -0,0 +1,160 @@
+/**
+ * @file    :   test_encoder_replay.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Host test: quadrature encoder decoding of a long transition replay
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Replays TEST_TRANSITIONS forward quadrature transitions on PB0 (A) / PB1 (B), one jump where
+ * both channels change before the edge interrupt runs (a missed edge), then as many transitions
+ * backward. The position must follow every transition exactly, the jump must count as the
+ * only error without moving the position, and the sampled velocity must match the replay rate.
+ */
+
+#include "sim_interface.h"
+#include "test_interface.h"
+#include "encoder_interface.h"
+
+#include <stdio.h>
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define TEST_US                     1000ULL     /* ns */
+#define TEST_MS                     1000000ULL  /* ns */
+
+#define TEST_PORT_B                 1
+#define TEST_PIN_A                  0
+#define TEST_PIN_B                  1
+
+#define TEST_TRANSITIONS            25600       /* each way */
+#define TEST_EDGE_NS                (20 * TEST_US)
+#define TEST_VELOCITY               50000       /* counts per second, one count per TEST_EDGE_NS */
+#define TEST_VELOCITY_TOLERANCE     500         /* 1 % */
+#define TEST_SAMPLE_MS              10
+#define TEST_AHEAD_NS               (1 * TEST_MS)
+#define TEST_SETTLE_NS              (50 * TEST_MS)
+
+/* Gray state (A << 1) | B of each step of the forward sequence 00 -> 01 -> 11 -> 10 */
+#define TEST_GRAY_STEPS             4
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+static const uint8_t_ gl_arr_u8_test_gray[TEST_GRAY_STEPS] = { 0, 1, 3, 2 };
+
+static uint8_t_ gl_u8_test_step = 0;            // index in gl_arr_u8_test_gray of the last scheduled state
+static sint8_t_ gl_s8_test_direction = 1;
+static uint32_t_ gl_u32_test_remaining = 0;     // transitions left to schedule
+static uint64_t_ gl_u64_test_next_ns = 0;
+static boolean gl_bool_test_schedule_failed = FALSE;
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Queues the transitions due in the next TEST_AHEAD_NS, the model only
+ *                                  holds SIM_EVENTS_MAX pin drives
+ */
+static void test_schedule_transitions(void)
+{
+    uint8_t_ u8_previous;
+    uint8_t_ u8_state;
+    uint8_t_ u8_pin;
+
+    while((ZERO != gl_u32_test_remaining) && ((sim_now_ns() + TEST_AHEAD_NS) > gl_u64_test_next_ns))
+    {
+        u8_previous = gl_arr_u8_test_gray[gl_u8_test_step];
+        gl_u8_test_step = (uint8_t_)((gl_u8_test_step + TEST_GRAY_STEPS + gl_s8_test_direction) % TEST_GRAY_STEPS);
+        u8_state = gl_arr_u8_test_gray[gl_u8_test_step];
+
+        // one channel changes per step
+        u8_pin = (ZERO != ((u8_previous ^ u8_state) & 2)) ? TEST_PIN_A : TEST_PIN_B;
+        if(SIM_OK != sim_pin_schedule(gl_u64_test_next_ns, TEST_PORT_B, u8_pin,
+                                      (ZERO != (u8_state & ((TEST_PIN_A == u8_pin) ? 2 : 1))) ? SIM_PIN_HIGH : SIM_PIN_LOW))
+        {
+            gl_bool_test_schedule_failed = TRUE;
+        }
+
+        gl_u64_test_next_ns += TEST_EDGE_NS;
+        gl_u32_test_remaining--;
+    }
+}
+
+/**
+ * @brief                       :   Port listener, keeps the replay queued ahead of the clock
+ */
+static void test_port_changed(uint8_t_ u8_port, const st_sim_port_state_t_ * ptr_st_state)
+{
+    (void) u8_port;
+    (void) ptr_st_state;
+
+    test_schedule_transitions();
+}
+
+/**
+ * @brief                       :   Replays transitions in one direction, checks the velocity halfway
+ */
+static void test_replay(sint8_t_ s8_direction)
+{
+    gl_s8_test_direction = s8_direction;
+    gl_u32_test_remaining = TEST_TRANSITIONS;
+    gl_u64_test_next_ns = sim_now_ns() + TEST_EDGE_NS;
+    test_schedule_transitions();
+
+    sim_run_for((TEST_TRANSITIONS / 2) * TEST_EDGE_NS);
+    printf("velocity %ld counts/s\n", encoder_get_velocity());
+    TEST_CHECK_RANGE(encoder_get_velocity(), (s8_direction * TEST_VELOCITY) - TEST_VELOCITY_TOLERANCE,
+                     (s8_direction * TEST_VELOCITY) + TEST_VELOCITY_TOLERANCE);
+
+    sim_run_for(((TEST_TRANSITIONS / 2) * TEST_EDGE_NS) + TEST_SETTLE_NS);
+    TEST_CHECK_EQ(gl_u32_test_remaining, 0);
+}
+
+/*---------------------------------------------------------/
+/- MAIN
+/---------------------------------------------------------*/
+int main(void)
+{
+    const st_encoder_cfg_t_ st_encoder_cfg = {
+        .en_port = BTN_PORT_B,
+        .en_pin_a = BTN_PIN_0,
+        .en_pin_b = BTN_PIN_1,
+        .en_pull_type = BTN_INTERNAL_PULL_UP,
+        .en_timer = TIMER_3,
+        .u16_sample_ms = TEST_SAMPLE_MS
+    };
+
+    sim_init();
+
+    // both channels low: state 00, step 0 of the Gray sequence
+    sim_pin_drive(TEST_PORT_B, TEST_PIN_A, SIM_PIN_LOW);
+    sim_pin_drive(TEST_PORT_B, TEST_PIN_B, SIM_PIN_LOW);
+    TEST_CHECK(ENCODER_OK == encoder_init(&st_encoder_cfg));
+    sim_add_port_listener(test_port_changed);
+
+    test_replay(1);
+    TEST_CHECK_EQ(encoder_get_position(), TEST_TRANSITIONS);
+    TEST_CHECK_EQ(encoder_get_errors(), 0);
+
+    // both channels change while interrupts are masked: the handler sees a two step jump
+    gl_u8_test_step = (uint8_t_)((gl_u8_test_step + 2) % TEST_GRAY_STEPS);
+    sim_irq_mask(TRUE);
+    sim_pin_drive(TEST_PORT_B, TEST_PIN_A, (ZERO != (gl_arr_u8_test_gray[gl_u8_test_step] & 2)) ? SIM_PIN_HIGH : SIM_PIN_LOW);
+    sim_pin_drive(TEST_PORT_B, TEST_PIN_B, (ZERO != (gl_arr_u8_test_gray[gl_u8_test_step] & 1)) ? SIM_PIN_HIGH : SIM_PIN_LOW);
+    sim_irq_mask(FALSE);
+    sim_run_for(TEST_SETTLE_NS);
+    TEST_CHECK_EQ(encoder_get_position(), TEST_TRANSITIONS);
+    TEST_CHECK_EQ(encoder_get_errors(), 1);
+
+    test_replay(-1);
+    TEST_CHECK_EQ(encoder_get_position(), 0);
+    TEST_CHECK_EQ(encoder_get_errors(), 1);
+    TEST_CHECK_EQ(encoder_get_velocity(), 0);
+
+    TEST_CHECK(FALSE == gl_bool_test_schedule_failed);
+
+    return test_result("test_encoder_replay");
+}
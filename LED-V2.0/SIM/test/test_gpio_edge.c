@@ -0,0 +1,133 @@
+/**
+ * @file    :   test_gpio_edge.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Host test: edge interrupt to output toggle delay of the vcd_gpio_demo button
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * The bouncing PF4 press of vcd_gpio_demo, without the PWM: every falling edge interrupt toggles
+ * PF2 through gpio_togPinVal. Each toggle must follow its edge by exactly
+ * TEST_EDGE_DELAY_ACCESSES register accesses of the ISR path, 630 ns.
+ */
+
+#include "sim_interface.h"
+#include "test_interface.h"
+#include "gpio_interface.h"
+#include "led_interface.h"
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define TEST_US                     1000ULL     /* ns */
+#define TEST_MS                     1000000ULL  /* ns */
+
+#define TEST_PRESS_NS               (6 * TEST_MS)
+#define TEST_BOUNCE_NS              (50 * TEST_US)
+#define TEST_BOUNCES                3           /* extra low pulses after the first edge */
+#define TEST_RELEASE_NS             (9 * TEST_MS)
+#define TEST_END_NS                 (10 * TEST_MS)
+
+#define TEST_EDGE_DELAY_ACCESSES    10
+#define TEST_EDGE_DELAY_NS          (TEST_EDGE_DELAY_ACCESSES * SIM_ACCESS_NS)     /* 630 ns */
+
+#define TEST_PORT_F                 5
+#define TEST_BTN_PIN                4
+#define TEST_BLUE_PIN               2
+#define TEST_EDGES_MAX              8
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+static uint64_t_ gl_arr_u64_test_edges_ns[TEST_EDGES_MAX];
+static uint64_t_ gl_arr_u64_test_toggles_ns[TEST_EDGES_MAX];
+static uint8_t_ gl_u8_test_edges = 0;
+static uint8_t_ gl_u8_test_toggles = 0;
+static uint8_t_ gl_u8_test_levels = 0;
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Button falling edge interrupt callback, toggles the blue LED
+ */
+static void test_btn_edge(void)
+{
+    gpio_togPinVal(GPIO_PORT_F, GPIO_PIN_2);
+}
+
+/**
+ * @brief                       :   Port listener, stamps the button falling edges and the blue toggles
+ */
+static void test_port_changed(uint8_t_ u8_port, const st_sim_port_state_t_ * ptr_st_state)
+{
+    uint8_t_ u8_changed = gl_u8_test_levels ^ ptr_st_state->u8_levels;
+
+    if(TEST_PORT_F == u8_port)
+    {
+        if((ZERO != (u8_changed & (1 << TEST_BTN_PIN))) && (ZERO == (ptr_st_state->u8_levels & (1 << TEST_BTN_PIN))) &&
+           (TEST_EDGES_MAX > gl_u8_test_edges))
+        {
+            gl_arr_u64_test_edges_ns[gl_u8_test_edges++] = sim_now_ns();
+        }
+
+        if((ZERO != (u8_changed & (1 << TEST_BLUE_PIN))) && (TEST_EDGES_MAX > gl_u8_test_toggles))
+        {
+            gl_arr_u64_test_toggles_ns[gl_u8_test_toggles++] = sim_now_ns();
+        }
+
+        gl_u8_test_levels = ptr_st_state->u8_levels;
+    }
+}
+
+/*---------------------------------------------------------/
+/- MAIN
+/---------------------------------------------------------*/
+int main(void)
+{
+    st_gpio_cfg_t st_btn_cfg = {
+        .port = GPIO_PORT_F,
+        .pin = GPIO_PIN_4,
+        .current = PIN_CURRENT_2MA,
+        .pin_cfg = INPUT_PULL_UP
+    };
+    st_sim_port_state_t_ st_port;
+    uint64_t_ u64_at = TEST_PRESS_NS;
+    uint8_t_ u8_bounce;
+    uint8_t_ u8_edge;
+
+    sim_init();
+
+    TEST_CHECK(LED_OK == led_init(LED_PORT_F, LED_PIN_2));
+    TEST_CHECK(GPIO_OK == gpio_pin_init(&st_btn_cfg));
+    TEST_CHECK(GPIO_OK == gpio_setIntSense(GPIO_PORT_F, GPIO_PIN_4, FALLING_EDGE));
+    TEST_CHECK(GPIO_OK == gpio_setIntCallback(GPIO_PORT_F, GPIO_PIN_4, test_btn_edge));
+    TEST_CHECK(GPIO_OK == gpio_enableInt(GPIO_PORT_F, GPIO_PIN_4));
+
+    sim_pin_schedule(u64_at, TEST_PORT_F, TEST_BTN_PIN, SIM_PIN_LOW);
+    for(u8_bounce = 0; u8_bounce < TEST_BOUNCES; u8_bounce++)
+    {
+        sim_pin_schedule(u64_at + TEST_BOUNCE_NS, TEST_PORT_F, TEST_BTN_PIN, SIM_PIN_RELEASE);
+        sim_pin_schedule(u64_at + (2 * TEST_BOUNCE_NS), TEST_PORT_F, TEST_BTN_PIN, SIM_PIN_LOW);
+        u64_at += 2 * TEST_BOUNCE_NS;
+    }
+    sim_pin_schedule(TEST_RELEASE_NS, TEST_PORT_F, TEST_BTN_PIN, SIM_PIN_RELEASE);
+
+    sim_port_get_state(TEST_PORT_F, &st_port);
+    gl_u8_test_levels = st_port.u8_levels;
+    sim_add_port_listener(test_port_changed);
+
+    sim_run_for(TEST_END_NS - sim_now_ns());
+
+    // one toggle per falling edge, the release edge toggles nothing
+    TEST_CHECK_EQ(gl_u8_test_edges, TEST_BOUNCES + 1);
+    TEST_CHECK_EQ(gl_u8_test_toggles, gl_u8_test_edges);
+
+    for(u8_edge = 0; (u8_edge < gl_u8_test_edges) && (u8_edge < gl_u8_test_toggles); u8_edge++)
+    {
+        TEST_CHECK_EQ(gl_arr_u64_test_toggles_ns[u8_edge] - gl_arr_u64_test_edges_ns[u8_edge], TEST_EDGE_DELAY_NS);
+    }
+
+    return test_result("test_gpio_edge");
+}
@@ -0,0 +1,63 @@
+/**
+ * @file    :   test_interface.h
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Header File contains all host test checks' macros and functions' prototypes
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Checks of the SIM test programs (ctest). A failed check is printed with its source line and
+ * the program goes on, test_result gives the exit code once every check ran.
+ */
+
+#ifndef TEST_INTERFACE_H_
+#define TEST_INTERFACE_H_
+
+#include "std.h"
+
+/*----------------------------------------------------------/
+/- MACROS
+/----------------------------------------------------------*/
+#define TEST_CHECK(COND)                    test_check((COND) ? TRUE : FALSE, #COND, __FILE__, __LINE__)
+#define TEST_CHECK_RANGE(VALUE, MIN, MAX)   test_check_range((sint64_t_)(VALUE), (sint64_t_)(MIN), (sint64_t_)(MAX), \
+                                                             #VALUE, __FILE__, __LINE__)
+#define TEST_CHECK_EQ(VALUE, EXPECTED)      TEST_CHECK_RANGE(VALUE, EXPECTED, EXPECTED)
+
+/*---------------------------------------------------------/
+/- FUNCTION PROTOTYPES
+/---------------------------------------------------------*/
+
+/**
+ * @brief                       :   Counts a check, prints it when it failed
+ *
+ * @param[in]   bool_passed     :   TRUE: check passed
+ * @param[in]   ptr_str_check   :   Checked expression
+ * @param[in]   ptr_str_file    :   Source file of the check
+ * @param[in]   u32_line        :   Source line of the check
+ */
+void test_check(boolean bool_passed, const char * ptr_str_check, const char * ptr_str_file, uint32_t_ u32_line);
+
+/**
+ * @brief                       :   Counts a check of a value against a range, prints the value when out of it
+ *
+ * @param[in]   s64_value       :   Value
+ * @param[in]   s64_min         :   Smallest value passing
+ * @param[in]   s64_max         :   Largest value passing
+ * @param[in]   ptr_str_value   :   Checked expression
+ * @param[in]   ptr_str_file    :   Source file of the check
+ * @param[in]   u32_line        :   Source line of the check
+ */
+void test_check_range(sint64_t_ s64_value, sint64_t_ s64_min, sint64_t_ s64_max,
+                      const char * ptr_str_value, const char * ptr_str_file, uint32_t_ u32_line);
+
+/**
+ * @brief                       :   Prints the number of checks and failures
+ *
+ * @param[in]   ptr_str_name    :   Test name
+ *
+ * @return  process exit code, 0: every check passed and at least one ran, 1: else
+ */
+int test_result(const char * ptr_str_name);
+
+#endif /* TEST_INTERFACE_H_ */
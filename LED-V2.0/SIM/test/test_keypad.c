@@ -0,0 +1,250 @@
+/**
+ * @file    :   test_keypad.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Host test: keypad scan of a 4x4 and an 8x8 matrix, key detection latency and scan cost
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Wires a key matrix to the model: rows on port B, columns on port A (pull ups), a pressed key
+ * pulls its column low while its row is driven low. The column drives follow the row pins from
+ * a port listener, scheduled at the row change so they settle before the next column read.
+ * Per matrix, TEST_PRESSES presses of pseudo random keys at pseudo random scan phases, then:
+ *  - each press and release gives one event of that key, after TEST_SCANS_MIN to TEST_SCANS_MAX
+ *    full scan periods (the row read once per scan, then KEYPAD_DEBOUNCE_SCANS identical scans),
+ *  - the scan costs the same register accesses per row tick for both sizes, with no key down,
+ * and prints the latency min/mean/max and the accesses per row tick and per full scan.
+ */
+
+#include "sim_interface.h"
+#include "test_interface.h"
+#include "keypad_interface.h"
+#include "TM4C123.h"
+
+#include <stdio.h>
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define TEST_US                     1000ULL     /* ns */
+#define TEST_MS                     1000000ULL  /* ns */
+
+#define TEST_PORT_A                 0           /* columns */
+#define TEST_PORT_B                 1           /* rows */
+
+#define TEST_SCAN_HZ                200
+#define TEST_PERIOD_NS              (1000000000ULL / TEST_SCAN_HZ)
+#define TEST_SCANS_MIN              (KEYPAD_DEBOUNCE_SCANS - 1)     /* key down just before its row is read */
+#define TEST_SCANS_MAX              (KEYPAD_DEBOUNCE_SCANS + 1)     /* plus the wait for the key's row */
+#define TEST_PRESSES                40
+#define TEST_HOLD_MS                100
+#define TEST_GAP_MS                 60
+#define TEST_POLL_NS                (20 * TEST_US)
+#define TEST_IDLE_SCANS             100
+#define TEST_TICK_ACCESSES          4           /* timer ack, column read, row direction read modify write */
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+static const st_keypad_cfg_t_ gl_arr_st_test_keypads[] = {
+    {
+        .en_row_port = BTN_PORT_B, .arr_en_row_pins = { BTN_PIN_0, BTN_PIN_1, BTN_PIN_2, BTN_PIN_3 }, .u8_rows = 4,
+        .en_col_port = BTN_PORT_A, .arr_en_col_pins = { BTN_PIN_0, BTN_PIN_1, BTN_PIN_2, BTN_PIN_3 }, .u8_cols = 4,
+        .en_timer = TIMER_1, .u16_scan_hz = TEST_SCAN_HZ
+    },
+    {
+        .en_row_port = BTN_PORT_B, .arr_en_row_pins = { BTN_PIN_0, BTN_PIN_1, BTN_PIN_2, BTN_PIN_3,
+                                                        BTN_PIN_4, BTN_PIN_5, BTN_PIN_6, BTN_PIN_7 }, .u8_rows = 8,
+        .en_col_port = BTN_PORT_A, .arr_en_col_pins = { BTN_PIN_0, BTN_PIN_1, BTN_PIN_2, BTN_PIN_3,
+                                                        BTN_PIN_4, BTN_PIN_5, BTN_PIN_6, BTN_PIN_7 }, .u8_cols = 8,
+        .en_timer = TIMER_1, .u16_scan_hz = TEST_SCAN_HZ
+    },
+};
+
+#define TEST_KEYPADS                (sizeof(gl_arr_st_test_keypads) / sizeof(gl_arr_st_test_keypads[0]))
+
+/* pressed columns of every row (port A bits), column pins pulled low now */
+static uint8_t_ gl_arr_u8_test_pressed[KEYPAD_ROWS_MAX];
+static uint8_t_ gl_u8_test_cols_low = 0;
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Columns pulled low by the pressed keys of the rows driven low
+ */
+static uint8_t_ test_cols_low(void)
+{
+    st_sim_port_state_t_ st_rows;
+    uint8_t_ u8_cols = 0;
+    uint8_t_ u8_row;
+
+    sim_port_get_state(TEST_PORT_B, &st_rows);
+
+    for(u8_row = 0; u8_row < KEYPAD_ROWS_MAX; u8_row++)
+    {
+        if((st_rows.u8_dir & ~st_rows.u8_levels) & (1 << u8_row))
+        {
+            u8_cols |= gl_arr_u8_test_pressed[u8_row];
+        }
+    }
+
+    return u8_cols;
+}
+
+/**
+ * @brief                       :   Schedules the column pins that change now
+ */
+static void test_cols_follow(void)
+{
+    uint8_t_ u8_cols = test_cols_low();
+    uint8_t_ u8_changed = u8_cols ^ gl_u8_test_cols_low;
+    uint8_t_ u8_col;
+
+    for(u8_col = 0; u8_col < KEYPAD_COLS_MAX; u8_col++)
+    {
+        if(u8_changed & (1 << u8_col))
+        {
+            TEST_CHECK(SIM_OK == sim_pin_schedule(sim_now_ns(), TEST_PORT_A, u8_col,
+                                                  (u8_cols & (1 << u8_col)) ? SIM_PIN_LOW : SIM_PIN_RELEASE));
+        }
+    }
+
+    gl_u8_test_cols_low = u8_cols;
+}
+
+/**
+ * @brief                       :   Port listener, the columns follow the rows
+ */
+static void test_port_changed(uint8_t_ u8_port, const st_sim_port_state_t_ * ptr_st_state)
+{
+    (void) ptr_st_state;
+
+    if(TEST_PORT_B == u8_port)
+    {
+        test_cols_follow();
+    }
+}
+
+/**
+ * @brief                       :   Runs until the keypad gives an event or the time is out
+ *
+ * @param[out]  ptr_st_event    :   Event
+ * @param[in]   u64_max_ns      :   Longest wait
+ *
+ * @return  time waited, u64_max_ns and more when no event came
+ */
+static uint64_t_ test_wait_event(st_keypad_event_t_ * ptr_st_event, uint64_t_ u64_max_ns)
+{
+    uint64_t_ u64_start_ns = sim_now_ns();
+
+    while((KEYPAD_OK != keypad_event_get(ptr_st_event)) && ((sim_now_ns() - u64_start_ns) <= u64_max_ns))
+    {
+        sim_run_for(TEST_POLL_NS);
+    }
+
+    return sim_now_ns() - u64_start_ns;
+}
+
+/**
+ * @brief                       :   Presses and releases keys of a keypad, checks the events and their latency,
+ *                                  then measures the idle scan cost
+ *
+ * @param[in]   ptr_st_cfg      :   Keypad
+ * @param[out]  ptr_u64_tick    :   Register accesses per row tick, in 1/1000
+ */
+static void test_keypad(const st_keypad_cfg_t_ * ptr_st_cfg, uint64_t_ * ptr_u64_tick)
+{
+    st_keypad_event_t_ st_event;
+    uint32_t_ u32_seed = ptr_st_cfg->u8_rows;
+    uint64_t_ u64_latency_ns;
+    uint64_t_ u64_min_ns = SIM_TIME_NEVER;
+    uint64_t_ u64_max_ns = 0;
+    uint64_t_ u64_sum_ns = 0;
+    uint64_t_ u64_accesses;
+    uint32_t_ u32_ticks;
+    uint32_t_ u32_press;
+    uint8_t_ u8_edge;
+    uint8_t_ u8_row;
+    uint8_t_ u8_col;
+
+    sim_init();
+    TEST_CHECK(SIM_OK == sim_add_port_listener(test_port_changed));
+    for(u8_row = 0; u8_row < KEYPAD_ROWS_MAX; u8_row++)
+    {
+        gl_arr_u8_test_pressed[u8_row] = 0;
+    }
+    gl_u8_test_cols_low = 0;
+
+    TEST_CHECK(KEYPAD_OK == keypad_init(ptr_st_cfg));
+    sim_run_for(TEST_PERIOD_NS * TEST_SCANS_MAX);
+    TEST_CHECK(KEYPAD_ERROR == keypad_event_get(&st_event));
+
+    for(u32_press = 0; u32_press < TEST_PRESSES; u32_press++)
+    {
+        // LCG: key, then the phase to the scan
+        u32_seed = (u32_seed * 1103515245UL) + 12345UL;
+        u8_row = (uint8_t_) ((u32_seed >> 16) % ptr_st_cfg->u8_rows);
+        u8_col = (uint8_t_) ((u32_seed >> 24) % ptr_st_cfg->u8_cols);
+        u32_seed = (u32_seed * 1103515245UL) + 12345UL;
+        sim_run_for((u32_seed >> 8) % TEST_PERIOD_NS);
+
+        for(u8_edge = 0; u8_edge < 2; u8_edge++)
+        {
+            gl_arr_u8_test_pressed[u8_row] ^= (1 << ptr_st_cfg->arr_en_col_pins[u8_col]);
+            test_cols_follow();
+
+            u64_latency_ns = test_wait_event(&st_event, TEST_PERIOD_NS * TEST_SCANS_MAX);
+            TEST_CHECK_RANGE(u64_latency_ns, TEST_PERIOD_NS * TEST_SCANS_MIN, TEST_PERIOD_NS * TEST_SCANS_MAX);
+            TEST_CHECK_EQ(st_event.u8_key, (u8_row * ptr_st_cfg->u8_cols) + u8_col);
+            TEST_CHECK_EQ(st_event.bool_pressed, (ZERO == u8_edge) ? TRUE : FALSE);
+            TEST_CHECK_EQ(keypad_is_pressed(u8_row, u8_col), (ZERO == u8_edge) ? TRUE : FALSE);
+
+            u64_min_ns = (u64_latency_ns < u64_min_ns) ? u64_latency_ns : u64_min_ns;
+            u64_max_ns = (u64_latency_ns > u64_max_ns) ? u64_latency_ns : u64_max_ns;
+            u64_sum_ns += u64_latency_ns;
+
+            sim_run_for(((ZERO == u8_edge) ? TEST_HOLD_MS : TEST_GAP_MS) * TEST_MS);
+            TEST_CHECK(KEYPAD_ERROR == keypad_event_get(&st_event));
+        }
+    }
+
+    TEST_CHECK(FALSE == keypad_is_ghosting());
+
+    // idle scans, every row read once per period
+    u32_ticks = sim_irq_entries(TIMER1A_IRQn);
+    u64_accesses = sim_access_count();
+    sim_run_for(TEST_PERIOD_NS * TEST_IDLE_SCANS);
+    u32_ticks = sim_irq_entries(TIMER1A_IRQn) - u32_ticks;
+    u64_accesses = sim_access_count() - u64_accesses;
+
+    TEST_CHECK_RANGE(u32_ticks, (TEST_IDLE_SCANS * ptr_st_cfg->u8_rows) - 1, TEST_IDLE_SCANS * ptr_st_cfg->u8_rows);
+    *ptr_u64_tick = (u64_accesses * 1000) / u32_ticks;
+
+    printf("%ux%u at %d Hz: latency min %llu us, mean %llu us, max %llu us (scan period %llu us)\n",
+           ptr_st_cfg->u8_rows, ptr_st_cfg->u8_cols, TEST_SCAN_HZ, u64_min_ns / TEST_US,
+           u64_sum_ns / (2 * TEST_PRESSES * TEST_US), u64_max_ns / TEST_US, TEST_PERIOD_NS / TEST_US);
+    printf("  %llu.%03llu accesses per row tick, %llu per full scan, %.3f%% of the time on the bus\n",
+           *ptr_u64_tick / 1000, *ptr_u64_tick % 1000, (*ptr_u64_tick * ptr_st_cfg->u8_rows) / 1000,
+           100.0 * (double) u64_accesses * 63.0 / (double) (TEST_PERIOD_NS * TEST_IDLE_SCANS));
+
+    sim_remove_port_listener(test_port_changed);
+}
+
+/*---------------------------------------------------------/
+/- MAIN
+/---------------------------------------------------------*/
+int main(void)
+{
+    uint64_t_ arr_u64_tick[TEST_KEYPADS];
+    uint8_t_ u8_keypad;
+
+    for(u8_keypad = 0; u8_keypad < TEST_KEYPADS; u8_keypad++)
+    {
+        test_keypad(&gl_arr_st_test_keypads[u8_keypad], &arr_u64_tick[u8_keypad]);
+        TEST_CHECK_EQ(arr_u64_tick[u8_keypad], TEST_TICK_ACCESSES * 1000);
+    }
+
+    return test_result("test_keypad");
+}
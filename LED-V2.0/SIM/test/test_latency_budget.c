@@ -0,0 +1,135 @@
+/**
+ * @file    :   test_latency_budget.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Host test: p99 button to LED latency of the whole firmware against its budget
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Runs main.c built with LATENCY_INSTRUMENTATION = 1 on the register model and presses SW1 (PF4)
+ * TEST_PRESSES times, each press bouncing and at a different phase of the ticks. Every press must
+ * give one latency sample and the histogram's p99 must stay within TEST_P99_BUDGET_US.
+ */
+
+#include "sim_interface.h"
+#include "test_interface.h"
+#include "latency_interface.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* the firmware's main becomes firmware_main, called once the model is set up */
+#define main firmware_main
+#include "main.c"
+#undef main
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define TEST_US                     1000ULL     /* ns */
+#define TEST_MS                     1000000ULL  /* ns */
+
+#define TEST_PORT_F                 5
+#define TEST_BTN_PIN                4
+
+#define TEST_PRESSES                100
+#define TEST_FIRST_NS               (500 * TEST_MS)
+#define TEST_PERIOD_NS              (300 * TEST_MS)
+#define TEST_PHASE_NS               (137 * TEST_US)     /* press phase step against the 1 ms and 5 ms ticks */
+#define TEST_BOUNCE_NS              (400 * TEST_US)
+#define TEST_BOUNCES                3
+#define TEST_HOLD_NS                (80 * TEST_MS)
+#define TEST_AHEAD_NS               (4 * TEST_PERIOD_NS)
+
+#define TEST_P99_BUDGET_US          35000               /* 20 ms holdoff a bounce can wait for, then 15 ms debounce */
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+static uint16_t_ gl_u16_test_scheduled = 0;
+static boolean gl_bool_test_schedule_failed = FALSE;
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Schedules the presses due in the next TEST_AHEAD_NS, the model
+ *                                  only queues SIM_EVENTS_MAX pin drives
+ */
+static void test_schedule_presses(void)
+{
+    uint64_t_ u64_at_ns = TEST_FIRST_NS + (gl_u16_test_scheduled * (TEST_PERIOD_NS + TEST_PHASE_NS));
+    en_sim_error_t_ en_sim_error = SIM_OK;
+    uint8_t_ u8_bounce;
+
+    while((TEST_PRESSES > gl_u16_test_scheduled) && ((sim_now_ns() + TEST_AHEAD_NS) > u64_at_ns))
+    {
+        en_sim_error |= sim_pin_schedule(u64_at_ns, TEST_PORT_F, TEST_BTN_PIN, SIM_PIN_LOW);
+        for(u8_bounce = 0; u8_bounce < TEST_BOUNCES; u8_bounce++)
+        {
+            en_sim_error |= sim_pin_schedule(u64_at_ns + ((2 * u8_bounce) + 1) * TEST_BOUNCE_NS, TEST_PORT_F,
+                                             TEST_BTN_PIN, SIM_PIN_RELEASE);
+            en_sim_error |= sim_pin_schedule(u64_at_ns + ((2 * u8_bounce) + 2) * TEST_BOUNCE_NS, TEST_PORT_F,
+                                             TEST_BTN_PIN, SIM_PIN_LOW);
+        }
+        en_sim_error |= sim_pin_schedule(u64_at_ns + TEST_HOLD_NS, TEST_PORT_F, TEST_BTN_PIN, SIM_PIN_RELEASE);
+
+        gl_u16_test_scheduled++;
+        u64_at_ns += TEST_PERIOD_NS + TEST_PHASE_NS;
+    }
+
+    if(SIM_OK != en_sim_error)
+    {
+        gl_bool_test_schedule_failed = TRUE;
+    }
+}
+
+/**
+ * @brief                       :   Port listener, keeps the press queue ahead of the clock
+ */
+static void test_port_changed(uint8_t_ u8_port, const st_sim_port_state_t_ * ptr_st_state)
+{
+    (void) u8_port;
+    (void) ptr_st_state;
+
+    test_schedule_presses();
+}
+
+/**
+ * @brief                       :   End of the simulation, checks the histogram against the budget
+ */
+static void test_end(void)
+{
+    st_latency_stats_t_ st_stats;
+    uint32_t_ u32_p99_us = latency_get_percentile_us(99);
+
+    latency_get_stats(&st_stats);
+    printf("samples %lu  min %lu us  p50 <= %lu us  p99 <= %lu us  max %lu us\n", st_stats.u32_samples,
+           st_stats.u32_min_us, latency_get_percentile_us(50), u32_p99_us, st_stats.u32_max_us);
+
+    TEST_CHECK(FALSE == gl_bool_test_schedule_failed);
+    TEST_CHECK_EQ(gl_u16_test_scheduled, TEST_PRESSES);
+    TEST_CHECK_EQ(st_stats.u32_samples, TEST_PRESSES);
+    TEST_CHECK_RANGE(u32_p99_us, 1, TEST_P99_BUDGET_US);
+
+    exit(test_result("test_latency_budget"));
+}
+
+/*---------------------------------------------------------/
+/- MAIN
+/---------------------------------------------------------*/
+int main(void)
+{
+    sim_init();
+
+    test_schedule_presses();
+    sim_add_port_listener(test_port_changed);
+
+    // the firmware never returns: the end handler checks and exits
+    sim_set_end(TEST_FIRST_NS + (TEST_PRESSES * (TEST_PERIOD_NS + TEST_PHASE_NS)), test_end);
+    firmware_main();
+
+    TEST_CHECK(FALSE);
+    return test_result("test_latency_budget");
+}
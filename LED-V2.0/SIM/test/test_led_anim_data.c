@@ -0,0 +1,300 @@
+/**
+ * @file    :   test_led_anim_data.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Compressed led_anim animations played by test_led_pattern
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Generated, see test_led_pattern.c: the frames printed by test_led_pattern --frames <name>
+ * encoded by tools/led_anim_encode.py, 20 ms per frame.
+ */
+
+/* generated by tools/led_anim_encode.py from chase.txt, do not edit */
+
+#include "led_anim_interface.h"
+
+static const uint8_t_ gl_arr_u8_test_chase_data[619] = {
+    0x42, 0xFF, 0x66, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0x40, 0x42, 0xFF, 0x23, 0x42, 0x00, 0x42,
+    0x10, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x23, 0x42, 0x00, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40,
+    0x42, 0xFF, 0x23, 0x02, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x20, 0x05, 0x42, 0x00,
+    0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x1D, 0x08, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF,
+    0x1A, 0x0B, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x17, 0x0E, 0x42, 0x00, 0x42, 0x10,
+    0x42, 0x40, 0x42, 0xFF, 0x14, 0x11, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x11, 0x14,
+    0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x0E, 0x17, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40,
+    0x42, 0xFF, 0x0B, 0x1A, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x08, 0x1D, 0x42, 0x00,
+    0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x05, 0x20, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF,
+    0x02, 0x23, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x42, 0xFF, 0x23, 0x42, 0x00, 0x42,
+    0x10, 0x42, 0x40, 0x42, 0x40, 0x42, 0xFF, 0x23, 0x42, 0x00, 0x42, 0x10, 0x42, 0x10, 0x42, 0x40,
+    0x42, 0xFF, 0x23, 0x42, 0x00, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x23, 0x02, 0x42,
+    0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x20, 0x05, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42,
+    0xFF, 0x1D, 0x08, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x1A, 0x0B, 0x42, 0x00, 0x42,
+    0x10, 0x42, 0x40, 0x42, 0xFF, 0x17, 0x0E, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x14,
+    0x11, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x11, 0x14, 0x42, 0x00, 0x42, 0x10, 0x42,
+    0x40, 0x42, 0xFF, 0x0E, 0x17, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x0B, 0x1A, 0x42,
+    0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x08, 0x1D, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42,
+    0xFF, 0x05, 0x20, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x02, 0x23, 0x42, 0x00, 0x42,
+    0x10, 0x42, 0x40, 0x42, 0xFF, 0x42, 0xFF, 0x23, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0x40,
+    0x42, 0xFF, 0x23, 0x42, 0x00, 0x42, 0x10, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x23, 0x42, 0x00,
+    0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x23, 0x02, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40,
+    0x42, 0xFF, 0x20, 0x05, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x1D, 0x08, 0x42, 0x00,
+    0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x1A, 0x0B, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF,
+    0x17, 0x0E, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x14, 0x11, 0x42, 0x00, 0x42, 0x10,
+    0x42, 0x40, 0x42, 0xFF, 0x11, 0x14, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x0E, 0x17,
+    0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x0B, 0x1A, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40,
+    0x42, 0xFF, 0x08, 0x1D, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x05, 0x20, 0x42, 0x00,
+    0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x02, 0x23, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF,
+    0x42, 0xFF, 0x23, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0x40, 0x42, 0xFF, 0x23, 0x42, 0x00,
+    0x42, 0x10, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x23, 0x42, 0x00, 0x42, 0x00, 0x42, 0x10, 0x42,
+    0x40, 0x42, 0xFF, 0x23, 0x02, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x20, 0x05, 0x42,
+    0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x1D, 0x08, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42,
+    0xFF, 0x1A, 0x0B, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x17, 0x0E, 0x42, 0x00, 0x42,
+    0x10, 0x42, 0x40, 0x42, 0xFF, 0x14, 0x11, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x11,
+    0x14, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x0E, 0x17, 0x42, 0x00, 0x42, 0x10, 0x42,
+    0x40, 0x42, 0xFF, 0x0B, 0x1A, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x08, 0x1D, 0x42,
+    0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF, 0x05, 0x20, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42,
+    0xFF, 0x02, 0x23, 0x42, 0x00, 0x42, 0x10, 0x42, 0x40, 0x42, 0xFF,
+};
+
+const st_led_anim_t_ gl_st_test_chase = {
+    .ptr_u8_data    = gl_arr_u8_test_chase_data,
+    .u32_size       = 619,
+    .u16_channels   = 48,
+    .u16_frames     = 64,
+    .u16_frame_ms   = 20
+};
+
+/* generated by tools/led_anim_encode.py from breathe.txt, do not edit */
+
+#include "led_anim_interface.h"
+
+static const uint8_t_ gl_arr_u8_test_breathe_data[127] = {
+    0x6F, 0x00, 0x6F, 0x08, 0x6F, 0x10, 0x6F, 0x18, 0x6F, 0x20, 0x6F, 0x29, 0x6F, 0x31, 0x6F, 0x39,
+    0x6F, 0x41, 0x6F, 0x4A, 0x6F, 0x52, 0x6F, 0x5A, 0x6F, 0x62, 0x6F, 0x6A, 0x6F, 0x73, 0x6F, 0x7B,
+    0x6F, 0x83, 0x6F, 0x8B, 0x6F, 0x94, 0x6F, 0x9C, 0x6F, 0xA4, 0x6F, 0xAC, 0x6F, 0xB4, 0x6F, 0xBD,
+    0x6F, 0xC5, 0x6F, 0xCD, 0x6F, 0xD5, 0x6F, 0xDE, 0x6F, 0xE6, 0x6F, 0xEE, 0x6F, 0xF6, 0x6F, 0xFF,
+    0x2F, 0x6F, 0xF6, 0x6F, 0xEE, 0x6F, 0xE6, 0x6F, 0xDE, 0x6F, 0xD5, 0x6F, 0xCD, 0x6F, 0xC5, 0x6F,
+    0xBD, 0x6F, 0xB4, 0x6F, 0xAC, 0x6F, 0xA4, 0x6F, 0x9C, 0x6F, 0x94, 0x6F, 0x8B, 0x6F, 0x83, 0x6F,
+    0x7B, 0x6F, 0x73, 0x6F, 0x6A, 0x6F, 0x62, 0x6F, 0x5A, 0x6F, 0x52, 0x6F, 0x4A, 0x6F, 0x41, 0x6F,
+    0x39, 0x6F, 0x31, 0x6F, 0x29, 0x6F, 0x20, 0x6F, 0x18, 0x6F, 0x10, 0x6F, 0x08, 0x6F, 0x00,
+};
+
+const st_led_anim_t_ gl_st_test_breathe = {
+    .ptr_u8_data    = gl_arr_u8_test_breathe_data,
+    .u32_size       = 127,
+    .u16_channels   = 48,
+    .u16_frames     = 64,
+    .u16_frame_ms   = 20
+};
+
+/* generated by tools/led_anim_encode.py from rainbow.txt, do not edit */
+
+#include "led_anim_interface.h"
+
+static const uint8_t_ gl_arr_u8_test_rainbow_data[3136] = {
+    0xAF, 0x00, 0xAA, 0xAA, 0x20, 0xCA, 0x8A, 0x40, 0xEA, 0x6A, 0x60, 0xF4, 0x4A, 0x80, 0xD4, 0x2A,
+    0xA0, 0xB4, 0x0A, 0xC0, 0x94, 0x14, 0xE0, 0x74, 0x34, 0xFE, 0x54, 0x54, 0xDE, 0x34, 0x74, 0xBE,
+    0x14, 0x94, 0x9E, 0x0A, 0xB4, 0x7E, 0x2A, 0xD4, 0x5E, 0x4A, 0xF4, 0x3E, 0x6A, 0xEA, 0x1E, 0x8A,
+    0xCA, 0xAF, 0x10, 0xBA, 0x9A, 0x30, 0xDA, 0x7A, 0x50, 0xFA, 0x5A, 0x70, 0xE4, 0x3A, 0x90, 0xC4,
+    0x1A, 0xB0, 0xA4, 0x04, 0xD0, 0x84, 0x24, 0xF0, 0x64, 0x44, 0xEE, 0x44, 0x64, 0xCE, 0x24, 0x84,
+    0xAE, 0x04, 0xA4, 0x8E, 0x1A, 0xC4, 0x6E, 0x3A, 0xE4, 0x4E, 0x5A, 0xFA, 0x2E, 0x7A, 0xDA, 0x0E,
+    0x9A, 0xBA, 0xAF, 0x20, 0xCA, 0x8A, 0x40, 0xEA, 0x6A, 0x60, 0xF4, 0x4A, 0x80, 0xD4, 0x2A, 0xA0,
+    0xB4, 0x0A, 0xC0, 0x94, 0x14, 0xE0, 0x74, 0x34, 0xFE, 0x54, 0x54, 0xDE, 0x34, 0x74, 0xBE, 0x14,
+    0x94, 0x9E, 0x0A, 0xB4, 0x7E, 0x2A, 0xD4, 0x5E, 0x4A, 0xF4, 0x3E, 0x6A, 0xEA, 0x1E, 0x8A, 0xCA,
+    0x00, 0xAA, 0xAA, 0xAF, 0x30, 0xDA, 0x7A, 0x50, 0xFA, 0x5A, 0x70, 0xE4, 0x3A, 0x90, 0xC4, 0x1A,
+    0xB0, 0xA4, 0x04, 0xD0, 0x84, 0x24, 0xF0, 0x64, 0x44, 0xEE, 0x44, 0x64, 0xCE, 0x24, 0x84, 0xAE,
+    0x04, 0xA4, 0x8E, 0x1A, 0xC4, 0x6E, 0x3A, 0xE4, 0x4E, 0x5A, 0xFA, 0x2E, 0x7A, 0xDA, 0x0E, 0x9A,
+    0xBA, 0x10, 0xBA, 0x9A, 0xAF, 0x40, 0xEA, 0x6A, 0x60, 0xF4, 0x4A, 0x80, 0xD4, 0x2A, 0xA0, 0xB4,
+    0x0A, 0xC0, 0x94, 0x14, 0xE0, 0x74, 0x34, 0xFE, 0x54, 0x54, 0xDE, 0x34, 0x74, 0xBE, 0x14, 0x94,
+    0x9E, 0x0A, 0xB4, 0x7E, 0x2A, 0xD4, 0x5E, 0x4A, 0xF4, 0x3E, 0x6A, 0xEA, 0x1E, 0x8A, 0xCA, 0x00,
+    0xAA, 0xAA, 0x20, 0xCA, 0x8A, 0xAF, 0x50, 0xFA, 0x5A, 0x70, 0xE4, 0x3A, 0x90, 0xC4, 0x1A, 0xB0,
+    0xA4, 0x04, 0xD0, 0x84, 0x24, 0xF0, 0x64, 0x44, 0xEE, 0x44, 0x64, 0xCE, 0x24, 0x84, 0xAE, 0x04,
+    0xA4, 0x8E, 0x1A, 0xC4, 0x6E, 0x3A, 0xE4, 0x4E, 0x5A, 0xFA, 0x2E, 0x7A, 0xDA, 0x0E, 0x9A, 0xBA,
+    0x10, 0xBA, 0x9A, 0x30, 0xDA, 0x7A, 0xAF, 0x60, 0xF4, 0x4A, 0x80, 0xD4, 0x2A, 0xA0, 0xB4, 0x0A,
+    0xC0, 0x94, 0x14, 0xE0, 0x74, 0x34, 0xFE, 0x54, 0x54, 0xDE, 0x34, 0x74, 0xBE, 0x14, 0x94, 0x9E,
+    0x0A, 0xB4, 0x7E, 0x2A, 0xD4, 0x5E, 0x4A, 0xF4, 0x3E, 0x6A, 0xEA, 0x1E, 0x8A, 0xCA, 0x00, 0xAA,
+    0xAA, 0x20, 0xCA, 0x8A, 0x40, 0xEA, 0x6A, 0xAF, 0x70, 0xE4, 0x3A, 0x90, 0xC4, 0x1A, 0xB0, 0xA4,
+    0x04, 0xD0, 0x84, 0x24, 0xF0, 0x64, 0x44, 0xEE, 0x44, 0x64, 0xCE, 0x24, 0x84, 0xAE, 0x04, 0xA4,
+    0x8E, 0x1A, 0xC4, 0x6E, 0x3A, 0xE4, 0x4E, 0x5A, 0xFA, 0x2E, 0x7A, 0xDA, 0x0E, 0x9A, 0xBA, 0x10,
+    0xBA, 0x9A, 0x30, 0xDA, 0x7A, 0x50, 0xFA, 0x5A, 0xAF, 0x80, 0xD4, 0x2A, 0xA0, 0xB4, 0x0A, 0xC0,
+    0x94, 0x14, 0xE0, 0x74, 0x34, 0xFE, 0x54, 0x54, 0xDE, 0x34, 0x74, 0xBE, 0x14, 0x94, 0x9E, 0x0A,
+    0xB4, 0x7E, 0x2A, 0xD4, 0x5E, 0x4A, 0xF4, 0x3E, 0x6A, 0xEA, 0x1E, 0x8A, 0xCA, 0x00, 0xAA, 0xAA,
+    0x20, 0xCA, 0x8A, 0x40, 0xEA, 0x6A, 0x60, 0xF4, 0x4A, 0xAF, 0x90, 0xC4, 0x1A, 0xB0, 0xA4, 0x04,
+    0xD0, 0x84, 0x24, 0xF0, 0x64, 0x44, 0xEE, 0x44, 0x64, 0xCE, 0x24, 0x84, 0xAE, 0x04, 0xA4, 0x8E,
+    0x1A, 0xC4, 0x6E, 0x3A, 0xE4, 0x4E, 0x5A, 0xFA, 0x2E, 0x7A, 0xDA, 0x0E, 0x9A, 0xBA, 0x10, 0xBA,
+    0x9A, 0x30, 0xDA, 0x7A, 0x50, 0xFA, 0x5A, 0x70, 0xE4, 0x3A, 0xAF, 0xA0, 0xB4, 0x0A, 0xC0, 0x94,
+    0x14, 0xE0, 0x74, 0x34, 0xFE, 0x54, 0x54, 0xDE, 0x34, 0x74, 0xBE, 0x14, 0x94, 0x9E, 0x0A, 0xB4,
+    0x7E, 0x2A, 0xD4, 0x5E, 0x4A, 0xF4, 0x3E, 0x6A, 0xEA, 0x1E, 0x8A, 0xCA, 0x00, 0xAA, 0xAA, 0x20,
+    0xCA, 0x8A, 0x40, 0xEA, 0x6A, 0x60, 0xF4, 0x4A, 0x80, 0xD4, 0x2A, 0xAF, 0xB0, 0xA4, 0x04, 0xD0,
+    0x84, 0x24, 0xF0, 0x64, 0x44, 0xEE, 0x44, 0x64, 0xCE, 0x24, 0x84, 0xAE, 0x04, 0xA4, 0x8E, 0x1A,
+    0xC4, 0x6E, 0x3A, 0xE4, 0x4E, 0x5A, 0xFA, 0x2E, 0x7A, 0xDA, 0x0E, 0x9A, 0xBA, 0x10, 0xBA, 0x9A,
+    0x30, 0xDA, 0x7A, 0x50, 0xFA, 0x5A, 0x70, 0xE4, 0x3A, 0x90, 0xC4, 0x1A, 0xAF, 0xC0, 0x94, 0x14,
+    0xE0, 0x74, 0x34, 0xFE, 0x54, 0x54, 0xDE, 0x34, 0x74, 0xBE, 0x14, 0x94, 0x9E, 0x0A, 0xB4, 0x7E,
+    0x2A, 0xD4, 0x5E, 0x4A, 0xF4, 0x3E, 0x6A, 0xEA, 0x1E, 0x8A, 0xCA, 0x00, 0xAA, 0xAA, 0x20, 0xCA,
+    0x8A, 0x40, 0xEA, 0x6A, 0x60, 0xF4, 0x4A, 0x80, 0xD4, 0x2A, 0xA0, 0xB4, 0x0A, 0xAF, 0xD0, 0x84,
+    0x24, 0xF0, 0x64, 0x44, 0xEE, 0x44, 0x64, 0xCE, 0x24, 0x84, 0xAE, 0x04, 0xA4, 0x8E, 0x1A, 0xC4,
+    0x6E, 0x3A, 0xE4, 0x4E, 0x5A, 0xFA, 0x2E, 0x7A, 0xDA, 0x0E, 0x9A, 0xBA, 0x10, 0xBA, 0x9A, 0x30,
+    0xDA, 0x7A, 0x50, 0xFA, 0x5A, 0x70, 0xE4, 0x3A, 0x90, 0xC4, 0x1A, 0xB0, 0xA4, 0x04, 0xAF, 0xE0,
+    0x74, 0x34, 0xFE, 0x54, 0x54, 0xDE, 0x34, 0x74, 0xBE, 0x14, 0x94, 0x9E, 0x0A, 0xB4, 0x7E, 0x2A,
+    0xD4, 0x5E, 0x4A, 0xF4, 0x3E, 0x6A, 0xEA, 0x1E, 0x8A, 0xCA, 0x00, 0xAA, 0xAA, 0x20, 0xCA, 0x8A,
+    0x40, 0xEA, 0x6A, 0x60, 0xF4, 0x4A, 0x80, 0xD4, 0x2A, 0xA0, 0xB4, 0x0A, 0xC0, 0x94, 0x14, 0xAF,
+    0xF0, 0x64, 0x44, 0xEE, 0x44, 0x64, 0xCE, 0x24, 0x84, 0xAE, 0x04, 0xA4, 0x8E, 0x1A, 0xC4, 0x6E,
+    0x3A, 0xE4, 0x4E, 0x5A, 0xFA, 0x2E, 0x7A, 0xDA, 0x0E, 0x9A, 0xBA, 0x10, 0xBA, 0x9A, 0x30, 0xDA,
+    0x7A, 0x50, 0xFA, 0x5A, 0x70, 0xE4, 0x3A, 0x90, 0xC4, 0x1A, 0xB0, 0xA4, 0x04, 0xD0, 0x84, 0x24,
+    0xAF, 0xFE, 0x54, 0x54, 0xDE, 0x34, 0x74, 0xBE, 0x14, 0x94, 0x9E, 0x0A, 0xB4, 0x7E, 0x2A, 0xD4,
+    0x5E, 0x4A, 0xF4, 0x3E, 0x6A, 0xEA, 0x1E, 0x8A, 0xCA, 0x00, 0xAA, 0xAA, 0x20, 0xCA, 0x8A, 0x40,
+    0xEA, 0x6A, 0x60, 0xF4, 0x4A, 0x80, 0xD4, 0x2A, 0xA0, 0xB4, 0x0A, 0xC0, 0x94, 0x14, 0xE0, 0x74,
+    0x34, 0xAF, 0xEE, 0x44, 0x64, 0xCE, 0x24, 0x84, 0xAE, 0x04, 0xA4, 0x8E, 0x1A, 0xC4, 0x6E, 0x3A,
+    0xE4, 0x4E, 0x5A, 0xFA, 0x2E, 0x7A, 0xDA, 0x0E, 0x9A, 0xBA, 0x10, 0xBA, 0x9A, 0x30, 0xDA, 0x7A,
+    0x50, 0xFA, 0x5A, 0x70, 0xE4, 0x3A, 0x90, 0xC4, 0x1A, 0xB0, 0xA4, 0x04, 0xD0, 0x84, 0x24, 0xF0,
+    0x64, 0x44, 0xAF, 0xDE, 0x34, 0x74, 0xBE, 0x14, 0x94, 0x9E, 0x0A, 0xB4, 0x7E, 0x2A, 0xD4, 0x5E,
+    0x4A, 0xF4, 0x3E, 0x6A, 0xEA, 0x1E, 0x8A, 0xCA, 0x00, 0xAA, 0xAA, 0x20, 0xCA, 0x8A, 0x40, 0xEA,
+    0x6A, 0x60, 0xF4, 0x4A, 0x80, 0xD4, 0x2A, 0xA0, 0xB4, 0x0A, 0xC0, 0x94, 0x14, 0xE0, 0x74, 0x34,
+    0xFE, 0x54, 0x54, 0xAF, 0xCE, 0x24, 0x84, 0xAE, 0x04, 0xA4, 0x8E, 0x1A, 0xC4, 0x6E, 0x3A, 0xE4,
+    0x4E, 0x5A, 0xFA, 0x2E, 0x7A, 0xDA, 0x0E, 0x9A, 0xBA, 0x10, 0xBA, 0x9A, 0x30, 0xDA, 0x7A, 0x50,
+    0xFA, 0x5A, 0x70, 0xE4, 0x3A, 0x90, 0xC4, 0x1A, 0xB0, 0xA4, 0x04, 0xD0, 0x84, 0x24, 0xF0, 0x64,
+    0x44, 0xEE, 0x44, 0x64, 0xAF, 0xBE, 0x14, 0x94, 0x9E, 0x0A, 0xB4, 0x7E, 0x2A, 0xD4, 0x5E, 0x4A,
+    0xF4, 0x3E, 0x6A, 0xEA, 0x1E, 0x8A, 0xCA, 0x00, 0xAA, 0xAA, 0x20, 0xCA, 0x8A, 0x40, 0xEA, 0x6A,
+    0x60, 0xF4, 0x4A, 0x80, 0xD4, 0x2A, 0xA0, 0xB4, 0x0A, 0xC0, 0x94, 0x14, 0xE0, 0x74, 0x34, 0xFE,
+    0x54, 0x54, 0xDE, 0x34, 0x74, 0xAF, 0xAE, 0x04, 0xA4, 0x8E, 0x1A, 0xC4, 0x6E, 0x3A, 0xE4, 0x4E,
+    0x5A, 0xFA, 0x2E, 0x7A, 0xDA, 0x0E, 0x9A, 0xBA, 0x10, 0xBA, 0x9A, 0x30, 0xDA, 0x7A, 0x50, 0xFA,
+    0x5A, 0x70, 0xE4, 0x3A, 0x90, 0xC4, 0x1A, 0xB0, 0xA4, 0x04, 0xD0, 0x84, 0x24, 0xF0, 0x64, 0x44,
+    0xEE, 0x44, 0x64, 0xCE, 0x24, 0x84, 0xAF, 0x9E, 0x0A, 0xB4, 0x7E, 0x2A, 0xD4, 0x5E, 0x4A, 0xF4,
+    0x3E, 0x6A, 0xEA, 0x1E, 0x8A, 0xCA, 0x00, 0xAA, 0xAA, 0x20, 0xCA, 0x8A, 0x40, 0xEA, 0x6A, 0x60,
+    0xF4, 0x4A, 0x80, 0xD4, 0x2A, 0xA0, 0xB4, 0x0A, 0xC0, 0x94, 0x14, 0xE0, 0x74, 0x34, 0xFE, 0x54,
+    0x54, 0xDE, 0x34, 0x74, 0xBE, 0x14, 0x94, 0xAF, 0x8E, 0x1A, 0xC4, 0x6E, 0x3A, 0xE4, 0x4E, 0x5A,
+    0xFA, 0x2E, 0x7A, 0xDA, 0x0E, 0x9A, 0xBA, 0x10, 0xBA, 0x9A, 0x30, 0xDA, 0x7A, 0x50, 0xFA, 0x5A,
+    0x70, 0xE4, 0x3A, 0x90, 0xC4, 0x1A, 0xB0, 0xA4, 0x04, 0xD0, 0x84, 0x24, 0xF0, 0x64, 0x44, 0xEE,
+    0x44, 0x64, 0xCE, 0x24, 0x84, 0xAE, 0x04, 0xA4, 0xAF, 0x7E, 0x2A, 0xD4, 0x5E, 0x4A, 0xF4, 0x3E,
+    0x6A, 0xEA, 0x1E, 0x8A, 0xCA, 0x00, 0xAA, 0xAA, 0x20, 0xCA, 0x8A, 0x40, 0xEA, 0x6A, 0x60, 0xF4,
+    0x4A, 0x80, 0xD4, 0x2A, 0xA0, 0xB4, 0x0A, 0xC0, 0x94, 0x14, 0xE0, 0x74, 0x34, 0xFE, 0x54, 0x54,
+    0xDE, 0x34, 0x74, 0xBE, 0x14, 0x94, 0x9E, 0x0A, 0xB4, 0xAF, 0x6E, 0x3A, 0xE4, 0x4E, 0x5A, 0xFA,
+    0x2E, 0x7A, 0xDA, 0x0E, 0x9A, 0xBA, 0x10, 0xBA, 0x9A, 0x30, 0xDA, 0x7A, 0x50, 0xFA, 0x5A, 0x70,
+    0xE4, 0x3A, 0x90, 0xC4, 0x1A, 0xB0, 0xA4, 0x04, 0xD0, 0x84, 0x24, 0xF0, 0x64, 0x44, 0xEE, 0x44,
+    0x64, 0xCE, 0x24, 0x84, 0xAE, 0x04, 0xA4, 0x8E, 0x1A, 0xC4, 0xAF, 0x5E, 0x4A, 0xF4, 0x3E, 0x6A,
+    0xEA, 0x1E, 0x8A, 0xCA, 0x00, 0xAA, 0xAA, 0x20, 0xCA, 0x8A, 0x40, 0xEA, 0x6A, 0x60, 0xF4, 0x4A,
+    0x80, 0xD4, 0x2A, 0xA0, 0xB4, 0x0A, 0xC0, 0x94, 0x14, 0xE0, 0x74, 0x34, 0xFE, 0x54, 0x54, 0xDE,
+    0x34, 0x74, 0xBE, 0x14, 0x94, 0x9E, 0x0A, 0xB4, 0x7E, 0x2A, 0xD4, 0xAF, 0x4E, 0x5A, 0xFA, 0x2E,
+    0x7A, 0xDA, 0x0E, 0x9A, 0xBA, 0x10, 0xBA, 0x9A, 0x30, 0xDA, 0x7A, 0x50, 0xFA, 0x5A, 0x70, 0xE4,
+    0x3A, 0x90, 0xC4, 0x1A, 0xB0, 0xA4, 0x04, 0xD0, 0x84, 0x24, 0xF0, 0x64, 0x44, 0xEE, 0x44, 0x64,
+    0xCE, 0x24, 0x84, 0xAE, 0x04, 0xA4, 0x8E, 0x1A, 0xC4, 0x6E, 0x3A, 0xE4, 0xAF, 0x3E, 0x6A, 0xEA,
+    0x1E, 0x8A, 0xCA, 0x00, 0xAA, 0xAA, 0x20, 0xCA, 0x8A, 0x40, 0xEA, 0x6A, 0x60, 0xF4, 0x4A, 0x80,
+    0xD4, 0x2A, 0xA0, 0xB4, 0x0A, 0xC0, 0x94, 0x14, 0xE0, 0x74, 0x34, 0xFE, 0x54, 0x54, 0xDE, 0x34,
+    0x74, 0xBE, 0x14, 0x94, 0x9E, 0x0A, 0xB4, 0x7E, 0x2A, 0xD4, 0x5E, 0x4A, 0xF4, 0xAF, 0x2E, 0x7A,
+    0xDA, 0x0E, 0x9A, 0xBA, 0x10, 0xBA, 0x9A, 0x30, 0xDA, 0x7A, 0x50, 0xFA, 0x5A, 0x70, 0xE4, 0x3A,
+    0x90, 0xC4, 0x1A, 0xB0, 0xA4, 0x04, 0xD0, 0x84, 0x24, 0xF0, 0x64, 0x44, 0xEE, 0x44, 0x64, 0xCE,
+    0x24, 0x84, 0xAE, 0x04, 0xA4, 0x8E, 0x1A, 0xC4, 0x6E, 0x3A, 0xE4, 0x4E, 0x5A, 0xFA, 0xAF, 0x1E,
+    0x8A, 0xCA, 0x00, 0xAA, 0xAA, 0x20, 0xCA, 0x8A, 0x40, 0xEA, 0x6A, 0x60, 0xF4, 0x4A, 0x80, 0xD4,
+    0x2A, 0xA0, 0xB4, 0x0A, 0xC0, 0x94, 0x14, 0xE0, 0x74, 0x34, 0xFE, 0x54, 0x54, 0xDE, 0x34, 0x74,
+    0xBE, 0x14, 0x94, 0x9E, 0x0A, 0xB4, 0x7E, 0x2A, 0xD4, 0x5E, 0x4A, 0xF4, 0x3E, 0x6A, 0xEA, 0xAF,
+    0x0E, 0x9A, 0xBA, 0x10, 0xBA, 0x9A, 0x30, 0xDA, 0x7A, 0x50, 0xFA, 0x5A, 0x70, 0xE4, 0x3A, 0x90,
+    0xC4, 0x1A, 0xB0, 0xA4, 0x04, 0xD0, 0x84, 0x24, 0xF0, 0x64, 0x44, 0xEE, 0x44, 0x64, 0xCE, 0x24,
+    0x84, 0xAE, 0x04, 0xA4, 0x8E, 0x1A, 0xC4, 0x6E, 0x3A, 0xE4, 0x4E, 0x5A, 0xFA, 0x2E, 0x7A, 0xDA,
+    0xAF, 0x00, 0xAA, 0xAA, 0x20, 0xCA, 0x8A, 0x40, 0xEA, 0x6A, 0x60, 0xF4, 0x4A, 0x80, 0xD4, 0x2A,
+    0xA0, 0xB4, 0x0A, 0xC0, 0x94, 0x14, 0xE0, 0x74, 0x34, 0xFE, 0x54, 0x54, 0xDE, 0x34, 0x74, 0xBE,
+    0x14, 0x94, 0x9E, 0x0A, 0xB4, 0x7E, 0x2A, 0xD4, 0x5E, 0x4A, 0xF4, 0x3E, 0x6A, 0xEA, 0x1E, 0x8A,
+    0xCA, 0xAF, 0x10, 0xBA, 0x9A, 0x30, 0xDA, 0x7A, 0x50, 0xFA, 0x5A, 0x70, 0xE4, 0x3A, 0x90, 0xC4,
+    0x1A, 0xB0, 0xA4, 0x04, 0xD0, 0x84, 0x24, 0xF0, 0x64, 0x44, 0xEE, 0x44, 0x64, 0xCE, 0x24, 0x84,
+    0xAE, 0x04, 0xA4, 0x8E, 0x1A, 0xC4, 0x6E, 0x3A, 0xE4, 0x4E, 0x5A, 0xFA, 0x2E, 0x7A, 0xDA, 0x0E,
+    0x9A, 0xBA, 0xAF, 0x20, 0xCA, 0x8A, 0x40, 0xEA, 0x6A, 0x60, 0xF4, 0x4A, 0x80, 0xD4, 0x2A, 0xA0,
+    0xB4, 0x0A, 0xC0, 0x94, 0x14, 0xE0, 0x74, 0x34, 0xFE, 0x54, 0x54, 0xDE, 0x34, 0x74, 0xBE, 0x14,
+    0x94, 0x9E, 0x0A, 0xB4, 0x7E, 0x2A, 0xD4, 0x5E, 0x4A, 0xF4, 0x3E, 0x6A, 0xEA, 0x1E, 0x8A, 0xCA,
+    0x00, 0xAA, 0xAA, 0xAF, 0x30, 0xDA, 0x7A, 0x50, 0xFA, 0x5A, 0x70, 0xE4, 0x3A, 0x90, 0xC4, 0x1A,
+    0xB0, 0xA4, 0x04, 0xD0, 0x84, 0x24, 0xF0, 0x64, 0x44, 0xEE, 0x44, 0x64, 0xCE, 0x24, 0x84, 0xAE,
+    0x04, 0xA4, 0x8E, 0x1A, 0xC4, 0x6E, 0x3A, 0xE4, 0x4E, 0x5A, 0xFA, 0x2E, 0x7A, 0xDA, 0x0E, 0x9A,
+    0xBA, 0x10, 0xBA, 0x9A, 0xAF, 0x40, 0xEA, 0x6A, 0x60, 0xF4, 0x4A, 0x80, 0xD4, 0x2A, 0xA0, 0xB4,
+    0x0A, 0xC0, 0x94, 0x14, 0xE0, 0x74, 0x34, 0xFE, 0x54, 0x54, 0xDE, 0x34, 0x74, 0xBE, 0x14, 0x94,
+    0x9E, 0x0A, 0xB4, 0x7E, 0x2A, 0xD4, 0x5E, 0x4A, 0xF4, 0x3E, 0x6A, 0xEA, 0x1E, 0x8A, 0xCA, 0x00,
+    0xAA, 0xAA, 0x20, 0xCA, 0x8A, 0xAF, 0x50, 0xFA, 0x5A, 0x70, 0xE4, 0x3A, 0x90, 0xC4, 0x1A, 0xB0,
+    0xA4, 0x04, 0xD0, 0x84, 0x24, 0xF0, 0x64, 0x44, 0xEE, 0x44, 0x64, 0xCE, 0x24, 0x84, 0xAE, 0x04,
+    0xA4, 0x8E, 0x1A, 0xC4, 0x6E, 0x3A, 0xE4, 0x4E, 0x5A, 0xFA, 0x2E, 0x7A, 0xDA, 0x0E, 0x9A, 0xBA,
+    0x10, 0xBA, 0x9A, 0x30, 0xDA, 0x7A, 0xAF, 0x60, 0xF4, 0x4A, 0x80, 0xD4, 0x2A, 0xA0, 0xB4, 0x0A,
+    0xC0, 0x94, 0x14, 0xE0, 0x74, 0x34, 0xFE, 0x54, 0x54, 0xDE, 0x34, 0x74, 0xBE, 0x14, 0x94, 0x9E,
+    0x0A, 0xB4, 0x7E, 0x2A, 0xD4, 0x5E, 0x4A, 0xF4, 0x3E, 0x6A, 0xEA, 0x1E, 0x8A, 0xCA, 0x00, 0xAA,
+    0xAA, 0x20, 0xCA, 0x8A, 0x40, 0xEA, 0x6A, 0xAF, 0x70, 0xE4, 0x3A, 0x90, 0xC4, 0x1A, 0xB0, 0xA4,
+    0x04, 0xD0, 0x84, 0x24, 0xF0, 0x64, 0x44, 0xEE, 0x44, 0x64, 0xCE, 0x24, 0x84, 0xAE, 0x04, 0xA4,
+    0x8E, 0x1A, 0xC4, 0x6E, 0x3A, 0xE4, 0x4E, 0x5A, 0xFA, 0x2E, 0x7A, 0xDA, 0x0E, 0x9A, 0xBA, 0x10,
+    0xBA, 0x9A, 0x30, 0xDA, 0x7A, 0x50, 0xFA, 0x5A, 0xAF, 0x80, 0xD4, 0x2A, 0xA0, 0xB4, 0x0A, 0xC0,
+    0x94, 0x14, 0xE0, 0x74, 0x34, 0xFE, 0x54, 0x54, 0xDE, 0x34, 0x74, 0xBE, 0x14, 0x94, 0x9E, 0x0A,
+    0xB4, 0x7E, 0x2A, 0xD4, 0x5E, 0x4A, 0xF4, 0x3E, 0x6A, 0xEA, 0x1E, 0x8A, 0xCA, 0x00, 0xAA, 0xAA,
+    0x20, 0xCA, 0x8A, 0x40, 0xEA, 0x6A, 0x60, 0xF4, 0x4A, 0xAF, 0x90, 0xC4, 0x1A, 0xB0, 0xA4, 0x04,
+    0xD0, 0x84, 0x24, 0xF0, 0x64, 0x44, 0xEE, 0x44, 0x64, 0xCE, 0x24, 0x84, 0xAE, 0x04, 0xA4, 0x8E,
+    0x1A, 0xC4, 0x6E, 0x3A, 0xE4, 0x4E, 0x5A, 0xFA, 0x2E, 0x7A, 0xDA, 0x0E, 0x9A, 0xBA, 0x10, 0xBA,
+    0x9A, 0x30, 0xDA, 0x7A, 0x50, 0xFA, 0x5A, 0x70, 0xE4, 0x3A, 0xAF, 0xA0, 0xB4, 0x0A, 0xC0, 0x94,
+    0x14, 0xE0, 0x74, 0x34, 0xFE, 0x54, 0x54, 0xDE, 0x34, 0x74, 0xBE, 0x14, 0x94, 0x9E, 0x0A, 0xB4,
+    0x7E, 0x2A, 0xD4, 0x5E, 0x4A, 0xF4, 0x3E, 0x6A, 0xEA, 0x1E, 0x8A, 0xCA, 0x00, 0xAA, 0xAA, 0x20,
+    0xCA, 0x8A, 0x40, 0xEA, 0x6A, 0x60, 0xF4, 0x4A, 0x80, 0xD4, 0x2A, 0xAF, 0xB0, 0xA4, 0x04, 0xD0,
+    0x84, 0x24, 0xF0, 0x64, 0x44, 0xEE, 0x44, 0x64, 0xCE, 0x24, 0x84, 0xAE, 0x04, 0xA4, 0x8E, 0x1A,
+    0xC4, 0x6E, 0x3A, 0xE4, 0x4E, 0x5A, 0xFA, 0x2E, 0x7A, 0xDA, 0x0E, 0x9A, 0xBA, 0x10, 0xBA, 0x9A,
+    0x30, 0xDA, 0x7A, 0x50, 0xFA, 0x5A, 0x70, 0xE4, 0x3A, 0x90, 0xC4, 0x1A, 0xAF, 0xC0, 0x94, 0x14,
+    0xE0, 0x74, 0x34, 0xFE, 0x54, 0x54, 0xDE, 0x34, 0x74, 0xBE, 0x14, 0x94, 0x9E, 0x0A, 0xB4, 0x7E,
+    0x2A, 0xD4, 0x5E, 0x4A, 0xF4, 0x3E, 0x6A, 0xEA, 0x1E, 0x8A, 0xCA, 0x00, 0xAA, 0xAA, 0x20, 0xCA,
+    0x8A, 0x40, 0xEA, 0x6A, 0x60, 0xF4, 0x4A, 0x80, 0xD4, 0x2A, 0xA0, 0xB4, 0x0A, 0xAF, 0xD0, 0x84,
+    0x24, 0xF0, 0x64, 0x44, 0xEE, 0x44, 0x64, 0xCE, 0x24, 0x84, 0xAE, 0x04, 0xA4, 0x8E, 0x1A, 0xC4,
+    0x6E, 0x3A, 0xE4, 0x4E, 0x5A, 0xFA, 0x2E, 0x7A, 0xDA, 0x0E, 0x9A, 0xBA, 0x10, 0xBA, 0x9A, 0x30,
+    0xDA, 0x7A, 0x50, 0xFA, 0x5A, 0x70, 0xE4, 0x3A, 0x90, 0xC4, 0x1A, 0xB0, 0xA4, 0x04, 0xAF, 0xE0,
+    0x74, 0x34, 0xFE, 0x54, 0x54, 0xDE, 0x34, 0x74, 0xBE, 0x14, 0x94, 0x9E, 0x0A, 0xB4, 0x7E, 0x2A,
+    0xD4, 0x5E, 0x4A, 0xF4, 0x3E, 0x6A, 0xEA, 0x1E, 0x8A, 0xCA, 0x00, 0xAA, 0xAA, 0x20, 0xCA, 0x8A,
+    0x40, 0xEA, 0x6A, 0x60, 0xF4, 0x4A, 0x80, 0xD4, 0x2A, 0xA0, 0xB4, 0x0A, 0xC0, 0x94, 0x14, 0xAF,
+    0xF0, 0x64, 0x44, 0xEE, 0x44, 0x64, 0xCE, 0x24, 0x84, 0xAE, 0x04, 0xA4, 0x8E, 0x1A, 0xC4, 0x6E,
+    0x3A, 0xE4, 0x4E, 0x5A, 0xFA, 0x2E, 0x7A, 0xDA, 0x0E, 0x9A, 0xBA, 0x10, 0xBA, 0x9A, 0x30, 0xDA,
+    0x7A, 0x50, 0xFA, 0x5A, 0x70, 0xE4, 0x3A, 0x90, 0xC4, 0x1A, 0xB0, 0xA4, 0x04, 0xD0, 0x84, 0x24,
+    0xAF, 0xFE, 0x54, 0x54, 0xDE, 0x34, 0x74, 0xBE, 0x14, 0x94, 0x9E, 0x0A, 0xB4, 0x7E, 0x2A, 0xD4,
+    0x5E, 0x4A, 0xF4, 0x3E, 0x6A, 0xEA, 0x1E, 0x8A, 0xCA, 0x00, 0xAA, 0xAA, 0x20, 0xCA, 0x8A, 0x40,
+    0xEA, 0x6A, 0x60, 0xF4, 0x4A, 0x80, 0xD4, 0x2A, 0xA0, 0xB4, 0x0A, 0xC0, 0x94, 0x14, 0xE0, 0x74,
+    0x34, 0xAF, 0xEE, 0x44, 0x64, 0xCE, 0x24, 0x84, 0xAE, 0x04, 0xA4, 0x8E, 0x1A, 0xC4, 0x6E, 0x3A,
+    0xE4, 0x4E, 0x5A, 0xFA, 0x2E, 0x7A, 0xDA, 0x0E, 0x9A, 0xBA, 0x10, 0xBA, 0x9A, 0x30, 0xDA, 0x7A,
+    0x50, 0xFA, 0x5A, 0x70, 0xE4, 0x3A, 0x90, 0xC4, 0x1A, 0xB0, 0xA4, 0x04, 0xD0, 0x84, 0x24, 0xF0,
+    0x64, 0x44, 0xAF, 0xDE, 0x34, 0x74, 0xBE, 0x14, 0x94, 0x9E, 0x0A, 0xB4, 0x7E, 0x2A, 0xD4, 0x5E,
+    0x4A, 0xF4, 0x3E, 0x6A, 0xEA, 0x1E, 0x8A, 0xCA, 0x00, 0xAA, 0xAA, 0x20, 0xCA, 0x8A, 0x40, 0xEA,
+    0x6A, 0x60, 0xF4, 0x4A, 0x80, 0xD4, 0x2A, 0xA0, 0xB4, 0x0A, 0xC0, 0x94, 0x14, 0xE0, 0x74, 0x34,
+    0xFE, 0x54, 0x54, 0xAF, 0xCE, 0x24, 0x84, 0xAE, 0x04, 0xA4, 0x8E, 0x1A, 0xC4, 0x6E, 0x3A, 0xE4,
+    0x4E, 0x5A, 0xFA, 0x2E, 0x7A, 0xDA, 0x0E, 0x9A, 0xBA, 0x10, 0xBA, 0x9A, 0x30, 0xDA, 0x7A, 0x50,
+    0xFA, 0x5A, 0x70, 0xE4, 0x3A, 0x90, 0xC4, 0x1A, 0xB0, 0xA4, 0x04, 0xD0, 0x84, 0x24, 0xF0, 0x64,
+    0x44, 0xEE, 0x44, 0x64, 0xAF, 0xBE, 0x14, 0x94, 0x9E, 0x0A, 0xB4, 0x7E, 0x2A, 0xD4, 0x5E, 0x4A,
+    0xF4, 0x3E, 0x6A, 0xEA, 0x1E, 0x8A, 0xCA, 0x00, 0xAA, 0xAA, 0x20, 0xCA, 0x8A, 0x40, 0xEA, 0x6A,
+    0x60, 0xF4, 0x4A, 0x80, 0xD4, 0x2A, 0xA0, 0xB4, 0x0A, 0xC0, 0x94, 0x14, 0xE0, 0x74, 0x34, 0xFE,
+    0x54, 0x54, 0xDE, 0x34, 0x74, 0xAF, 0xAE, 0x04, 0xA4, 0x8E, 0x1A, 0xC4, 0x6E, 0x3A, 0xE4, 0x4E,
+    0x5A, 0xFA, 0x2E, 0x7A, 0xDA, 0x0E, 0x9A, 0xBA, 0x10, 0xBA, 0x9A, 0x30, 0xDA, 0x7A, 0x50, 0xFA,
+    0x5A, 0x70, 0xE4, 0x3A, 0x90, 0xC4, 0x1A, 0xB0, 0xA4, 0x04, 0xD0, 0x84, 0x24, 0xF0, 0x64, 0x44,
+    0xEE, 0x44, 0x64, 0xCE, 0x24, 0x84, 0xAF, 0x9E, 0x0A, 0xB4, 0x7E, 0x2A, 0xD4, 0x5E, 0x4A, 0xF4,
+    0x3E, 0x6A, 0xEA, 0x1E, 0x8A, 0xCA, 0x00, 0xAA, 0xAA, 0x20, 0xCA, 0x8A, 0x40, 0xEA, 0x6A, 0x60,
+    0xF4, 0x4A, 0x80, 0xD4, 0x2A, 0xA0, 0xB4, 0x0A, 0xC0, 0x94, 0x14, 0xE0, 0x74, 0x34, 0xFE, 0x54,
+    0x54, 0xDE, 0x34, 0x74, 0xBE, 0x14, 0x94, 0xAF, 0x8E, 0x1A, 0xC4, 0x6E, 0x3A, 0xE4, 0x4E, 0x5A,
+    0xFA, 0x2E, 0x7A, 0xDA, 0x0E, 0x9A, 0xBA, 0x10, 0xBA, 0x9A, 0x30, 0xDA, 0x7A, 0x50, 0xFA, 0x5A,
+    0x70, 0xE4, 0x3A, 0x90, 0xC4, 0x1A, 0xB0, 0xA4, 0x04, 0xD0, 0x84, 0x24, 0xF0, 0x64, 0x44, 0xEE,
+    0x44, 0x64, 0xCE, 0x24, 0x84, 0xAE, 0x04, 0xA4, 0xAF, 0x7E, 0x2A, 0xD4, 0x5E, 0x4A, 0xF4, 0x3E,
+    0x6A, 0xEA, 0x1E, 0x8A, 0xCA, 0x00, 0xAA, 0xAA, 0x20, 0xCA, 0x8A, 0x40, 0xEA, 0x6A, 0x60, 0xF4,
+    0x4A, 0x80, 0xD4, 0x2A, 0xA0, 0xB4, 0x0A, 0xC0, 0x94, 0x14, 0xE0, 0x74, 0x34, 0xFE, 0x54, 0x54,
+    0xDE, 0x34, 0x74, 0xBE, 0x14, 0x94, 0x9E, 0x0A, 0xB4, 0xAF, 0x6E, 0x3A, 0xE4, 0x4E, 0x5A, 0xFA,
+    0x2E, 0x7A, 0xDA, 0x0E, 0x9A, 0xBA, 0x10, 0xBA, 0x9A, 0x30, 0xDA, 0x7A, 0x50, 0xFA, 0x5A, 0x70,
+    0xE4, 0x3A, 0x90, 0xC4, 0x1A, 0xB0, 0xA4, 0x04, 0xD0, 0x84, 0x24, 0xF0, 0x64, 0x44, 0xEE, 0x44,
+    0x64, 0xCE, 0x24, 0x84, 0xAE, 0x04, 0xA4, 0x8E, 0x1A, 0xC4, 0xAF, 0x5E, 0x4A, 0xF4, 0x3E, 0x6A,
+    0xEA, 0x1E, 0x8A, 0xCA, 0x00, 0xAA, 0xAA, 0x20, 0xCA, 0x8A, 0x40, 0xEA, 0x6A, 0x60, 0xF4, 0x4A,
+    0x80, 0xD4, 0x2A, 0xA0, 0xB4, 0x0A, 0xC0, 0x94, 0x14, 0xE0, 0x74, 0x34, 0xFE, 0x54, 0x54, 0xDE,
+    0x34, 0x74, 0xBE, 0x14, 0x94, 0x9E, 0x0A, 0xB4, 0x7E, 0x2A, 0xD4, 0xAF, 0x4E, 0x5A, 0xFA, 0x2E,
+    0x7A, 0xDA, 0x0E, 0x9A, 0xBA, 0x10, 0xBA, 0x9A, 0x30, 0xDA, 0x7A, 0x50, 0xFA, 0x5A, 0x70, 0xE4,
+    0x3A, 0x90, 0xC4, 0x1A, 0xB0, 0xA4, 0x04, 0xD0, 0x84, 0x24, 0xF0, 0x64, 0x44, 0xEE, 0x44, 0x64,
+    0xCE, 0x24, 0x84, 0xAE, 0x04, 0xA4, 0x8E, 0x1A, 0xC4, 0x6E, 0x3A, 0xE4, 0xAF, 0x3E, 0x6A, 0xEA,
+    0x1E, 0x8A, 0xCA, 0x00, 0xAA, 0xAA, 0x20, 0xCA, 0x8A, 0x40, 0xEA, 0x6A, 0x60, 0xF4, 0x4A, 0x80,
+    0xD4, 0x2A, 0xA0, 0xB4, 0x0A, 0xC0, 0x94, 0x14, 0xE0, 0x74, 0x34, 0xFE, 0x54, 0x54, 0xDE, 0x34,
+    0x74, 0xBE, 0x14, 0x94, 0x9E, 0x0A, 0xB4, 0x7E, 0x2A, 0xD4, 0x5E, 0x4A, 0xF4, 0xAF, 0x2E, 0x7A,
+    0xDA, 0x0E, 0x9A, 0xBA, 0x10, 0xBA, 0x9A, 0x30, 0xDA, 0x7A, 0x50, 0xFA, 0x5A, 0x70, 0xE4, 0x3A,
+    0x90, 0xC4, 0x1A, 0xB0, 0xA4, 0x04, 0xD0, 0x84, 0x24, 0xF0, 0x64, 0x44, 0xEE, 0x44, 0x64, 0xCE,
+    0x24, 0x84, 0xAE, 0x04, 0xA4, 0x8E, 0x1A, 0xC4, 0x6E, 0x3A, 0xE4, 0x4E, 0x5A, 0xFA, 0xAF, 0x1E,
+    0x8A, 0xCA, 0x00, 0xAA, 0xAA, 0x20, 0xCA, 0x8A, 0x40, 0xEA, 0x6A, 0x60, 0xF4, 0x4A, 0x80, 0xD4,
+    0x2A, 0xA0, 0xB4, 0x0A, 0xC0, 0x94, 0x14, 0xE0, 0x74, 0x34, 0xFE, 0x54, 0x54, 0xDE, 0x34, 0x74,
+    0xBE, 0x14, 0x94, 0x9E, 0x0A, 0xB4, 0x7E, 0x2A, 0xD4, 0x5E, 0x4A, 0xF4, 0x3E, 0x6A, 0xEA, 0xAF,
+    0x0E, 0x9A, 0xBA, 0x10, 0xBA, 0x9A, 0x30, 0xDA, 0x7A, 0x50, 0xFA, 0x5A, 0x70, 0xE4, 0x3A, 0x90,
+    0xC4, 0x1A, 0xB0, 0xA4, 0x04, 0xD0, 0x84, 0x24, 0xF0, 0x64, 0x44, 0xEE, 0x44, 0x64, 0xCE, 0x24,
+    0x84, 0xAE, 0x04, 0xA4, 0x8E, 0x1A, 0xC4, 0x6E, 0x3A, 0xE4, 0x4E, 0x5A, 0xFA, 0x2E, 0x7A, 0xDA,
+};
+
+const st_led_anim_t_ gl_st_test_rainbow = {
+    .ptr_u8_data    = gl_arr_u8_test_rainbow_data,
+    .u32_size       = 3136,
+    .u16_channels   = 48,
+    .u16_frames     = 64,
+    .u16_frame_ms   = 20
+};
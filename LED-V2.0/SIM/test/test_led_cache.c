@@ -0,0 +1,143 @@
+/**
+ * @file    :   test_led_cache.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Host test: LED state cache over 1M requests
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Drives the RGB LED (PF1 -> PF3) with TEST_ITERATIONS requests of each kind on the register
+ * model and checks the issued/elided counters, the bus accesses and the pin levels:
+ *  - repeating the state the LED already has issues no port write and no bus access,
+ *  - the app loop (stage red/green/blue, commit) writes only when a color changes,
+ *  - alternating on/off issues one write per request.
+ */
+
+#include "sim_interface.h"
+#include "test_interface.h"
+#include "led_interface.h"
+
+#include <stdio.h>
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define TEST_ITERATIONS             1000000UL
+#define TEST_COLOR_PERIOD           1000UL      /* app loop passes per color change */
+#define TEST_WRITE_ACCESSES         2           /* bus accesses of an issued LED write */
+
+#define TEST_PORT_F                 5
+#define TEST_RED                    (1 << LED_PIN_1)
+#define TEST_BLUE                   (1 << LED_PIN_2)
+#define TEST_GREEN                  (1 << LED_PIN_3)
+#define TEST_RGB                    (TEST_RED | TEST_BLUE | TEST_GREEN)
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Reads the lit RGB LEDs from the model's pins
+ */
+static uint8_t_ test_rgb_pins(void)
+{
+    st_sim_port_state_t_ st_port;
+
+    sim_port_get_state(TEST_PORT_F, &st_port);
+
+    return st_port.u8_levels & st_port.u8_dir & TEST_RGB;
+}
+
+/**
+ * @brief                       :   Stages one color of the app loop, a single LED of the RGB LED
+ */
+static void test_stage_color(uint8_t_ u8_color)
+{
+    led_stage(LED_PORT_F, LED_PIN_1, (TEST_RED == u8_color)   ? LED_STATE_ON : LED_STATE_OFF);
+    led_stage(LED_PORT_F, LED_PIN_3, (TEST_GREEN == u8_color) ? LED_STATE_ON : LED_STATE_OFF);
+    led_stage(LED_PORT_F, LED_PIN_2, (TEST_BLUE == u8_color)  ? LED_STATE_ON : LED_STATE_OFF);
+}
+
+/*---------------------------------------------------------/
+/- MAIN
+/---------------------------------------------------------*/
+int main(void)
+{
+    static const uint8_t_ arr_u8_colors[] = { TEST_RED, TEST_GREEN, TEST_BLUE };
+    st_led_stats_t_ st_stats;
+    uint64_t_ u64_accesses;
+    uint32_t_ u32_iteration;
+    uint32_t_ u32_changes;
+    uint8_t_ u8_color = TEST_RED;
+
+    sim_init();
+
+    TEST_CHECK(LED_OK == led_init(LED_PORT_F, LED_PIN_1));
+    TEST_CHECK(LED_OK == led_init(LED_PORT_F, LED_PIN_2));
+    TEST_CHECK(LED_OK == led_init(LED_PORT_F, LED_PIN_3));
+    TEST_CHECK_EQ(test_rgb_pins(), 0);
+
+    // same state: only the first request reaches the port
+    led_reset_stats();
+    u64_accesses = sim_access_count();
+    for(u32_iteration = 0; u32_iteration < TEST_ITERATIONS; u32_iteration++)
+    {
+        led_on(LED_PORT_F, LED_PIN_1);
+    }
+    u64_accesses = sim_access_count() - u64_accesses;
+    led_get_stats(&st_stats);
+    printf("same state     : %lu issued, %lu elided, %llu accesses\n", st_stats.u32_writes_issued,
+           st_stats.u32_writes_elided, u64_accesses);
+    TEST_CHECK_EQ(st_stats.u32_writes_issued, 1);
+    TEST_CHECK_EQ(st_stats.u32_writes_elided, TEST_ITERATIONS - 1);
+    TEST_CHECK_EQ(u64_accesses, TEST_WRITE_ACCESSES);
+    TEST_CHECK_EQ(test_rgb_pins(), TEST_RED);
+
+    // app loop: stage every LED, commit the port once per pass
+    led_reset_stats();
+    u64_accesses = sim_access_count();
+    u32_changes = 0;
+    for(u32_iteration = 0; u32_iteration < TEST_ITERATIONS; u32_iteration++)
+    {
+        if(arr_u8_colors[(u32_iteration / TEST_COLOR_PERIOD) % sizeof(arr_u8_colors)] != u8_color)
+        {
+            u8_color = arr_u8_colors[(u32_iteration / TEST_COLOR_PERIOD) % sizeof(arr_u8_colors)];
+            u32_changes++;
+        }
+        test_stage_color(u8_color);
+        led_commit(LED_PORT_F);
+    }
+    u64_accesses = sim_access_count() - u64_accesses;
+    led_get_stats(&st_stats);
+    printf("app loop       : %lu issued, %lu elided, %llu accesses\n", st_stats.u32_writes_issued,
+           st_stats.u32_writes_elided, u64_accesses);
+    TEST_CHECK_EQ(st_stats.u32_writes_issued, u32_changes);
+    TEST_CHECK_EQ(u64_accesses, u32_changes * TEST_WRITE_ACCESSES);
+    TEST_CHECK_EQ(test_rgb_pins(), u8_color);
+
+    // alternating: every request changes the pin, blue is off after the app loop
+    TEST_CHECK(TEST_BLUE != u8_color);
+    led_reset_stats();
+    u64_accesses = sim_access_count();
+    for(u32_iteration = 0; u32_iteration < TEST_ITERATIONS; u32_iteration++)
+    {
+        if(ZERO == (u32_iteration & 1))
+        {
+            led_on(LED_PORT_F, LED_PIN_2);
+        }
+        else
+        {
+            led_off(LED_PORT_F, LED_PIN_2);
+        }
+    }
+    u64_accesses = sim_access_count() - u64_accesses;
+    led_get_stats(&st_stats);
+    printf("alternating    : %lu issued, %lu elided, %llu accesses\n", st_stats.u32_writes_issued,
+           st_stats.u32_writes_elided, u64_accesses);
+    TEST_CHECK_EQ(st_stats.u32_writes_issued, TEST_ITERATIONS);
+    TEST_CHECK_EQ(st_stats.u32_writes_elided, 0);
+    TEST_CHECK_EQ(u64_accesses, TEST_ITERATIONS * TEST_WRITE_ACCESSES);
+    TEST_CHECK_EQ(test_rgb_pins(), u8_color);
+
+    return test_result("test_led_cache");
+}
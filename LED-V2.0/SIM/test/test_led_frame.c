@@ -0,0 +1,164 @@
+/**
+ * @file    :   test_led_frame.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Host test: LED frame buffer commits applied by its refresh timer
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Maps five logical LEDs on two ports (PF1 -> PF3, PB0 -> PB1) and commits TEST_FRAMES frames,
+ * while the main line toggles PB2, an LED of the same port outside the frame, through the LED
+ * state cache the refresh tick also writes. Checks:
+ *  - the refresh timer applies each commit within one refresh period, drawing and committing
+ *    are refused until then,
+ *  - both ports change within TEST_SKEW_NS (two port writes apart), one write per changed port,
+ *  - the frame pins show the frame and PB2 its last toggle. The model takes interrupts at register
+ *    accesses only, it can't split the cache's read-modify-writes the way a core can.
+ */
+
+#include "sim_interface.h"
+#include "test_interface.h"
+#include "led_frame_interface.h"
+
+#include <stdio.h>
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define TEST_FRAMES                 200
+#define TEST_REFRESH_HZ             1000
+#define TEST_PERIOD_NS              (1000000000ULL / TEST_REFRESH_HZ)
+#define TEST_SKEW_NS                1000ULL     /* one port's write to the next one's */
+
+#define TEST_PORT_B                 1
+#define TEST_PORT_F                 5
+#define TEST_FRAME_B                0x03        /* PB0, PB1 */
+#define TEST_FRAME_F                0x0E        /* PF1 -> PF3 */
+#define TEST_TOGGLED                (1 << LED_PIN_2)    /* PB2 */
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+static const st_led_frame_map_t_ gl_arr_st_test_map[] = {
+    { LED_PORT_F, LED_PIN_1 },      // 0: PF1
+    { LED_PORT_F, LED_PIN_2 },      // 1: PF2
+    { LED_PORT_F, LED_PIN_3 },      // 2: PF3
+    { LED_PORT_B, LED_PIN_0 },      // 3: PB0
+    { LED_PORT_B, LED_PIN_1 },      // 4: PB1
+};
+
+#define TEST_LEDS                   (sizeof(gl_arr_st_test_map) / sizeof(gl_arr_st_test_map[0]))
+
+/* per port: frame pins last seen, their changes and the time of the last one */
+static uint8_t_ gl_arr_u8_test_levels[TEST_PORT_F + 1];
+static uint32_t_ gl_arr_u32_test_changes[TEST_PORT_F + 1];
+static uint64_t_ gl_arr_u64_test_changed_ns[TEST_PORT_F + 1];
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Reads the lit pins of a port within a mask
+ */
+static uint8_t_ test_pins(uint8_t_ u8_port, uint8_t_ u8_mask)
+{
+    st_sim_port_state_t_ st_port;
+
+    sim_port_get_state(u8_port, &st_port);
+
+    return st_port.u8_levels & st_port.u8_dir & u8_mask;
+}
+
+/**
+ * @brief                       :   Port listener, records the changes of the frame pins
+ */
+static void test_port_changed(uint8_t_ u8_port, const st_sim_port_state_t_ * ptr_st_state)
+{
+    uint8_t_ u8_mask = (TEST_PORT_B == u8_port) ? TEST_FRAME_B : ((TEST_PORT_F == u8_port) ? TEST_FRAME_F : 0);
+    uint8_t_ u8_levels = ptr_st_state->u8_levels & ptr_st_state->u8_dir & u8_mask;
+
+    if(u8_levels != gl_arr_u8_test_levels[u8_port])
+    {
+        gl_arr_u8_test_levels[u8_port] = u8_levels;
+        gl_arr_u32_test_changes[u8_port]++;
+        gl_arr_u64_test_changed_ns[u8_port] = sim_now_ns();
+    }
+}
+
+/*---------------------------------------------------------/
+/- MAIN
+/---------------------------------------------------------*/
+int main(void)
+{
+    st_led_frame_cfg_t_ st_cfg = {
+        .ptr_st_map     = gl_arr_st_test_map,
+        .u8_leds_count  = TEST_LEDS,
+        .en_timer       = TIMER_3,
+        .u16_refresh_hz = TEST_REFRESH_HZ
+    };
+    uint32_t_ u32_frame;
+    uint32_t_ u32_toggles = 0;
+    uint32_t_ u32_both = 0;
+    uint64_t_ u64_commit_ns;
+    uint8_t_ u8_led;
+    uint8_t_ u8_image;
+    uint8_t_ u8_previous = 0;
+    uint32_t_ arr_u32_changes[TEST_PORT_F + 1];
+
+    sim_init();
+    TEST_CHECK(SIM_OK == sim_add_port_listener(test_port_changed));
+
+    TEST_CHECK(LED_FRAME_ERROR == led_frame_init(NULL_PTR));
+    TEST_CHECK(LED_OK == led_init(LED_PORT_B, LED_PIN_2));
+    TEST_CHECK(LED_FRAME_OK == led_frame_init(&st_cfg));
+
+    for(u32_frame = 1; u32_frame <= TEST_FRAMES; u32_frame++)
+    {
+        // the five low bits of the frame number, one per LED
+        u8_image = (uint8_t_) (u32_frame & 0x1F);
+
+        for(u8_led = 0; u8_led < TEST_LEDS; u8_led++)
+        {
+            TEST_CHECK(LED_FRAME_OK == led_frame_set(u8_led, ((u8_image >> u8_led) & 1) ? LED_STATE_ON : LED_STATE_OFF));
+        }
+
+        arr_u32_changes[TEST_PORT_B] = gl_arr_u32_test_changes[TEST_PORT_B];
+        arr_u32_changes[TEST_PORT_F] = gl_arr_u32_test_changes[TEST_PORT_F];
+        u64_commit_ns = sim_now_ns();
+        TEST_CHECK(LED_FRAME_OK == led_frame_commit());
+
+        // the main line keeps writing port B until the tick applied the frame
+        while(TRUE == led_frame_is_pending())
+        {
+            TEST_CHECK(LED_FRAME_BUSY == led_frame_set(0, LED_STATE_ON));
+            TEST_CHECK(LED_FRAME_BUSY == led_frame_commit());
+            TEST_CHECK(LED_OK == led_toggle(LED_PORT_B, LED_PIN_2));
+            u32_toggles++;
+        }
+
+        // plus the end of the loop pass the tick came in
+        TEST_CHECK_RANGE(sim_now_ns() - u64_commit_ns, 0, TEST_PERIOD_NS + TEST_SKEW_NS);
+        TEST_CHECK_EQ(test_pins(TEST_PORT_F, TEST_FRAME_F), (u8_image & 0x07) << 1);
+        TEST_CHECK_EQ(test_pins(TEST_PORT_B, TEST_FRAME_B), u8_image >> 3);
+        TEST_CHECK_EQ(test_pins(TEST_PORT_B, TEST_TOGGLED), (u32_toggles & 1) ? TEST_TOGGLED : 0);
+
+        // one write per changed port, in port order: PF after PB within the skew
+        TEST_CHECK_EQ(gl_arr_u32_test_changes[TEST_PORT_F] - arr_u32_changes[TEST_PORT_F],
+                      ((u8_image ^ u8_previous) & 0x07) ? 1 : 0);
+        TEST_CHECK_EQ(gl_arr_u32_test_changes[TEST_PORT_B] - arr_u32_changes[TEST_PORT_B],
+                      ((u8_image ^ u8_previous) & 0x18) ? 1 : 0);
+        if(((u8_image ^ u8_previous) & 0x07) && ((u8_image ^ u8_previous) & 0x18))
+        {
+            TEST_CHECK_RANGE(gl_arr_u64_test_changed_ns[TEST_PORT_F] - gl_arr_u64_test_changed_ns[TEST_PORT_B],
+                             0, TEST_SKEW_NS);
+            u32_both++;
+        }
+
+        u8_previous = u8_image;
+    }
+
+    printf("%d frames, %lu on both ports, %lu toggles of PB2 while pending\n", TEST_FRAMES, u32_both, u32_toggles);
+
+    return test_result("test_led_frame");
+}
@@ -0,0 +1,276 @@
+/**
+ * @file    :   test_led_matrix.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Host test: LED matrix scan, per LED on-time integrated over whole refresh periods
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Scans a 4 x 6 row/column matrix (rows PB0 -> PB3 active high, columns PE0 -> PE5 active low)
+ * and a 4 pin charlieplexed one (PC4 -> PC7, 12 LEDs) with every brightness level set on some
+ * LED. A port listener keeps which LEDs conduct from the pin states (row/col: row driven high and
+ * column driven low, charlieplex: anode driven high and cathode driven low) and integrates their
+ * on-time over TEST_PERIODS refresh periods. Checks per mode:
+ *  - each LED's duty is B / (LED_MATRIX_LEVELS * lines) within TEST_DUTY_TOL_PPM,
+ *  - brightness 0 LEDs never conduct, not even between the writes of a line change (ghosting),
+ *  - at most one line active at any time.
+ * The pin model has no LED currents: charlieplex paths through two LEDs in series are not seen.
+ */
+
+#include "sim_interface.h"
+#include "test_interface.h"
+#include "led_matrix_interface.h"
+
+#include <stdio.h>
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define TEST_REFRESH_HZ             200
+#define TEST_PERIODS                10
+#define TEST_DUTY_TOL_PPM           250         /* of the window: slot writes lag their timer by a few accesses */
+
+#define TEST_PORT_B                 1
+#define TEST_PORT_C                 2
+#define TEST_PORT_E                 4
+
+#define TEST_ROWS                   4
+#define TEST_COLS                   6
+#define TEST_CHARLIE_PINS           4
+#define TEST_CHARLIE_PIN_0          4           /* PC4 */
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+static const st_led_matrix_cfg_t_ gl_st_test_row_col = {
+    .en_type                = LED_MATRIX_ROW_COL,
+    .en_row_port            = LED_PORT_B,
+    .arr_en_row_pins        = { LED_PIN_0, LED_PIN_1, LED_PIN_2, LED_PIN_3 },
+    .u8_rows                = TEST_ROWS,
+    .en_col_port            = LED_PORT_E,
+    .arr_en_col_pins        = { LED_PIN_0, LED_PIN_1, LED_PIN_2, LED_PIN_3, LED_PIN_4, LED_PIN_5 },
+    .u8_cols                = TEST_COLS,
+    .bool_row_active_high   = TRUE,
+    .bool_col_active_high   = FALSE,
+    .en_timer               = TIMER_1,
+    .u16_refresh_hz         = TEST_REFRESH_HZ
+};
+
+static const st_led_matrix_cfg_t_ gl_st_test_charlieplex = {
+    .en_type                = LED_MATRIX_CHARLIEPLEX,
+    .en_row_port            = LED_PORT_C,
+    .arr_en_row_pins        = { LED_PIN_4, LED_PIN_5, LED_PIN_6, LED_PIN_7 },
+    .u8_rows                = TEST_CHARLIE_PINS,
+    .en_timer               = TIMER_1,
+    .u16_refresh_hz         = TEST_REFRESH_HZ
+};
+
+static const st_led_matrix_cfg_t_ * gl_ptr_st_test_cfg = NULL_PTR;
+
+/* LEDs conducting since gl_u64_test_last_ns, their on-time in the window */
+static boolean gl_arr_bool_test_lit[LED_MATRIX_LINES_MAX][LED_MATRIX_COLS_MAX];
+static uint64_t_ gl_arr_u64_test_on_ns[LED_MATRIX_LINES_MAX][LED_MATRIX_COLS_MAX];
+static uint64_t_ gl_u64_test_last_ns = 0;
+static uint32_t_ gl_u32_test_lines_overlap = 0;
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Pins of a port driven high and driven low as outputs
+ */
+static void test_port_drive(uint8_t_ u8_port, uint8_t_ * ptr_u8_high, uint8_t_ * ptr_u8_low)
+{
+    st_sim_port_state_t_ st_port;
+
+    sim_port_get_state(u8_port, &st_port);
+
+    *ptr_u8_high = st_port.u8_dir & st_port.u8_levels;
+    *ptr_u8_low = st_port.u8_dir & ~st_port.u8_levels;
+}
+
+/**
+ * @brief                       :   Port listener, adds the time since the last change to the LEDs that
+ *                                  conducted, then takes the LEDs conducting now
+ */
+static void test_port_changed(uint8_t_ u8_port, const st_sim_port_state_t_ * ptr_st_state)
+{
+    uint64_t_ u64_now_ns = sim_now_ns();
+    uint8_t_ u8_high;
+    uint8_t_ u8_low;
+    uint8_t_ u8_col_high;
+    uint8_t_ u8_col_low;
+    uint8_t_ u8_lines;
+    uint8_t_ u8_row;
+    uint8_t_ u8_col;
+
+    (void) u8_port;
+    (void) ptr_st_state;
+
+    for(u8_row = 0; u8_row < LED_MATRIX_LINES_MAX; u8_row++)
+    {
+        for(u8_col = 0; u8_col < LED_MATRIX_COLS_MAX; u8_col++)
+        {
+            gl_arr_u64_test_on_ns[u8_row][u8_col] += (TRUE == gl_arr_bool_test_lit[u8_row][u8_col]) ?
+                                                     (u64_now_ns - gl_u64_test_last_ns) : 0;
+            gl_arr_bool_test_lit[u8_row][u8_col] = FALSE;
+        }
+    }
+    gl_u64_test_last_ns = u64_now_ns;
+
+    if(NULL_PTR == gl_ptr_st_test_cfg)
+    {
+        /* Do Nothing */
+    }
+    else if(LED_MATRIX_CHARLIEPLEX == gl_ptr_st_test_cfg->en_type)
+    {
+        test_port_drive(TEST_PORT_C, &u8_high, &u8_low);
+        u8_high >>= TEST_CHARLIE_PIN_0;
+        u8_low >>= TEST_CHARLIE_PIN_0;
+        u8_lines = 0;
+
+        for(u8_row = 0; u8_row < TEST_CHARLIE_PINS; u8_row++)
+        {
+            u8_lines += (u8_high >> u8_row) & 1;
+            for(u8_col = 0; u8_col < TEST_CHARLIE_PINS; u8_col++)
+            {
+                gl_arr_bool_test_lit[u8_row][u8_col] = (((u8_high >> u8_row) & 1) && ((u8_low >> u8_col) & 1)) ?
+                                                       TRUE : FALSE;
+            }
+        }
+        gl_u32_test_lines_overlap += (1 < u8_lines) ? 1 : 0;
+    }
+    else
+    {
+        test_port_drive(TEST_PORT_B, &u8_high, &u8_low);
+        test_port_drive(TEST_PORT_E, &u8_col_high, &u8_col_low);
+        u8_lines = 0;
+
+        for(u8_row = 0; u8_row < TEST_ROWS; u8_row++)
+        {
+            u8_lines += (u8_high >> u8_row) & 1;
+            for(u8_col = 0; u8_col < TEST_COLS; u8_col++)
+            {
+                gl_arr_bool_test_lit[u8_row][u8_col] = (((u8_high >> u8_row) & 1) && ((u8_col_low >> u8_col) & 1)) ?
+                                                       TRUE : FALSE;
+            }
+        }
+        gl_u32_test_lines_overlap += (1 < u8_lines) ? 1 : 0;
+    }
+}
+
+/**
+ * @brief                       :   Brightness of an LED: every level 0 -> LED_MATRIX_LEVELS on some LED
+ */
+static uint8_t_ test_brightness(uint8_t_ u8_row, uint8_t_ u8_col, uint8_t_ u8_cols)
+{
+    return (uint8_t_) (((u8_row * u8_cols) + u8_col) * 7 % (LED_MATRIX_LEVELS + 1));
+}
+
+/**
+ * @brief                       :   Scans a matrix for TEST_PERIODS refresh periods and checks the LED duties
+ *
+ * @param[in]   ptr_st_cfg      :   Matrix
+ * @param[in]   ptr_str_name    :   Mode name printed
+ */
+static void test_scan(const st_led_matrix_cfg_t_ * ptr_st_cfg, const char * ptr_str_name)
+{
+    boolean bool_charlieplex = (LED_MATRIX_CHARLIEPLEX == ptr_st_cfg->en_type) ? TRUE : FALSE;
+    uint8_t_ u8_lines = ptr_st_cfg->u8_rows;
+    uint8_t_ u8_cols = (TRUE == bool_charlieplex) ? ptr_st_cfg->u8_rows : ptr_st_cfg->u8_cols;
+    uint32_t_ u32_slot_us = 1000000UL / ((uint32_t_) TEST_REFRESH_HZ * u8_lines * LED_MATRIX_LEVELS);
+    uint64_t_ u64_window_ns = (uint64_t_) u32_slot_us * 1000 * LED_MATRIX_LEVELS * u8_lines * TEST_PERIODS;
+    uint64_t_ u64_start_ns;
+    uint32_t_ u32_ghosts = 0;
+    uint32_t_ u32_off_duty = 0;
+    sint64_t_ s64_error_ppm;
+    sint64_t_ s64_worst_ppm = 0;
+    uint8_t_ u8_brightness;
+    uint8_t_ u8_row;
+    uint8_t_ u8_col;
+
+    sim_init();
+    TEST_CHECK(SIM_OK == sim_add_port_listener(test_port_changed));
+    gl_ptr_st_test_cfg = ptr_st_cfg;
+
+    TEST_CHECK(LED_MATRIX_OK == led_matrix_init(ptr_st_cfg));
+    for(u8_row = 0; u8_row < u8_lines; u8_row++)
+    {
+        for(u8_col = 0; u8_col < u8_cols; u8_col++)
+        {
+            if((FALSE == bool_charlieplex) || (u8_row != u8_col))
+            {
+                TEST_CHECK(LED_MATRIX_OK == led_matrix_set(u8_row, u8_col, test_brightness(u8_row, u8_col, u8_cols)));
+            }
+        }
+    }
+    TEST_CHECK(LED_MATRIX_ERROR == led_matrix_set(u8_lines, 0, 1));
+    TEST_CHECK(LED_MATRIX_ERROR == led_matrix_set(0, 0, LED_MATRIX_LEVELS + 1));
+
+    // one period to get the new brightness on every line, then a window of whole periods
+    sim_run_for(u64_window_ns / TEST_PERIODS);
+    test_port_changed(0, NULL_PTR);
+    for(u8_row = 0; u8_row < LED_MATRIX_LINES_MAX; u8_row++)
+    {
+        for(u8_col = 0; u8_col < LED_MATRIX_COLS_MAX; u8_col++)
+        {
+            gl_arr_u64_test_on_ns[u8_row][u8_col] = 0;
+        }
+    }
+    gl_u32_test_lines_overlap = 0;
+    u64_start_ns = sim_now_ns();
+
+    sim_run_for(u64_window_ns);
+    test_port_changed(0, NULL_PTR);
+    TEST_CHECK_EQ(sim_now_ns() - u64_start_ns, u64_window_ns);
+
+    printf("%s: %u lines, %lu us slots, duty %% (brightness)\n", ptr_str_name, u8_lines, u32_slot_us);
+    for(u8_row = 0; u8_row < u8_lines; u8_row++)
+    {
+        printf(" ");
+        for(u8_col = 0; u8_col < u8_cols; u8_col++)
+        {
+            if((TRUE == bool_charlieplex) && (u8_row == u8_col))
+            {
+                TEST_CHECK_EQ(gl_arr_u64_test_on_ns[u8_row][u8_col], 0);
+                printf("      -     ");
+            }
+            else
+            {
+                u8_brightness = test_brightness(u8_row, u8_col, u8_cols);
+
+                // on-time against B slots of each line scan
+                s64_error_ppm = ((sint64_t_) gl_arr_u64_test_on_ns[u8_row][u8_col] * 1000000 / (sint64_t_) u64_window_ns) -
+                                ((sint64_t_) u8_brightness * 1000000 / (LED_MATRIX_LEVELS * u8_lines));
+                s64_worst_ppm = (s64_error_ppm > s64_worst_ppm) ? s64_error_ppm :
+                                ((-s64_error_ppm > s64_worst_ppm) ? -s64_error_ppm : s64_worst_ppm);
+                u32_off_duty += ((s64_error_ppm > TEST_DUTY_TOL_PPM) || (s64_error_ppm < -TEST_DUTY_TOL_PPM)) ? 1 : 0;
+                u32_ghosts += ((ZERO == u8_brightness) && (ZERO != gl_arr_u64_test_on_ns[u8_row][u8_col])) ? 1 : 0;
+
+                printf(" %6.3f (%2u)", 100.0 * (double) gl_arr_u64_test_on_ns[u8_row][u8_col] / (double) u64_window_ns,
+                       u8_brightness);
+            }
+        }
+        printf("\n");
+    }
+    printf("  worst duty error %lld ppm, %lu line overlaps\n", s64_worst_ppm, gl_u32_test_lines_overlap);
+
+    TEST_CHECK_EQ(u32_off_duty, 0);
+    TEST_CHECK_EQ(u32_ghosts, 0);
+    TEST_CHECK_EQ(gl_u32_test_lines_overlap, 0);
+
+    sim_remove_port_listener(test_port_changed);
+    gl_ptr_st_test_cfg = NULL_PTR;
+}
+
+/*---------------------------------------------------------/
+/- MAIN
+/---------------------------------------------------------*/
+int main(void)
+{
+    test_scan(&gl_st_test_row_col, "row/col 4 x 6");
+    test_scan(&gl_st_test_charlieplex, "charlieplex 4 pins");
+
+    return test_result("test_led_matrix");
+}
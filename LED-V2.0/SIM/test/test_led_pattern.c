@@ -0,0 +1,461 @@
+/**
+ * @file    :   test_led_pattern.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Host test: LED pattern interpreter on a virtual tick
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Runs patterns through led_pattern_tick() one tick at a time and checks the output callback:
+ *  - the breathing example of led_pattern_interface.h: fade end points and their ticks, the
+ *    color moving one way during a fade, the hold, the period of the endless loop,
+ *  - its event branch, for an event posted during a fade (taken when WAIT_EVENT runs) and
+ *    during the hold (taken on the next tick), then END with the LEDs off,
+ *  - nested counted loops run their bodies count times,
+ *  - a jump out of the program stops it in LED_PATTERN_FAULT with the LEDs off.
+ * Then plays the compressed led_anim animations of test_led_anim_data.c (16 RGB LEDs, chase,
+ * white breathing and a rainbow) and checks each decoded frame against the frame generated
+ * here, and reports as checked outputs:
+ *  - the compression ratio, raw channel bytes / compressed bytes,
+ *  - the decode cost per frame: data bytes read and channel writes (callback calls).
+ * Ratio and cost are exact for the data, their ranges hold the reported values within 5 %.
+ *
+ * test_led_pattern --frames <name> prints the frames of an animation for tools/led_anim_encode.py,
+ * test_led_anim_data.c is regenerated with:
+ *  test_led_pattern --frames chase > chase.txt && led_anim_encode.py chase.txt test_chase 20
+ * (same for breathe and rainbow) and the outputs concatenated.
+ */
+
+#include "test_interface.h"
+#include "led_pattern_interface.h"
+#include "led_anim_interface.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define TEST_FADE_TICKS             LED_PATTERN_TICKS(1000)
+#define TEST_HOLD_TICKS             LED_PATTERN_TICKS(500)
+#define TEST_RED_TICKS              LED_PATTERN_TICKS(2000)
+#define TEST_PERIOD_TICKS           ((2 * TEST_FADE_TICKS) + TEST_HOLD_TICKS)
+#define TEST_TOP_TICK               (1 + TEST_FADE_TICKS)   /* first fade ends, tick 1 starts it */
+#define TEST_CYCLES                 4
+#define TEST_LOOP_TICKS             LED_PATTERN_TICKS(100)
+#define TEST_OUTER_COUNT            3
+#define TEST_INNER_COUNT            2
+#define TEST_EVENT                  0
+#define TEST_FULL                   255
+
+#define TEST_ANIM_LEDS              16
+#define TEST_ANIM_CHANNELS          (3 * TEST_ANIM_LEDS)    /* R G B per LED */
+#define TEST_ANIM_FRAMES            64
+#define TEST_ANIM_TOLERANCE         5                       /* % around the reported ratio and cost */
+#define TEST_ANIMS                  (sizeof(gl_arr_st_test_anims) / sizeof(gl_arr_st_test_anims[0]))
+
+/*---------------------------------------------------------/
+/- STRUCTS
+/---------------------------------------------------------*/
+typedef struct
+{
+    const char *            ptr_str_name                        ;
+    uint8_t_                (*ptr_value)(uint16_t_ u16_frame, uint16_t_ u16_channel);
+    const st_led_anim_t_ *  ptr_st_anim                         ;
+    uint32_t_               u32_ratio_x100                      ;   /* reported */
+    uint32_t_               u32_bytes_x100                      ;   /* reported, read per frame */
+    uint32_t_               u32_writes_x100                     ;   /* reported, per frame */
+}st_test_anim_t_;
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+/* the example of led_pattern_interface.h */
+static const uint8_t_ gl_arr_u8_test_breathe[] = {
+    LED_PATTERN_LOOP(0),                                    //  0: forever
+    LED_PATTERN_FADE(0, 0, 255, 1000),                      //  2: blue up in 1 s
+    LED_PATTERN_WAIT_EVENT(TEST_EVENT, 500, 21),            //  8: hold 0.5 s, event 0 -> 21
+    LED_PATTERN_FADE(0, 0, 0, 1000),                        // 14: blue down in 1 s
+    LED_PATTERN_NEXT(),                                     // 20
+    LED_PATTERN_SET(255, 0, 0),                             // 21: red
+    LED_PATTERN_WAIT(2000),                                 // 25
+    LED_PATTERN_END()                                       // 28: off
+};
+
+static const uint8_t_ gl_arr_u8_test_loops[] = {
+    LED_PATTERN_LOOP(TEST_OUTER_COUNT),                     //  0
+    LED_PATTERN_LOOP(TEST_INNER_COUNT),                     //  2
+    LED_PATTERN_SET(0, 255, 0),                             //  4: green
+    LED_PATTERN_WAIT(100),                                  //  8
+    LED_PATTERN_SET(0, 0, 0),                               // 11
+    LED_PATTERN_WAIT(100),                                  // 15
+    LED_PATTERN_NEXT(),                                     // 18
+    LED_PATTERN_SET(255, 0, 0),                             // 19: red
+    LED_PATTERN_WAIT(100),                                  // 23
+    LED_PATTERN_SET(0, 0, 0),                               // 26
+    LED_PATTERN_WAIT(100),                                  // 30
+    LED_PATTERN_NEXT(),                                     // 33
+    LED_PATTERN_END()                                       // 34
+};
+
+static const uint8_t_ gl_arr_u8_test_bad_jump[] = {
+    LED_PATTERN_SET(255, 255, 255),                         //  0
+    LED_PATTERN_WAIT(100),                                  //  4
+    LED_PATTERN_JUMP(200)                                   //  7: past the end
+};
+
+/* test_led_anim_data.c, generated from the frames below */
+extern const st_led_anim_t_ gl_st_test_chase;
+extern const st_led_anim_t_ gl_st_test_breathe;
+extern const st_led_anim_t_ gl_st_test_rainbow;
+
+static uint8_t_ gl_arr_u8_test_shown[TEST_ANIM_CHANNELS];
+static uint32_t_ gl_u32_test_writes = 0;
+
+static st_led_pattern_t_ gl_st_test_pattern;
+static st_led_pattern_color_t_ gl_st_test_color;
+static uint32_t_ gl_u32_test_outputs = 0;
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Output callback, keeps the last color
+ */
+static void test_output(const st_led_pattern_color_t_ * ptr_st_color)
+{
+    gl_st_test_color = *ptr_st_color;
+    gl_u32_test_outputs++;
+}
+
+/**
+ * @brief                       :   Starts a pattern, checks the LEDs are off
+ */
+static void test_start(const uint8_t_ * ptr_u8_program, uint16_t_ u16_length)
+{
+    gl_u32_test_outputs = 0;
+    TEST_CHECK(LED_PATTERN_OK == led_pattern_start(&gl_st_test_pattern, ptr_u8_program, u16_length, test_output));
+    TEST_CHECK_EQ(gl_u32_test_outputs, 1);
+    TEST_CHECK_EQ(gl_st_test_color.u8_red | gl_st_test_color.u8_green | gl_st_test_color.u8_blue, 0);
+}
+
+/**
+ * @brief                       :   Runs the breathing pattern without events, checks end points,
+ *                                  direction and period of TEST_CYCLES cycles
+ */
+static void test_breathe(void)
+{
+    uint32_t_ u32_tick;
+    uint32_t_ u32_phase;
+    uint32_t_ u32_tops = 0;
+    uint32_t_ u32_bottoms = 0;
+    uint8_t_ u8_before;
+
+    test_start(gl_arr_u8_test_breathe, sizeof(gl_arr_u8_test_breathe));
+
+    for(u32_tick = 1; u32_tick <= (TEST_TOP_TICK + (TEST_CYCLES * TEST_PERIOD_TICKS)); u32_tick++)
+    {
+        u8_before = gl_st_test_color.u8_blue;
+        led_pattern_tick(&gl_st_test_pattern);
+
+        TEST_CHECK_EQ(gl_st_test_color.u8_red | gl_st_test_color.u8_green, 0);
+
+        // phase 0: a fade up ends, HOLD + FADE: a fade down ends (and tick 1 starts the first fade up)
+        u32_phase = (u32_tick + TEST_PERIOD_TICKS - TEST_TOP_TICK) % TEST_PERIOD_TICKS;
+
+        if(0 == u32_phase)
+        {
+            TEST_CHECK_EQ(gl_st_test_color.u8_blue, TEST_FULL);
+            u32_tops++;
+        }
+        else if(u32_phase <= TEST_HOLD_TICKS)
+        {
+            TEST_CHECK_EQ(gl_st_test_color.u8_blue, TEST_FULL);
+        }
+        else if(u32_phase < (TEST_HOLD_TICKS + TEST_FADE_TICKS))
+        {
+            TEST_CHECK_RANGE(gl_st_test_color.u8_blue, 1, u8_before);
+        }
+        else if(u32_phase == (TEST_HOLD_TICKS + TEST_FADE_TICKS))
+        {
+            TEST_CHECK_EQ(gl_st_test_color.u8_blue, 0);
+            u32_bottoms++;
+        }
+        else
+        {
+            TEST_CHECK_RANGE(gl_st_test_color.u8_blue, u8_before, TEST_FULL - 1);
+        }
+    }
+
+    TEST_CHECK_EQ(u32_tops, TEST_CYCLES + 1);
+    TEST_CHECK_EQ(u32_bottoms, TEST_CYCLES + 1);
+    TEST_CHECK(LED_PATTERN_RUNNING == led_pattern_get_state(&gl_st_test_pattern));
+    printf("breathe: %lu outputs over %d cycles\n", gl_u32_test_outputs, TEST_CYCLES);
+}
+
+/**
+ * @brief                       :   Posts the event on a tick of the breathing pattern, checks the
+ *                                  branch to red on the expected tick, the red time and END
+ *
+ * @param[in]   u32_post_tick   :   Tick after which the event is posted
+ * @param[in]   u32_branch_tick :   Tick expected to turn the LED red
+ */
+static void test_branch(uint32_t_ u32_post_tick, uint32_t_ u32_branch_tick)
+{
+    uint32_t_ u32_tick;
+
+    test_start(gl_arr_u8_test_breathe, sizeof(gl_arr_u8_test_breathe));
+
+    for(u32_tick = 1; u32_tick <= (u32_branch_tick + TEST_RED_TICKS + 1); u32_tick++)
+    {
+        led_pattern_tick(&gl_st_test_pattern);
+
+        if(u32_tick == u32_post_tick)
+        {
+            TEST_CHECK(LED_PATTERN_OK == led_pattern_post_event(&gl_st_test_pattern, TEST_EVENT));
+        }
+
+        if(u32_tick < u32_branch_tick)
+        {
+            TEST_CHECK_EQ(gl_st_test_color.u8_red, 0);
+        }
+        else if(u32_tick < (u32_branch_tick + TEST_RED_TICKS))
+        {
+            TEST_CHECK_EQ(gl_st_test_color.u8_red, TEST_FULL);
+            TEST_CHECK_EQ(gl_st_test_color.u8_green | gl_st_test_color.u8_blue, 0);
+            TEST_CHECK(LED_PATTERN_RUNNING == led_pattern_get_state(&gl_st_test_pattern));
+        }
+        else
+        {
+            TEST_CHECK_EQ(gl_st_test_color.u8_red | gl_st_test_color.u8_green | gl_st_test_color.u8_blue, 0);
+            TEST_CHECK(LED_PATTERN_STOPPED == led_pattern_get_state(&gl_st_test_pattern));
+        }
+    }
+}
+
+/**
+ * @brief                       :   Runs the nested loops to the end, counts the green and red flashes
+ */
+static void test_loops(void)
+{
+    uint32_t_ u32_tick;
+    uint32_t_ u32_green = 0;
+    uint32_t_ u32_red = 0;
+    st_led_pattern_color_t_ st_before;
+
+    test_start(gl_arr_u8_test_loops, sizeof(gl_arr_u8_test_loops));
+
+    for(u32_tick = 1; u32_tick <= (TEST_OUTER_COUNT * (TEST_INNER_COUNT + 1) * 2 * TEST_LOOP_TICKS) + 2; u32_tick++)
+    {
+        st_before = gl_st_test_color;
+        led_pattern_tick(&gl_st_test_pattern);
+
+        if((0 == st_before.u8_green) && (0 != gl_st_test_color.u8_green))
+        {
+            u32_green++;
+        }
+        if((0 == st_before.u8_red) && (0 != gl_st_test_color.u8_red))
+        {
+            u32_red++;
+        }
+    }
+
+    TEST_CHECK_EQ(u32_green, TEST_OUTER_COUNT * TEST_INNER_COUNT);
+    TEST_CHECK_EQ(u32_red, TEST_OUTER_COUNT);
+    TEST_CHECK(LED_PATTERN_STOPPED == led_pattern_get_state(&gl_st_test_pattern));
+}
+
+/**
+ * @brief                       :   Runs a jump past the end of the program, checks the fault
+ */
+static void test_fault(void)
+{
+    uint32_t_ u32_tick;
+
+    test_start(gl_arr_u8_test_bad_jump, sizeof(gl_arr_u8_test_bad_jump));
+
+    // SET and WAIT on tick 1, the wait ends and JUMP runs on tick 1 + TEST_LOOP_TICKS
+    for(u32_tick = 1; u32_tick <= TEST_LOOP_TICKS; u32_tick++)
+    {
+        led_pattern_tick(&gl_st_test_pattern);
+        TEST_CHECK_EQ(gl_st_test_color.u8_red, TEST_FULL);
+    }
+
+    led_pattern_tick(&gl_st_test_pattern);
+    TEST_CHECK(LED_PATTERN_FAULT == led_pattern_get_state(&gl_st_test_pattern));
+    TEST_CHECK_EQ(gl_st_test_color.u8_red | gl_st_test_color.u8_green | gl_st_test_color.u8_blue, 0);
+}
+
+/**
+ * @brief                       :   Chase: one white LED going round with a fading tail of two
+ */
+static uint8_t_ test_chase_value(uint16_t_ u16_frame, uint16_t_ u16_channel)
+{
+    static const uint8_t_ arr_u8_tail[3] = { 255, 64, 16 };
+    uint16_t_ u16_behind = ((u16_frame % TEST_ANIM_LEDS) + TEST_ANIM_LEDS - (u16_channel / 3)) % TEST_ANIM_LEDS;
+
+    return (u16_behind < 3) ? arr_u8_tail[u16_behind] : 0;
+}
+
+/**
+ * @brief                       :   Breathing: every channel up 0 -> 255 and down again over 64 frames
+ */
+static uint8_t_ test_breathe_value(uint16_t_ u16_frame, uint16_t_ u16_channel)
+{
+    uint16_t_ u16_phase = u16_frame % TEST_ANIM_FRAMES;
+
+    (void) u16_channel;
+
+    return (uint8_t_)((u16_phase < 32) ? ((u16_phase * 255) / 31) : (((63 - u16_phase) * 255) / 31));
+}
+
+/**
+ * @brief                       :   Rainbow: triangle wave per color, phase shifted along the LEDs and
+ *                                  between the colors, moving 8 steps per frame
+ */
+static uint8_t_ test_rainbow_value(uint16_t_ u16_frame, uint16_t_ u16_channel)
+{
+    uint8_t_ u8_hue = (uint8_t_)(((u16_channel / 3) * 16) + (u16_frame * 8) + ((u16_channel % 3) * 85));
+
+    return (uint8_t_)((u8_hue < 128) ? (u8_hue * 2) : ((255 - u8_hue) * 2));
+}
+
+static const st_test_anim_t_ gl_arr_st_test_anims[] = {
+    /* name        frames              compressed              ratio   bytes   writes */
+    { "chase",      test_chase_value,   &gl_st_test_chase,      496,    967,    1256    },
+    { "breathe",    test_breathe_value, &gl_st_test_breathe,    2418,   198,    4725    },
+    { "rainbow",    test_rainbow_value, &gl_st_test_rainbow,    97,     4900,   4800    },
+};
+
+/**
+ * @brief                       :   led_anim output callback, keeps the shown channels
+ */
+static void test_anim_output(uint16_t_ u16_channel, uint8_t_ u8_value)
+{
+    TEST_CHECK_RANGE(u16_channel, 0, TEST_ANIM_CHANNELS - 1);
+    gl_arr_u8_test_shown[u16_channel % TEST_ANIM_CHANNELS] = u8_value;
+    gl_u32_test_writes++;
+}
+
+/**
+ * @brief                       :   Plays a compressed animation, checks every frame, its ratio and decode cost
+ */
+static void test_anim(const st_test_anim_t_ * ptr_st_test)
+{
+    const st_led_anim_t_ * ptr_st_anim = ptr_st_test->ptr_st_anim;
+    st_led_anim_player_t_ st_player;
+    uint32_t_ u32_wrong = 0;
+    uint32_t_ u32_ratio_x100;
+    uint32_t_ u32_bytes_x100;
+    uint32_t_ u32_writes_x100;
+    uint16_t_ u16_frame;
+    uint16_t_ u16_channel;
+
+    memset(gl_arr_u8_test_shown, 0, sizeof(gl_arr_u8_test_shown));
+    gl_u32_test_writes = 0;
+
+    TEST_CHECK_EQ(ptr_st_anim->u16_channels, TEST_ANIM_CHANNELS);
+    TEST_CHECK_EQ(ptr_st_anim->u16_frames, TEST_ANIM_FRAMES);
+    TEST_CHECK(LED_ANIM_OK == led_anim_start(&st_player, ptr_st_anim, test_anim_output));
+
+    for(u16_frame = 0; u16_frame < TEST_ANIM_FRAMES; u16_frame++)
+    {
+        TEST_CHECK(LED_ANIM_OK == led_anim_next_frame(&st_player));
+
+        for(u16_channel = 0; u16_channel < TEST_ANIM_CHANNELS; u16_channel++)
+        {
+            u32_wrong += (gl_arr_u8_test_shown[u16_channel] != ptr_st_test->ptr_value(u16_frame, u16_channel)) ? 1 : 0;
+        }
+    }
+
+    TEST_CHECK_EQ(u32_wrong, 0);
+    TEST_CHECK(LED_ANIM_DONE == led_anim_next_frame(&st_player));
+    TEST_CHECK_EQ(st_player.u32_offset, ptr_st_anim->u32_size);
+
+    u32_ratio_x100 = (100UL * TEST_ANIM_CHANNELS * TEST_ANIM_FRAMES) / ptr_st_anim->u32_size;
+    u32_bytes_x100 = (100UL * ptr_st_anim->u32_size) / TEST_ANIM_FRAMES;
+    u32_writes_x100 = (100UL * gl_u32_test_writes) / TEST_ANIM_FRAMES;
+
+    printf("%-8s %4lu -> %4lu bytes, ratio %lu.%02lu, per frame: %lu.%02lu bytes read, %lu.%02lu channel writes\n",
+           ptr_st_test->ptr_str_name, (uint32_t_)(TEST_ANIM_CHANNELS * TEST_ANIM_FRAMES), ptr_st_anim->u32_size,
+           u32_ratio_x100 / 100, u32_ratio_x100 % 100, u32_bytes_x100 / 100, u32_bytes_x100 % 100,
+           u32_writes_x100 / 100, u32_writes_x100 % 100);
+
+    TEST_CHECK_RANGE(u32_ratio_x100, (ptr_st_test->u32_ratio_x100 * (100 - TEST_ANIM_TOLERANCE)) / 100,
+                     (ptr_st_test->u32_ratio_x100 * (100 + TEST_ANIM_TOLERANCE)) / 100);
+    TEST_CHECK_RANGE(u32_bytes_x100, (ptr_st_test->u32_bytes_x100 * (100 - TEST_ANIM_TOLERANCE)) / 100,
+                     (ptr_st_test->u32_bytes_x100 * (100 + TEST_ANIM_TOLERANCE)) / 100);
+    TEST_CHECK_RANGE(u32_writes_x100, (ptr_st_test->u32_writes_x100 * (100 - TEST_ANIM_TOLERANCE)) / 100,
+                     (ptr_st_test->u32_writes_x100 * (100 + TEST_ANIM_TOLERANCE)) / 100);
+}
+
+/**
+ * @brief                       :   Prints the frames of an animation, one line per frame
+ *
+ * @return  0: printed, 1: unknown animation
+ */
+static int test_print_frames(const char * ptr_str_name)
+{
+    int exit_code = 1;
+    uint8_t_ u8_anim;
+    uint16_t_ u16_frame;
+    uint16_t_ u16_channel;
+
+    for(u8_anim = 0; u8_anim < TEST_ANIMS; u8_anim++)
+    {
+        if(ZERO == strcmp(ptr_str_name, gl_arr_st_test_anims[u8_anim].ptr_str_name))
+        {
+            printf("# %s, %d frames x %d channels (R G B of %d LEDs)\n", ptr_str_name, TEST_ANIM_FRAMES,
+                   TEST_ANIM_CHANNELS, TEST_ANIM_LEDS);
+
+            for(u16_frame = 0; u16_frame < TEST_ANIM_FRAMES; u16_frame++)
+            {
+                for(u16_channel = 0; u16_channel < TEST_ANIM_CHANNELS; u16_channel++)
+                {
+                    printf("%s%u", (ZERO == u16_channel) ? "" : " ", gl_arr_st_test_anims[u8_anim].ptr_value(u16_frame, u16_channel));
+                }
+                printf("\n");
+            }
+            exit_code = 0;
+        }
+    }
+
+    return exit_code;
+}
+
+/*---------------------------------------------------------/
+/- MAIN
+/---------------------------------------------------------*/
+int main(int argc, char * argv[])
+{
+    int exit_code;
+    uint8_t_ u8_anim;
+
+    if((3 == argc) && (ZERO == strcmp(argv[1], "--frames")))
+    {
+        exit_code = test_print_frames(argv[2]);
+    }
+    else
+    {
+        test_breathe();
+
+        // posted during the first fade: pending until WAIT_EVENT runs at the top
+        test_branch(TEST_TOP_TICK / 2, TEST_TOP_TICK);
+
+        // posted during the hold: taken on the next tick
+        test_branch(TEST_TOP_TICK + (TEST_HOLD_TICKS / 2), TEST_TOP_TICK + (TEST_HOLD_TICKS / 2) + 1);
+
+        test_loops();
+        test_fault();
+
+        for(u8_anim = 0; u8_anim < TEST_ANIMS; u8_anim++)
+        {
+            test_anim(&gl_arr_st_test_anims[u8_anim]);
+        }
+
+        exit_code = test_result("test_led_pattern");
+    }
+
+    return exit_code;
+}
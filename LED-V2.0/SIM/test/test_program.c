@@ -0,0 +1,72 @@
+/**
+ * @file    :   test_program.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Program File contains all host test checks' functions' implementation
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "test_interface.h"
+
+#include <stdio.h>
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+static uint32_t_ gl_u32_test_checks = 0;
+static uint32_t_ gl_u32_test_failures = 0;
+
+/*---------------------------------------------------------/
+/- FUNCTION IMPLEMENTATION
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Counts a check, prints it when it failed
+ */
+void test_check(boolean bool_passed, const char * ptr_str_check, const char * ptr_str_file, uint32_t_ u32_line)
+{
+    gl_u32_test_checks++;
+
+    if(FALSE == bool_passed)
+    {
+        gl_u32_test_failures++;
+        printf("%s:%lu: FAILED %s\n", ptr_str_file, u32_line, ptr_str_check);
+    }
+}
+
+/**
+ * @brief                       :   Counts a check of a value against a range, prints the value when out of it
+ */
+void test_check_range(sint64_t_ s64_value, sint64_t_ s64_min, sint64_t_ s64_max,
+                      const char * ptr_str_value, const char * ptr_str_file, uint32_t_ u32_line)
+{
+    gl_u32_test_checks++;
+
+    if((s64_value < s64_min) || (s64_value > s64_max))
+    {
+        gl_u32_test_failures++;
+
+        if(s64_min == s64_max)
+        {
+            printf("%s:%lu: FAILED %s is %lld, expected %lld\n", ptr_str_file, u32_line, ptr_str_value,
+                   s64_value, s64_min);
+        }
+        else
+        {
+            printf("%s:%lu: FAILED %s is %lld, expected %lld -> %lld\n", ptr_str_file, u32_line, ptr_str_value,
+                   s64_value, s64_min, s64_max);
+        }
+    }
+}
+
+/**
+ * @brief                       :   Prints the number of checks and failures
+ */
+int test_result(const char * ptr_str_name)
+{
+    printf("%s: %lu checks, %lu failed\n", ptr_str_name, gl_u32_test_checks, gl_u32_test_failures);
+    fflush(stdout);
+
+    return ((ZERO == gl_u32_test_failures) && (ZERO != gl_u32_test_checks)) ? 0 : 1;
+}
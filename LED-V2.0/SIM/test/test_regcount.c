@@ -0,0 +1,159 @@
+/**
+ * @file    :   test_regcount.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Host test: register access counts of gpio_pin_init and led_on
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Built with REGCOUNT_INSTRUMENTATION = 1, counts the register accesses of single calls on the
+ * register model and checks them against the driver code:
+ *  - gpio_pin_init of an output on a reset port: each SET_BIT a read modify write, each CLR_BIT
+ *    of a clear bit a repeat, then the DIR read of the drive strength,
+ *  - the same gpio_pin_init again: no write, every read modify write now a repeat,
+ *  - led_on after led_off: one DIR read and one masked DATA write, led_on of a LED already on:
+ *    no access.
+ */
+
+#include "sim_interface.h"
+#include "test_interface.h"
+#include "regcount_interface.h"
+#include "gpio_interface.h"
+#include "led_interface.h"
+
+#include <stdio.h>
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define TEST_RCGCGPIO               0x400FE608UL
+#define TEST_PORTF_DATA_PF1         0x40025008UL    /* GPIODATA_MASKED(F, PF1) */
+#define TEST_PORTF_DIR              0x40025400UL
+#define TEST_PORTF_DR2R             0x40025500UL
+#define TEST_PORTF_DEN              0x4002551CUL
+#define TEST_PORTF_AMSEL            0x40025528UL
+
+#define TEST_TOGGLES                100
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Checks counts against reads, writes, read modify writes and repeats
+ */
+static void test_counts(const st_regcount_counts_t_ * ptr_st_counts, uint32_t_ u32_reads, uint32_t_ u32_writes,
+                        uint32_t_ u32_rmws, uint32_t_ u32_repeats)
+{
+    TEST_CHECK_EQ(ptr_st_counts->u32_reads, u32_reads);
+    TEST_CHECK_EQ(ptr_st_counts->u32_writes, u32_writes);
+    TEST_CHECK_EQ(ptr_st_counts->u32_rmws, u32_rmws);
+    TEST_CHECK_EQ(ptr_st_counts->u32_repeats, u32_repeats);
+}
+
+/**
+ * @brief                       :   Checks the counts of one register
+ */
+static void test_register(uint32_t_ u32_addr, uint32_t_ u32_reads, uint32_t_ u32_writes,
+                          uint32_t_ u32_rmws, uint32_t_ u32_repeats)
+{
+    st_regcount_counts_t_ st_counts;
+
+    TEST_CHECK(REGCOUNT_OK == regcount_get_register(u32_addr, &st_counts));
+    test_counts(&st_counts, u32_reads, u32_writes, u32_rmws, u32_repeats);
+}
+
+/**
+ * @brief                       :   Checks the totals
+ */
+static void test_totals(uint32_t_ u32_reads, uint32_t_ u32_writes, uint32_t_ u32_rmws, uint32_t_ u32_repeats)
+{
+    st_regcount_counts_t_ st_counts;
+
+    TEST_CHECK(REGCOUNT_OK == regcount_get_totals(&st_counts));
+    test_counts(&st_counts, u32_reads, u32_writes, u32_rmws, u32_repeats);
+}
+
+/**
+ * @brief                       :   gpio_pin_init of PF1 as an output, on a reset port then again
+ */
+static void test_gpio_pin_init(void)
+{
+    st_gpio_cfg_t st_gpio_cfg = {.port = GPIO_PORT_F, .pin = GPIO_PIN_1, .pin_cfg = OUTPUT};
+
+    sim_init();
+
+    // RCGCGPIO, DEN, DIR, DR2R set: 4 read modify writes, AMSEL, AFSEL already clear: 2 repeats
+    regcount_start();
+    TEST_CHECK(GPIO_OK == gpio_pin_init(&st_gpio_cfg));
+    regcount_stop();
+    regcount_dump("gpio_pin_init, reset port");
+
+    test_totals(9, 4, 4, 2);
+    test_register(TEST_RCGCGPIO, 1, 1, 1, 0);
+    test_register(TEST_PORTF_DEN, 1, 1, 1, 0);
+    test_register(TEST_PORTF_AMSEL, 2, 0, 0, 1);
+    test_register(TEST_PORTF_DIR, 2, 1, 1, 0);
+    test_register(TEST_PORTF_DR2R, 1, 1, 1, 0);
+
+    // the same configuration: 13 reads, the 6 bit operations write back unchanged values
+    regcount_start();
+    TEST_CHECK(GPIO_OK == gpio_pin_init(&st_gpio_cfg));
+    regcount_stop();
+    regcount_dump("gpio_pin_init, again");
+
+    test_totals(13, 0, 0, 6);
+    test_register(TEST_RCGCGPIO, 2, 0, 0, 1);
+    test_register(TEST_PORTF_DIR, 3, 0, 0, 1);
+}
+
+/**
+ * @brief                       :   led_on after led_off, of a LED already on, and alternating with led_off
+ */
+static void test_led_on(void)
+{
+    uint32_t_ u32_toggle;
+
+    sim_init();
+    TEST_CHECK(LED_OK == led_init(LED_PORT_F, LED_PIN_1));
+    TEST_CHECK(LED_OK == led_off(LED_PORT_F, LED_PIN_1));
+
+    // the output check reads DIR, the masked address writes PF1 alone
+    regcount_start();
+    TEST_CHECK(LED_OK == led_on(LED_PORT_F, LED_PIN_1));
+    regcount_stop();
+    regcount_dump("led_on, LED off");
+
+    test_totals(1, 1, 0, 0);
+    test_register(TEST_PORTF_DIR, 1, 0, 0, 0);
+    test_register(TEST_PORTF_DATA_PF1, 0, 1, 0, 0);
+
+    // the state cache skips the port
+    regcount_start();
+    TEST_CHECK(LED_OK == led_on(LED_PORT_F, LED_PIN_1));
+    regcount_stop();
+
+    test_totals(0, 0, 0, 0);
+
+    regcount_start();
+    for(u32_toggle = 0; u32_toggle < TEST_TOGGLES; u32_toggle++)
+    {
+        TEST_CHECK(LED_OK == led_off(LED_PORT_F, LED_PIN_1));
+        TEST_CHECK(LED_OK == led_on(LED_PORT_F, LED_PIN_1));
+    }
+    regcount_stop();
+
+    test_totals(2 * TEST_TOGGLES, 2 * TEST_TOGGLES, 0, 0);
+    test_register(TEST_PORTF_DATA_PF1, 0, 2 * TEST_TOGGLES, 0, 0);
+}
+
+/*---------------------------------------------------------/
+/- MAIN
+/---------------------------------------------------------*/
+int main(void)
+{
+    test_gpio_pin_init();
+    test_led_on();
+
+    return test_result("test_regcount");
+}
@@ -0,0 +1,160 @@
+/**
+ * @file    :   test_six_presses.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Host test: the whole firmware through the six presses of six_presses.sim
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Runs main.c on the register model as led_sim does and presses SW1 (PF4) at the times of
+ * SIM/harness/six_presses.sim. The RGB LED must go RED -> GREEN -> BLUE -> ALL -> OFF -> RED,
+ * each color TEST_LATENCY_MS after its press (debounce), and a color left alone must go off
+ * COLOR_ON_MS after it came on. Every change is checked against its expected time within
+ * TEST_TOLERANCE_MS. The second press lands on the end of RED's on-time: its debounced edge
+ * comes first (the timeout timer starts once RED is written), RED goes to GREEN directly.
+ */
+
+#include "sim_interface.h"
+#include "test_interface.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* the firmware's main becomes firmware_main, called once the model is set up */
+#define main firmware_main
+#include "main.c"
+#undef main
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define TEST_NS_PER_MS              1000000ULL
+
+#define TEST_PORT_F                 5
+#define TEST_BTN_PIN                4
+#define TEST_HOLD_MS                80
+#define TEST_END_MS                 5500
+
+#define TEST_RED                    (1 << 1)    /* PF1 */
+#define TEST_BLUE                   (1 << 2)    /* PF2 */
+#define TEST_GREEN                  (1 << 3)    /* PF3 */
+#define TEST_ALL                    (TEST_RED | TEST_BLUE | TEST_GREEN)
+#define TEST_OFF                    0
+
+#define TEST_LATENCY_MS             20          /* press to LED change, debounce from the tick's restart */
+#define TEST_ON_MS                  1000        /* COLOR_ON_MS */
+#define TEST_TOLERANCE_MS           1           /* interrupt and loop pass */
+
+#define TEST_PRESS_MS(INDEX)        (gl_arr_u32_test_presses_ms[INDEX] + TEST_LATENCY_MS)
+#define TEST_CHANGES_MAX            32
+
+/*---------------------------------------------------------/
+/- STRUCTS
+/---------------------------------------------------------*/
+typedef struct
+{
+    uint32_t_               u32_at_ms       ;
+    uint8_t_                u8_leds         ;
+}st_test_change_t_;
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+/* six_presses.sim */
+static const uint32_t_ gl_arr_u32_test_presses_ms[] = { 500, 1500, 1800, 3200, 3500, 4000 };
+
+static const st_test_change_t_ gl_arr_st_test_expected[] = {
+    { TEST_PRESS_MS(0)                  , TEST_RED      },
+    { TEST_PRESS_MS(1)                  , TEST_GREEN    },
+    { TEST_PRESS_MS(2)                  , TEST_BLUE     },
+    { TEST_PRESS_MS(2) + TEST_ON_MS     , TEST_OFF      },
+    { TEST_PRESS_MS(3)                  , TEST_ALL      },
+    { TEST_PRESS_MS(4)                  , TEST_OFF      },
+    { TEST_PRESS_MS(5)                  , TEST_RED      },
+    { TEST_PRESS_MS(5) + TEST_ON_MS     , TEST_OFF      },
+};
+
+static uint64_t_ gl_arr_u64_test_changes_ns[TEST_CHANGES_MAX];
+static uint8_t_ gl_arr_u8_test_changes_leds[TEST_CHANGES_MAX];
+static uint8_t_ gl_u8_test_changes = 0;
+static uint8_t_ gl_u8_test_leds = TEST_OFF;
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Port listener, stamps every change of the lit RGB LEDs
+ */
+static void test_port_changed(uint8_t_ u8_port, const st_sim_port_state_t_ * ptr_st_state)
+{
+    uint8_t_ u8_leds = ptr_st_state->u8_levels & ptr_st_state->u8_dir & TEST_ALL;
+
+    if((TEST_PORT_F == u8_port) && (u8_leds != gl_u8_test_leds))
+    {
+        if(TEST_CHANGES_MAX > gl_u8_test_changes)
+        {
+            gl_arr_u64_test_changes_ns[gl_u8_test_changes] = sim_now_ns();
+            gl_arr_u8_test_changes_leds[gl_u8_test_changes] = u8_leds;
+        }
+        gl_u8_test_changes++;
+        gl_u8_test_leds = u8_leds;
+    }
+}
+
+/**
+ * @brief                       :   End of the simulation, checks the changes against the expected ones
+ */
+static void test_end(void)
+{
+    uint8_t_ u8_change;
+    sint64_t_ s64_at_ns;
+    sint64_t_ s64_expected_ns;
+
+    TEST_CHECK_EQ(gl_u8_test_changes, sizeof(gl_arr_st_test_expected) / sizeof(gl_arr_st_test_expected[0]));
+
+    for(u8_change = 0;
+        (u8_change < gl_u8_test_changes) && (u8_change < (sizeof(gl_arr_st_test_expected) / sizeof(gl_arr_st_test_expected[0])));
+        u8_change++)
+    {
+        s64_at_ns = (sint64_t_) gl_arr_u64_test_changes_ns[u8_change];
+        s64_expected_ns = (sint64_t_) gl_arr_st_test_expected[u8_change].u32_at_ms * TEST_NS_PER_MS;
+
+        printf("%12.3f ms  RGB = %c%c%c\n", (double) s64_at_ns / TEST_NS_PER_MS,
+               (ZERO != (gl_arr_u8_test_changes_leds[u8_change] & TEST_RED))   ? 'R' : '-',
+               (ZERO != (gl_arr_u8_test_changes_leds[u8_change] & TEST_GREEN)) ? 'G' : '-',
+               (ZERO != (gl_arr_u8_test_changes_leds[u8_change] & TEST_BLUE))  ? 'B' : '-');
+
+        TEST_CHECK_EQ(gl_arr_u8_test_changes_leds[u8_change], gl_arr_st_test_expected[u8_change].u8_leds);
+        TEST_CHECK_RANGE(s64_at_ns, s64_expected_ns - (TEST_TOLERANCE_MS * TEST_NS_PER_MS),
+                         s64_expected_ns + (TEST_TOLERANCE_MS * TEST_NS_PER_MS));
+    }
+
+    exit(test_result("test_six_presses"));
+}
+
+/*---------------------------------------------------------/
+/- MAIN
+/---------------------------------------------------------*/
+int main(void)
+{
+    uint8_t_ u8_press;
+
+    sim_init();
+
+    for(u8_press = 0; u8_press < (sizeof(gl_arr_u32_test_presses_ms) / sizeof(gl_arr_u32_test_presses_ms[0])); u8_press++)
+    {
+        sim_pin_schedule(gl_arr_u32_test_presses_ms[u8_press] * TEST_NS_PER_MS, TEST_PORT_F, TEST_BTN_PIN, SIM_PIN_LOW);
+        sim_pin_schedule((gl_arr_u32_test_presses_ms[u8_press] + TEST_HOLD_MS) * TEST_NS_PER_MS, TEST_PORT_F, TEST_BTN_PIN,
+                         SIM_PIN_RELEASE);
+    }
+
+    sim_add_port_listener(test_port_changed);
+
+    // the firmware never returns: the end handler checks and exits
+    sim_set_end(TEST_END_MS * TEST_NS_PER_MS, test_end);
+    firmware_main();
+
+    TEST_CHECK(FALSE);
+    return test_result("test_six_presses");
+}
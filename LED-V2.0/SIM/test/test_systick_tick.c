@@ -0,0 +1,78 @@
+/**
+ * @file    :   test_systick_tick.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Host test: the SysTick time base against the simulated time
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Starts the free running time base with the app's SysTick configuration and period and advances
+ * the virtual clock for TEST_RUN_MS in uneven steps. After every step systick_get_ms must be within
+ * TEST_TOLERANCE_MS of the simulated time elapsed since systick_tick_start, the ms between two
+ * interrupts are read from the counter. SysTick interrupts once per period only, periods beyond
+ * the 24-bit counter are refused.
+ */
+
+#include "sim_interface.h"
+#include "test_interface.h"
+#include "systick_interface.h"
+#include "TM4C123.h"
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define TEST_NS_PER_MS              1000000ULL
+#define TEST_RUN_MS                 10000
+#define TEST_STEP_MAX_NS            (3 * TEST_NS_PER_MS)
+#define TEST_TOLERANCE_MS           1
+#define TEST_PERIOD_MS              100         /* APP_TIME_BASE_MS */
+#define TEST_PERIOD_MAX_MS          4194        /* 2^24 cycles of PIOSC / 4 */
+
+/*---------------------------------------------------------/
+/- MAIN
+/---------------------------------------------------------*/
+int main(void)
+{
+    st_systick_cfg_t st_systick_cfg = {
+            .bool_systick_int_enabled = TRUE,
+            .en_systick_clk_src = CLK_SRC_PIOSC
+    };
+    uint64_t_ u64_start_ns;
+    uint64_t_ u64_elapsed_ms;
+    uint32_t_ u32_seed = 1;
+    sint64_t_ s64_error_ms;
+    sint64_t_ s64_error_min_ms = 0;
+    sint64_t_ s64_error_max_ms = 0;
+
+    sim_init();
+
+    TEST_CHECK(ST_OK == systick_init(&st_systick_cfg));
+    TEST_CHECK(ST_INVALID_ARGS == systick_tick_start(0));
+    TEST_CHECK(ST_INVALID_ARGS == systick_tick_start(TEST_PERIOD_MAX_MS + 1));
+    TEST_CHECK(ST_OK == systick_tick_start(TEST_PERIOD_MS));
+    u64_start_ns = sim_now_ns();
+
+    do
+    {
+        // uneven steps (LCG), so the checks don't stay in phase with the tick
+        u32_seed = (u32_seed * 1103515245UL) + 12345UL;
+        sim_run_for(1 + ((u32_seed >> 8) % TEST_STEP_MAX_NS));
+
+        u64_elapsed_ms = (sim_now_ns() - u64_start_ns) / TEST_NS_PER_MS;
+        s64_error_ms = (sint64_t_) systick_get_ms() - (sint64_t_) u64_elapsed_ms;
+
+        s64_error_min_ms = (s64_error_ms < s64_error_min_ms) ? s64_error_ms : s64_error_min_ms;
+        s64_error_max_ms = (s64_error_ms > s64_error_max_ms) ? s64_error_ms : s64_error_max_ms;
+    }
+    while(TEST_RUN_MS > u64_elapsed_ms);
+
+    TEST_CHECK_RANGE(s64_error_min_ms, -TEST_TOLERANCE_MS, TEST_TOLERANCE_MS);
+    TEST_CHECK_RANGE(s64_error_max_ms, -TEST_TOLERANCE_MS, TEST_TOLERANCE_MS);
+    TEST_CHECK_EQ(sim_irq_entries(SysTick_IRQn), u64_elapsed_ms / TEST_PERIOD_MS);
+
+    // the blocking delay would stop the counter
+    TEST_CHECK(ST_INVALID_CONFIG == systick_ms_delay(1));
+
+    return test_result("test_systick_tick");
+}
@@ -0,0 +1,209 @@
+/**
+ * @file    :   test_tlc59xx.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Host test: TLC5947 chain grayscale stream decoded from SSI2 and latched by XLAT
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Models the 4 chip chain as one 1152 bit shift register fed MSB first with the 12 bit SSI2
+ * frames the uDMA sends, latched into the 96 grayscale values on each XLAT (PB5) rising edge:
+ * channel c holds bits 12c -> 12c + 11 of the register. Shows pseudo random frames, all full,
+ * all off and a partial update (the other channels keep their values). Checks per frame:
+ *  - every latched channel is the brightness set, the chain got exactly 96 frames,
+ *  - the frames leave back to back: 96 * 12 bits at 8 MHz = 144 us,
+ *  - one XLAT pulse, after the last bit and within one latch period of the show, BLANK low,
+ *  - tlc59xx_show is refused until the frame is latched.
+ */
+
+#include "sim_interface.h"
+#include "test_interface.h"
+#include "tlc59xx_interface.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define TEST_SSI_2                  2
+#define TEST_PORT_B                 1
+#define TEST_XLAT_BIT               (1 << 5)    /* PB5 */
+#define TEST_BLANK_BIT              (1 << 6)    /* PB6 */
+
+#define TEST_GS_BITS                12
+#define TEST_CHAIN_BITS             (TLC59XX_CHANNELS * TEST_GS_BITS)
+#define TEST_FRAME_NS               1500ULL     /* 12 bits at 16 MHz / 2 */
+#define TEST_SHIFT_NS               (TLC59XX_CHANNELS * TEST_FRAME_NS)
+#define TEST_LATCH_PERIOD_NS        (1000000000ULL / TLC59XX_LATCH_HZ)
+#define TEST_STEP_NS                10000ULL    /* polling step while a frame is in flight */
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+/* chain shift register, bit 0 entered last (SIN of chip 0) */
+static uint8_t_ gl_arr_u8_test_chain[TEST_CHAIN_BITS];
+static uint16_t_ gl_arr_u16_test_latched[TLC59XX_CHANNELS];
+
+static uint32_t_ gl_u32_test_frames = 0;
+static uint64_t_ gl_u64_test_first_ns = 0;
+static uint64_t_ gl_u64_test_last_ns = 0;
+static uint32_t_ gl_u32_test_latches = 0;
+static uint64_t_ gl_u64_test_latch_ns = 0;
+static uint32_t_ gl_u32_test_blanks = 0;
+static uint8_t_ gl_u8_test_port_b = 0;
+
+/* brightness set, per channel */
+static uint16_t_ gl_arr_u16_test_set[TLC59XX_CHANNELS];
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   SSI listener, shifts the frames of SSI2 into the chain, MSB first
+ */
+static void test_ssi_frame(uint8_t_ u8_module, uint16_t_ u16_frame)
+{
+    sint8_t_ s8_bit;
+
+    if(TEST_SSI_2 == u8_module)
+    {
+        for(s8_bit = TEST_GS_BITS - 1; s8_bit >= 0; s8_bit--)
+        {
+            memmove(&gl_arr_u8_test_chain[1], &gl_arr_u8_test_chain[0], TEST_CHAIN_BITS - 1);
+            gl_arr_u8_test_chain[0] = (u16_frame >> s8_bit) & 1;
+        }
+
+        gl_u64_test_first_ns = (ZERO == gl_u32_test_frames) ? sim_now_ns() : gl_u64_test_first_ns;
+        gl_u64_test_last_ns = sim_now_ns();
+        gl_u32_test_frames++;
+    }
+}
+
+/**
+ * @brief                       :   Port listener, latches the chain on an XLAT rising edge, counts BLANK highs
+ */
+static void test_port_changed(uint8_t_ u8_port, const st_sim_port_state_t_ * ptr_st_state)
+{
+    uint8_t_ u8_levels = ptr_st_state->u8_levels & ptr_st_state->u8_dir;
+    uint8_t_ u8_channel;
+    uint8_t_ u8_bit;
+
+    if(TEST_PORT_B == u8_port)
+    {
+        if((ZERO != (u8_levels & TEST_XLAT_BIT)) && (ZERO == (gl_u8_test_port_b & TEST_XLAT_BIT)))
+        {
+            for(u8_channel = 0; u8_channel < TLC59XX_CHANNELS; u8_channel++)
+            {
+                gl_arr_u16_test_latched[u8_channel] = 0;
+                for(u8_bit = 0; u8_bit < TEST_GS_BITS; u8_bit++)
+                {
+                    gl_arr_u16_test_latched[u8_channel] |= gl_arr_u8_test_chain[(u8_channel * TEST_GS_BITS) + u8_bit] << u8_bit;
+                }
+            }
+
+            gl_u32_test_latches++;
+            gl_u64_test_latch_ns = sim_now_ns();
+        }
+
+        gl_u32_test_blanks += ((ZERO != (u8_levels & TEST_BLANK_BIT)) && (ZERO == (gl_u8_test_port_b & TEST_BLANK_BIT))) ? 1 : 0;
+        gl_u8_test_port_b = u8_levels;
+    }
+}
+
+/**
+ * @brief                       :   Shows the drawn frame and checks the decoded stream and its latch
+ *
+ * @param[in]   ptr_str_name    :   Frame name printed
+ */
+static void test_show(const char * ptr_str_name)
+{
+    uint64_t_ u64_show_ns;
+    uint32_t_ u32_wrong = 0;
+    uint8_t_ u8_channel;
+
+    gl_u32_test_frames = 0;
+    gl_u32_test_latches = 0;
+    u64_show_ns = sim_now_ns();
+
+    TEST_CHECK(TLC59XX_OK == tlc59xx_show());
+    TEST_CHECK(TLC59XX_BUSY == tlc59xx_show());
+
+    while(TRUE == tlc59xx_is_busy())
+    {
+        sim_run_for(TEST_STEP_NS);
+    }
+
+    for(u8_channel = 0; u8_channel < TLC59XX_CHANNELS; u8_channel++)
+    {
+        u32_wrong += (gl_arr_u16_test_latched[u8_channel] != gl_arr_u16_test_set[u8_channel]) ? 1 : 0;
+    }
+
+    TEST_CHECK_EQ(gl_u32_test_frames, TLC59XX_CHANNELS);
+    TEST_CHECK_EQ(u32_wrong, 0);
+    TEST_CHECK_EQ(gl_u64_test_last_ns - gl_u64_test_first_ns + TEST_FRAME_NS, TEST_SHIFT_NS);
+    TEST_CHECK_EQ(gl_u32_test_latches, 1);
+    TEST_CHECK_RANGE(gl_u64_test_latch_ns, gl_u64_test_last_ns, u64_show_ns + TEST_SHIFT_NS + TEST_LATCH_PERIOD_NS);
+
+    printf("%-16s shift %4llu us, latched %5llu us after the show, channels 0/95: %4u %4u\n", ptr_str_name,
+           (gl_u64_test_last_ns - gl_u64_test_first_ns + TEST_FRAME_NS) / 1000, (gl_u64_test_latch_ns - u64_show_ns) / 1000,
+           gl_arr_u16_test_latched[0], gl_arr_u16_test_latched[TLC59XX_CHANNELS - 1]);
+}
+
+/**
+ * @brief                       :   Sets one channel, keeps what was set
+ */
+static void test_set(uint8_t_ u8_channel, uint16_t_ u16_brightness)
+{
+    TEST_CHECK(TLC59XX_OK == tlc59xx_set_brightness(u8_channel, u16_brightness));
+    gl_arr_u16_test_set[u8_channel] = u16_brightness;
+}
+
+/*---------------------------------------------------------/
+/- MAIN
+/---------------------------------------------------------*/
+int main(void)
+{
+    uint32_t_ u32_seed = 1;
+    uint8_t_ u8_channel;
+
+    sim_init();
+    sim_set_ssi_listener(test_ssi_frame);
+    TEST_CHECK(SIM_OK == sim_add_port_listener(test_port_changed));
+
+    TEST_CHECK(TLC59XX_ERROR == tlc59xx_show());
+    TEST_CHECK(TLC59XX_OK == tlc59xx_init());
+    TEST_CHECK(TLC59XX_ERROR == tlc59xx_set_brightness(TLC59XX_CHANNELS, 0));
+    TEST_CHECK(TLC59XX_ERROR == tlc59xx_set_brightness(0, TLC59XX_BRIGHTNESS_MAX + 1));
+
+    for(u8_channel = 0; u8_channel < TLC59XX_CHANNELS; u8_channel++)
+    {
+        // LCG, all 12 bits used
+        u32_seed = (u32_seed * 1103515245UL) + 12345UL;
+        test_set(u8_channel, (uint16_t_) ((u32_seed >> 16) & TLC59XX_BRIGHTNESS_MAX));
+    }
+    test_show("random");
+
+    for(u8_channel = 0; u8_channel < TLC59XX_CHANNELS; u8_channel++)
+    {
+        test_set(u8_channel, TLC59XX_BRIGHTNESS_MAX);
+    }
+    test_show("all full");
+
+    for(u8_channel = 0; u8_channel < TLC59XX_CHANNELS; u8_channel++)
+    {
+        test_set(u8_channel, 0);
+    }
+    test_show("all off");
+
+    // the back buffer continues from the shown frame
+    test_set(0, 1);
+    test_set(TLC59XX_CHANNELS_PER_CHIP, 0x800);
+    test_set(TLC59XX_CHANNELS - 1, TLC59XX_BRIGHTNESS_MAX);
+    test_show("three channels");
+
+    TEST_CHECK_EQ(gl_u32_test_blanks, 0);
+
+    return test_result("test_tlc59xx");
+}
@@ -0,0 +1,255 @@
+/**
+ * @file    :   test_trace_wrap.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Host test: trace ring wraparound, dumped and decoded by tools/trace_decode.py
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Writes two and a half rings of records on the register model, spaced 1 to 5 us apart, with a
+ * few 100 s pauses so the DWT stamps wrap 2^32 cycles too. Record n carries event n % events,
+ * arg0 n & 0xFF and arg1 n, so every decoded line tells which record it is. Checks:
+ *  - the ring: index counts every record, slot n % TRACE_RECORDS holds record n for the last
+ *    TRACE_RECORDS records, the header is intact,
+ *  - the dump: gl_st_trace saved after a block of unrelated RAM is found and decoded by
+ *    trace_decode.py, the summary counts the overwritten records, and the TRACE_RECORDS lines
+ *    are the last records, oldest first, with their event names, arguments and times since the
+ *    first shown record and since the previous one, across the index and stamp wraps.
+ * usage: test_trace_wrap python trace_decode.py dump.bin
+ */
+
+#include "TM4C123.h"
+
+#include "sim_interface.h"
+#include "test_interface.h"
+#include "trace_interface.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define TEST_WRITES                 ((2 * TRACE_RECORDS) + (TRACE_RECORDS / 2) + 37)
+#define TEST_FIRST_SHOWN            (TEST_WRITES - TRACE_RECORDS)
+#define TEST_NS_PER_US              1000ULL
+#define TEST_GAP_US(N)              (1 + ((N) % 5))
+#define TEST_PAUSE_EVERY            300         /* records between 100 s pauses */
+#define TEST_PAUSE_NS               100000000000ULL
+#define TEST_PAD_BYTES              100         /* RAM dumped before the buffer */
+#define TEST_LINE_MAX               160
+#define TEST_COMMAND_MAX            512
+#define TEST_US_TOLERANCE           0.07        /* a 16 MHz stamp cycle, two decimals printed */
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+extern st_trace_buffer_t gl_st_trace;
+
+/* decoder names, TRACE_EV_ prefix dropped */
+static const char * const gl_arr_str_test_events[TRACE_EV_TOTAL] = {
+    "GPIO_ISR", "SYSTICK", "BTN_EDGE", "BTN_EVENT", "LED_WRITE", "APP_STATE"
+};
+
+/* virtual time of each record */
+static uint64_t_ gl_arr_u64_test_write_ns[TEST_WRITES];
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Data word of record n
+ */
+static uint32_t_ test_data(uint32_t_ u32_record)
+{
+    return (u32_record % TRACE_EV_TOTAL) |
+           ((u32_record & 0xFF) << TRACE_DATA_ARG0_POS) |
+           ((u32_record & 0xFFFF) << TRACE_DATA_ARG1_POS);
+}
+
+/**
+ * @brief                       :   Writes one word as the target holds it: 32 bits, little endian
+ */
+static boolean test_word(FILE * ptr_file, uint32_t_ u32_word)
+{
+    uint8_t_ arr_u8_bytes[4];
+    uint8_t_ u8_byte;
+
+    for(u8_byte = 0; u8_byte < 4; u8_byte++)
+    {
+        arr_u8_bytes[u8_byte] = (uint8_t_)(u32_word >> (8 * u8_byte));
+    }
+
+    return (1 == fwrite(arr_u8_bytes, sizeof(arr_u8_bytes), 1, ptr_file)) ? TRUE : FALSE;
+}
+
+/**
+ * @brief                       :   Saves gl_st_trace after a block of unrelated RAM, as a debugger dump of the target
+ *
+ * uint32_t_ is wider on the host, the words are written in the target layout of st_trace_buffer_t
+ */
+static boolean test_dump(const char * ptr_str_path)
+{
+    boolean bool_saved = FALSE;
+    uint8_t_ arr_u8_pad[TEST_PAD_BYTES];
+    uint32_t_ u32_slot;
+    FILE * ptr_file = fopen(ptr_str_path, "wb");
+
+    if(NULL_PTR != ptr_file)
+    {
+        memset(arr_u8_pad, 0xA5, sizeof(arr_u8_pad));
+        bool_saved = ((1 == fwrite(arr_u8_pad, sizeof(arr_u8_pad), 1, ptr_file)) &&
+                      (TRUE == test_word(ptr_file, gl_st_trace.u32_magic)) &&
+                      (TRUE == test_word(ptr_file, gl_st_trace.u32_records)) &&
+                      (TRUE == test_word(ptr_file, gl_st_trace.u32_clock_hz)) &&
+                      (TRUE == test_word(ptr_file, gl_st_trace.u32_index))) ? TRUE : FALSE;
+
+        for(u32_slot = 0; u32_slot < TRACE_RECORDS; u32_slot++)
+        {
+            bool_saved = ((TRUE == bool_saved) &&
+                          (TRUE == test_word(ptr_file, gl_st_trace.arr_st_records[u32_slot].u32_stamp)) &&
+                          (TRUE == test_word(ptr_file, gl_st_trace.arr_st_records[u32_slot].u32_data))) ? TRUE : FALSE;
+        }
+
+        bool_saved = (0 == fclose(ptr_file)) ? bool_saved : FALSE;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    return bool_saved;
+}
+
+/**
+ * @brief                       :   Runs the decoder on the dump, checks its summary and every line
+ */
+static void test_decode(const char * ptr_str_python, const char * ptr_str_decoder, const char * ptr_str_dump)
+{
+    char arr_c_command[TEST_COMMAND_MAX];
+    char arr_c_line[TEST_LINE_MAX];
+    char arr_c_event[32];
+    char arr_c_summary[TEST_LINE_MAX];
+    FILE * ptr_pipe;
+    uint32_t_ u32_lines = 0;
+    uint32_t_ u32_wrong = 0;
+    uint32_t_ u32_record;
+    uint32_t_ u32_arg0;
+    uint32_t_ u32_arg1;
+    double f64_t_us;
+    double f64_dt_us;
+    double f64_expected_t_us;
+    double f64_expected_dt_us;
+
+    snprintf(arr_c_command, sizeof(arr_c_command), "\"%s\" \"%s\" \"%s\"", ptr_str_python, ptr_str_decoder, ptr_str_dump);
+    snprintf(arr_c_summary, sizeof(arr_c_summary), "# %d records written, %d shown, %d overwritten, %d slots, %lu Hz\n",
+             TEST_WRITES, TRACE_RECORDS, TEST_FIRST_SHOWN, TRACE_RECORDS, (unsigned long) gl_st_trace.u32_clock_hz);
+
+    ptr_pipe = popen(arr_c_command, "r");
+    TEST_CHECK(NULL_PTR != ptr_pipe);
+
+    while((NULL_PTR != ptr_pipe) && (NULL_PTR != fgets(arr_c_line, sizeof(arr_c_line), ptr_pipe)))
+    {
+        if('#' == arr_c_line[0])
+        {
+            // the summary, then the column titles
+            TEST_CHECK((ZERO == strcmp(arr_c_line, arr_c_summary)) || (ZERO == strncmp(arr_c_line, "#         t_us", 14)));
+        }
+        else if((5 == sscanf(arr_c_line, "%lf %lf %31s arg0=%u arg1=0x%x", &f64_t_us, &f64_dt_us, arr_c_event, &u32_arg0, &u32_arg1)) &&
+                (TRACE_RECORDS > u32_lines))
+        {
+            u32_record = TEST_FIRST_SHOWN + u32_lines;
+
+            f64_expected_t_us = (double)(gl_arr_u64_test_write_ns[u32_record] - gl_arr_u64_test_write_ns[TEST_FIRST_SHOWN]) / TEST_NS_PER_US;
+            f64_expected_dt_us = (ZERO == u32_lines) ? 0.0 :
+                                 (double)(gl_arr_u64_test_write_ns[u32_record] - gl_arr_u64_test_write_ns[u32_record - 1]) / TEST_NS_PER_US;
+
+            u32_wrong += ((ZERO != strcmp(arr_c_event, gl_arr_str_test_events[u32_record % TRACE_EV_TOTAL])) ||
+                          (u32_arg0 != (u32_record & 0xFF)) ||
+                          (u32_arg1 != (u32_record & 0xFFFF)) ||
+                          (TEST_US_TOLERANCE < (f64_t_us - f64_expected_t_us)) || (-TEST_US_TOLERANCE > (f64_t_us - f64_expected_t_us)) ||
+                          (TEST_US_TOLERANCE < (f64_dt_us - f64_expected_dt_us)) || (-TEST_US_TOLERANCE > (f64_dt_us - f64_expected_dt_us))) ? 1 : 0;
+            u32_lines++;
+        }
+        else
+        {
+            u32_wrong++;
+            printf("unexpected: %s", arr_c_line);
+        }
+    }
+
+    TEST_CHECK((NULL_PTR != ptr_pipe) && (0 == pclose(ptr_pipe)));
+    TEST_CHECK_EQ(u32_lines, TRACE_RECORDS);
+    TEST_CHECK_EQ(u32_wrong, 0);
+
+    printf("decoded %lu lines, records %d -> %d, %lu wrong\n", (unsigned long) u32_lines,
+           TEST_FIRST_SHOWN, TEST_WRITES - 1, (unsigned long) u32_wrong);
+}
+
+/*---------------------------------------------------------/
+/- MAIN
+/---------------------------------------------------------*/
+int main(int argc, char * argv[])
+{
+    uint32_t_ u32_record;
+    uint32_t_ u32_wrong = 0;
+    uint32_t_ u32_stamp_wraps = 0;
+    uint32_t_ u32_slot;
+
+    sim_init();
+    trace_init();
+
+    TEST_CHECK_EQ(gl_st_trace.u32_magic, TRACE_MAGIC);
+    TEST_CHECK_EQ(gl_st_trace.u32_records, TRACE_RECORDS);
+    TEST_CHECK_EQ(gl_st_trace.u32_clock_hz, SystemCoreClock);
+    TEST_CHECK_EQ(gl_st_trace.u32_index, 0);
+
+    for(u32_record = 0; u32_record < TEST_WRITES; u32_record++)
+    {
+        sim_run_for(((ZERO != u32_record) && (ZERO == (u32_record % TEST_PAUSE_EVERY))) ? TEST_PAUSE_NS : (TEST_GAP_US(u32_record) * TEST_NS_PER_US));
+
+        trace_write(test_data(u32_record));
+        gl_arr_u64_test_write_ns[u32_record] = sim_now_ns();
+    }
+
+    // the ring holds the last TRACE_RECORDS records, stamps in index order
+    TEST_CHECK_EQ(gl_st_trace.u32_index, TEST_WRITES);
+
+    for(u32_record = TEST_FIRST_SHOWN; u32_record < TEST_WRITES; u32_record++)
+    {
+        u32_slot = u32_record % TRACE_RECORDS;
+        u32_wrong += (test_data(u32_record) != gl_st_trace.arr_st_records[u32_slot].u32_data) ? 1 : 0;
+
+        if(TEST_FIRST_SHOWN != u32_record)
+        {
+            u32_stamp_wraps += (gl_st_trace.arr_st_records[u32_slot].u32_stamp <
+                                gl_st_trace.arr_st_records[(u32_record - 1) % TRACE_RECORDS].u32_stamp) ? 1 : 0;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    TEST_CHECK_EQ(u32_wrong, 0);
+    TEST_CHECK(ZERO != u32_stamp_wraps);
+
+    printf("%d records in %d slots, index %lu, %lu stamp wraps in the ring\n", TEST_WRITES, TRACE_RECORDS,
+           (unsigned long) gl_st_trace.u32_index, (unsigned long) u32_stamp_wraps);
+
+    // dumped and decoded
+    TEST_CHECK_EQ(argc, 4);
+
+    if(4 == argc)
+    {
+        TEST_CHECK(TRUE == test_dump(argv[3]));
+        test_decode(argv[1], argv[2], argv[3]);
+    }
+    else
+    {
+        printf("usage: %s python trace_decode.py dump.bin\n", argv[0]);
+    }
+
+    return test_result("test_trace_wrap");
+}
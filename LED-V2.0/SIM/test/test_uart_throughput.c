@@ -0,0 +1,179 @@
+/**
+ * @file    :   test_uart_throughput.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Host test: UART0 and its uDMA rings at 1 Mbaud, both directions at once
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Runs the UART driver at 1 Mbaud (16 MHz / 16, 10 us per 8N1 frame) on the register model.
+ * A scripted command stream arrives on U0RX back to back while an answer stream is written
+ * out, the test loop stands in for the main loop: every TEST_POLL_NS it takes what was
+ * received and writes the answer bytes of one poll's line time, the TX ring stays half full.
+ * Checks:
+ *  - both streams arrive whole and in order, nothing dropped on TX nor lost or overrun on RX,
+ *  - TX: every byte leaves one frame after the previous one, across ring wraps and uDMA
+ *    chunks, 100000 bytes/s,
+ *  - RX: the stream is taken at line rate, the last byte within one poll of its stop bit.
+ */
+
+#include "sim_interface.h"
+#include "test_interface.h"
+#include "uart_interface.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define TEST_BAUD                   1000000UL
+#define TEST_FRAME_NS               10000ULL    /* start, 8 data, stop bits */
+#define TEST_STREAM_BYTES           8192
+#define TEST_POLL_NS                200000ULL   /* 20 frames, well inside both rings */
+#define TEST_FEED_BYTES             256         /* queued on U0RX at once */
+#define TEST_POLL_BYTES             (TEST_POLL_NS / TEST_FRAME_NS)      /* line time of a poll */
+#define TEST_PRIME_BYTES            (UART_TX_BUFFER_SIZE / 2)           /* TX ring fill kept */
+#define TEST_END_NS                 ((2 * TEST_STREAM_BYTES * TEST_FRAME_NS) + TEST_POLL_NS)
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+static const char * const gl_arr_str_test_commands[] = { "color red\r", "btn\r", "color off\r\n", "stats\r" };
+static const char * const gl_arr_str_test_answers[] = {
+    "presses 12\r\nedges_suppressed 0\r\nevents_dropped 0\r\n> ",
+    "uptime_ms 81250\r\nwake_button 12\r\nwake_timeout 7\r\n> ",
+};
+
+static uint8_t_ gl_arr_u8_test_rx_script[TEST_STREAM_BYTES];
+static uint8_t_ gl_arr_u8_test_tx_script[TEST_STREAM_BYTES];
+static uint8_t_ gl_arr_u8_test_rx[TEST_STREAM_BYTES];
+static uint8_t_ gl_arr_u8_test_tx[TEST_STREAM_BYTES];
+
+static uint32_t_ gl_u32_test_tx_count = 0;
+static uint32_t_ gl_u32_test_tx_gaps = 0;      // consecutive bytes further apart than one frame
+static uint64_t_ gl_u64_test_tx_first_ns = 0;
+static uint64_t_ gl_u64_test_tx_last_ns = 0;
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   UART listener, keeps the sent bytes and checks their spacing
+ */
+static void test_uart_sent(uint8_t_ u8_byte)
+{
+    uint64_t_ u64_now_ns = sim_now_ns();
+
+    if(ZERO == gl_u32_test_tx_count)
+    {
+        gl_u64_test_tx_first_ns = u64_now_ns;
+    }
+    else
+    {
+        gl_u32_test_tx_gaps += ((u64_now_ns - gl_u64_test_tx_last_ns) != TEST_FRAME_NS) ? 1 : 0;
+    }
+
+    if(TEST_STREAM_BYTES > gl_u32_test_tx_count)
+    {
+        gl_arr_u8_test_tx[gl_u32_test_tx_count] = u8_byte;
+    }
+    gl_u32_test_tx_count++;
+    gl_u64_test_tx_last_ns = u64_now_ns;
+}
+
+/**
+ * @brief                       :   Fills a script by repeating its lines
+ */
+static void test_script(uint8_t_ * ptr_u8_script, const char * const * ptr_str_lines, uint8_t_ u8_lines)
+{
+    uint32_t_ u32_index = 0;
+    uint32_t_ u32_line = 0;
+    uint32_t_ u32_char = 0;
+
+    for(u32_index = 0; u32_index < TEST_STREAM_BYTES; u32_index++)
+    {
+        ptr_u8_script[u32_index] = (uint8_t_) ptr_str_lines[u32_line][u32_char++];
+
+        if('\0' == ptr_str_lines[u32_line][u32_char])
+        {
+            u32_line = (u32_line + 1) % u8_lines;
+            u32_char = 0;
+        }
+    }
+}
+
+/*---------------------------------------------------------/
+/- MAIN
+/---------------------------------------------------------*/
+int main(void)
+{
+    st_uart_cfg_t st_uart_cfg = { .u32_baud_rate = TEST_BAUD };
+    st_uart_stats_t st_uart_stats;
+    uint32_t_ u32_fed = 0;
+    uint32_t_ u32_written = 0;
+    uint32_t_ u32_read = 0;
+    uint64_t_ u64_rx_start_ns;
+    uint64_t_ u64_rx_end_ns = 0;
+    uint64_t_ u64_tx_ns;
+    uint64_t_ u64_rx_ns;
+    uint16_t_ u16_feed;
+    uint16_t_ u16_write;
+
+    test_script(gl_arr_u8_test_rx_script, gl_arr_str_test_commands, 4);
+    test_script(gl_arr_u8_test_tx_script, gl_arr_str_test_answers, 2);
+
+    sim_init();
+    sim_set_uart_listener(test_uart_sent);
+    TEST_CHECK(UART_OK == uart_init(&st_uart_cfg));
+
+    u64_rx_start_ns = sim_now_ns();
+
+    while(((u32_read < TEST_STREAM_BYTES) || (TRUE == uart_tx_busy())) && (sim_now_ns() < TEST_END_NS))
+    {
+        // the host keeps U0RX busy
+        u16_feed = (uint16_t_)(((TEST_STREAM_BYTES - u32_fed) < TEST_FEED_BYTES) ? (TEST_STREAM_BYTES - u32_fed) : TEST_FEED_BYTES);
+        if((ZERO != u16_feed) && (SIM_OK == sim_uart_receive(&gl_arr_u8_test_rx_script[u32_fed], u16_feed)))
+        {
+            u32_fed += u16_feed;
+        }
+
+        // main loop pass
+        u32_read += uart_read(&gl_arr_u8_test_rx[u32_read], (uint16_t_)(TEST_STREAM_BYTES - u32_read));
+        u64_rx_end_ns = (TEST_STREAM_BYTES == u32_read) && (ZERO == u64_rx_end_ns) ? sim_now_ns() : u64_rx_end_ns;
+
+        // answers come as fast as they leave, the ring is kept half full
+        u16_write = (uint16_t_)((ZERO == u32_written) ? TEST_PRIME_BYTES : TEST_POLL_BYTES);
+        u16_write = (uint16_t_)(((TEST_STREAM_BYTES - u32_written) < u16_write) ? (TEST_STREAM_BYTES - u32_written) : u16_write);
+        u32_written += uart_write(&gl_arr_u8_test_tx_script[u32_written], u16_write);
+
+        sim_run_for(TEST_POLL_NS);
+    }
+
+    TEST_CHECK(UART_OK == uart_get_stats(&st_uart_stats));
+
+    // whole and in order
+    TEST_CHECK_EQ(u32_read, TEST_STREAM_BYTES);
+    TEST_CHECK_EQ(gl_u32_test_tx_count, TEST_STREAM_BYTES);
+    TEST_CHECK(ZERO == memcmp(gl_arr_u8_test_rx, gl_arr_u8_test_rx_script, TEST_STREAM_BYTES));
+    TEST_CHECK(ZERO == memcmp(gl_arr_u8_test_tx, gl_arr_u8_test_tx_script, TEST_STREAM_BYTES));
+    TEST_CHECK_EQ(st_uart_stats.u32_tx_dropped, 0);
+    TEST_CHECK_EQ(st_uart_stats.u32_rx_overruns, 0);
+    TEST_CHECK_EQ(sim_uart_rx_lost(), 0);
+
+    // TX back to back at line rate
+    u64_tx_ns = gl_u64_test_tx_last_ns - gl_u64_test_tx_first_ns + TEST_FRAME_NS;
+    TEST_CHECK_EQ(gl_u32_test_tx_gaps, 0);
+    TEST_CHECK_EQ(u64_tx_ns, TEST_STREAM_BYTES * TEST_FRAME_NS);
+
+    // RX taken at line rate
+    u64_rx_ns = u64_rx_end_ns - u64_rx_start_ns;
+    TEST_CHECK_RANGE(u64_rx_ns, TEST_STREAM_BYTES * TEST_FRAME_NS, (TEST_STREAM_BYTES * TEST_FRAME_NS) + TEST_POLL_NS);
+
+    printf("1 Mbaud, %d bytes each way: TX %llu bytes/s, %lu gaps; RX %llu bytes/s, %lu overruns, %lu lost\n",
+           TEST_STREAM_BYTES, (1000000000ULL * TEST_STREAM_BYTES) / u64_tx_ns, gl_u32_test_tx_gaps,
+           (1000000000ULL * TEST_STREAM_BYTES) / u64_rx_ns, st_uart_stats.u32_rx_overruns, sim_uart_rx_lost());
+
+    return test_result("test_uart_throughput");
+}
@@ -0,0 +1,252 @@
+/**
+ * @file    :   test_ws2812.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Host test: WS2812 strip data captured on SSI0 TX and decoded back to pixels
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Shows TEST_SHOWS frames of pseudo random pixels through ws2812_show, takes every 12 bit frame
+ * SSI0 sends through uDMA from the model and decodes it like a strip would, 3 SSI bits per strip
+ * bit (100: 0, 110: 1). Checks per shown frame:
+ *  - every symbol is a 0 or a 1, the decoded GRB pixels are the ones drawn,
+ *  - the latch: WS2812_RESET_FRAMES all zero frames, the line low for >= TEST_LATCH_MIN_NS,
+ *  - the SSI frames leave back to back (no gap at the uDMA chunk switches), T0H, T1H and the
+ *    strip bit time from the measured frame time,
+ *  - ws2812_show is refused while the previous frame streams.
+ * Prints the frame time measured for WS2812_PIXELS_MAX pixels and what it gives for N pixels.
+ */
+
+#include "sim_interface.h"
+#include "test_interface.h"
+#include "ws2812_interface.h"
+
+#include <stdio.h>
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define TEST_SSI_0                  0
+#define TEST_SHOWS                  4
+#define TEST_STEP_NS                10000ULL    /* polling step while a frame streams */
+#define TEST_START_NS               2000ULL     /* show to the first frame on the line */
+
+#define TEST_SSI_BITS               12          /* per SSI frame */
+#define TEST_SYMBOL_BITS            3           /* SSI bits per strip bit */
+#define TEST_SYMBOL_0               0x4         /* 100 */
+#define TEST_SYMBOL_1               0x6         /* 110 */
+#define TEST_PIXEL_BITS             24
+#define TEST_PIXEL_FRAMES           ((TEST_PIXEL_BITS * TEST_SYMBOL_BITS) / TEST_SSI_BITS)
+#define TEST_RESET_FRAMES           67          /* WS2812_RESET_FRAMES */
+#define TEST_FRAMES                 ((WS2812_PIXELS_MAX * TEST_PIXEL_FRAMES) + TEST_RESET_FRAMES)
+
+#define TEST_FRAME_NS               4500ULL     /* 12 bits at 16 MHz / (2 * (1 + 2)) */
+#define TEST_T0H_NS                 375ULL      /* WS2812: 400 +- 150 ns */
+#define TEST_T1H_NS                 750ULL      /* WS2812: 800 +- 150 ns */
+#define TEST_LATCH_MIN_NS           300000ULL   /* WS2812B reset, >= 280 us */
+#define TEST_DRAIN_NS               (8 * TEST_FRAME_NS)     /* TX FIFO depth, shifted after the uDMA stopped */
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+static uint16_t_ gl_arr_u16_test_frames[TEST_FRAMES];
+static uint64_t_ gl_arr_u64_test_frames_ns[TEST_FRAMES];
+static uint32_t_ gl_u32_test_frames = 0;
+
+/* strip lengths the frame time is printed for */
+static const uint16_t_ gl_arr_u16_test_lengths[] = { 1, 8, 30, 60, 150, WS2812_PIXELS_MAX };
+
+#define TEST_LENGTHS                (sizeof(gl_arr_u16_test_lengths) / sizeof(gl_arr_u16_test_lengths[0]))
+
+/* pixels drawn, R G B */
+static uint8_t_ gl_arr_u8_test_pixels[WS2812_PIXELS_MAX][3];
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   SSI listener, records the frames of SSI0 and the time each one ended
+ */
+static void test_ssi_frame(uint8_t_ u8_module, uint16_t_ u16_frame)
+{
+    if(TEST_SSI_0 == u8_module)
+    {
+        if(TEST_FRAMES > gl_u32_test_frames)
+        {
+            gl_arr_u16_test_frames[gl_u32_test_frames] = u16_frame;
+            gl_arr_u64_test_frames_ns[gl_u32_test_frames] = sim_now_ns();
+        }
+        gl_u32_test_frames++;
+    }
+}
+
+/**
+ * @brief                       :   Decodes the strip bits of the captured pixel frames
+ *
+ * @param[in]   u16_pixel       :   Pixel
+ * @param[out]  ptr_u32_grb     :   Pointer to store the 24 GRB bits in, MSB first on the wire
+ *
+ * @return  symbols that are neither a 0 nor a 1
+ */
+static uint32_t_ test_decode_pixel(uint16_t_ u16_pixel, uint32_t_ * ptr_u32_grb)
+{
+    uint32_t_ u32_bad = 0;
+    uint32_t_ u32_grb = 0;
+    uint16_t_ u16_frame;
+    uint8_t_ u8_frame;
+    uint8_t_ u8_symbol;
+    sint8_t_ s8_shift;
+
+    for(u8_frame = 0; u8_frame < TEST_PIXEL_FRAMES; u8_frame++)
+    {
+        u16_frame = gl_arr_u16_test_frames[(u16_pixel * TEST_PIXEL_FRAMES) + u8_frame];
+
+        // MSB first: 4 symbols per frame
+        for(s8_shift = TEST_SSI_BITS - TEST_SYMBOL_BITS; s8_shift >= 0; s8_shift -= TEST_SYMBOL_BITS)
+        {
+            u8_symbol = (u16_frame >> s8_shift) & 0x7;
+            u32_grb = (u32_grb << 1) | ((TEST_SYMBOL_1 == u8_symbol) ? 1 : 0);
+            u32_bad += ((TEST_SYMBOL_0 != u8_symbol) && (TEST_SYMBOL_1 != u8_symbol)) ? 1 : 0;
+        }
+    }
+
+    *ptr_u32_grb = u32_grb;
+
+    return u32_bad;
+}
+
+/**
+ * @brief                       :   Draws a frame of pseudo random pixels, the seed picks the frame
+ */
+static void test_draw(uint32_t_ u32_seed)
+{
+    uint16_t_ u16_pixel;
+    uint8_t_ u8_color;
+
+    for(u16_pixel = 0; u16_pixel < WS2812_PIXELS_MAX; u16_pixel++)
+    {
+        for(u8_color = 0; u8_color < 3; u8_color++)
+        {
+            // LCG
+            u32_seed = (u32_seed * 1103515245UL) + 12345UL;
+            gl_arr_u8_test_pixels[u16_pixel][u8_color] = (uint8_t_) (u32_seed >> 16);
+        }
+
+        TEST_CHECK(WS2812_OK == ws2812_set_pixel(u16_pixel, gl_arr_u8_test_pixels[u16_pixel][0],
+                                                 gl_arr_u8_test_pixels[u16_pixel][1],
+                                                 gl_arr_u8_test_pixels[u16_pixel][2]));
+    }
+}
+
+/**
+ * @brief                       :   Checks the captured frames against the drawn pixels
+ */
+static void test_check_stream(void)
+{
+    uint32_t_ u32_grb;
+    uint32_t_ u32_frame;
+    uint32_t_ u32_bad = 0;
+    uint32_t_ u32_wrong = 0;
+    uint32_t_ u32_gaps = 0;
+    uint16_t_ u16_pixel;
+
+    TEST_CHECK_EQ(gl_u32_test_frames, TEST_FRAMES);
+
+    for(u16_pixel = 0; (u16_pixel < WS2812_PIXELS_MAX) && (TEST_FRAMES == gl_u32_test_frames); u16_pixel++)
+    {
+        u32_bad += test_decode_pixel(u16_pixel, &u32_grb);
+        u32_wrong += (u32_grb != (((uint32_t_) gl_arr_u8_test_pixels[u16_pixel][1] << 16) |
+                                  ((uint32_t_) gl_arr_u8_test_pixels[u16_pixel][0] << 8) |
+                                  gl_arr_u8_test_pixels[u16_pixel][2])) ? 1 : 0;
+    }
+    TEST_CHECK_EQ(u32_bad, 0);
+    TEST_CHECK_EQ(u32_wrong, 0);
+
+    // latch: the line stays low
+    for(u32_frame = WS2812_PIXELS_MAX * TEST_PIXEL_FRAMES; u32_frame < gl_u32_test_frames; u32_frame++)
+    {
+        u32_bad += (ZERO != gl_arr_u16_test_frames[u32_frame]) ? 1 : 0;
+    }
+    TEST_CHECK_EQ(u32_bad, 0);
+    if(TEST_FRAMES == gl_u32_test_frames)
+    {
+        TEST_CHECK(TEST_LATCH_MIN_NS <= (gl_arr_u64_test_frames_ns[TEST_FRAMES - 1] -
+                                         gl_arr_u64_test_frames_ns[(WS2812_PIXELS_MAX * TEST_PIXEL_FRAMES) - 1]));
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    // back to back, across the uDMA chunks
+    for(u32_frame = 1; (u32_frame < gl_u32_test_frames) && (u32_frame < TEST_FRAMES); u32_frame++)
+    {
+        u32_gaps += ((gl_arr_u64_test_frames_ns[u32_frame] - gl_arr_u64_test_frames_ns[u32_frame - 1]) != TEST_FRAME_NS) ? 1 : 0;
+    }
+    TEST_CHECK_EQ(u32_gaps, 0);
+}
+
+/*---------------------------------------------------------/
+/- MAIN
+/---------------------------------------------------------*/
+int main(void)
+{
+    uint64_t_ u64_show_ns;
+    uint64_t_ u64_frame_ns = 0;
+    uint64_t_ u64_bit_ns;
+    uint8_t_ u8_show;
+    uint64_t_ u64_length_ns;
+    uint8_t_ u8_length;
+
+    sim_init();
+    sim_set_ssi_listener(test_ssi_frame);
+
+    TEST_CHECK(WS2812_ERROR == ws2812_show());
+    TEST_CHECK(WS2812_OK == ws2812_init());
+    TEST_CHECK(WS2812_ERROR == ws2812_set_pixel(WS2812_PIXELS_MAX, 0, 0, 0));
+
+    for(u8_show = 0; u8_show < TEST_SHOWS; u8_show++)
+    {
+        test_draw(u8_show + 1);
+
+        gl_u32_test_frames = 0;
+        u64_show_ns = sim_now_ns();
+        TEST_CHECK(WS2812_OK == ws2812_show());
+        TEST_CHECK(WS2812_BUSY == ws2812_show());
+
+        while(TRUE == ws2812_is_busy())
+        {
+            sim_run_for(TEST_STEP_NS);
+        }
+
+        // the uDMA stops with the last frames still to shift out
+        sim_run_for(TEST_DRAIN_NS);
+
+        test_check_stream();
+
+        // the first frame leaves on the show, the last one ends the latch
+        TEST_CHECK_RANGE(gl_arr_u64_test_frames_ns[0] - u64_show_ns, TEST_FRAME_NS, TEST_FRAME_NS + TEST_START_NS);
+        u64_frame_ns = gl_arr_u64_test_frames_ns[TEST_FRAMES - 1] - gl_arr_u64_test_frames_ns[0] + TEST_FRAME_NS;
+        TEST_CHECK_EQ(u64_frame_ns, TEST_FRAMES * TEST_FRAME_NS);
+    }
+
+    // SSI bit: a third of a strip bit
+    u64_bit_ns = TEST_FRAME_NS / TEST_SSI_BITS;
+    TEST_CHECK_EQ(u64_bit_ns, TEST_T0H_NS);
+    TEST_CHECK_EQ(2 * u64_bit_ns, TEST_T1H_NS);
+    printf("strip bit %llu ns (T0H %llu ns, T1H %llu ns), latch %llu us\n", TEST_SYMBOL_BITS * u64_bit_ns,
+           u64_bit_ns, 2 * u64_bit_ns, (TEST_RESET_FRAMES * TEST_FRAME_NS) / 1000);
+    printf("%d pixels: %llu us per frame, %.1f frames/s\n", WS2812_PIXELS_MAX, u64_frame_ns / 1000,
+           1e9 / (double) u64_frame_ns);
+
+    // the strip length only changes the pixel part, the latch stays
+    for(u8_length = 0; u8_length < TEST_LENGTHS; u8_length++)
+    {
+        u64_length_ns = u64_frame_ns - ((WS2812_PIXELS_MAX - gl_arr_u16_test_lengths[u8_length]) * TEST_PIXEL_FRAMES * TEST_FRAME_NS);
+        printf("  %3u pixels: %5llu us, %6.1f frames/s\n", gl_arr_u16_test_lengths[u8_length], u64_length_ns / 1000,
+               1e9 / (double) u64_length_ns);
+    }
+
+    return test_result("test_ws2812");
+}
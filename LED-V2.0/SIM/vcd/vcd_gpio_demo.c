@@ -0,0 +1,129 @@
+/**
+ * @file    :   vcd_gpio_demo.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Host program: scripted GPIO scenario dumped as a VCD waveform
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * usage : vcd_gpio_demo [out.vcd]
+ *
+ * Runs the unmodified gpio and led drivers on the register model:
+ *  - red LED (PF1): 1 kHz software PWM at 25 % duty for 5 ms, through led_write_port
+ *  - user button (PF4, pull up): a press at 6 ms bouncing for 0.3 ms, released at 9 ms,
+ *    every falling edge interrupt toggles the blue LED (PF2) without debouncing
+ * The dump shows the PWM edges and one blue toggle per bounce edge.
+ */
+
+#include "sim_interface.h"
+#include "vcd_interface.h"
+#include "gpio_interface.h"
+#include "led_interface.h"
+
+#include <stdio.h>
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define DEMO_US                     1000ULL     /* ns */
+#define DEMO_MS                     1000000ULL  /* ns */
+
+#define DEMO_PWM_PERIOD_NS          (1 * DEMO_MS)
+#define DEMO_PWM_ON_NS              (250 * DEMO_US)
+#define DEMO_PWM_PERIODS            5
+
+#define DEMO_PRESS_NS               (6 * DEMO_MS)
+#define DEMO_BOUNCE_NS              (50 * DEMO_US)
+#define DEMO_BOUNCES                3           /* extra low pulses after the first edge */
+#define DEMO_RELEASE_NS             (9 * DEMO_MS)
+#define DEMO_END_NS                 (10 * DEMO_MS)
+
+#define DEMO_PORT_F                 5
+#define DEMO_BTN_PIN                4
+#define DEMO_RED                    (1 << LED_PIN_1)
+#define DEMO_BLUE                   (1 << LED_PIN_2)
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Button falling edge interrupt callback, toggles the blue LED
+ */
+static void demo_btn_edge(void)
+{
+    gpio_togPinVal(GPIO_PORT_F, GPIO_PIN_2);
+}
+
+/**
+ * @brief                       :   Scripts the button: first contact, bounces, release
+ */
+static void demo_schedule_button(void)
+{
+    uint64_t_ u64_at = DEMO_PRESS_NS;
+    uint8_t_ u8_bounce;
+
+    sim_pin_schedule(u64_at, DEMO_PORT_F, DEMO_BTN_PIN, SIM_PIN_LOW);
+    for(u8_bounce = 0; u8_bounce < DEMO_BOUNCES; u8_bounce++)
+    {
+        sim_pin_schedule(u64_at + DEMO_BOUNCE_NS, DEMO_PORT_F, DEMO_BTN_PIN, SIM_PIN_RELEASE);
+        sim_pin_schedule(u64_at + (2 * DEMO_BOUNCE_NS), DEMO_PORT_F, DEMO_BTN_PIN, SIM_PIN_LOW);
+        u64_at += 2 * DEMO_BOUNCE_NS;
+    }
+    sim_pin_schedule(DEMO_RELEASE_NS, DEMO_PORT_F, DEMO_BTN_PIN, SIM_PIN_RELEASE);
+}
+
+/*---------------------------------------------------------/
+/- MAIN
+/---------------------------------------------------------*/
+int main(int argc, char * argv[])
+{
+    const char * ptr_str_path = (argc > 1) ? argv[1] : "gpio_demo.vcd";
+    st_gpio_cfg_t st_btn_cfg = {
+        .port = GPIO_PORT_F,
+        .pin = GPIO_PIN_4,
+        .current = PIN_CURRENT_2MA,
+        .pin_cfg = INPUT_PULL_UP
+    };
+    uint8_t_ u8_period;
+    int exit_code = 0;
+
+    sim_init();
+
+    if(VCD_OK != vcd_open(ptr_str_path))
+    {
+        fprintf(stderr, "can't create %s\n", ptr_str_path);
+        exit_code = 1;
+    }
+    else if(
+            (LED_OK != led_init(LED_PORT_F, LED_PIN_1))                                 ||
+            (LED_OK != led_init(LED_PORT_F, LED_PIN_2))                                 ||
+            (GPIO_OK != gpio_pin_init(&st_btn_cfg))                                     ||
+            (GPIO_OK != gpio_setIntSense(GPIO_PORT_F, GPIO_PIN_4, FALLING_EDGE))        ||
+            (GPIO_OK != gpio_setIntCallback(GPIO_PORT_F, GPIO_PIN_4, demo_btn_edge))    ||
+            (GPIO_OK != gpio_enableInt(GPIO_PORT_F, GPIO_PIN_4))
+            )
+    {
+        fprintf(stderr, "driver init failed\n");
+        exit_code = 1;
+    }
+    else
+    {
+        demo_schedule_button();
+
+        for(u8_period = 0; u8_period < DEMO_PWM_PERIODS; u8_period++)
+        {
+            led_write_port(LED_PORT_F, DEMO_RED, DEMO_RED);
+            sim_run_for(DEMO_PWM_ON_NS);
+            led_write_port(LED_PORT_F, DEMO_RED, 0);
+            sim_run_for(DEMO_PWM_PERIOD_NS - DEMO_PWM_ON_NS);
+        }
+
+        sim_run_for(DEMO_END_NS - sim_now_ns());
+        printf("%s: %llu ns simulated\n", ptr_str_path, sim_now_ns());
+    }
+
+    vcd_close();
+
+    return exit_code;
+}
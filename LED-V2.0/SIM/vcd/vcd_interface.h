@@ -0,0 +1,50 @@
+/**
+ * @file    :   vcd_interface.h
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Header File contains all VCD waveform export typedefs and functions' prototypes
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Writes the simulated pins as a Value Change Dump (IEEE 1364) for GTKWave: one wire per pin
+ * (PA0 -> PF7, 'z' while floating) and an 8-bit direction vector per port (DIR_PA -> DIR_PF),
+ * time stamps in ns of the virtual clock. Every port state change reported by SIM/sim is
+ * dumped at the time it happened.
+ */
+
+#ifndef VCD_INTERFACE_H_
+#define VCD_INTERFACE_H_
+
+#include "std.h"
+
+/*----------------------------------------------------------/
+/- ENUMS
+/----------------------------------------------------------*/
+typedef enum
+{
+    VCD_OK                  = 0 ,
+    VCD_ERROR                   ,
+}en_vcd_error_t_;
+
+/*---------------------------------------------------------/
+/- FUNCTION PROTOTYPES
+/---------------------------------------------------------*/
+
+/**
+ * @brief                       :   Creates the dump, writes the header and the current pin states,
+ *                                  then follows the simulated ports
+ *
+ * @param[in]   ptr_str_path    :   Output file path
+ *
+ * @return  VCD_OK              :   In case of Successful Operation
+ *          VCD_ERROR           :   File can't be created or a dump is already open
+ */
+en_vcd_error_t_ vcd_open(const char * ptr_str_path);
+
+/**
+ * @brief                       :   Ends the dump at the current virtual time and closes the file
+ */
+void vcd_close(void);
+
+#endif /* VCD_INTERFACE_H_ */
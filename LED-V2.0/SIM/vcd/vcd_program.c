@@ -0,0 +1,172 @@
+/**
+ * @file    :   vcd_program.c
+ * @author  :   Team 1 - Sub team A
+ * @brief   :   Program File contains all VCD waveform export functions' implementation
+ * @version :   0.1
+ * @date    :   2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include "vcd_interface.h"
+
+// private includes
+#include "sim_interface.h"
+
+#include <stdio.h>
+
+/*---------------------------------------------------------/
+/- LOCAL MACROS
+/---------------------------------------------------------*/
+#define VCD_ID_FIRST                '!'     /* identifiers: one printable character per signal */
+#define VCD_DIR_ID(PORT)            (VCD_ID_FIRST + (SIM_GPIO_PORTS * SIM_GPIO_PINS) + (PORT))
+#define VCD_PIN_ID(PORT, PIN)       (VCD_ID_FIRST + ((PORT) * SIM_GPIO_PINS) + (PIN))
+
+/*---------------------------------------------------------/
+/- PRIVATE VARIABLES
+/---------------------------------------------------------*/
+static FILE * gl_ptr_vcd_file = NULL_PTR;
+static st_sim_port_state_t_ gl_arr_st_vcd_dumped[SIM_GPIO_PORTS];   // states in the dump
+static uint64_t_ gl_u64_vcd_time_ns = 0;                            // last time stamp written
+
+/*---------------------------------------------------------/
+/- PRIVATE FUNCTIONS
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Writes the value of one pin
+ */
+static void vcd_write_pin(uint8_t_ u8_port, uint8_t_ u8_pin, const st_sim_port_state_t_ * ptr_st_state)
+{
+    char c_value = 'z';
+
+    if(ZERO != (ptr_st_state->u8_driven & (1 << u8_pin)))
+    {
+        c_value = (ZERO != (ptr_st_state->u8_levels & (1 << u8_pin))) ? '1' : '0';
+    }
+
+    fprintf(gl_ptr_vcd_file, "%c%c\n", c_value, VCD_PIN_ID(u8_port, u8_pin));
+}
+
+/**
+ * @brief                       :   Writes the direction vector of one port
+ */
+static void vcd_write_dir(uint8_t_ u8_port, uint8_t_ u8_dir)
+{
+    sint8_t_ s8_bit;
+
+    fputc('b', gl_ptr_vcd_file);
+    for(s8_bit = SIM_GPIO_PINS - 1; s8_bit >= 0; s8_bit--)
+    {
+        fputc((ZERO != (u8_dir & (1 << s8_bit))) ? '1' : '0', gl_ptr_vcd_file);
+    }
+    fprintf(gl_ptr_vcd_file, " %c\n", VCD_DIR_ID(u8_port));
+}
+
+/**
+ * @brief                       :   Port listener of SIM/sim, dumps the changed signals
+ */
+static void vcd_port_changed(uint8_t_ u8_port, const st_sim_port_state_t_ * ptr_st_state)
+{
+    st_sim_port_state_t_ * ptr_st_dumped = &gl_arr_st_vcd_dumped[u8_port];
+    uint8_t_ u8_changed = (uint8_t_)((ptr_st_state->u8_levels ^ ptr_st_dumped->u8_levels) |
+                                     (ptr_st_state->u8_driven ^ ptr_st_dumped->u8_driven));
+    uint8_t_ u8_pin;
+
+    if(gl_u64_vcd_time_ns != sim_now_ns())
+    {
+        gl_u64_vcd_time_ns = sim_now_ns();
+        fprintf(gl_ptr_vcd_file, "#%llu\n", gl_u64_vcd_time_ns);
+    }
+
+    for(u8_pin = 0; u8_pin < SIM_GPIO_PINS; u8_pin++)
+    {
+        if(ZERO != (u8_changed & (1 << u8_pin)))
+        {
+            vcd_write_pin(u8_port, u8_pin, ptr_st_state);
+        }
+    }
+
+    if(ptr_st_state->u8_dir != ptr_st_dumped->u8_dir)
+    {
+        vcd_write_dir(u8_port, ptr_st_state->u8_dir);
+    }
+
+    *ptr_st_dumped = *ptr_st_state;
+}
+
+/*---------------------------------------------------------/
+/- FUNCTION IMPLEMENTATION
+/---------------------------------------------------------*/
+/**
+ * @brief                       :   Creates the dump, writes the header and the current pin states,
+ *                                  then follows the simulated ports
+ *
+ * @param[in]   ptr_str_path    :   Output file path
+ *
+ * @return  VCD_OK              :   In case of Successful Operation
+ *          VCD_ERROR           :   File can't be created or a dump is already open
+ */
+en_vcd_error_t_ vcd_open(const char * ptr_str_path)
+{
+    en_vcd_error_t_ en_vcd_error_retval = VCD_OK;
+    uint8_t_ u8_port;
+    uint8_t_ u8_pin;
+
+    if((NULL_PTR != gl_ptr_vcd_file) || (NULL_PTR == ptr_str_path))
+    {
+        en_vcd_error_retval = VCD_ERROR;
+    }
+    else if(NULL_PTR == (gl_ptr_vcd_file = fopen(ptr_str_path, "w")))
+    {
+        en_vcd_error_retval = VCD_ERROR;
+    }
+    else
+    {
+        fprintf(gl_ptr_vcd_file, "$version LED-V2.0 host simulation $end\n$timescale 1ns $end\n$scope module tm4c123 $end\n");
+        for(u8_port = 0; u8_port < SIM_GPIO_PORTS; u8_port++)
+        {
+            for(u8_pin = 0; u8_pin < SIM_GPIO_PINS; u8_pin++)
+            {
+                fprintf(gl_ptr_vcd_file, "$var wire 1 %c P%c%d $end\n", VCD_PIN_ID(u8_port, u8_pin), 'A' + u8_port, u8_pin);
+            }
+            fprintf(gl_ptr_vcd_file, "$var wire %d %c DIR_P%c $end\n", SIM_GPIO_PINS, VCD_DIR_ID(u8_port), 'A' + u8_port);
+        }
+        fprintf(gl_ptr_vcd_file, "$upscope $end\n$enddefinitions $end\n");
+
+        gl_u64_vcd_time_ns = sim_now_ns();
+        fprintf(gl_ptr_vcd_file, "#%llu\n$dumpvars\n", gl_u64_vcd_time_ns);
+        for(u8_port = 0; u8_port < SIM_GPIO_PORTS; u8_port++)
+        {
+            sim_port_get_state(u8_port, &gl_arr_st_vcd_dumped[u8_port]);
+            for(u8_pin = 0; u8_pin < SIM_GPIO_PINS; u8_pin++)
+            {
+                vcd_write_pin(u8_port, u8_pin, &gl_arr_st_vcd_dumped[u8_port]);
+            }
+            vcd_write_dir(u8_port, gl_arr_st_vcd_dumped[u8_port].u8_dir);
+        }
+        fprintf(gl_ptr_vcd_file, "$end\n");
+
+        sim_add_port_listener(vcd_port_changed);
+    }
+
+    return en_vcd_error_retval;
+}
+
+/**
+ * @brief                       :   Ends the dump at the current virtual time and closes the file
+ */
+void vcd_close(void)
+{
+    if(NULL_PTR != gl_ptr_vcd_file)
+    {
+        // flushes pending driver writes into the dump first
+        sim_remove_port_listener(vcd_port_changed);
+
+        if(gl_u64_vcd_time_ns != sim_now_ns())
+        {
+            fprintf(gl_ptr_vcd_file, "#%llu\n", sim_now_ns());
+        }
+        fclose(gl_ptr_vcd_file);
+        gl_ptr_vcd_file = NULL_PTR;
+    }
+}
@@ -11,6 +11,8 @@
 #ifndef LED_H_
 #define LED_H_
 
+#include "std.h"
+
 /* LED Pins */
 typedef enum{
     LED_PIN_0	=	0	,
@@ -42,6 +44,21 @@ typedef enum
     LED_ERROR               ,
 }en_led_error_t_;
 
+/* LED States */
+typedef enum
+{
+    LED_STATE_OFF       = 0 ,
+    LED_STATE_ON            ,
+    LED_STATE_TOTAL
+}en_led_state_t_;
+
+/* Hardware write counters of the LED state cache */
+typedef struct
+{
+    uint32_t_ u32_writes_issued ; /* Port writes that reached the GPIO */
+    uint32_t_ u32_writes_elided ; /* Requests skipped as the pins already had the requested state */
+}st_led_stats_t_;
+
 /**
  * @brief                       :   Initializes LED on given port & pin
  *
@@ -87,4 +104,56 @@ en_led_error_t_ led_off(en_led_port_t_ en_led_port, en_led_pin_t_ en_led_pin);
  */
 en_led_error_t_ led_toggle(en_led_port_t_ en_led_port, en_led_pin_t_ en_led_pin); // toggle LED
 
+/**
+ * @brief                       :   Sets the state of an LED in the state cache without touching the hardware,
+ *                                  pending changes are written by led_commit
+ *
+ * @param[in]   en_led_port    :   LED Port
+ * @param[in]   en_led_pin     :   LED Pin number in en_led_port
+ * @param[in]   en_led_state   :   Requested LED state
+ *
+ * @return  LED_OK              :   In case of Successful Operation
+ *          LED_ERROR           :   In case of Failed Operation
+ */
+en_led_error_t_ led_stage(en_led_port_t_ en_led_port, en_led_pin_t_ en_led_pin, en_led_state_t_ en_led_state);
+
+/**
+ * @brief                       :   Writes all pending LED changes of a port in one port write,
+ *                                  nothing is written if no LED changed
+ *
+ * @param[in]   en_led_port    :   LED Port
+ *
+ * @return  LED_OK              :   In case of Successful Operation
+ *          LED_ERROR           :   In case of Failed Operation
+ */
+en_led_error_t_ led_commit(en_led_port_t_ en_led_port);
+
+/**
+ * @brief                       :   Sets the states of several LEDs of a port and writes the changed ones
+ *                                  in one port write
+ *
+ * @param[in]   en_led_port    :   LED Port
+ * @param[in]   u8_mask        :   LED pins to set (all must be initialized LEDs)
+ * @param[in]   u8_levels      :   Pin levels (bit set -> LED on) of the masked pins
+ *
+ * @return  LED_OK              :   In case of Successful Operation
+ *          LED_ERROR           :   In case of Failed Operation
+ */
+en_led_error_t_ led_write_port(en_led_port_t_ en_led_port, uint8_t_ u8_mask, uint8_t_ u8_levels);
+
+/**
+ * @brief                       :   Reads the issued/elided hardware write counters
+ *
+ * @param[out]  ptr_st_led_stats   :   Pointer to store the counters in
+ *
+ * @return  LED_OK              :   In case of Successful Operation
+ *          LED_ERROR           :   In case of NULL pointer
+ */
+en_led_error_t_ led_get_stats(st_led_stats_t_ * ptr_st_led_stats);
+
+/**
+ * @brief                       :   Resets the issued/elided hardware write counters
+ */
+void led_reset_stats(void);
+
 #endif /* LED_H_ */
\ No newline at end of file
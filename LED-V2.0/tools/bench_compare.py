@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+"""
+bench_compare.py - flags benchmarks that got more expensive than a reference report
+
+Input : two JSON reports of the same benchmark program, the reference (baseline) and the
+        current one, as written by SIM api_bench (accesses_per_call, sim_ns_per_call)
+Output: one line per benchmark and metric that changed, the regressions marked, and a summary;
+        exit status 1 when a cost grew by more than the threshold
+
+usage : bench_compare.py baseline.json current.json [--threshold PERCENT] [--update]
+
+--update copies the current report over the baseline once the change is intended.
+Benchmarks only in one report are listed, they are not regressions.
+"""
+
+import argparse
+import json
+import shutil
+import sys
+
+METRICS = ['accesses_per_call', 'sim_ns_per_call']
+
+
+def read_report(path):
+    """Maps benchmark name -> result."""
+    with open(path) as f:
+        report = json.load(f)
+    return {result['name']: result for result in report['results']}
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compare two benchmark reports')
+    parser.add_argument('baseline')
+    parser.add_argument('current')
+    parser.add_argument('--threshold', type=float, default=5.0,
+                        help='percent growth flagged as a regression (default 5)')
+    parser.add_argument('--update', action='store_true',
+                        help='replace the baseline with the current report')
+    args = parser.parse_args()
+
+    baseline = read_report(args.baseline)
+    current = read_report(args.current)
+
+    regressions = 0
+    for name in current:
+        if name not in baseline:
+            print('  new      %s' % name)
+            continue
+        for metric in METRICS:
+            if metric not in current[name] or metric not in baseline[name]:
+                continue
+            old, new = baseline[name][metric], current[name][metric]
+            if old == new:
+                continue
+            # a cost appearing from nothing is always a regression
+            growth = (new - old) * 100.0 / old if old else float('inf')
+            flagged = growth > args.threshold
+            regressions += flagged
+            print('%s %-34s %-18s %12.2f -> %12.2f  %+8.1f%%'
+                  % ('! REGRESS' if flagged else '  changed', name, metric, old, new, growth))
+    for name in baseline:
+        if name not in current:
+            print('  missing  %s' % name)
+
+    print('# %d regression(s) above %.1f%%, %d benchmarks compared'
+          % (regressions, args.threshold, len(set(baseline) & set(current))))
+
+    if args.update:
+        shutil.copyfile(args.current, args.baseline)
+        print('# %s updated' % args.baseline)
+
+    sys.exit(1 if regressions and not args.update else 0)
+
+
+if __name__ == '__main__':
+    main()
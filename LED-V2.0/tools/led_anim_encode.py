@@ -0,0 +1,197 @@
+#!/usr/bin/env python3
+"""
+led_anim_encode.py - encodes an LED animation for HAL/led_anim
+
+Input : text file, one frame per line, channel values 0 -> 255 separated by spaces or commas,
+        every frame has the same number of channels ('#' starts a comment)
+Output: C source with the compressed data and its st_led_anim_t_ descriptor
+
+usage : led_anim_encode.py frames.txt NAME FRAME_MS [-o out.c]
+
+The format is described in led_anim_interface.h. Frames are encoded greedily against the
+previous frame, the first frame is encoded in full so the animation can be replayed.
+Every encoding is decoded again and compared before it is written.
+"""
+
+import argparse
+import sys
+
+TOKEN_SKIP, TOKEN_RUN, TOKEN_LITERAL, TOKEN_DELTA = 0, 1, 2, 3
+TOKEN_MAX = 64
+DELTA_MIN, DELTA_MAX = -8, 7
+
+
+def signed_delta(base, value):
+    return ((value - base + 128) & 0xFF) - 128
+
+
+def token(kind, count):
+    return (kind << 6) | (count - 1)
+
+
+def skip_run(cur, prev, i):
+    n = 0
+    while prev is not None and i + n < len(cur) and n < TOKEN_MAX and cur[i + n] == prev[i + n]:
+        n += 1
+    return n
+
+
+def equal_run(cur, i):
+    n = 1
+    while i + n < len(cur) and n < TOKEN_MAX and cur[i + n] == cur[i]:
+        n += 1
+    return n
+
+
+def cheaper_start(cur, prev, j):
+    """a SKIP or RUN token starting at j beats extending a DELTA or LITERAL token over it"""
+    return skip_run(cur, prev, j) >= 2 or equal_run(cur, j) >= 3
+
+
+def delta_run(cur, prev, i, base):
+    n = 0
+    while i + n < len(cur) and n < TOKEN_MAX and DELTA_MIN <= signed_delta(base, cur[i + n]) <= DELTA_MAX:
+        if n and cheaper_start(cur, prev, i + n):
+            break
+        base = cur[i + n]
+        n += 1
+    return n
+
+
+def encode_frame(cur, prev):
+    out = []
+    i = 0
+    last = 0    # previous value written in this frame, DELTA base
+    while i < len(cur):
+        skip = skip_run(cur, prev, i)
+        if skip:
+            out.append(token(TOKEN_SKIP, skip))
+            i += skip
+            continue
+        run = equal_run(cur, i)
+        if run >= 2:
+            out += [token(TOKEN_RUN, run), cur[i]]
+            last = cur[i]
+            i += run
+            continue
+        delta = delta_run(cur, prev, i, last)
+        if delta >= 3:
+            packed = [0] * ((delta + 1) // 2)
+            for k in range(delta):
+                packed[k // 2] |= (signed_delta(last, cur[i + k]) & 0x0F) << (4 * (k & 1))
+                last = cur[i + k]
+            out += [token(TOKEN_DELTA, delta)] + packed
+            i += delta
+            continue
+        # literal until a cheaper token can start
+        n = 1
+        while i + n < len(cur) and n < TOKEN_MAX:
+            j = i + n
+            if cheaper_start(cur, prev, j) or delta_run(cur, prev, j, cur[j - 1]) >= 4:
+                break
+            n += 1
+        out += [token(TOKEN_LITERAL, n)] + cur[i:i + n]
+        last = cur[i + n - 1]
+        i += n
+    return out
+
+
+def decode(data, channels, frames):
+    """Reference decoder, mirrors led_anim_next_frame()"""
+    shown = [None] * channels
+    offset = 0
+    result = []
+    for _ in range(frames):
+        channel, value = 0, 0
+        while channel < channels:
+            tok = data[offset]
+            kind, count = tok >> 6, (tok & 0x3F) + 1
+            offset += 1
+            if kind == TOKEN_SKIP:
+                pass
+            elif kind == TOKEN_RUN:
+                value = data[offset]
+                shown[channel:channel + count] = [value] * count
+                offset += 1
+            elif kind == TOKEN_LITERAL:
+                shown[channel:channel + count] = data[offset:offset + count]
+                value = data[offset + count - 1]
+                offset += count
+            else:
+                for k in range(count):
+                    nibble = (data[offset + k // 2] >> (4 * (k & 1))) & 0x0F
+                    value = (value + (nibble - 16 if nibble & 0x08 else nibble)) & 0xFF
+                    shown[channel + k] = value
+                offset += (count + 1) // 2
+            channel += count
+        result.append(list(shown))
+    return result
+
+
+def read_frames(path):
+    frames = []
+    with open(path) as f:
+        for line in f:
+            line = line.split('#')[0].replace(',', ' ').split()
+            if line:
+                frames.append([int(v) for v in line])
+    if not frames:
+        sys.exit('no frames in %s' % path)
+    for frame in frames:
+        if len(frame) != len(frames[0]) or any(v < 0 or v > 255 for v in frame):
+            sys.exit('frames must have %d channels of 0 -> 255' % len(frames[0]))
+    if len(frames[0]) > 0xFFFF or len(frames) > 0xFFFF:
+        sys.exit('too many channels or frames')
+    return frames
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Encode an LED animation for HAL/led_anim')
+    parser.add_argument('frames')
+    parser.add_argument('name')
+    parser.add_argument('frame_ms', type=int)
+    parser.add_argument('-o', '--output')
+    args = parser.parse_args()
+
+    frames = read_frames(args.frames)
+    channels = len(frames[0])
+    data = []
+    prev = None
+    for frame in frames:
+        data += encode_frame(frame, prev)
+        prev = frame
+
+    if decode(data, channels, len(frames)) != frames:
+        sys.exit('internal error: round trip mismatch')
+
+    raw = channels * len(frames)
+    sys.stderr.write('%s: %d frames x %d channels, %d -> %d bytes (ratio %.2f)\n'
+                     % (args.name, len(frames), channels, raw, len(data), raw / float(len(data))))
+
+    lines = ['/* generated by tools/led_anim_encode.py from %s, do not edit */' % args.frames,
+             '',
+             '#include "led_anim_interface.h"',
+             '',
+             'static const uint8_t_ gl_arr_u8_%s_data[%d] = {' % (args.name, len(data))]
+    for i in range(0, len(data), 16):
+        lines.append('    ' + ', '.join('0x%02X' % b for b in data[i:i + 16]) + ',')
+    lines += ['};',
+              '',
+              'const st_led_anim_t_ gl_st_%s = {' % args.name,
+              '    .ptr_u8_data    = gl_arr_u8_%s_data,' % args.name,
+              '    .u32_size       = %d,' % len(data),
+              '    .u16_channels   = %d,' % channels,
+              '    .u16_frames     = %d,' % len(frames),
+              '    .u16_frame_ms   = %d' % args.frame_ms,
+              '};',
+              '']
+
+    if args.output:
+        with open(args.output, 'w') as f:
+            f.write('\n'.join(lines))
+    else:
+        sys.stdout.write('\n'.join(lines))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+"""
+trace_decode.py - turns a RAM dump of MCAL/trace's ring into a timeline
+
+Input : RAM dump holding gl_st_trace, either raw binary (gdb: dump binary memory ...) or
+        Intel HEX (Keil: SAVE dump.hex 0x20000000,0x20007FFF)
+Output: one line per record, oldest first: time since the first record, time since the
+        previous record, event name and arguments
+
+usage : trace_decode.py dump.bin [--clock-hz HZ] [--header ../MCAL/trace/trace_interface.h]
+
+The buffer is located by TRACE_MAGIC, the layout is described in trace_interface.h.
+Event names and argument descriptions are read from the en_trace_event_t enum of the header
+so new events decode without touching this script.
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+TRACE_MAGIC = 0x31435254
+HEADER_FORMAT = '<IIII'                 # magic, records, clock_hz, index
+RECORD_FORMAT = '<II'                   # stamp, data
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)
+RECORD_SIZE = struct.calcsize(RECORD_FORMAT)
+STAMP_MODULO = 1 << 32
+DEFAULT_HEADER = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                              '..', 'MCAL', 'trace', 'trace_interface.h')
+
+
+def read_events(header_path):
+    """Maps event number -> (name, argument comment) from en_trace_event_t."""
+    with open(header_path) as f:
+        text = f.read()
+    body = re.search(r'typedef enum\s*\{(.*?)\}\s*en_trace_event_t', text, re.S)
+    if body is None:
+        sys.exit('%s: en_trace_event_t not found' % header_path)
+    events = {}
+    number = 0
+    for line in body.group(1).splitlines():
+        m = re.match(r'\s*TRACE_EV_(\w+)\s*(?:=\s*(\d+))?\s*,?\s*(?:/\*\s*(.*?)\s*\*/)?', line)
+        if m is None or m.group(1) == 'TOTAL':
+            continue
+        if m.group(2) is not None:
+            number = int(m.group(2))
+        events[number] = (m.group(1), m.group(3) or '')
+        number += 1
+    return events
+
+
+def read_hex(text):
+    """Intel HEX -> bytes from the lowest address, gaps filled with 0."""
+    chunks = {}
+    base = 0
+    for line in text.splitlines():
+        line = line.strip()
+        if not line.startswith(':'):
+            continue
+        raw = bytes.fromhex(line[1:])
+        count, address, kind = raw[0], (raw[1] << 8) | raw[2], raw[3]
+        data = raw[4:4 + count]
+        if kind == 0:
+            chunks[base + address] = data
+        elif kind == 1:
+            break
+        elif kind == 2:
+            base = ((data[0] << 8) | data[1]) << 4
+        elif kind == 4:
+            base = ((data[0] << 8) | data[1]) << 16
+    if not chunks:
+        return b''
+    start = min(chunks)
+    end = max(a + len(d) for a, d in chunks.items())
+    image = bytearray(end - start)
+    for address, data in chunks.items():
+        image[address - start:address - start + len(data)] = data
+    return bytes(image)
+
+
+def read_dump(path):
+    with open(path, 'rb') as f:
+        raw = f.read()
+    if raw[:1] == b':':
+        return read_hex(raw.decode('ascii', 'replace'))
+    return raw
+
+
+def find_buffer(image):
+    """Offset of the trace header: magic followed by a power of 2 record count that fits."""
+    magic = struct.pack('<I', TRACE_MAGIC)
+    offset = image.find(magic)
+    while offset >= 0:
+        if offset % 4 == 0 and offset + HEADER_SIZE <= len(image):
+            _, records, _, _ = struct.unpack_from(HEADER_FORMAT, image, offset)
+            if (records and records & (records - 1) == 0 and
+                    offset + HEADER_SIZE + records * RECORD_SIZE <= len(image)):
+                return offset
+        offset = image.find(magic, offset + 1)
+    return -1
+
+
+def decode(image, offset):
+    """Records in write order as (index, stamp, event, arg0, arg1), plus the header."""
+    _, records, clock_hz, index = struct.unpack_from(HEADER_FORMAT, image, offset)
+    count = min(index, records)
+    out = []
+    for n in range(index - count, index):
+        stamp, data = struct.unpack_from(RECORD_FORMAT, image,
+                                         offset + HEADER_SIZE + (n % records) * RECORD_SIZE)
+        out.append((n, stamp, data & 0xFF, (data >> 8) & 0xFF, data >> 16))
+    return out, records, clock_hz, index
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode an MCAL/trace RAM dump')
+    parser.add_argument('dump')
+    parser.add_argument('--clock-hz', type=int, default=0,
+                        help='core clock of the stamps (default: recorded by trace_init)')
+    parser.add_argument('--header', default=DEFAULT_HEADER)
+    args = parser.parse_args()
+
+    events = read_events(args.header)
+    image = read_dump(args.dump)
+    offset = find_buffer(image)
+    if offset < 0:
+        sys.exit('%s: no trace buffer found' % args.dump)
+
+    records, ring_size, clock_hz, index = decode(image, offset)
+    clock_hz = args.clock_hz or clock_hz
+    if not clock_hz:
+        sys.exit('clock unknown (trace_init not run), pass --clock-hz')
+
+    lost = index - len(records)
+    print('# %d records written, %d shown, %d overwritten, %d slots, %d Hz'
+          % (index, len(records), lost, ring_size, clock_hz))
+    print('# %12s %12s  %-14s %s' % ('t_us', 'dt_us', 'event', 'arguments'))
+
+    elapsed = 0
+    previous = None
+    for n, stamp, event, arg0, arg1 in records:
+        # stamps wrap every 2^32 cycles, consecutive records are assumed closer than that
+        delta = 0 if previous is None else (stamp - previous) % STAMP_MODULO
+        elapsed += delta
+        previous = stamp
+        name, described = events.get(event, ('EVENT_%d' % event, ''))
+        print('%14.2f %12.2f  %-14s arg0=%-3d arg1=0x%04X  %s'
+              % (elapsed * 1e6 / clock_hz, delta * 1e6 / clock_hz, name, arg0, arg1, described))
+
+
+if __name__ == '__main__':
+    main()